@@ -122,6 +122,17 @@ bool MpiWrapper::initialized()
 #endif
 }
 
+bool MpiWrapper::finalized()
+{
+#ifdef GEOS_USE_MPI
+  int ret = false;
+  MPI_CHECK_ERROR( MPI_Finalized( &ret ) );
+  return ret;
+#else
+  return false;
+#endif
+}
+
 int MpiWrapper::init( int * argc, char * * * argv )
 {
 #ifdef GEOS_USE_MPI
@@ -161,6 +172,17 @@ MPI_Comm MpiWrapper::commSplit( MPI_Comm const comm, int color, int key )
 #endif
 }
 
+MPI_Comm MpiWrapper::commSplitShared( MPI_Comm const comm )
+{
+#ifdef GEOS_USE_MPI
+  MPI_Comm scomm;
+  MPI_CHECK_ERROR( MPI_Comm_split_type( comm, MPI_COMM_TYPE_SHARED, commRank( comm ), MPI_INFO_NULL, &scomm ) );
+  return scomm;
+#else
+  return comm;
+#endif
+}
+
 int MpiWrapper::test( MPI_Request * request, int * flag, MPI_Status * status )
 {
 #ifdef GEOS_USE_MPI
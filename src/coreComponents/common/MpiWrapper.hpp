@@ -165,6 +165,8 @@ public:
 
   static bool initialized();
 
+  static bool finalized();
+
   static int init( int * argc, char * * * argv );
 
   static void finalize();
@@ -173,6 +175,13 @@ public:
 
   static MPI_Comm commSplit( MPI_Comm const comm, int color, int key );
 
+  /**
+   * @brief Split a communicator into groups of ranks that can share memory (ranks running on the same node)
+   * @param[in] comm the communicator to split
+   * @return the communicator of the ranks of @p comm sharing memory with the current rank
+   */
+  static MPI_Comm commSplitShared( MPI_Comm const comm = MPI_COMM_GEOS );
+
   static int test( MPI_Request * request, int * flag, MPI_Status * status );
 
   static int testAny( int count, MPI_Request array_of_requests[], int * idx, int * flags, MPI_Status array_of_statuses[] );
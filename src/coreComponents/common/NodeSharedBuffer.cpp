@@ -0,0 +1,106 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file NodeSharedBuffer.cpp
+ */
+
+#include "NodeSharedBuffer.hpp"
+
+namespace geos
+{
+
+NodeSharedBuffer::~NodeSharedBuffer()
+{
+#ifdef GEOS_USE_MPI
+  // the window and the communicator cannot be freed anymore once MPI is finalized
+  if( MpiWrapper::initialized() && !MpiWrapper::finalized() )
+  {
+    free();
+    if( m_nodeComm != MPI_COMM_NULL )
+    {
+      MpiWrapper::commFree( m_nodeComm );
+    }
+  }
+#endif
+}
+
+void NodeSharedBuffer::joinNode()
+{
+#ifdef GEOS_USE_MPI
+  if( m_nodeComm == MPI_COMM_NULL && MpiWrapper::initialized() )
+  {
+    m_nodeComm = MpiWrapper::commSplitShared();
+    m_nodeRank = MpiWrapper::commRank( m_nodeComm );
+    m_numNodeRanks = MpiWrapper::commSize( m_nodeComm );
+  }
+#endif
+}
+
+void NodeSharedBuffer::allocate( std::size_t const numBytes )
+{
+  free();
+  joinNode();
+  m_numBytes = numBytes;
+
+#ifdef GEOS_USE_MPI
+  // a rank alone on its node keeps a rank-local allocation
+  if( m_numNodeRanks > 1 )
+  {
+    // the whole buffer is allocated by the node leader, the other ranks query its address
+    MPI_Aint const localSize = m_nodeRank == 0 ? static_cast< MPI_Aint >( numBytes ) : 0;
+    void * localData = nullptr;
+    MPI_CHECK_ERROR( MPI_Win_allocate_shared( localSize, 1, MPI_INFO_NULL, m_nodeComm, &localData, &m_window ) );
+    m_allocatedBytes = static_cast< std::size_t >( localSize );
+
+    MPI_Aint leaderSize;
+    int dispUnit;
+    MPI_CHECK_ERROR( MPI_Win_shared_query( m_window, 0, &leaderSize, &dispUnit, &m_data ) );
+    MPI_CHECK_ERROR( MPI_Win_fence( 0, m_window ) );
+    return;
+  }
+#endif
+
+  m_localData.resize( numBytes );
+  m_data = m_localData.data();
+  m_allocatedBytes = numBytes;
+}
+
+void NodeSharedBuffer::free()
+{
+#ifdef GEOS_USE_MPI
+  if( m_window != MPI_WIN_NULL )
+  {
+    MPI_CHECK_ERROR( MPI_Win_free( &m_window ) );
+  }
+#endif
+  m_localData.clear();
+  m_localData.shrink_to_fit();
+  m_data = nullptr;
+  m_numBytes = 0;
+  m_allocatedBytes = 0;
+}
+
+void NodeSharedBuffer::sync() const
+{
+#ifdef GEOS_USE_MPI
+  if( m_window != MPI_WIN_NULL )
+  {
+    MPI_CHECK_ERROR( MPI_Win_fence( 0, m_window ) );
+  }
+#endif
+}
+
+} // namespace geos
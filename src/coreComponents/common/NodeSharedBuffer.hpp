@@ -0,0 +1,173 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file NodeSharedBuffer.hpp
+ */
+
+#ifndef GEOS_COMMON_NODESHAREDBUFFER_HPP_
+#define GEOS_COMMON_NODESHAREDBUFFER_HPP_
+
+#include "common/MpiWrapper.hpp"
+
+#include <vector>
+
+namespace geos
+{
+
+/**
+ * @class NodeSharedBuffer
+ * @brief Read-only data stored once per compute node and mapped into the memory of all the ranks of the node.
+ *
+ * The buffer is allocated through an MPI-3 shared memory window over the ranks of MPI_COMM_GEOS running on
+ * the same node. It is filled by the node leader (see isNodeLeader), then read by all the ranks of the node
+ * after a call to sync. Without MPI, or when the rank is alone on its node, the buffer is a plain rank-local
+ * allocation.
+ *
+ * The memory is host memory: it is meant to be read by host kernels only.
+ */
+class NodeSharedBuffer
+{
+public:
+
+  /// Default constructor, no memory is allocated
+  NodeSharedBuffer() = default;
+
+  /// Destructor, releasing the memory
+  ~NodeSharedBuffer();
+
+  /// Deleted copy constructor
+  NodeSharedBuffer( NodeSharedBuffer const & ) = delete;
+
+  /// Deleted copy assignment operator
+  NodeSharedBuffer & operator=( NodeSharedBuffer const & ) = delete;
+
+  /**
+   * @brief Find the ranks sharing the node of the current rank, if not done yet
+   * @note Collective over MPI_COMM_GEOS. It is called by allocate, and can be called before to know whether
+   *       the current rank is the node leader, for instance to let only the node leader read the data.
+   */
+  void joinNode();
+
+  /**
+   * @brief Allocate the buffer, releasing the previous allocation if any
+   * @param[in] numBytes the size of the buffer in bytes
+   * @note Collective over MPI_COMM_GEOS
+   */
+  void allocate( std::size_t const numBytes );
+
+  /**
+   * @brief Release the memory of the buffer
+   * @note Collective over MPI_COMM_GEOS
+   */
+  void free();
+
+  /**
+   * @brief Make the data written by the node leader visible to all the ranks of the node
+   * @note Collective over MPI_COMM_GEOS, must be called between the writes and the reads of the buffer
+   */
+  void sync() const;
+
+  /**
+   * @brief Send values from the node leader to the other ranks of its node
+   * @tparam T the type of the values
+   * @param[inout] values the values, read on the node leader and written on the other ranks
+   * @param[in] count the number of values
+   * @note Collective over the ranks of the node, joinNode must have been called
+   */
+  template< typename T >
+  void broadcastFromLeader( T * const values, int const count ) const
+  {
+#ifdef GEOS_USE_MPI
+    if( m_nodeComm != MPI_COMM_NULL )
+    {
+      MpiWrapper::bcast( values, count, 0, m_nodeComm );
+    }
+#else
+    GEOS_UNUSED_VAR( values, count );
+#endif
+  }
+
+  /**
+   * @brief Check whether the current rank is in charge of filling the buffer on its node
+   * @return true if the current rank is the first rank of its node
+   */
+  bool isNodeLeader() const { return m_nodeRank == 0; }
+
+  /**
+   * @brief Check whether the buffer is mapped in the memory of several ranks
+   * @return true if the buffer is allocated in a shared memory window
+   */
+  bool isShared() const
+  {
+#ifdef GEOS_USE_MPI
+    return m_window != MPI_WIN_NULL;
+#else
+    return false;
+#endif
+  }
+
+  /**
+   * @brief Get the size of the memory allocated by the current rank for the buffer
+   * @return the size of the buffer on the node leader or when the buffer is not shared, 0 otherwise
+   */
+  std::size_t allocatedSize() const { return m_allocatedBytes; }
+
+  /**
+   * @brief Get the size of the buffer
+   * @return the size of the buffer in bytes
+   */
+  std::size_t size() const { return m_numBytes; }
+
+  /**
+   * @brief Get a typed pointer to the data of the buffer
+   * @tparam T the type of the data
+   * @return a pointer to the first value
+   */
+  template< typename T >
+  T * data() const { return static_cast< T * >( m_data ); }
+
+private:
+
+#ifdef GEOS_USE_MPI
+  /// Communicator of the ranks of the node
+  MPI_Comm m_nodeComm = MPI_COMM_NULL;
+
+  /// Shared memory window
+  MPI_Win m_window = MPI_WIN_NULL;
+#endif
+
+  /// Storage used when the memory cannot be shared
+  std::vector< char > m_localData;
+
+  /// Pointer to the data
+  void * m_data = nullptr;
+
+  /// Size of the buffer in bytes
+  std::size_t m_numBytes = 0;
+
+  /// Size of the memory allocated by the current rank in bytes
+  std::size_t m_allocatedBytes = 0;
+
+  /// Rank in the node
+  int m_nodeRank = 0;
+
+  /// Number of ranks in the node
+  int m_numNodeRanks = 1;
+};
+
+} // namespace geos
+
+#endif // GEOS_COMMON_NODESHAREDBUFFER_HPP_
@@ -0,0 +1,122 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "common/DataTypes.hpp"
+#include "common/initializeEnvironment.hpp"
+#include "common/MpiWrapper.hpp"
+#include "common/NodeSharedBuffer.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geos;
+
+// This unit test is run on a single rank, where the buffer is a rank-local allocation, and on several ranks,
+// where the ranks of a node share the allocation of their node leader.
+
+TEST( NodeSharedBufferTest, singleAllocationPerNode )
+{
+  int const rank = MpiWrapper::commRank();
+  MPI_Comm nodeComm = MpiWrapper::commSplitShared();
+  int const numNodeRanks = MpiWrapper::commSize( nodeComm );
+  int const nodeLeader = MpiWrapper::min( rank, nodeComm );
+
+  localIndex const numValues = 1000;
+  NodeSharedBuffer buffer;
+  buffer.allocate( numValues * sizeof( real64 ) );
+  EXPECT_EQ( buffer.size(), numValues * sizeof( real64 ) );
+  EXPECT_EQ( buffer.isNodeLeader(), rank == nodeLeader );
+  EXPECT_EQ( buffer.isShared(), MpiWrapper::initialized() && numNodeRanks > 1 );
+
+  // the node leader allocates the whole buffer, the other ranks of the node nothing
+  EXPECT_EQ( buffer.allocatedSize(), buffer.isNodeLeader() ? buffer.size() : 0 );
+  globalIndex const numNodes = MpiWrapper::sum( globalIndex( buffer.isNodeLeader() ? 1 : 0 ) );
+  globalIndex const allocatedSize = MpiWrapper::sum( globalIndex( buffer.allocatedSize() ) );
+  EXPECT_EQ( allocatedSize, numNodes * globalIndex( buffer.size() ) );
+
+  // the values written by the node leader are read by all the ranks of the node
+  real64 * const data = buffer.data< real64 >();
+  if( buffer.isNodeLeader() )
+  {
+    for( localIndex i = 0; i < numValues; ++i )
+    {
+      data[i] = nodeLeader + 0.5 * i;
+    }
+  }
+  buffer.sync();
+  for( localIndex i = 0; i < numValues; ++i )
+  {
+    EXPECT_EQ( data[i], nodeLeader + 0.5 * i ) << "rank " << rank << ", value " << i;
+  }
+  buffer.sync();
+
+  MpiWrapper::commFree( nodeComm );
+}
+
+TEST( NodeSharedBufferTest, reallocateAndFree )
+{
+  int const rank = MpiWrapper::commRank();
+  MPI_Comm nodeComm = MpiWrapper::commSplitShared();
+  int const nodeLeader = MpiWrapper::min( rank, nodeComm );
+
+  // the node leader is known before the allocation
+  NodeSharedBuffer buffer;
+  buffer.joinNode();
+  EXPECT_EQ( buffer.isNodeLeader(), rank == nodeLeader );
+
+  for( localIndex const numValues : { 10, 100, 3 } )
+  {
+    buffer.allocate( numValues * sizeof( integer ) );
+    EXPECT_EQ( buffer.size(), numValues * sizeof( integer ) );
+    EXPECT_EQ( buffer.isNodeLeader(), rank == nodeLeader );
+
+    integer * const data = buffer.data< integer >();
+    if( buffer.isNodeLeader() )
+    {
+      for( localIndex i = 0; i < numValues; ++i )
+      {
+        data[i] = LvArray::integerConversion< integer >( numValues + i );
+      }
+    }
+    buffer.sync();
+    for( localIndex i = 0; i < numValues; ++i )
+    {
+      EXPECT_EQ( data[i], numValues + i ) << "rank " << rank << ", value " << i;
+    }
+    buffer.sync();
+  }
+
+  // the values broadcast by the node leader are received by all the ranks of the node
+  integer values[2] = { rank, -rank };
+  buffer.broadcastFromLeader( values, 2 );
+  EXPECT_EQ( values[0], nodeLeader );
+  EXPECT_EQ( values[1], -nodeLeader );
+
+  buffer.free();
+  EXPECT_EQ( buffer.size(), 0u );
+  EXPECT_EQ( buffer.allocatedSize(), 0u );
+  EXPECT_EQ( buffer.data< integer >(), nullptr );
+  EXPECT_FALSE( buffer.isShared() );
+
+  MpiWrapper::commFree( nodeComm );
+}
+
+int main( int argc, char * argv[] )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  setupMPI( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  finalizeMPI();
+  return result;
+}
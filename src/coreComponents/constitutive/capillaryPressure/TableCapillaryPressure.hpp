@@ -60,16 +60,46 @@ public:
                    arrayView3d< real64, cappres::USD_CAPPRES > const & phaseCapPres,
                    arrayView4d< real64, cappres::USD_CAPPRES_DS > const & dPhaseCapPres_dPhaseVolFrac );
 
+    /**
+     * @brief Compute the capillary pressures
+     * @param[in] phaseVolFraction the phase volume fractions
+     * @param[out] phaseCapPres the phase capillary pressures
+     * @param[out] dPhaseCapPres_dPhaseVolFrac the derivatives of the phase capillary pressures wrt the phase volume fractions
+     * @param[in] phaseVolFracPositions the positions of the phase volume fractions on the table axes, or nullptr to search for them
+     */
     GEOS_HOST_DEVICE
     void compute( arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseVolFraction,
                   arraySlice1d< real64, cappres::USD_CAPPRES - 2 > const & phaseCapPres,
-                  arraySlice2d< real64, cappres::USD_CAPPRES_DS - 2 > const & dPhaseCapPres_dPhaseVolFrac ) const;
+                  arraySlice2d< real64, cappres::USD_CAPPRES_DS - 2 > const & dPhaseCapPres_dPhaseVolFrac,
+                  TableFunction::AxisPosition const * const phaseVolFracPositions = nullptr ) const;
 
     GEOS_HOST_DEVICE
     virtual void update( localIndex const k,
                          localIndex const q,
                          arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseVolFraction ) const override;
 
+    /**
+     * @brief Update the capillary pressures, reusing the positions of the phase volume fractions on the table axes
+     * @param[in] k the element index
+     * @param[in] q the gauss point index
+     * @param[in] phaseVolFraction the phase volume fractions
+     * @param[in] phaseVolFracPositions the positions of the phase volume fractions, found on axes identical to the table axes
+     */
+    GEOS_HOST_DEVICE
+    void update( localIndex const k,
+                 localIndex const q,
+                 arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseVolFraction,
+                 TableFunction::AxisPosition const * const phaseVolFracPositions ) const;
+
+    /**
+     * @brief Get the tables evaluated at the volume fraction of a phase
+     * @param[in] ip the phase index
+     * @param[inout] tables the tables evaluated at the volume fraction of phase @p ip, appended to the existing ones
+     * @note This function reads the table kernel wrappers on the host.
+     */
+    void getPhaseVolFractionTables( integer const ip,
+                                    std::vector< TableFunction::KernelWrapper const * > & tables ) const;
+
 private:
 
     /// Array of kernel wrappers for the capillary pressures
@@ -124,7 +154,8 @@ inline void
 TableCapillaryPressure::KernelWrapper::
   compute( arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseVolFraction,
            arraySlice1d< real64, cappres::USD_CAPPRES - 2 > const & phaseCapPres,
-           arraySlice2d< real64, cappres::USD_CAPPRES_DS - 2 > const & dPhaseCapPres_dPhaseVolFrac ) const
+           arraySlice2d< real64, cappres::USD_CAPPRES_DS - 2 > const & dPhaseCapPres_dPhaseVolFrac,
+           TableFunction::AxisPosition const * const phaseVolFracPositions ) const
 {
   LvArray::forValuesInSlice( dPhaseCapPres_dPhaseVolFrac, []( real64 & val ){ val = 0.0; } );
 
@@ -139,13 +170,15 @@ TableCapillaryPressure::KernelWrapper::
 
     // water-oil capillary pressure
     phaseCapPres[ipWater] =
-      m_capPresKernelWrappers[TPT::INTERMEDIATE_WETTING].compute( &(phaseVolFraction)[ipWater],
-                                                                  &(dPhaseCapPres_dPhaseVolFrac)[ipWater][ipWater] );
+      m_capPresKernelWrappers[TPT::INTERMEDIATE_WETTING].compute( phaseVolFraction[ipWater],
+                                                                  TableFunction::AxisPosition::at( phaseVolFracPositions, ipWater ),
+                                                                  dPhaseCapPres_dPhaseVolFrac[ipWater][ipWater] );
 
     // gas-oil capillary pressure
     phaseCapPres[ipGas] =
-      m_capPresKernelWrappers[TPT::INTERMEDIATE_NONWETTING].compute( &(phaseVolFraction)[ipGas],
-                                                                     &(dPhaseCapPres_dPhaseVolFrac)[ipGas][ipGas] );
+      m_capPresKernelWrappers[TPT::INTERMEDIATE_NONWETTING].compute( phaseVolFraction[ipGas],
+                                                                     TableFunction::AxisPosition::at( phaseVolFracPositions, ipGas ),
+                                                                     dPhaseCapPres_dPhaseVolFrac[ipGas][ipGas] );
 
     // when pc is on the gas phase, we need to multiply user input by -1
     // because CompositionalMultiphaseFVM does: pres_gas = pres_oil - pc_og, so we need a negative pc_og
@@ -156,8 +189,9 @@ TableCapillaryPressure::KernelWrapper::
   {
     // put capillary pressure on the non-wetting phase
     phaseCapPres[ipGas] =
-      m_capPresKernelWrappers[0].compute( &(phaseVolFraction)[ipGas],
-                                          &(dPhaseCapPres_dPhaseVolFrac)[ipGas][ipGas] );
+      m_capPresKernelWrappers[0].compute( phaseVolFraction[ipGas],
+                                          TableFunction::AxisPosition::at( phaseVolFracPositions, ipGas ),
+                                          dPhaseCapPres_dPhaseVolFrac[ipGas][ipGas] );
 
     // when pc is on the gas phase, we need to multiply user input by -1
     // because CompositionalMultiphaseFVM does: pres_gas = pres_oil - pc_og, so we need a negative pc_og
@@ -168,8 +202,9 @@ TableCapillaryPressure::KernelWrapper::
   {
     // put capillary pressure on the wetting phase
     phaseCapPres[ipWater] =
-      m_capPresKernelWrappers[0].compute( &(phaseVolFraction)[ipWater],
-                                          &(dPhaseCapPres_dPhaseVolFrac)[ipWater][ipWater] );
+      m_capPresKernelWrappers[0].compute( phaseVolFraction[ipWater],
+                                          TableFunction::AxisPosition::at( phaseVolFracPositions, ipWater ),
+                                          dPhaseCapPres_dPhaseVolFrac[ipWater][ipWater] );
   }
 }
 
@@ -185,6 +220,48 @@ TableCapillaryPressure::KernelWrapper::
            m_dPhaseCapPressure_dPhaseVolFrac[k][q] );
 }
 
+GEOS_HOST_DEVICE
+inline void
+TableCapillaryPressure::KernelWrapper::
+  update( localIndex const k,
+          localIndex const q,
+          arraySlice1d< geos::real64 const, compflow::USD_PHASE - 1 > const & phaseVolFraction,
+          TableFunction::AxisPosition const * const phaseVolFracPositions ) const
+{
+  compute( phaseVolFraction,
+           m_phaseCapPressure[k][q],
+           m_dPhaseCapPressure_dPhaseVolFrac[k][q],
+           phaseVolFracPositions );
+}
+
+inline void
+TableCapillaryPressure::KernelWrapper::
+  getPhaseVolFractionTables( integer const ip,
+                             std::vector< TableFunction::KernelWrapper const * > & tables ) const
+{
+  using PT = CapillaryPressureBase::PhaseType;
+  integer const ipWater = m_phaseOrder[PT::WATER];
+  integer const ipOil   = m_phaseOrder[PT::OIL];
+  integer const ipGas   = m_phaseOrder[PT::GAS];
+
+  if( ipWater >= 0 && ipOil >= 0 && ipGas >= 0 )
+  {
+    using TPT = TableCapillaryPressure::ThreePhasePairPhaseType;
+    if( ip == ipWater )
+    {
+      tables.push_back( &m_capPresKernelWrappers[TPT::INTERMEDIATE_WETTING] );
+    }
+    else if( ip == ipGas )
+    {
+      tables.push_back( &m_capPresKernelWrappers[TPT::INTERMEDIATE_NONWETTING] );
+    }
+  }
+  else if( ( ipWater < 0 && ip == ipGas ) || ( ipWater >= 0 && ip == ipWater ) )
+  {
+    tables.push_back( &m_capPresKernelWrappers[0] );
+  }
+}
+
 } // namespace constitutive
 
 } // namespace geos
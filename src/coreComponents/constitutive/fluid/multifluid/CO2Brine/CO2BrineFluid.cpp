@@ -229,6 +229,8 @@ void CO2BrineFluid< PHASE1, PHASE2, FLASH >::postInputInitialization()
   string const expectedGasPhaseNames[] = { "CO2", "co2", "gas", "Gas" };
   m_p2Index = PVTFunctionHelpers::findName( m_phaseNames, expectedGasPhaseNames, viewKeyStruct::phaseNamesString() );
 
+  // collective: the tables of the models are computed across the ranks (see PVTFunctionHelpers::computePropertyTables),
+  // while the copies made by deliverClone find them in the FunctionManager
   createPVTModels();
 }
 
@@ -120,16 +120,22 @@ TableFunction const * makeCO2EnthalpyTable( string_array const & inputParams,
       GEOS_THROW( GEOS_FMT( "{}: invalid model parameter value: {}", functionName, e.what() ), InputError );
     }
 
-    array1d< real64 > densities( tableCoords.nPressures() * tableCoords.nTemperatures() );
-    array1d< real64 > enthalpies( tableCoords.nPressures() * tableCoords.nTemperatures() );
-
-    SpanWagnerCO2Density::calculateCO2Density( functionName, tolerance, tableCoords, densities );
-
-    CO2Enthalpy::calculateCO2Enthalpy( tableCoords, densities, enthalpies );
+    // the same key is used by CO2Enthalpy and BrineEnthalpy, which compute the same table
+    array1d< array1d< real64 > > enthalpies( 1 );
+    PVTFunctionHelpers::computePropertyTables( functionName,
+                                               GEOS_FMT( "CO2Enthalpy tolerance={}", tolerance ),
+                                               tableCoords,
+                                               [&]( PTTableCoordinates const & coords, array1d< array1d< real64 > > & tables )
+    {
+      array1d< real64 > densities( coords.nPressures() * coords.nTemperatures() );
+      SpanWagnerCO2Density::calculateCO2Density( functionName, tolerance, coords, densities );
+      CO2Enthalpy::calculateCO2Enthalpy( coords, densities, tables[0] );
+    },
+                                               enthalpies );
 
     TableFunction * const enthalpyTable = dynamicCast< TableFunction * >( functionManager.createChild( TableFunction::catalogName(), tableName ) );
     enthalpyTable->setTableCoordinates( tableCoords.getCoords(), tableCoords.coordsUnits );
-    enthalpyTable->setTableValues( enthalpies, units::Enthalpy );
+    enthalpyTable->setTableValues( enthalpies[0], units::Enthalpy );
     enthalpyTable->setInterpolationMethod( TableFunction::InterpolationType::Linear );
     return enthalpyTable;
   }
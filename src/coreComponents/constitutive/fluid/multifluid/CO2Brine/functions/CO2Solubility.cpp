@@ -130,29 +130,41 @@ makeSolubilityTables( string const & functionName,
   integer const nPressures = tableCoords.nPressures();
   integer const nTemperatures = tableCoords.nTemperatures();
 
-  array1d< real64 > co2Solubility( nPressures * nTemperatures );
-  array1d< real64 > h2oSolubility( nPressures * nTemperatures );
-
-  if( solubilityModel == constitutive::PVTProps::CO2Solubility::SolubilityModel::DuanSun )
-  {
-    constitutive::PVTProps::CO2SolubilityDuanSun::populateSolubilityTables(
-      functionName,
-      tableCoords,
-      salinity,
-      tolerance,
-      co2Solubility,
-      h2oSolubility );
-  }
-  else if( solubilityModel == constitutive::PVTProps::CO2Solubility::SolubilityModel::SpycherPruess )
+  string const modelKey = GEOS_FMT( "CO2Solubility {} salinity={} tolerance={}",
+                                    EnumStrings< constitutive::PVTProps::CO2Solubility::SolubilityModel >::toString( solubilityModel ),
+                                    salinity, tolerance );
+  array1d< array1d< real64 > > solubilities( 2 );
+  constitutive::PVTProps::PVTFunctionHelpers::computePropertyTables( functionName,
+                                                                     modelKey,
+                                                                     tableCoords,
+                                                                     [&]( constitutive::PVTProps::PTTableCoordinates const & coords,
+                                                                          array1d< array1d< real64 > > & tables )
   {
-    constitutive::PVTProps::CO2SolubilitySpycherPruess::populateSolubilityTables(
-      functionName,
-      tableCoords,
-      salinity,
-      tolerance,
-      co2Solubility,
-      h2oSolubility );
-  }
+    if( solubilityModel == constitutive::PVTProps::CO2Solubility::SolubilityModel::DuanSun )
+    {
+      constitutive::PVTProps::CO2SolubilityDuanSun::populateSolubilityTables(
+        functionName,
+        coords,
+        salinity,
+        tolerance,
+        tables[0],
+        tables[1] );
+    }
+    else if( solubilityModel == constitutive::PVTProps::CO2Solubility::SolubilityModel::SpycherPruess )
+    {
+      constitutive::PVTProps::CO2SolubilitySpycherPruess::populateSolubilityTables(
+        functionName,
+        coords,
+        salinity,
+        tolerance,
+        tables[0],
+        tables[1] );
+    }
+  },
+                                                                     solubilities );
+
+  array1d< real64 > co2Solubility = std::move( solubilities[0] );
+  array1d< real64 > h2oSolubility = std::move( solubilities[1] );
 
   // Truncate negative solubility and warn
   integer constexpr maxBad = 5;     // Maximum number of bad values to report
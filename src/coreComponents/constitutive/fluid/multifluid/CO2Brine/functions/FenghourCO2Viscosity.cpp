@@ -120,17 +120,22 @@ TableFunction const * makeViscosityTable( string_array const & inputParams,
       GEOS_THROW( GEOS_FMT( "{}: invalid model parameter value: {}", functionName, e.what() ), InputError );
     }
 
-    localIndex const nP = tableCoords.nPressures();
-    localIndex const nT = tableCoords.nTemperatures();
-    array1d< real64 > density( nP * nT );
-    array1d< real64 > viscosity( nP * nT );
-    SpanWagnerCO2Density::calculateCO2Density( functionName, tolerance, tableCoords, density );
-    calculateCO2Viscosity( tableCoords, density, viscosity );
+    array1d< array1d< real64 > > viscosity( 1 );
+    PVTFunctionHelpers::computePropertyTables( functionName,
+                                               GEOS_FMT( "FenghourCO2Viscosity tolerance={}", tolerance ),
+                                               tableCoords,
+                                               [&]( PTTableCoordinates const & coords, array1d< array1d< real64 > > & tables )
+    {
+      array1d< real64 > density( coords.nPressures() * coords.nTemperatures() );
+      SpanWagnerCO2Density::calculateCO2Density( functionName, tolerance, coords, density );
+      calculateCO2Viscosity( coords, density, tables[0] );
+    },
+                                               viscosity );
 
     TableFunction * const viscosityTable = dynamicCast< TableFunction * >( functionManager.createChild( "TableFunction", tableName ) );
     viscosityTable->setTableCoordinates( tableCoords.getCoords(),
                                          { units::Pressure, units::TemperatureInC } );
-    viscosityTable->setTableValues( viscosity, units::Viscosity );
+    viscosityTable->setTableValues( viscosity[0], units::Viscosity );
     viscosityTable->setInterpolationMethod( TableFunction::InterpolationType::Linear );
     return viscosityTable;
   }
@@ -19,6 +19,14 @@
 
 #include "constitutive/fluid/multifluid/CO2Brine/functions/PVTFunctionHelpers.hpp"
 #include "LvArray/src/sortedArrayManipulation.hpp"
+#include "common/MpiWrapper.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <sstream>
+#include <unistd.h>
 
 namespace geos
 {
@@ -152,6 +160,265 @@ BlackOilTables::buildAllTables( localIndex const ipOil,
   }
 }
 
+namespace PVTFunctionHelpers
+{
+
+namespace
+{
+
+/// Version of the table cache file format
+constexpr std::uint64_t tableCacheVersion = 1;
+
+/**
+ * @brief Compute the 64-bit FNV-1a hash of a string (stable across platforms and runs)
+ * @param[in] str the string
+ * @return the hash
+ */
+std::uint64_t hashString( string const & str )
+{
+  std::uint64_t hash = 14695981039346656037ull;
+  for( char const c : str )
+  {
+    hash ^= static_cast< unsigned char >( c );
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+/**
+ * @brief Build the key identifying a set of tables, made of the model key and of the exact grid coordinates
+ * @param[in] modelKey the model key
+ * @param[in] tableCoords the (p,T) coordinates of the tables
+ * @return the key
+ */
+string makeTableCacheKey( string const & modelKey,
+                          PTTableCoordinates const & tableCoords )
+{
+  std::ostringstream key;
+  key << std::hexfloat << modelKey << "\nP";
+  for( real64 const pressure : tableCoords.getPressures() )
+  {
+    key << ' ' << pressure;
+  }
+  key << "\nT";
+  for( real64 const temperature : tableCoords.getTemperatures() )
+  {
+    key << ' ' << temperature;
+  }
+  return key.str();
+}
+
+/**
+ * @brief Read tables from a cache file
+ * @param[in] fileName the name of the cache file
+ * @param[in] key the key of the tables
+ * @param[inout] tables the tables, sized on input
+ * @return true if the file exists and holds the tables of the key
+ */
+bool readTableCache( string const & fileName,
+                     string const & key,
+                     array1d< array1d< real64 > > & tables )
+{
+  std::ifstream file( fileName, std::ios::binary );
+  if( !file )
+  {
+    return false;
+  }
+
+  std::uint64_t header[3];
+  file.read( reinterpret_cast< char * >( header ), sizeof( header ) );
+  if( !file || header[0] != tableCacheVersion || header[1] != key.size() || header[2] != static_cast< std::uint64_t >( tables.size() ) )
+  {
+    return false;
+  }
+  string storedKey( header[1], '\0' );
+  file.read( storedKey.data(), storedKey.size() );
+  if( !file || storedKey != key )
+  {
+    return false;
+  }
+
+  for( array1d< real64 > & table : tables )
+  {
+    file.read( reinterpret_cast< char * >( table.data() ), table.size() * sizeof( real64 ) );
+  }
+  return static_cast< bool >( file );
+}
+
+/**
+ * @brief Write tables to a cache file (through a temporary file, so that concurrent runs never read a partial file)
+ * @param[in] fileName the name of the cache file
+ * @param[in] key the key of the tables
+ * @param[in] tables the tables
+ * @return true if the file has been written
+ */
+bool writeTableCache( string const & fileName,
+                      string const & key,
+                      array1d< array1d< real64 > > const & tables )
+{
+  string const tmpFileName = GEOS_FMT( "{}.{}.tmp", fileName, ::getpid() );
+  {
+    std::ofstream file( tmpFileName, std::ios::binary );
+    if( !file )
+    {
+      return false;
+    }
+    std::uint64_t const header[3] = { tableCacheVersion, key.size(), static_cast< std::uint64_t >( tables.size() ) };
+    file.write( reinterpret_cast< char const * >( header ), sizeof( header ) );
+    file.write( key.data(), key.size() );
+    for( array1d< real64 > const & table : tables )
+    {
+      file.write( reinterpret_cast< char const * >( table.data() ), table.size() * sizeof( real64 ) );
+    }
+    if( !file )
+    {
+      std::remove( tmpFileName.c_str() );
+      return false;
+    }
+  }
+  return std::rename( tmpFileName.c_str(), fileName.c_str() ) == 0;
+}
+
+} // namespace
+
+void
+computePropertyTables( string const & functionName,
+                       string const & modelKey,
+                       PTTableCoordinates const & tableCoords,
+                       std::function< void ( PTTableCoordinates const &, array1d< array1d< real64 > > & ) > const & computeTables,
+                       array1d< array1d< real64 > > & tables )
+{
+  localIndex const nPressures = tableCoords.nPressures();
+  localIndex const nTemperatures = tableCoords.nTemperatures();
+  localIndex const numTables = tables.size();
+  for( array1d< real64 > & table : tables )
+  {
+    table.resize( nPressures * nTemperatures );
+  }
+
+  // 1) load the tables from the cache: read by the first rank and broadcast
+  char const * const cacheDirectory = std::getenv( "GEOS_PVT_TABLE_CACHE_DIR" );
+  string const key = makeTableCacheKey( modelKey, tableCoords );
+  string const cacheFileName = cacheDirectory != nullptr
+                             ? GEOS_FMT( "{}/pvt_{:016x}.bin", cacheDirectory, hashString( key ) )
+                             : string();
+  // without MPI (e.g. a table built before MPI is initialized), the rank computes the tables alone
+  bool const distributed = MpiWrapper::initialized() && MpiWrapper::commSize() > 1;
+  int const numRanks = distributed ? MpiWrapper::commSize() : 1;
+  int const rank = distributed ? MpiWrapper::commRank() : 0;
+
+  if( !cacheFileName.empty() )
+  {
+    int found = rank == 0 ? readTableCache( cacheFileName, key, tables ) : 0;
+    if( distributed )
+    {
+      MpiWrapper::broadcast( found );
+    }
+    if( found )
+    {
+      if( distributed )
+      {
+        for( array1d< real64 > & table : tables )
+        {
+          MpiWrapper::bcast( table.data(), LvArray::integerConversion< int >( table.size() ), 0, MPI_COMM_GEOS );
+        }
+      }
+      GEOS_LOG_RANK_0( GEOS_FMT( "{}: tables read from {}", functionName, cacheFileName ) );
+      return;
+    }
+  }
+
+  // 2) compute the tables, each rank taking a contiguous block of pressure rows
+  localIndex const firstPressure = nPressures * rank / numRanks;
+  localIndex const lastPressure = nPressures * ( rank + 1 ) / numRanks;
+  localIndex const nLocalPressures = lastPressure - firstPressure;
+
+  // the rows of the other ranks are left to zero, and filled by a sum over the ranks
+  array1d< real64 > localValues( numTables * nPressures * nTemperatures );
+  std::exception_ptr computeException;
+  if( nLocalPressures > 0 )
+  {
+    PTTableCoordinates localCoords;
+    for( localIndex i = firstPressure; i < lastPressure; ++i )
+    {
+      localCoords.appendPressure( tableCoords.getPressure( i ) );
+    }
+    for( localIndex j = 0; j < nTemperatures; ++j )
+    {
+      localCoords.appendTemperature( tableCoords.getTemperature( j ) );
+    }
+
+    array1d< array1d< real64 > > localTables( numTables );
+    for( array1d< real64 > & table : localTables )
+    {
+      table.resize( nLocalPressures * nTemperatures );
+    }
+
+    // an error on one rank must not leave the other ranks waiting in the reduction below
+    try
+    {
+      computeTables( localCoords, localTables );
+    }
+    catch( ... )
+    {
+      computeException = std::current_exception();
+    }
+
+    for( localIndex k = 0; k < numTables && !computeException; ++k )
+    {
+      for( localIndex j = 0; j < nTemperatures; ++j )
+      {
+        for( localIndex i = 0; i < nLocalPressures; ++i )
+        {
+          localValues[( k * nTemperatures + j ) * nPressures + firstPressure + i] = localTables[k][j * nLocalPressures + i];
+        }
+      }
+    }
+  }
+
+  // all the ranks throw if the computation failed on one of them
+  if( distributed )
+  {
+    integer const computeFailed = MpiWrapper::max( integer( computeException ? 1 : 0 ) );
+    if( computeException )
+    {
+      std::rethrow_exception( computeException );
+    }
+    GEOS_THROW_IF( computeFailed != 0,
+                   GEOS_FMT( "{}: the computation of the tables failed on another rank", functionName ),
+                   InputError );
+  }
+  else if( computeException )
+  {
+    std::rethrow_exception( computeException );
+  }
+
+  array1d< real64 > values( numTables * nPressures * nTemperatures );
+  if( distributed )
+  {
+    MpiWrapper::allReduce( localValues.data(), values.data(), LvArray::integerConversion< int >( values.size() ), MPI_SUM, MPI_COMM_GEOS );
+  }
+  else
+  {
+    values = std::move( localValues );
+  }
+  for( localIndex k = 0; k < numTables; ++k )
+  {
+    std::copy( values.begin() + k * nPressures * nTemperatures,
+               values.begin() + ( k + 1 ) * nPressures * nTemperatures,
+               tables[k].begin() );
+  }
+
+  // 3) store the tables in the cache
+  if( !cacheFileName.empty() && rank == 0 )
+  {
+    bool const written = writeTableCache( cacheFileName, key, tables );
+    GEOS_WARNING_IF( !written, GEOS_FMT( "{}: could not write the table cache file {}", functionName, cacheFileName ) );
+  }
+}
+
+} // namespace PVTFunctionHelpers
+
 } // namespace PVTProps
 
 } // namespace constitutive
@@ -22,6 +22,8 @@
 #include "common/logger/Logger.hpp"
 #include "common/format/StringUtilities.hpp"
 
+#include <functional>
+
 #ifndef GEOS_CONSTITUTIVE_FLUID_MULTIFLUID_CO2BRINE_FUNCTIONS_PVTFUNCTIONHELPERS_HPP_
 #define GEOS_CONSTITUTIVE_FLUID_MULTIFLUID_CO2BRINE_FUNCTIONS_PVTFUNCTIONHELPERS_HPP_
 
@@ -230,6 +232,29 @@ initializePropertyTable( string_array const & inputParameters,
   }
 }
 
+/**
+ * @brief Compute property tables on a (p,T) grid, or load them from the table cache
+ * @param[in] functionName the name of the PVT function
+ * @param[in] modelKey a string identifying the model and the values of all its parameters
+ * @param[in] tableCoords the (p,T) coordinates of the tables
+ * @param[in] computeTables the function computing the tables on a (p,T) grid (values stored as [j*nPressures+i])
+ * @param[inout] tables the tables (the size of this array gives the number of tables)
+ *
+ * The pressure rows of the grid are distributed across the ranks, and the computed rows are exchanged between them.
+ * If the environment variable GEOS_PVT_TABLE_CACHE_DIR is set, the tables are stored in a binary file of this
+ * directory, named after a hash of the model key and of the grid, and are read from it by later runs.
+ * An exception thrown by @p computeTables on one rank is thrown on all the ranks.
+ * @note Collective over MPI_COMM_GEOS when MPI is initialized: all the ranks must build the same tables in the
+ *       same order. This is the case for the tables built when the PVT models are created from the input, since
+ *       the later copies of the models find the tables in the FunctionManager.
+ */
+void
+computePropertyTables( string const & functionName,
+                       string const & modelKey,
+                       PTTableCoordinates const & tableCoords,
+                       std::function< void ( PTTableCoordinates const &, array1d< array1d< real64 > > & ) > const & computeTables,
+                       array1d< array1d< real64 > > & tables );
+
 } // namespace PVTFunctionHelpers
 
 } // namespace PVTProps
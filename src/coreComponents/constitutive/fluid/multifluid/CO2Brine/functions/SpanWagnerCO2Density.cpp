@@ -240,12 +240,19 @@ TableFunction const * makeDensityTable( string_array const & inputParams,
       GEOS_THROW( GEOS_FMT( "{}: invalid model parameter value: {}", functionName, e.what() ), InputError );
     }
 
-    array1d< real64 > densities( tableCoords.nPressures() * tableCoords.nTemperatures() );
-    SpanWagnerCO2Density::calculateCO2Density( functionName, tolerance, tableCoords, densities );
+    array1d< array1d< real64 > > densities( 1 );
+    PVTFunctionHelpers::computePropertyTables( functionName,
+                                               GEOS_FMT( "SpanWagnerCO2Density tolerance={}", tolerance ),
+                                               tableCoords,
+                                               [&]( PTTableCoordinates const & coords, array1d< array1d< real64 > > & tables )
+    {
+      SpanWagnerCO2Density::calculateCO2Density( functionName, tolerance, coords, tables[0] );
+    },
+                                               densities );
 
     TableFunction * const densityTable = dynamicCast< TableFunction * >( functionManager.createChild( "TableFunction", tableName ) );
     densityTable->setTableCoordinates( tableCoords.getCoords(), tableCoords.coordsUnits );
-    densityTable->setTableValues( densities, units::Density );
+    densityTable->setTableValues( densities[0], units::Density );
     densityTable->setInterpolationMethod( TableFunction::InterpolationType::Linear );
     return densityTable;
   }
@@ -32,7 +32,8 @@ namespace constitutive
 MultiFluidBase::MultiFluidBase( string const & name, Group * const parent )
   : ConstitutiveBase( name, parent ),
   m_useMass( false ),
-  m_checkPVTTablesRanges( 1 )
+  m_checkPVTTablesRanges( 1 ),
+  m_useFloatPhaseCompFractionDerivatives( 0 )
 {
   // We make base inputs optional here, since derived classes may want to predefine/hardcode
   // components/phases. Models that do need these inputs should change input flags accordingly.
@@ -77,6 +78,7 @@ MultiFluidBase::MultiFluidBase( string const & name, Group * const parent )
   registerField( fields::multifluid::phaseCompFraction{}, &m_phaseCompFraction.value );
   registerField( fields::multifluid::phaseCompFraction_n{}, &m_phaseCompFraction_n );
   registerField( fields::multifluid::dPhaseCompFraction{}, &m_phaseCompFraction.derivs );
+  registerField( fields::multifluid::dPhaseCompFraction_float{}, &m_phaseCompFraction.derivsFloat );
 
   registerField( fields::multifluid::totalDensity{}, &m_totalDensity.value );
   registerField( fields::multifluid::totalDensity_n{}, &m_totalDensity_n );
@@ -88,6 +90,13 @@ MultiFluidBase::MultiFluidBase( string const & name, Group * const parent )
     setRestartFlags( RestartFlags::NO_WRITE ).
     setDescription( "Enable (1) or disable (0) an error when the input pressure or temperature of the PVT tables is out of range." ).
     setDefaultValue( 1 );
+
+  registerWrapper( viewKeyStruct::useFloatPhaseCompFractionDerivativesString(), &m_useFloatPhaseCompFractionDerivatives ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setRestartFlags( RestartFlags::NO_WRITE ).
+    setDescription( "Store (1) or not (0) the derivatives of the phase component fractions in single precision, "
+                    "to reduce the memory footprint of the fluid model. The derivatives are still computed in double precision." ).
+    setDefaultValue( 0 );
 }
 
 void MultiFluidBase::resizeFields( localIndex const size, localIndex const numPts )
@@ -95,6 +104,11 @@ void MultiFluidBase::resizeFields( localIndex const size, localIndex const numPt
   integer const numPhase = numFluidPhases();
   integer const numComp = numFluidComponents();
   integer const numDof = numComp + 2;
+  // the derivatives of the enthalpy and internal energy are only needed to assemble the energy balance
+  integer const numThermalDof = isThermal() ? numDof : 0;
+  // the derivatives of the phase component fractions are stored in one of the two arrays, the other one is empty
+  integer const numPhaseCompDof = m_useFloatPhaseCompFractionDerivatives ? 0 : numDof;
+  integer const numPhaseCompFloatDof = m_useFloatPhaseCompFractionDerivatives ? numDof : 0;
 
   m_phaseFraction.value.resize( size, numPts, numPhase );
   m_phaseFraction.derivs.resize( size, numPts, numPhase, numDof );
@@ -111,15 +125,16 @@ void MultiFluidBase::resizeFields( localIndex const size, localIndex const numPt
 
   m_phaseEnthalpy.value.resize( size, numPts, numPhase );
   m_phaseEnthalpy_n.resize( size, numPts, numPhase );
-  m_phaseEnthalpy.derivs.resize( size, numPts, numPhase, numDof );
+  m_phaseEnthalpy.derivs.resize( size, numPts, numPhase, numThermalDof );
 
   m_phaseInternalEnergy.value.resize( size, numPts, numPhase );
   m_phaseInternalEnergy_n.resize( size, numPts, numPhase );
-  m_phaseInternalEnergy.derivs.resize( size, numPts, numPhase, numDof );
+  m_phaseInternalEnergy.derivs.resize( size, numPts, numPhase, numThermalDof );
 
   m_phaseCompFraction.value.resize( size, numPts, numPhase, numComp );
   m_phaseCompFraction_n.resize( size, numPts, numPhase, numComp );
-  m_phaseCompFraction.derivs.resize( size, numPts, numPhase, numComp, numDof );
+  m_phaseCompFraction.derivs.resize( size, numPts, numPhase, numComp, numPhaseCompDof );
+  m_phaseCompFraction.derivsFloat.resize( size, numPts, numPhase, numComp, numPhaseCompFloatDof );
 
   m_totalDensity.value.resize( size, numPts );
   m_totalDensity_n.resize( size, numPts );
@@ -109,7 +109,8 @@ public:
    * @brief Get the thermal flag.
    * @return boolean value indicating whether the model can be used to assemble the energy balance equation or not
    * @detail if isThermal is true, the constitutive model compute the enthalpy and internal energy of the phase.
-   *         This can be used to check the compatibility of the constitutive model with the solver
+   *         This can be used to check the compatibility of the constitutive model with the solver.
+   *         Otherwise, the derivatives of the enthalpy and internal energy are not stored (their last dimension is empty)
    */
   virtual bool isThermal() const { return false; }
 
@@ -161,8 +162,16 @@ public:
   arrayView4d< real64 const, constitutive::multifluid::USD_PHASE_COMP > phaseCompFraction_n() const
   { return m_phaseCompFraction_n; }
 
-  arrayView5d< real64 const, constitutive::multifluid::USD_PHASE_COMP_DC > dPhaseCompFraction() const
-  { return m_phaseCompFraction.derivs; }
+  constitutive::multifluid::PhaseCompDerivsView dPhaseCompFraction() const
+  { return { m_phaseCompFraction.derivs.toViewConst(), m_phaseCompFraction.derivsFloat.toViewConst() }; }
+
+  /**
+   * @brief Get the single precision flag of the phase component fraction derivatives.
+   * @return boolean value indicating whether the derivatives of the phase component fractions are stored in single precision
+   * @detail The derivatives are still computed in double precision, and are only rounded when they are stored.
+   *         The storage that is not used has an empty last dimension.
+   */
+  bool useFloatPhaseCompFractionDerivatives() const { return m_useFloatPhaseCompFractionDerivatives; }
 
   arrayView2d< real64 const, constitutive::multifluid::USD_FLUID > totalDensity() const
   { return m_totalDensity.value; }
@@ -217,13 +226,52 @@ public:
     static constexpr char const * phaseNamesString() { return "phaseNames"; }
     static constexpr char const * useMassString() { return "useMass"; }
     static constexpr char const * checkPVTTablesRangesString() { return "checkPVTTablesRanges"; }
+    static constexpr char const * useFloatPhaseCompFractionDerivativesString() { return "useFloatPhaseCompFractionDerivatives"; }
   };
 
 
 public:
 
   using PhaseProp = MultiFluidVar< real64, 3, constitutive::multifluid::LAYOUT_PHASE, constitutive::multifluid::LAYOUT_PHASE_DC >;
-  using PhaseComp = MultiFluidVar< real64, 4, constitutive::multifluid::LAYOUT_PHASE_COMP, constitutive::multifluid::LAYOUT_PHASE_COMP_DC >;
+
+  /**
+   * @brief Phase component fractions, whose derivatives are stored either in double precision or in single precision
+   * @detail Only one of the two derivative arrays is used, the last dimension of the other one is empty
+   */
+  struct PhaseComp : public MultiFluidVar< real64, 4, constitutive::multifluid::LAYOUT_PHASE_COMP, constitutive::multifluid::LAYOUT_PHASE_COMP_DC >
+  {
+    using Base = MultiFluidVar< real64, 4, constitutive::multifluid::LAYOUT_PHASE_COMP, constitutive::multifluid::LAYOUT_PHASE_COMP_DC >;
+
+    /// Property derivatives w.r.t. pressure, temperature, compositions, stored in single precision
+    Array< real32, 5, constitutive::multifluid::LAYOUT_PHASE_COMP_DC > derivsFloat;
+
+    /// Views into the phase component fractions and into both derivative arrays
+    struct ViewType : public Base::ViewType
+    {
+      ViewType() = default;
+
+      GEOS_HOST_DEVICE
+      ViewType( ViewType const & src ):
+        Base::ViewType( src ),
+        derivsFloat( src.derivsFloat )
+      {}
+
+      GEOS_HOST_DEVICE
+      ViewType( Base::ViewType const & src,
+                ArrayView< real32, 5, constitutive::multifluid::USD_PHASE_COMP_DC > const & derivsFloatSrc ):
+        Base::ViewType( src ),
+        derivsFloat( derivsFloatSrc )
+      {}
+
+      ArrayView< real32, 5, constitutive::multifluid::USD_PHASE_COMP_DC > derivsFloat; ///< View into the single precision derivatives
+    };
+
+    ViewType toView()
+    {
+      return { Base::toView(), derivsFloat.toView() };
+    }
+  };
+
   using FluidProp = MultiFluidVar< real64, 2, constitutive::multifluid::LAYOUT_FLUID, constitutive::multifluid::LAYOUT_FLUID_DC >;
 
 public:
@@ -527,6 +575,60 @@ public:
       return 0.0 < totalFluidDensity ? dTotalFluidDensity_dP / totalFluidDensity : 0.0;
     }
 
+    /**
+     * @brief Compute the phase component fractions (+ derivatives) in a cell, and store them
+     * @tparam LAMBDA the type of the function computing the phase component fractions
+     * @param[in] k the element index
+     * @param[in] q the quadrature node index
+     * @param[in] computeFunc the function computing the phase component fractions, called with a PhaseComp::SliceType
+     * @detail When the derivatives are stored in single precision, they are computed in a double precision
+     *         stack buffer and rounded when copied back to the storage
+     */
+    template< typename LAMBDA >
+    GEOS_HOST_DEVICE
+    void computePhaseCompFraction( localIndex const k,
+                                   localIndex const q,
+                                   LAMBDA && computeFunc ) const
+    {
+      if( m_phaseCompFraction.derivsFloat.size( 4 ) == 0 )
+      {
+        computeFunc( m_phaseCompFraction( k, q ) );
+        return;
+      }
+
+      integer constexpr maxNumDof = MAX_NUM_COMPONENTS + 2;
+      integer const numPhase = numPhases();
+      integer const numComp = numComponents();
+      integer const numDof = numComp + 2;
+
+      // the buffer starts from the stored derivatives, since some models only overwrite part of them
+      StackArray< real64, 5, maxNumDof *MAX_NUM_COMPONENTS *MAX_NUM_PHASES, constitutive::multifluid::LAYOUT_PHASE_COMP_DC >
+      dPhaseCompFraction( 1, 1, numPhase, numComp, numDof );
+      for( integer ip = 0; ip < numPhase; ++ip )
+      {
+        for( integer ic = 0; ic < numComp; ++ic )
+        {
+          for( integer idof = 0; idof < numDof; ++idof )
+          {
+            dPhaseCompFraction[0][0][ip][ic][idof] = m_phaseCompFraction.derivsFloat[k][q][ip][ic][idof];
+          }
+        }
+      }
+
+      computeFunc( PhaseComp::SliceType( m_phaseCompFraction.value[k][q], dPhaseCompFraction[0][0] ) );
+
+      for( integer ip = 0; ip < numPhase; ++ip )
+      {
+        for( integer ic = 0; ic < numComp; ++ic )
+        {
+          for( integer idof = 0; idof < numDof; ++idof )
+          {
+            m_phaseCompFraction.derivsFloat[k][q][ip][ic][idof] = static_cast< real32 >( dPhaseCompFraction[0][0][ip][ic][idof] );
+          }
+        }
+      }
+    }
+
     /**
      * @brief Extract the phase mole fractions for a phase
      * @param i Element index
@@ -594,6 +696,7 @@ private:
      * @param[inout] dPhaseVisc the derivatives of phase viscosities wrt pressure, temperature, and comp fractions
      * @param[inout] dPhaseEnthalpy the derivatives of phase enthalpy wrt pressure, temperature, and comp fractions
      * @param[inout] dPhaseInternalEnergy the derivatives of phase internal energy wrt pressure, temperature, and comp fractions
+     * @note The enthalpy and internal energy derivatives are skipped if they are not stored (non-thermal fluids)
      */
     template< integer maxNumComp >
     GEOS_HOST_DEVICE
@@ -646,6 +749,9 @@ private:
                          real64 const pressure,
                          real64 const temperature,
                          arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & composition ) const = 0;
+
+    /// Whether the wrapper has an update< NC >() specialized for the number of components, see fluidComponentCountSwitch
+    static constexpr bool specializesComponentCount = false;
   };
 
 private:
@@ -674,6 +780,9 @@ protected:
   /// Enable an error when checkTableParameters() is called and the input pressure or temperature of the PVT tables is out of range
   integer m_checkPVTTablesRanges;
 
+  /// Flag to store the derivatives of the phase component fractions in single precision
+  integer m_useFloatPhaseCompFractionDerivatives;
+
   // general fluid composition information
 
   array1d< string > m_componentNames;
@@ -1001,8 +1110,11 @@ MultiFluidBase::KernelWrapper::
     applyChainRuleInPlace( numComp, dCompMoleFrac_dCompMassFrac, phaseFrac.derivs[ip], work, Deriv::dC );
     applyChainRuleInPlace( numComp, dCompMoleFrac_dCompMassFrac, dPhaseDens[ip], work, Deriv::dC );
     applyChainRuleInPlace( numComp, dCompMoleFrac_dCompMassFrac, dPhaseVisc[ip], work, Deriv::dC );
-    applyChainRuleInPlace( numComp, dCompMoleFrac_dCompMassFrac, dPhaseEnthalpy[ip], work, Deriv::dC );
-    applyChainRuleInPlace( numComp, dCompMoleFrac_dCompMassFrac, dPhaseInternalEnergy[ip], work, Deriv::dC );
+    if( dPhaseEnthalpy.size( 1 ) > 0 )
+    {
+      applyChainRuleInPlace( numComp, dCompMoleFrac_dCompMassFrac, dPhaseEnthalpy[ip], work, Deriv::dC );
+      applyChainRuleInPlace( numComp, dCompMoleFrac_dCompMassFrac, dPhaseInternalEnergy[ip], work, Deriv::dC );
+    }
 
     for( integer ic = 0; ic < numComp; ++ic )
     {
@@ -1159,6 +1271,61 @@ MultiFluidBase::KernelWrapper::
   }
 }
 
+/**
+ * @brief Call a lambda with the number of components of a fluid as a compile-time constant.
+ * @tparam FLUIDWRAPPER the type of the fluid kernel wrapper
+ * @tparam LAMBDA the type of the lambda
+ * @param[in] fluidWrapper the fluid kernel wrapper
+ * @param[in] lambda the lambda, taking a @c std::integral_constant holding the number of components
+ *
+ * To be called on the host, once per kernel launch, with a lambda launching the kernel and updating the fluid
+ * with updateFluid(). The lambda receives 0 if the fluid has no update specialized for the number of components.
+ */
+template< typename FLUIDWRAPPER, typename LAMBDA >
+void fluidComponentCountSwitch( FLUIDWRAPPER const & fluidWrapper,
+                                LAMBDA && lambda )
+{
+  if constexpr ( FLUIDWRAPPER::specializesComponentCount )
+  {
+    detail::componentCountSwitch( fluidWrapper.numComponents(), std::forward< LAMBDA >( lambda ) );
+  }
+  else
+  {
+    lambda( std::integral_constant< integer, 0 >() );
+  }
+}
+
+/**
+ * @brief Update the fluid properties in a cell, with the number of components given by fluidComponentCountSwitch.
+ * @tparam NC number of components if known at compile time, 0 otherwise
+ * @tparam FLUIDWRAPPER the type of the fluid kernel wrapper
+ * @param[in] fluidWrapper the fluid kernel wrapper
+ * @param[in] k index of the cell
+ * @param[in] q index of the quadrature point
+ * @param[in] pressure pressure in the cell
+ * @param[in] temperature temperature in the cell
+ * @param[in] composition mass/molar component fractions in the cell
+ */
+template< integer NC, typename FLUIDWRAPPER >
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+void updateFluid( FLUIDWRAPPER const & fluidWrapper,
+                  localIndex const k,
+                  localIndex const q,
+                  real64 const pressure,
+                  real64 const temperature,
+                  arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & composition )
+{
+  if constexpr ( 0 < NC )
+  {
+    fluidWrapper.template update< NC >( k, q, pressure, temperature, composition );
+  }
+  else
+  {
+    fluidWrapper.update( k, q, pressure, temperature, composition );
+  }
+}
+
 } //namespace constitutive
 
 } //namespace geos
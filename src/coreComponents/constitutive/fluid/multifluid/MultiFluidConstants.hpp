@@ -42,6 +42,13 @@ struct MultiFluidConstants
    */
   static constexpr integer MAX_NUM_PHASES = 4;
 
+  /**
+   * @brief Capacity of the per-component temporaries of kernels specialized for the number of components
+   * @tparam NC the number of components if known at compile time, 0 otherwise
+   */
+  template< integer NC >
+  static constexpr integer maxNumComponents = 0 < NC ? NC : MAX_NUM_COMPONENTS;
+
   /**
    * @brief Epsilon used in the calculations to check against zero
    */
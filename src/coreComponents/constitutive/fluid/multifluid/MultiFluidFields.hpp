@@ -38,6 +38,7 @@ using array3dLayoutPhase = array3d< real64, constitutive::multifluid::LAYOUT_PHA
 using array4dLayoutPhase_dC = array4d< real64, constitutive::multifluid::LAYOUT_PHASE_DC >;
 using array4dLayoutPhaseComp = array4d< real64, constitutive::multifluid::LAYOUT_PHASE_COMP >;
 using array5dLayoutPhaseComp_dC = array5d< real64, constitutive::multifluid::LAYOUT_PHASE_COMP_DC >;
+using array5dLayoutPhaseComp_dC_float = array5d< real32, constitutive::multifluid::LAYOUT_PHASE_COMP_DC >;
 
 DECLARE_FIELD( phaseFraction,
                "phaseFraction",
@@ -183,6 +184,15 @@ DECLARE_FIELD( dPhaseCompFraction,
                NO_WRITE,
                "Derivative of phase component fraction with respect to pressure, temperature, and global component fractions" );
 
+DECLARE_FIELD( dPhaseCompFraction_float,
+               "dPhaseCompFraction_float",
+               array5dLayoutPhaseComp_dC_float,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Derivative of phase component fraction with respect to pressure, temperature, and global component fractions, "
+               "stored in single precision" );
+
 DECLARE_FIELD( totalDensity,
                "totalDensity",
                array2dLayoutFluid,
@@ -20,6 +20,10 @@
 #define GEOS_CONSTITUTIVE_FLUID_MULTIFLUID_MULTIFLUIDUTILS_HPP_
 
 #include "common/DataTypes.hpp"
+#include "constitutive/fluid/multifluid/Layouts.hpp"
+#include "constitutive/fluid/multifluid/MultiFluidConstants.hpp"
+
+#include <type_traits>
 
 namespace geos
 {
@@ -141,6 +145,110 @@ struct MultiFluidVar
   }
 };
 
+/**
+ * @brief Read-only view of derivatives stored either in double precision or in single precision.
+ * @tparam DOUBLE_VIEW type of the view (or slice) of the derivatives stored in double precision
+ * @tparam SINGLE_VIEW type of the view (or slice) of the derivatives stored in single precision
+ *
+ * Both views have the same shape, except for the last dimension which is empty in the view that is not used.
+ * The view is indexed like the underlying views, and the derivatives are read in double precision.
+ */
+template< typename DOUBLE_VIEW, typename SINGLE_VIEW >
+class MixedPrecisionView
+{
+public:
+
+  /// Default constructor
+  MixedPrecisionView() = default;
+
+  /**
+   * @brief Constructor
+   * @param[in] doubleView the view of the derivatives stored in double precision
+   * @param[in] singleView the view of the derivatives stored in single precision
+   */
+  GEOS_HOST_DEVICE
+  MixedPrecisionView( DOUBLE_VIEW doubleView,
+                      SINGLE_VIEW singleView ):
+    m_doubleView( doubleView ),
+    m_singleView( singleView )
+  {}
+
+  /**
+   * @brief Access the sub-view at the given index of the first dimension, or the derivative in the last dimension.
+   * @param[in] i the index
+   * @return the view of the next dimensions, or the value of the derivative
+   */
+  GEOS_HOST_DEVICE
+  auto operator[]( localIndex const i ) const
+  {
+    using DoubleValueType = std::remove_cv_t< std::remove_reference_t< decltype( m_doubleView[i] ) > >;
+    if constexpr ( std::is_arithmetic< DoubleValueType >::value )
+    {
+      return m_doubleView.size() > 0 ? m_doubleView[i] : static_cast< real64 >( m_singleView[i] );
+    }
+    else
+    {
+      // the sub-views are stored by value, the accessors of several subregions return references
+      return MixedPrecisionView< std::remove_cv_t< std::remove_reference_t< decltype( m_doubleView[i] ) > >,
+                                 std::remove_cv_t< std::remove_reference_t< decltype( m_singleView[i] ) > > >( m_doubleView[i], m_singleView[i] );
+    }
+  }
+
+  /**
+   * @brief Access a derivative.
+   * @tparam INDICES the types of the remaining indices
+   * @param[in] i the index in the first dimension
+   * @param[in] indices the indices in the remaining dimensions
+   * @return the value of the derivative
+   */
+  template< typename ... INDICES >
+  GEOS_HOST_DEVICE
+  real64 operator()( localIndex const i, INDICES const ... indices ) const
+  {
+    if constexpr ( sizeof...( INDICES ) == 0 )
+    {
+      return (*this)[i];
+    }
+    else
+    {
+      return (*this)[i]( indices ... );
+    }
+  }
+
+private:
+
+  /// View of the derivatives stored in double precision
+  DOUBLE_VIEW m_doubleView;
+
+  /// View of the derivatives stored in single precision
+  SINGLE_VIEW m_singleView;
+};
+
+namespace multifluid
+{
+
+/// View of the derivatives of the phase component fractions of a fluid model
+using PhaseCompDerivsView = MixedPrecisionView< arrayView5d< real64 const, USD_PHASE_COMP_DC >,
+                                                arrayView5d< real32 const, USD_PHASE_COMP_DC > >;
+
+/// Slice of the derivatives of the phase component fractions at one point
+using PhaseCompDerivsSlice = MixedPrecisionView< arraySlice3d< real64 const, USD_PHASE_COMP_DC - 2 >,
+                                                 arraySlice3d< real32 const, USD_PHASE_COMP_DC - 2 > >;
+
+/// Slice of the derivatives of the phase component fractions of one phase at one point
+using PhaseCompDerivsPhaseSlice = MixedPrecisionView< arraySlice2d< real64 const, USD_PHASE_COMP_DC - 3 >,
+                                                      arraySlice2d< real32 const, USD_PHASE_COMP_DC - 3 > >;
+
+/**
+ * @brief Accessor to the derivatives of the phase component fractions of the fluid models of several subregions
+ * @tparam ELEMENT_VIEW the accessor template, e.g. ElementRegionManager::ElementViewConst
+ */
+template< template< typename > class ELEMENT_VIEW >
+using PhaseCompDerivsAccessor = MixedPrecisionView< ELEMENT_VIEW< arrayView5d< real64 const, USD_PHASE_COMP_DC > >,
+                                                    ELEMENT_VIEW< arrayView5d< real32 const, USD_PHASE_COMP_DC > > >;
+
+} // namespace multifluid
+
 namespace detail
 {
 /**
@@ -175,6 +283,45 @@ void convertToMoleFractions( integer numComponents,
   }
 }
 
+/**
+ * @brief Call a lambda with the number of components as a compile-time constant.
+ * @tparam LAMBDA the type of the lambda
+ * @param[in] numComps the number of components
+ * @param[in] lambda the lambda, taking a @c std::integral_constant holding the number of components
+ *
+ * The lambda receives 0 if @p numComps has no specialization, in which case the number of components
+ * must be taken from the runtime value and temporaries sized with MultiFluidConstants::MAX_NUM_COMPONENTS.
+ */
+template< typename LAMBDA >
+GEOS_HOST_DEVICE
+inline
+void componentCountSwitch( integer const numComps,
+                           LAMBDA && lambda )
+{
+  static_assert( MultiFluidConstants::MAX_NUM_COMPONENTS == 9, "Update the specializations below" );
+  switch( numComps )
+  {
+    case 2:
+    { lambda( std::integral_constant< integer, 2 >() ); return; }
+    case 3:
+    { lambda( std::integral_constant< integer, 3 >() ); return; }
+    case 4:
+    { lambda( std::integral_constant< integer, 4 >() ); return; }
+    case 5:
+    { lambda( std::integral_constant< integer, 5 >() ); return; }
+    case 6:
+    { lambda( std::integral_constant< integer, 6 >() ); return; }
+    case 7:
+    { lambda( std::integral_constant< integer, 7 >() ); return; }
+    case 8:
+    { lambda( std::integral_constant< integer, 8 >() ); return; }
+    case 9:
+    { lambda( std::integral_constant< integer, 9 >() ); return; }
+    default:
+    { lambda( std::integral_constant< integer, 0 >() ); return; }
+  }
+}
+
 } // namespace detail
 
 } // namespace constitutive
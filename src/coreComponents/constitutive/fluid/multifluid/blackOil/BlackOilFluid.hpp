@@ -939,17 +939,20 @@ BlackOilFluid::KernelWrapper::
           real64 const temperature,
           arraySlice1d< geos::real64 const, compflow::USD_COMP - 1 > const & composition ) const
 {
-  compute( pressure,
-           temperature,
-           composition,
-           m_phaseFraction( k, q ),
-           m_phaseDensity( k, q ),
-           m_phaseMassDensity( k, q ),
-           m_phaseViscosity( k, q ),
-           m_phaseEnthalpy( k, q ),
-           m_phaseInternalEnergy( k, q ),
-           m_phaseCompFraction( k, q ),
-           m_totalDensity( k, q ) );
+  computePhaseCompFraction( k, q, [&]( PhaseComp::SliceType const phaseCompFraction )
+  {
+    compute( pressure,
+             temperature,
+             composition,
+             m_phaseFraction( k, q ),
+             m_phaseDensity( k, q ),
+             m_phaseMassDensity( k, q ),
+             m_phaseViscosity( k, q ),
+             m_phaseEnthalpy( k, q ),
+             m_phaseInternalEnergy( k, q ),
+             phaseCompFraction,
+             m_totalDensity( k, q ) );
+  } );
 }
 
 } // namespace constitutive
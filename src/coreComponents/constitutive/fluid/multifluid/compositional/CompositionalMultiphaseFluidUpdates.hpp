@@ -78,7 +78,28 @@ public:
                        real64 const temperature,
                        arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & composition ) const override;
 
+  /// The update can be specialized for the number of components, see fluidComponentCountSwitch
+  static constexpr bool specializesComponentCount = true;
+
+  /**
+   * @brief Update function specialized for the number of components
+   * @tparam NC number of components if known at compile time, 0 otherwise
+   * @param[in] k index of the cell
+   * @param[in] q index of the quadrature point
+   * @param[in] pressure pressure in the cell
+   * @param[in] temperature temperature in the cell
+   * @param[in] composition mass/molar component fractions in the cell
+   */
+  template< integer NC >
+  GEOS_HOST_DEVICE
+  void update( localIndex const k,
+               localIndex const q,
+               real64 const pressure,
+               real64 const temperature,
+               arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & composition ) const;
+
 protected:
+  template< integer NC >
   GEOS_HOST_DEVICE
   void compute( real64 const pressure,
                 real64 const temperature,
@@ -190,21 +211,22 @@ CompositionalMultiphaseFluidUpdates< FLASH, PHASE1, PHASE2, PHASE3 >::compute(
 
   LvArray::forValuesInSlice( kValues[0][0], setZero );   // Force initialisation of k-Values
 
-  compute( pressure,
-           temperature,
-           composition,
-           phaseFrac,
-           phaseDens,
-           phaseMassDensity,
-           phaseVisc,
-           phaseEnthalpy,
-           phaseInternalEnergy,
-           phaseCompFrac,
-           totalDensity,
-           kValues[0][0] );
+  compute< 0 >( pressure,
+                temperature,
+                composition,
+                phaseFrac,
+                phaseDens,
+                phaseMassDensity,
+                phaseVisc,
+                phaseEnthalpy,
+                phaseInternalEnergy,
+                phaseCompFrac,
+                totalDensity,
+                kValues[0][0] );
 }
 
 template< typename FLASH, typename PHASE1, typename PHASE2, typename PHASE3 >
+template< integer NC >
 GEOS_HOST_DEVICE
 GEOS_FORCE_INLINE
 void
@@ -250,44 +272,44 @@ CompositionalMultiphaseFluidUpdates< FLASH, PHASE1, PHASE2, PHASE3 >::compute(
   }
 
   // 2. Compute phase fractions and phase component fractions
-  m_flash.compute( m_componentProperties,
-                   pressure,
-                   temperature,
-                   compMoleFrac.toSliceConst(),
-                   kValues,
-                   phaseFrac,
-                   phaseCompFrac );
+  m_flash.template compute< NC >( m_componentProperties,
+                                  pressure,
+                                  temperature,
+                                  compMoleFrac.toSliceConst(),
+                                  kValues,
+                                  phaseFrac,
+                                  phaseCompFrac );
 
   // 3. Calculate the phase densities
-  m_phase1.density.compute( m_componentProperties,
-                            pressure,
-                            temperature,
-                            phaseCompFrac.value[0].toSliceConst(),
-                            phaseDens.value[0],
-                            phaseDens.derivs[0],
-                            phaseMassDensity.value[0],
-                            phaseMassDensity.derivs[0],
-                            m_useMass );
-  m_phase2.density.compute( m_componentProperties,
-                            pressure,
-                            temperature,
-                            phaseCompFrac.value[1].toSliceConst(),
-                            phaseDens.value[1],
-                            phaseDens.derivs[1],
-                            phaseMassDensity.value[1],
-                            phaseMassDensity.derivs[1],
-                            m_useMass );
+  m_phase1.density.template compute< NC >( m_componentProperties,
+                                           pressure,
+                                           temperature,
+                                           phaseCompFrac.value[0].toSliceConst(),
+                                           phaseDens.value[0],
+                                           phaseDens.derivs[0],
+                                           phaseMassDensity.value[0],
+                                           phaseMassDensity.derivs[0],
+                                           m_useMass );
+  m_phase2.density.template compute< NC >( m_componentProperties,
+                                           pressure,
+                                           temperature,
+                                           phaseCompFrac.value[1].toSliceConst(),
+                                           phaseDens.value[1],
+                                           phaseDens.derivs[1],
+                                           phaseMassDensity.value[1],
+                                           phaseMassDensity.derivs[1],
+                                           m_useMass );
   if constexpr (2 < FLASH::KernelWrapper::getNumberOfPhases())
   {
-    m_phase3.density.compute( m_componentProperties,
-                              pressure,
-                              temperature,
-                              phaseCompFrac.value[2].toSliceConst(),
-                              phaseDens.value[2],
-                              phaseDens.derivs[2],
-                              phaseMassDensity.value[2],
-                              phaseMassDensity.derivs[2],
-                              m_useMass );
+    m_phase3.density.template compute< NC >( m_componentProperties,
+                                             pressure,
+                                             temperature,
+                                             phaseCompFrac.value[2].toSliceConst(),
+                                             phaseDens.value[2],
+                                             phaseDens.derivs[2],
+                                             phaseMassDensity.value[2],
+                                             phaseMassDensity.derivs[2],
+                                             m_useMass );
   }
 
   // 4. Calculate the phase viscosities
@@ -397,18 +419,36 @@ update( localIndex const k,
         real64 const temperature,
         arraySlice1d< geos::real64 const, compflow::USD_COMP - 1 > const & composition ) const
 {
-  compute( pressure,
-           temperature,
-           composition,
-           m_phaseFraction( k, q ),
-           m_phaseDensity( k, q ),
-           m_phaseMassDensity( k, q ),
-           m_phaseViscosity( k, q ),
-           m_phaseEnthalpy( k, q ),
-           m_phaseInternalEnergy( k, q ),
-           m_phaseCompFraction( k, q ),
-           m_totalDensity( k, q ),
-           m_kValues[k][q] );
+  update< 0 >( k, q, pressure, temperature, composition );
+}
+
+template< typename FLASH, typename PHASE1, typename PHASE2, typename PHASE3 >
+template< integer NC >
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+void
+CompositionalMultiphaseFluidUpdates< FLASH, PHASE1, PHASE2, PHASE3 >::
+update( localIndex const k,
+        localIndex const q,
+        real64 const pressure,
+        real64 const temperature,
+        arraySlice1d< geos::real64 const, compflow::USD_COMP - 1 > const & composition ) const
+{
+  computePhaseCompFraction( k, q, [&]( MultiFluidBase::PhaseComp::SliceType const phaseCompFraction )
+  {
+    compute< NC >( pressure,
+                   temperature,
+                   composition,
+                   m_phaseFraction( k, q ),
+                   m_phaseDensity( k, q ),
+                   m_phaseMassDensity( k, q ),
+                   m_phaseViscosity( k, q ),
+                   m_phaseEnthalpy( k, q ),
+                   m_phaseInternalEnergy( k, q ),
+                   phaseCompFraction,
+                   m_totalDensity( k, q ),
+                   m_kValues[k][q] );
+  } );
 }
 
 template< typename FLASH, typename PHASE1, typename PHASE2, typename PHASE3 >
@@ -86,6 +86,7 @@ public:
   /**
    * @brief Main entry point of the cubic EOS model
    * @details Computes the logarithm of the fugacity coefficients
+   * @tparam NC number of components if known at compile time, 0 otherwise
    * @param[in] numComps number of components
    * @param[in] pressure pressure
    * @param[in] temperature temperature
@@ -93,7 +94,7 @@ public:
    * @param[in] componentProperties The compositional component properties
    * @param[out] logFugacityCoefficients log of the fugacity coefficients
    */
-  template< integer USD >
+  template< integer NC = 0, integer USD >
   GEOS_HOST_DEVICE
   GEOS_FORCE_INLINE
   static void
@@ -107,6 +108,7 @@ public:
   /**
    * @brief Secondary entry point of the cubic EOS model
    * @details Computes the derivatives of the logarithm of the fugacity coefficients
+   * @tparam NC number of components if known at compile time, 0 otherwise
    * @param[in] numComps number of components
    * @param[in] pressure pressure
    * @param[in] temperature temperature
@@ -115,7 +117,7 @@ public:
    * @param[in] logFugacityCoefficients log of the fugacity coefficients
    * @param[out] logFugacityCoefficientDerivs derivatives of the log of the fugacity coefficients
    */
-  template< integer USD >
+  template< integer NC = 0, integer USD >
   GEOS_HOST_DEVICE
   GEOS_FORCE_INLINE
   static void
@@ -130,6 +132,7 @@ public:
   /**
    * @brief Compute compressibility factor for the cubic EOS model
    * @details Computes the compressibility factor (z-factor) for the cubic EOS model including derivatives
+   * @tparam NC number of components if known at compile time, 0 otherwise
    * @param[in] numComps number of components
    * @param[in] pressure pressure
    * @param[in] temperature temperature
@@ -138,7 +141,7 @@ public:
    * @param[out] compressibilityFactor the current compressibility factor
    * @param[out] compressibilityFactorDerivs derivatives of the compressibility factor
    */
-  template< integer USD >
+  template< integer NC = 0, integer USD >
   GEOS_HOST_DEVICE
   GEOS_FORCE_INLINE
   static void
@@ -237,6 +240,7 @@ public:
 
   /**
    * @brief Compute the mixture coefficients derivatives
+   * @tparam NC number of components if known at compile time, 0 otherwise
    * @param[in] numComps number of components
    * @param[in] pressure pressure
    * @param[in] temperature temperature
@@ -250,7 +254,7 @@ public:
    * @param[out] bMixtureCoefficientDerivs derivatives of mixture coefficient (B)
    * @note Assumes that pressure and temperature are strictly positive
    */
-  template< integer USD >
+  template< integer NC = 0, integer USD >
   GEOS_HOST_DEVICE
   GEOS_FORCE_INLINE
   static void
@@ -267,12 +271,9 @@ public:
                               arraySlice1d< real64 > const & bMixtureCoefficientDerivs );
 
   /**
-   * @brief Compute the compressibility factor using compositions, BICs, and mixture coefficients
+   * @brief Compute the compressibility factor using compositions and mixture coefficients
    * @param[in] numComps number of components
    * @param[in] composition composition of the phase
-   * @param[in] binaryInteractionCoefficients binary coefficients (currently not implemented)
-   * @param[in] aPureCoefficient pure coefficient (A)
-   * @param[in] bPureCoefficient pure coefficient (B)
    * @param[in] aMixtureCoefficient mixture coefficient (A)
    * @param[in] bMixtureCoefficient mixture coefficient (B)
    * @param[out] compressibilityFactor compressibility factor
@@ -283,9 +284,6 @@ public:
   static void
   computeCompressibilityFactor( integer const numComps,
                                 arraySlice1d< real64 const, USD > const & composition,
-                                arraySlice2d< real64 const > const & binaryInteractionCoefficients,
-                                arraySlice1d< real64 const > const & aPureCoefficient,
-                                arraySlice1d< real64 const > const & bPureCoefficient,
                                 real64 const & aMixtureCoefficient,
                                 real64 const & bMixtureCoefficient,
                                 real64 & compressibilityFactor );
@@ -314,6 +312,7 @@ public:
 
   /**
    * @brief Compute the log of the fugacity coefficients using compositions, BICs, compressibility factor and mixture coefficients
+   * @tparam NC number of components if known at compile time, 0 otherwise
    * @param[in] numComps number of components
    * @param[in] composition composition of the phase
    * @param[in] binaryInteractionCoefficients binary coefficients (currently not implemented)
@@ -324,7 +323,7 @@ public:
    * @param[in] bMixtureCoefficient mixture coefficient (B)
    * @param[out] logFugacityCoefficients log of the fugacity coefficients
    */
-  template< integer USD >
+  template< integer NC = 0, integer USD >
   GEOS_HOST_DEVICE
   GEOS_FORCE_INLINE
   static void
@@ -339,7 +338,7 @@ public:
                                   arraySlice1d< real64 > const & logFugacityCoefficients );
 
   /**
-   * @brief Helper functions solving a cubic equation using trigonometry
+   * @brief Helper functions solving a cubic equation using trigonometry, followed by a Newton step on each root
    *        m3 * x^3 + m2 * x^2 + m1 *x + m0  = 0
    * @param[in] m3 first coefficient (in front of x^3)
    * @param[in] m2 second coefficient (in front of x^2)
@@ -358,10 +357,28 @@ public:
                           real64 ( &roots )[3],
                           integer & numRoots );
 
+  /**
+   * @brief Compute the reduced Gibbs energy of a phase, up to terms independent of the compressibility factor
+   * @param[in] sumComposition sum of the composition of the phase
+   * @param[in] compressibilityFactor compressibility factor
+   * @param[in] aMixtureCoefficient mixture coefficient (A)
+   * @param[in] bMixtureCoefficient mixture coefficient (B)
+   * @return the composition-weighted sum of the log of the fugacity coefficients
+   * @note With the mixing rules of computeMixtureCoefficients, this is the sum of composition[ic] * logFugacityCoefficients[ic]
+   *       computed by computeLogFugacityCoefficients, evaluated at the cost of a single component
+   */
+  GEOS_HOST_DEVICE
+  GEOS_FORCE_INLINE
+  static real64
+  computeReducedGibbsEnergy( real64 const & sumComposition,
+                             real64 const & compressibilityFactor,
+                             real64 const & aMixtureCoefficient,
+                             real64 const & bMixtureCoefficient );
+
 };
 
 template< typename EOS_TYPE >
-template< integer USD >
+template< integer NC, integer USD >
 GEOS_HOST_DEVICE
 void
 CubicEOSPhaseModel< EOS_TYPE >::
@@ -373,8 +390,8 @@ computeLogFugacityCoefficients( integer const numComps,
                                 arraySlice1d< real64 > const & logFugacityCoefficients )
 {
   // step 0: allocate the stack memory needed for the update
-  stackArray1d< real64, MultiFluidConstants::MAX_NUM_COMPONENTS > aPureCoefficient( numComps );
-  stackArray1d< real64, MultiFluidConstants::MAX_NUM_COMPONENTS > bPureCoefficient( numComps );
+  stackArray1d< real64, MultiFluidConstants::maxNumComponents< NC > > aPureCoefficient( numComps );
+  stackArray1d< real64, MultiFluidConstants::maxNumComponents< NC > > bPureCoefficient( numComps );
   real64 aMixtureCoefficient = 0.0;
   real64 bMixtureCoefficient = 0.0;
   real64 compressibilityFactor = 0.0;
@@ -395,27 +412,24 @@ computeLogFugacityCoefficients( integer const numComps,
   // step 2: use mixture coefficients to update the compressibility factor
   computeCompressibilityFactor( numComps, // number of components
                                 composition, // cell input
-                                binaryInteractionCoefficients, // user input
-                                aPureCoefficient, // computed by computeMixtureCoefficients
-                                bPureCoefficient,
-                                aMixtureCoefficient,
+                                aMixtureCoefficient, // computed by computeMixtureCoefficients
                                 bMixtureCoefficient,
                                 compressibilityFactor ); // output
 
   // step 3: use mixture coefficients and compressibility factor to update fugacity coefficients
-  computeLogFugacityCoefficients( numComps, // number of components
-                                  composition, // cell input
-                                  binaryInteractionCoefficients, // user input
-                                  compressibilityFactor, // computed by computeCompressibilityFactor
-                                  aPureCoefficient, // computed by computeMixtureCoefficients
-                                  bPureCoefficient,
-                                  aMixtureCoefficient,
-                                  bMixtureCoefficient,
-                                  logFugacityCoefficients ); // output
+  computeLogFugacityCoefficients< NC >( numComps, // number of components
+                                        composition, // cell input
+                                        binaryInteractionCoefficients, // user input
+                                        compressibilityFactor, // computed by computeCompressibilityFactor
+                                        aPureCoefficient, // computed by computeMixtureCoefficients
+                                        bPureCoefficient,
+                                        aMixtureCoefficient,
+                                        bMixtureCoefficient,
+                                        logFugacityCoefficients ); // output
 }
 
 template< typename EOS_TYPE >
-template< integer USD >
+template< integer NC, integer USD >
 GEOS_HOST_DEVICE
 void
 CubicEOSPhaseModel< EOS_TYPE >::
@@ -427,8 +441,8 @@ computeLogFugacityCoefficients( integer const numComps,
                                 arraySlice1d< real64 const > const & logFugacityCoefficients,
                                 arraySlice2d< real64 > const & logFugacityCoefficientDerivs )
 {
-  integer constexpr numMaxComps = MultiFluidConstants::MAX_NUM_COMPONENTS;
-  integer constexpr numMaxDofs = MultiFluidConstants::MAX_NUM_COMPONENTS + 2;
+  integer constexpr numMaxComps = MultiFluidConstants::maxNumComponents< NC >;
+  integer constexpr numMaxDofs = MultiFluidConstants::maxNumComponents< NC > + 2;
   integer const numDofs = 2 + numComps;
 
   GEOS_UNUSED_VAR( logFugacityCoefficients );
@@ -473,25 +487,22 @@ computeLogFugacityCoefficients( integer const numComps,
   }
 
   // 1.3: Compute mixture coefficient derivatives
-  computeMixtureCoefficients( numComps,
-                              pressure,
-                              temperature,
-                              composition,
-                              componentProperties,
-                              aPureCoefficient,
-                              bPureCoefficient,
-                              aMixtureCoefficient,
-                              bMixtureCoefficient,
-                              aMixtureCoefficientDerivs,
-                              bMixtureCoefficientDerivs );
+  computeMixtureCoefficients< NC >( numComps,
+                                    pressure,
+                                    temperature,
+                                    composition,
+                                    componentProperties,
+                                    aPureCoefficient,
+                                    bPureCoefficient,
+                                    aMixtureCoefficient,
+                                    bMixtureCoefficient,
+                                    aMixtureCoefficientDerivs,
+                                    bMixtureCoefficientDerivs );
 
   // 2.1: Update the compressibility factor
   computeCompressibilityFactor( numComps, // number of components
                                 composition, // cell input
-                                binaryInteractionCoefficients, // user input
-                                aPureCoefficient, // computed by computeMixtureCoefficients
-                                bPureCoefficient,
-                                aMixtureCoefficient,
+                                aMixtureCoefficient, // computed by computeMixtureCoefficients
                                 bMixtureCoefficient,
                                 compressibilityFactor ); // output
   // 2.2: Update the compressibility factor derivatives
@@ -570,7 +581,7 @@ computeLogFugacityCoefficients( integer const numComps,
 }
 
 template< typename EOS_TYPE >
-template< integer USD >
+template< integer NC, integer USD >
 GEOS_HOST_DEVICE
 void
 CubicEOSPhaseModel< EOS_TYPE >::
@@ -583,8 +594,8 @@ computeCompressibilityFactor( integer const numComps,
                               arraySlice1d< real64 > const & compressibilityFactorDerivs )
 {
   // step 0: allocate the stack memory needed for the update
-  integer constexpr numMaxComps = MultiFluidConstants::MAX_NUM_COMPONENTS;
-  integer constexpr numMaxDofs = MultiFluidConstants::MAX_NUM_COMPONENTS + 2;
+  integer constexpr numMaxComps = MultiFluidConstants::maxNumComponents< NC >;
+  integer constexpr numMaxDofs = MultiFluidConstants::maxNumComponents< NC > + 2;
   integer const numDofs = 2 + numComps;
 
   stackArray1d< real64, numMaxComps > aPureCoefficient( numComps );
@@ -594,8 +605,6 @@ computeCompressibilityFactor( integer const numComps,
   stackArray1d< real64, numMaxDofs > aMixtureCoefficientDerivs( numDofs );
   stackArray1d< real64, numMaxDofs > bMixtureCoefficientDerivs( numDofs );
 
-  arraySlice2d< real64 const > const & binaryInteractionCoefficients = componentProperties.m_componentBinaryCoeff;
-
   // step 1: compute the mixture coefficients aPureCoefficient, bPureCoefficient, aMixtureCoefficient, bMixtureCoefficient
   // 1.1: Compute the pure and mixture coefficients
   computeMixtureCoefficients( numComps, // number of components
@@ -609,25 +618,22 @@ computeCompressibilityFactor( integer const numComps,
                               bMixtureCoefficient );
 
   // 1.2: Compute mixture coefficient derivatives
-  computeMixtureCoefficients( numComps,
-                              pressure,
-                              temperature,
-                              composition,
-                              componentProperties,
-                              aPureCoefficient,
-                              bPureCoefficient,
-                              aMixtureCoefficient,
-                              bMixtureCoefficient,
-                              aMixtureCoefficientDerivs,
-                              bMixtureCoefficientDerivs );
+  computeMixtureCoefficients< NC >( numComps,
+                                    pressure,
+                                    temperature,
+                                    composition,
+                                    componentProperties,
+                                    aPureCoefficient,
+                                    bPureCoefficient,
+                                    aMixtureCoefficient,
+                                    bMixtureCoefficient,
+                                    aMixtureCoefficientDerivs,
+                                    bMixtureCoefficientDerivs );
 
   // 2.1: Update the compressibility factor
   computeCompressibilityFactor( numComps, // number of components
                                 composition, // cell input
-                                binaryInteractionCoefficients, // user input
-                                aPureCoefficient, // computed by computeMixtureCoefficients
-                                bPureCoefficient,
-                                aMixtureCoefficient,
+                                aMixtureCoefficient, // computed by computeMixtureCoefficients
                                 bMixtureCoefficient,
                                 compressibilityFactor ); // output
 
@@ -758,7 +764,7 @@ computeMixtureCoefficients( integer const numComps,
 }
 
 template< typename EOS_TYPE >
-template< integer USD >
+template< integer NC, integer USD >
 GEOS_HOST_DEVICE
 void
 CubicEOSPhaseModel< EOS_TYPE >::
@@ -784,7 +790,7 @@ computeMixtureCoefficients( integer const numComps,
   real64 aCoefficient = 0.0;
   real64 bCoefficient = 0.0;
   real64 dummy = 0.0;
-  stackArray1d< real64, MultiFluidConstants::MAX_NUM_COMPONENTS > daPureCoefficient_dt( numComps );
+  stackArray1d< real64, MultiFluidConstants::maxNumComponents< NC > > daPureCoefficient_dt( numComps );
   for( integer ic = 0; ic < numComps; ++ic )
   {
     computePureCoefficients( ic, pressure, temperature, componentProperties,
@@ -827,9 +833,6 @@ void
 CubicEOSPhaseModel< EOS_TYPE >::
 computeCompressibilityFactor( integer const numComps,
                               arraySlice1d< real64 const, USD > const & composition,
-                              arraySlice2d< real64 const > const & binaryInteractionCoefficients,
-                              arraySlice1d< real64 const > const & aPureCoefficient,
-                              arraySlice1d< real64 const > const & bPureCoefficient,
                               real64 const & aMixtureCoefficient,
                               real64 const & bMixtureCoefficient,
                               real64 & compressibilityFactor )
@@ -858,34 +861,21 @@ computeCompressibilityFactor( integer const numComps,
     for( integer i = 0; i < 3; ++i )
     {
       // skip unphysical roots
-      if( roots[i] > bMixtureCoefficient )
-      {
-        // choose the root according to Gibbs' free energy minimization
-        if( zMin > roots[i] )
-        {
-          zMin = roots[i];
-        }
-        if( zMax < roots[i] )
-        {
-          zMax = roots[i];
-        }
-      }
+      bool const isPhysical = roots[i] > bMixtureCoefficient;
+      zMin = ( isPhysical && roots[i] < zMin ) ? roots[i] : zMin;
+      zMax = ( isPhysical && roots[i] > zMax ) ? roots[i] : zMax;
     }
 
-    stackArray1d< real64, MultiFluidConstants::MAX_NUM_COMPONENTS > logFugacityCoefficientsMax( numComps );
-    stackArray1d< real64, MultiFluidConstants::MAX_NUM_COMPONENTS > logFugacityCoefficientsMin( numComps );
-    computeLogFugacityCoefficients( numComps, composition, binaryInteractionCoefficients, zMin,
-                                    aPureCoefficient, bPureCoefficient, aMixtureCoefficient, bMixtureCoefficient,
-                                    logFugacityCoefficientsMin.toSlice() );
-    computeLogFugacityCoefficients( numComps, composition, binaryInteractionCoefficients, zMax,
-                                    aPureCoefficient, bPureCoefficient, aMixtureCoefficient, bMixtureCoefficient,
-                                    logFugacityCoefficientsMax.toSlice() );
-
-    real64 dG = 0.0;
+    // choose the root according to Gibbs' free energy minimization
+    // The BIC-weighted sums of the fugacity coefficients reduce to the mixture coefficients,
+    // so the comparison does not need the fugacity coefficients of each component
+    real64 sumComposition = 0.0;
     for( integer ic = 0; ic < numComps; ++ic )
     {
-      dG += composition[ic] * ( logFugacityCoefficientsMin[ic] - logFugacityCoefficientsMax[ic] );
+      sumComposition += composition[ic];
     }
+    real64 const dG = computeReducedGibbsEnergy( sumComposition, zMin, aMixtureCoefficient, bMixtureCoefficient )
+                      - computeReducedGibbsEnergy( sumComposition, zMax, aMixtureCoefficient, bMixtureCoefficient );
     compressibilityFactor = ( dG < 0 ) ? zMin : zMax;
   }
 }
@@ -933,7 +923,7 @@ computeCompressibilityFactor( integer const numComps,
 }
 
 template< typename EOS_TYPE >
-template< integer USD >
+template< integer NC, integer USD >
 GEOS_HOST_DEVICE
 void
 CubicEOSPhaseModel< EOS_TYPE >::
@@ -947,7 +937,7 @@ computeLogFugacityCoefficients( integer const numComps,
                                 real64 const & bMixtureCoefficient,
                                 arraySlice1d< real64 > const & logFugacityCoefficients )
 {
-  stackArray1d< real64, MultiFluidConstants::MAX_NUM_COMPONENTS > ki( numComps );
+  stackArray1d< real64, MultiFluidConstants::maxNumComponents< NC > > ki( numComps );
 
   // ki
   for( integer ic = 0; ic < numComps; ++ic )
@@ -1020,6 +1010,44 @@ solveCubicPolynomial( real64 const & m3,
     roots[0] = ( e + q / e ) - a1 / 3.;
     numRoots = 1;
   }
+
+  // polish the roots with a Newton step, as the trigonometric and Cardano formulas lose accuracy
+  // when roots are close to each other. The step is rejected if it does not reduce the residual,
+  // which happens close to an extremum of the polynomial
+  for( integer i = 0; i < numRoots; ++i )
+  {
+    real64 const x = roots[i];
+    real64 const f = ( ( x + a1 ) * x + a2 ) * x + a3;
+    real64 const df = ( 3.0 * x + 2.0 * a1 ) * x + a2;
+    if( MultiFluidConstants::epsilon < LvArray::math::abs( df ) )
+    {
+      real64 const xNew = x - f / df;
+      real64 const fNew = ( ( xNew + a1 ) * xNew + a2 ) * xNew + a3;
+      roots[i] = ( LvArray::math::abs( fNew ) < LvArray::math::abs( f ) ) ? xNew : x;
+    }
+  }
+}
+
+template< typename EOS_TYPE >
+GEOS_HOST_DEVICE
+real64
+CubicEOSPhaseModel< EOS_TYPE >::
+computeReducedGibbsEnergy( real64 const & sumComposition,
+                           real64 const & compressibilityFactor,
+                           real64 const & aMixtureCoefficient,
+                           real64 const & bMixtureCoefficient )
+{
+  real64 const expE = ( compressibilityFactor + EOS_TYPE::delta1 * bMixtureCoefficient ) /
+                      ( compressibilityFactor + EOS_TYPE::delta2 * bMixtureCoefficient );
+  real64 const expF = compressibilityFactor - bMixtureCoefficient;
+  GEOS_ERROR_IF( expE < MultiFluidConstants::epsilon || expF < MultiFluidConstants::epsilon,
+                 GEOS_FMT( "Cubic EOS failed with exp(E)={} and exp(F)={}", expE, expF ));
+  real64 const E = log( expE );
+  real64 const F = log( expF );
+  real64 const G = 1.0 / ( ( EOS_TYPE::delta1 - EOS_TYPE::delta2 ) * bMixtureCoefficient );
+
+  // sum_i x_i B_i = 1 and sum_i x_i k_i = A with the mixing rules of computeMixtureCoefficients
+  return ( compressibilityFactor - 1 ) - sumComposition * F - G * aMixtureCoefficient * E;
 }
 
 using CubicEOSPR = CubicEOSPhaseModel< PengRobinsonEOS >;
@@ -37,6 +37,7 @@ struct FugacityCalculator
 {
   /**
    * @brief Calculate the log fugacity for a phase
+   * @tparam NC number of components if known at compile time, 0 otherwise
    * @param[in] numComps number of components
    * @param[in] pressure pressure
    * @param[in] temperature temperature
@@ -45,7 +46,7 @@ struct FugacityCalculator
    * @param[in] equationOfState The equation of state
    * @param[out] logFugacity the calculated log fugacity
    */
-  template< int USD >
+  template< integer NC = 0, int USD >
   GEOS_HOST_DEVICE
   static void computeLogFugacity( integer const numComps,
                                   real64 const pressure,
@@ -57,6 +58,7 @@ struct FugacityCalculator
 
   /**
    * @brief Calculate the derivatives for the log fugacity for a phase
+   * @tparam NC number of components if known at compile time, 0 otherwise
    * @param[in] numComps number of components
    * @param[in] pressure pressure
    * @param[in] temperature temperature
@@ -66,7 +68,7 @@ struct FugacityCalculator
    * @param[in] logFugacity the calculated log fugacity
    * @param[out] logFugacityDerivs the calculated derivatives of the log fugacity
    */
-  template< int USD1, int USD2 >
+  template< integer NC = 0, int USD1, int USD2 >
   GEOS_HOST_DEVICE
   static void computeLogFugacityDerivatives( integer const numComps,
                                              real64 const pressure,
@@ -78,7 +80,7 @@ struct FugacityCalculator
                                              arraySlice2d< real64, USD2 > const & logFugacityDerivs );
 };
 
-template< int USD >
+template< integer NC, int USD >
 GEOS_HOST_DEVICE
 void FugacityCalculator::computeLogFugacity( integer const numComps,
                                              real64 const pressure,
@@ -91,26 +93,26 @@ void FugacityCalculator::computeLogFugacity( integer const numComps,
   if( equationOfState == EquationOfStateType::PengRobinson )
   {
     CubicEOSPhaseModel< PengRobinsonEOS >::
-    computeLogFugacityCoefficients( numComps,
-                                    pressure,
-                                    temperature,
-                                    composition,
-                                    componentProperties,
-                                    logFugacity );
+    computeLogFugacityCoefficients< NC >( numComps,
+                                          pressure,
+                                          temperature,
+                                          composition,
+                                          componentProperties,
+                                          logFugacity );
   }
   else if( equationOfState == EquationOfStateType::SoaveRedlichKwong )
   {
     CubicEOSPhaseModel< SoaveRedlichKwongEOS >::
-    computeLogFugacityCoefficients( numComps,
-                                    pressure,
-                                    temperature,
-                                    composition,
-                                    componentProperties,
-                                    logFugacity );
+    computeLogFugacityCoefficients< NC >( numComps,
+                                          pressure,
+                                          temperature,
+                                          composition,
+                                          componentProperties,
+                                          logFugacity );
   }
 }
 
-template< int USD1, int USD2 >
+template< integer NC, int USD1, int USD2 >
 GEOS_HOST_DEVICE
 void FugacityCalculator::computeLogFugacityDerivatives( integer const numComps,
                                                         real64 const pressure,
@@ -124,24 +126,24 @@ void FugacityCalculator::computeLogFugacityDerivatives( integer const numComps,
   if( equationOfState == EquationOfStateType::PengRobinson )
   {
     CubicEOSPhaseModel< PengRobinsonEOS >::
-    computeLogFugacityCoefficients( numComps,
-                                    pressure,
-                                    temperature,
-                                    composition,
-                                    componentProperties,
-                                    logFugacity,
-                                    logFugacityDerivs );
+    computeLogFugacityCoefficients< NC >( numComps,
+                                          pressure,
+                                          temperature,
+                                          composition,
+                                          componentProperties,
+                                          logFugacity,
+                                          logFugacityDerivs );
   }
   else if( equationOfState == EquationOfStateType::SoaveRedlichKwong )
   {
     CubicEOSPhaseModel< SoaveRedlichKwongEOS >::
-    computeLogFugacityCoefficients( numComps,
-                                    pressure,
-                                    temperature,
-                                    composition,
-                                    componentProperties,
-                                    logFugacity,
-                                    logFugacityDerivs );
+    computeLogFugacityCoefficients< NC >( numComps,
+                                          pressure,
+                                          temperature,
+                                          composition,
+                                          componentProperties,
+                                          logFugacity,
+                                          logFugacityDerivs );
   }
 }
 
@@ -25,7 +25,7 @@
 #include "FugacityCalculator.hpp"
 #include "constitutive/fluid/multifluid/MultiFluidConstants.hpp"
 #include "constitutive/fluid/multifluid/compositional/models/ComponentProperties.hpp"
-#include "denseLinearAlgebra/interfaces/blaslapack/BlasLapackLA.hpp"
+#include "denseLinearAlgebra/denseLASolvers.hpp"
 
 namespace geos
 {
@@ -42,7 +42,8 @@ struct NegativeTwoPhaseFlash
 public:
   /**
    * @brief Perform negative two-phase EOS flash
-   * @param[in] numComps number of components
+   * @tparam NC number of components if known at compile time, 0 otherwise
+   * @param[in] numComponents number of components (equal to NC if NC > 0)
    * @param[in] pressure pressure
    * @param[in] temperature temperature
    * @param[in] composition composition of the mixture
@@ -55,9 +56,9 @@ public:
    * @param[out] vapourComposition the calculated vapour phase composition
    * @return an indicator of success of the flash
    */
-  template< int USD1, int USD2 >
+  template< integer NC = 0, int USD1, int USD2 >
   GEOS_HOST_DEVICE
-  static bool compute( integer const numComps,
+  static bool compute( integer const numComponents,
                        real64 const pressure,
                        real64 const temperature,
                        arraySlice1d< real64 const > const & composition,
@@ -71,7 +72,8 @@ public:
 
   /**
    * @brief Calculate derivatives from the two-phase negative flash
-   * @param[in] numComps number of components
+   * @tparam NC number of components if known at compile time, 0 otherwise
+   * @param[in] numComponents number of components (equal to NC if NC > 0)
    * @param[in] pressure pressure
    * @param[in] temperature temperature
    * @param[in] composition composition of the mixture
@@ -84,10 +86,11 @@ public:
    * @param[out] vapourFractionDerivs derivatives of the calculated vapour (gas) mole fraction
    * @param[out] liquidCompositionDerivs derivatives of the calculated liquid phase composition
    * @param[out] vapourCompositionDerivs derivatives of the calculated vapour phase composition
+   * @return @c false if the linear system of the derivatives is singular, @c true otherwise
    */
-  template< integer USD1, integer USD2, integer USD3 >
+  template< integer NC = 0, integer USD1, integer USD2, integer USD3 >
   GEOS_HOST_DEVICE
-  static void computeDerivatives( integer const numComps,
+  static bool computeDerivatives( integer const numComponents,
                                   real64 const pressure,
                                   real64 const temperature,
                                   arraySlice1d< real64 const > const & composition,
@@ -157,6 +160,7 @@ private:
 
   /**
    * @brief Calculate the logarithms of the fugacity ratios
+   * @tparam NC number of components if known at compile time, 0 otherwise
    * @param[in] numComps number of components
    * @param[in] pressure pressure
    * @param[in] temperature temperature
@@ -174,7 +178,7 @@ private:
    * @param[out] fugacityRatios the fugacity rations
    * @return The error
    */
-  template< integer USD >
+  template< integer NC, integer USD >
   GEOS_HOST_DEVICE
   static real64 computeFugacityRatio(
     integer const numComps,
@@ -193,34 +197,11 @@ private:
     arraySlice1d< real64 > const & logVapourFugacity,
     arraySlice1d< real64 > const & fugacityRatios );
 
-  /**
-   * @brief Solve the lineat system for the derivatives of the flash
-   * @param[in] A the coefficient matrix
-   * @param[in] b the rhs
-   * @param[out] x the solution
-   * @return @c true if the problem is well solved @c false otherwise
-   */
-  GEOS_HOST_DEVICE
-  static bool solveLinearSystem( arraySlice2d< real64 const > const & A,
-                                 arraySlice1d< real64 const > const & b,
-                                 arraySlice1d< real64 > const & x )
-  {
-#if defined(GEOS_DEVICE_COMPILE)
-    GEOS_UNUSED_VAR( A );
-    GEOS_UNUSED_VAR( b );
-    GEOS_UNUSED_VAR( x );
-    return false;
-#else
-    BlasLapackLA::solveLinearSystem( A, b, x );
-    return true;
-#endif
-  }
-
 };
 
-template< int USD1, int USD2 >
+template< integer NC, int USD1, int USD2 >
 GEOS_HOST_DEVICE
-bool NegativeTwoPhaseFlash::compute( integer const numComps,
+bool NegativeTwoPhaseFlash::compute( integer const numComponents,
                                      real64 const pressure,
                                      real64 const temperature,
                                      arraySlice1d< real64 const > const & composition,
@@ -232,7 +213,8 @@ bool NegativeTwoPhaseFlash::compute( integer const numComps,
                                      arraySlice1d< real64, USD2 > const & liquidComposition,
                                      arraySlice1d< real64, USD2 > const & vapourComposition )
 {
-  constexpr integer maxNumComps = MultiFluidConstants::MAX_NUM_COMPONENTS;
+  integer const numComps = 0 < NC ? NC : numComponents;
+  constexpr integer maxNumComps = MultiFluidConstants::maxNumComponents< NC >;
   stackArray1d< real64, maxNumComps > logLiquidFugacity( numComps );
   stackArray1d< real64, maxNumComps > logVapourFugacity( numComps );
   stackArray1d< real64, maxNumComps > fugacityRatios( numComps );
@@ -278,21 +260,21 @@ bool NegativeTwoPhaseFlash::compute( integer const numComps,
   bool converged = false;
   for( localIndex iterationCount = 0; iterationCount < MultiFluidConstants::maxSSIIterations; ++iterationCount )
   {
-    real64 const error = computeFugacityRatio( numComps,
-                                               pressure,
-                                               temperature,
-                                               composition,
-                                               componentProperties,
-                                               liquidEos,
-                                               vapourEos,
-                                               kVapourLiquid.toSliceConst(),
-                                               presentComponents,
-                                               vapourPhaseMoleFraction,
-                                               liquidComposition,
-                                               vapourComposition,
-                                               logLiquidFugacity.toSlice(),
-                                               logVapourFugacity.toSlice(),
-                                               fugacityRatios.toSlice() );
+    real64 const error = computeFugacityRatio< NC >( numComps,
+                                                     pressure,
+                                                     temperature,
+                                                     composition,
+                                                     componentProperties,
+                                                     liquidEos,
+                                                     vapourEos,
+                                                     kVapourLiquid.toSliceConst(),
+                                                     presentComponents,
+                                                     vapourPhaseMoleFraction,
+                                                     liquidComposition,
+                                                     vapourComposition,
+                                                     logLiquidFugacity.toSlice(),
+                                                     logVapourFugacity.toSlice(),
+                                                     fugacityRatios.toSlice() );
 
     // Compute fugacity ratios and check convergence
     converged = (error < MultiFluidConstants::fugacityTolerance);
@@ -346,10 +328,10 @@ bool NegativeTwoPhaseFlash::compute( integer const numComps,
   return converged;
 }
 
-template< integer USD1, integer USD2, integer USD3 >
+template< integer NC, integer USD1, integer USD2, integer USD3 >
 GEOS_HOST_DEVICE
-void NegativeTwoPhaseFlash::computeDerivatives(
-  integer const numComps,
+bool NegativeTwoPhaseFlash::computeDerivatives(
+  integer const numComponents,
   real64 const pressure,
   real64 const temperature,
   arraySlice1d< real64 const > const & composition,
@@ -363,8 +345,9 @@ void NegativeTwoPhaseFlash::computeDerivatives(
   arraySlice2d< real64, USD3 > const & liquidCompositionDerivs,
   arraySlice2d< real64, USD3 > const & vapourCompositionDerivs )
 {
-  constexpr integer maxNumComps = MultiFluidConstants::MAX_NUM_COMPONENTS;
-  constexpr integer maxNumDofs = MultiFluidConstants::MAX_NUM_COMPONENTS + 2;
+  integer const numComps = 0 < NC ? NC : numComponents;
+  constexpr integer maxNumComps = MultiFluidConstants::maxNumComponents< NC >;
+  constexpr integer maxNumDofs = maxNumComps + 2;
 
   integer const numDofs = numComps + 2;
 
@@ -398,39 +381,39 @@ void NegativeTwoPhaseFlash::computeDerivatives(
     stackArray2d< real64, maxNumComps * maxNumDofs > logLiquidFugacityDerivs( numComps, numDofs );
     stackArray2d< real64, maxNumComps * maxNumDofs > logVapourFugacityDerivs( numComps, numDofs );
 
-    FugacityCalculator::computeLogFugacity( numComps,
-                                            pressure,
-                                            temperature,
-                                            liquidComposition,
-                                            componentProperties,
-                                            liquidEos,
-                                            logLiquidFugacity );
-    FugacityCalculator::computeLogFugacity( numComps,
-                                            pressure,
-                                            temperature,
-                                            vapourComposition,
-                                            componentProperties,
-                                            vapourEos,
-                                            logVapourFugacity );
-
-    FugacityCalculator::computeLogFugacityDerivatives( numComps,
-                                                       pressure,
-                                                       temperature,
-                                                       liquidComposition,
-                                                       componentProperties,
-                                                       liquidEos,
-                                                       logLiquidFugacity.toSliceConst(),
-                                                       logLiquidFugacityDerivs.toSlice() );
-    FugacityCalculator::computeLogFugacityDerivatives( numComps,
-                                                       pressure,
-                                                       temperature,
-                                                       vapourComposition,
-                                                       componentProperties,
-                                                       vapourEos,
-                                                       logVapourFugacity.toSliceConst(),
-                                                       logVapourFugacityDerivs.toSlice() );
-
-    constexpr integer maxNumVals = 2*MultiFluidConstants::MAX_NUM_COMPONENTS+1;
+    FugacityCalculator::computeLogFugacity< NC >( numComps,
+                                                  pressure,
+                                                  temperature,
+                                                  liquidComposition,
+                                                  componentProperties,
+                                                  liquidEos,
+                                                  logLiquidFugacity );
+    FugacityCalculator::computeLogFugacity< NC >( numComps,
+                                                  pressure,
+                                                  temperature,
+                                                  vapourComposition,
+                                                  componentProperties,
+                                                  vapourEos,
+                                                  logVapourFugacity );
+
+    FugacityCalculator::computeLogFugacityDerivatives< NC >( numComps,
+                                                             pressure,
+                                                             temperature,
+                                                             liquidComposition,
+                                                             componentProperties,
+                                                             liquidEos,
+                                                             logLiquidFugacity.toSliceConst(),
+                                                             logLiquidFugacityDerivs.toSlice() );
+    FugacityCalculator::computeLogFugacityDerivatives< NC >( numComps,
+                                                             pressure,
+                                                             temperature,
+                                                             vapourComposition,
+                                                             componentProperties,
+                                                             vapourEos,
+                                                             logVapourFugacity.toSliceConst(),
+                                                             logVapourFugacityDerivs.toSlice() );
+
+    constexpr integer maxNumVals = 2*maxNumComps+1;
     integer const numVals = 2*numComps;
     stackArray1d< real64, maxNumVals > b( numVals + 1 );
     stackArray1d< real64, maxNumVals > x( numVals + 1 );
@@ -469,6 +452,14 @@ void NegativeTwoPhaseFlash::computeDerivatives(
       A( e, xi ) = -1.0;
       A( e, yi ) =  1.0;
     }
+
+    // The same matrix is used for all the derivatives: factorize it once
+    integer pivots[maxNumVals];
+    if( !denseLinearAlgebra::factorizeLU< maxNumVals >( numVals + 1, A, pivots ) )
+    {
+      return false;
+    }
+
     // Pressure and temperature derivatives
     for( integer const pc : {Deriv::dP, Deriv::dT} )
     {
@@ -481,7 +472,7 @@ void NegativeTwoPhaseFlash::computeDerivatives(
                              + vapourComposition[ic] * phiV * logVapourFugacityDerivs( ic, pc );
       }
       b( numVals ) = 0.0;
-      solveLinearSystem( A, b, x );
+      denseLinearAlgebra::solveLU< maxNumVals >( numVals + 1, A, pivots, b, x );
       for( integer ic = 0; ic < numComps; ++ic )
       {
         liquidCompositionDerivs( ic, pc ) = x( ic );
@@ -501,7 +492,7 @@ void NegativeTwoPhaseFlash::computeDerivatives(
       }
       b( kc ) += 1.0;
       b( numVals ) = 0.0;
-      solveLinearSystem( A, b, x );
+      denseLinearAlgebra::solveLU< maxNumVals >( numVals + 1, A, pivots, b, x );
       for( integer ic = 0; ic < numComps; ++ic )
       {
         liquidCompositionDerivs( ic, pc ) = x( ic );
@@ -510,9 +501,10 @@ void NegativeTwoPhaseFlash::computeDerivatives(
       vapourFractionDerivs( pc ) = x( numVals );
     }
   }
+  return true;
 }
 
-template< integer USD >
+template< integer NC, integer USD >
 GEOS_HOST_DEVICE
 real64 NegativeTwoPhaseFlash::computeFugacityRatio(
   integer const numComps,
@@ -544,20 +536,20 @@ real64 NegativeTwoPhaseFlash::computeFugacityRatio(
   normalizeComposition( numComps, liquidComposition );
   normalizeComposition( numComps, vapourComposition );
 
-  FugacityCalculator::computeLogFugacity( numComps,
-                                          pressure,
-                                          temperature,
-                                          liquidComposition.toSliceConst(),
-                                          componentProperties,
-                                          liquidEos,
-                                          logLiquidFugacity );
-  FugacityCalculator::computeLogFugacity( numComps,
-                                          pressure,
-                                          temperature,
-                                          vapourComposition.toSliceConst(),
-                                          componentProperties,
-                                          vapourEos,
-                                          logVapourFugacity );
+  FugacityCalculator::computeLogFugacity< NC >( numComps,
+                                                pressure,
+                                                temperature,
+                                                liquidComposition.toSliceConst(),
+                                                componentProperties,
+                                                liquidEos,
+                                                logLiquidFugacity );
+  FugacityCalculator::computeLogFugacity< NC >( numComps,
+                                                pressure,
+                                                temperature,
+                                                vapourComposition.toSliceConst(),
+                                                componentProperties,
+                                                vapourEos,
+                                                logVapourFugacity );
 
   // Compute fugacity ratios and calculate the error
   real64 error = 0.0;
@@ -46,7 +46,11 @@ public:
     m_equationOfState( equationOfState )
   {}
 
-  template< integer USD1, integer USD2 >
+  /**
+   * @brief Compute the molar and mass densities of a phase and their derivatives
+   * @tparam NC number of components if known at compile time, 0 otherwise
+   */
+  template< integer NC = 0, integer USD1, integer USD2 >
   GEOS_HOST_DEVICE
   void compute( ComponentProperties::KernelWrapper const & componentProperties,
                 real64 const & pressure,
@@ -59,7 +63,7 @@ public:
                 bool useMass ) const;
 
 private:
-  template< integer USD >
+  template< integer NC, integer USD >
   GEOS_HOST_DEVICE
   void computeCompressibilityFactor( integer const numComps,
                                      real64 const & pressure,
@@ -112,7 +116,7 @@ private:
   EquationOfStateType m_equationOfState;
 };
 
-template< integer USD1, integer USD2 >
+template< integer NC, integer USD1, integer USD2 >
 GEOS_HOST_DEVICE
 void CompositionalDensityUpdate::compute(
   ComponentProperties::KernelWrapper const & componentProperties,
@@ -131,16 +135,16 @@ void CompositionalDensityUpdate::compute(
   integer const numDofs = 2 + numComps;
 
   real64 compressibilityFactor = 0.0;
-  stackArray1d< real64, 2+MultiFluidConstants::MAX_NUM_COMPONENTS > tempDerivs( numDofs );
+  stackArray1d< real64, 2+MultiFluidConstants::maxNumComponents< NC > > tempDerivs( numDofs );
 
-  computeCompressibilityFactor( numComps,
-                                pressure,
-                                temperature,
-                                phaseComposition,
-                                componentProperties,
-                                m_equationOfState,
-                                compressibilityFactor,
-                                tempDerivs.toSlice() );
+  computeCompressibilityFactor< NC >( numComps,
+                                      pressure,
+                                      temperature,
+                                      phaseComposition,
+                                      componentProperties,
+                                      m_equationOfState,
+                                      compressibilityFactor,
+                                      tempDerivs.toSlice() );
 
   CompositionalProperties::computeMolarDensity( numComps,
                                                 pressure,
@@ -161,7 +165,7 @@ void CompositionalDensityUpdate::compute(
                                                dMassDensity );
 }
 
-template< integer USD >
+template< integer NC, integer USD >
 GEOS_HOST_DEVICE
 void CompositionalDensityUpdate::computeCompressibilityFactor( integer const numComps,
                                                                real64 const & pressure,
@@ -175,24 +179,24 @@ void CompositionalDensityUpdate::computeCompressibilityFactor( integer const num
   if( equationOfState == EquationOfStateType::PengRobinson )
   {
     CubicEOSPhaseModel< PengRobinsonEOS >::
-    computeCompressibilityFactor( numComps,
-                                  pressure,
-                                  temperature,
-                                  composition,
-                                  componentProperties,
-                                  compressibilityFactor,
-                                  compressibilityFactorDerivs );
+    computeCompressibilityFactor< NC >( numComps,
+                                        pressure,
+                                        temperature,
+                                        composition,
+                                        componentProperties,
+                                        compressibilityFactor,
+                                        compressibilityFactorDerivs );
   }
   else if( equationOfState == EquationOfStateType::SoaveRedlichKwong )
   {
     CubicEOSPhaseModel< SoaveRedlichKwongEOS >::
-    computeCompressibilityFactor( numComps,
-                                  pressure,
-                                  temperature,
-                                  composition,
-                                  componentProperties,
-                                  compressibilityFactor,
-                                  compressibilityFactorDerivs );
+    computeCompressibilityFactor< NC >( numComps,
+                                        pressure,
+                                        temperature,
+                                        composition,
+                                        componentProperties,
+                                        compressibilityFactor,
+                                        compressibilityFactorDerivs );
   }
 }
 
@@ -55,7 +55,11 @@ public:
   GEOS_HOST_DEVICE
   static constexpr integer getNumberOfPhases() { return 2; }
 
-  template< int USD1, int USD2 >
+  /**
+   * @brief Compute the phase fractions and phase compositions and their derivatives
+   * @tparam NC number of components if known at compile time, 0 otherwise
+   */
+  template< integer NC = 0, int USD1, int USD2 >
   GEOS_HOST_DEVICE
   void compute( ComponentProperties::KernelWrapper const & componentProperties,
                 real64 const & pressure,
@@ -68,35 +72,39 @@ public:
     integer const numDofs = 2 + m_numComponents;
 
     // Iterative solve to converge flash
-    bool const flashStatus = NegativeTwoPhaseFlash::compute( m_numComponents,
-                                                             pressure,
-                                                             temperature,
-                                                             compFraction,
-                                                             componentProperties,
-                                                             m_liquidEos,
-                                                             m_vapourEos,
-                                                             kValues,
-                                                             phaseFraction.value[m_vapourIndex],
-                                                             phaseCompFraction.value[m_liquidIndex],
-                                                             phaseCompFraction.value[m_vapourIndex] );
+    bool const flashStatus = NegativeTwoPhaseFlash::compute< NC >( m_numComponents,
+                                                                   pressure,
+                                                                   temperature,
+                                                                   compFraction,
+                                                                   componentProperties,
+                                                                   m_liquidEos,
+                                                                   m_vapourEos,
+                                                                   kValues,
+                                                                   phaseFraction.value[m_vapourIndex],
+                                                                   phaseCompFraction.value[m_liquidIndex],
+                                                                   phaseCompFraction.value[m_vapourIndex] );
     GEOS_ERROR_IF( !flashStatus,
                    GEOS_FMT( "Negative two phase flash failed to converge at pressure {:.5e} and temperature {:.3f}",
                              pressure, temperature ));
 
     // Calculate derivatives
-    NegativeTwoPhaseFlash::computeDerivatives( m_numComponents,
-                                               pressure,
-                                               temperature,
-                                               compFraction,
-                                               componentProperties,
-                                               m_liquidEos,
-                                               m_vapourEos,
-                                               phaseFraction.value[m_vapourIndex],
-                                               phaseCompFraction.value[m_liquidIndex].toSliceConst(),
-                                               phaseCompFraction.value[m_vapourIndex].toSliceConst(),
-                                               phaseFraction.derivs[m_vapourIndex],
-                                               phaseCompFraction.derivs[m_liquidIndex],
-                                               phaseCompFraction.derivs[m_vapourIndex] );
+    bool const derivativesStatus =
+      NegativeTwoPhaseFlash::computeDerivatives< NC >( m_numComponents,
+                                                       pressure,
+                                                       temperature,
+                                                       compFraction,
+                                                       componentProperties,
+                                                       m_liquidEos,
+                                                       m_vapourEos,
+                                                       phaseFraction.value[m_vapourIndex],
+                                                       phaseCompFraction.value[m_liquidIndex].toSliceConst(),
+                                                       phaseCompFraction.value[m_vapourIndex].toSliceConst(),
+                                                       phaseFraction.derivs[m_vapourIndex],
+                                                       phaseCompFraction.derivs[m_liquidIndex],
+                                                       phaseCompFraction.derivs[m_vapourIndex] );
+    GEOS_ERROR_IF( !derivativesStatus,
+                   GEOS_FMT( "Negative two phase flash derivatives: singular matrix at pressure {:.5e} and temperature {:.3f}",
+                             pressure, temperature ));
 
     // Complete by calculating liquid phase fraction
     phaseFraction.value[m_liquidIndex] = 1.0 - phaseFraction.value[m_vapourIndex];
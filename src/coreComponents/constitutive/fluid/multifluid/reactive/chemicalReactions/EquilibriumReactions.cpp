@@ -20,7 +20,7 @@
 #include "EquilibriumReactions.hpp"
 
 #include "functions/FunctionManager.hpp"
-#include "denseLinearAlgebra/interfaces/blaslapack/BlasLapackLA.hpp"
+#include "denseLinearAlgebra/denseLASolvers.hpp"
 
 namespace geos
 {
@@ -190,7 +190,12 @@ void EquilibriumReactions::KernelWrapper::updateConcentrations( real64 const tem
                                        matrix,
                                        rhs );
 
-    real64 const residualNorm = BlasLapackLA::vectorNorm2( rhs.toSliceConst() );
+    real64 residualNorm = 0.0;
+    for( int i = 0; i < m_numPrimarySpecies; i++ )
+    {
+      residualNorm += rhs[i] * rhs[i];
+    }
+    residualNorm = LvArray::math::sqrt( residualNorm );
 
     if( residualNorm < m_newtonTol && iteration >= 1 )
     {
@@ -198,7 +203,9 @@ void EquilibriumReactions::KernelWrapper::updateConcentrations( real64 const tem
       break;
     }
 
-    BlasLapackLA::solveLinearSystem( matrix, rhs, solution );
+    bool const solved =
+      denseLinearAlgebra::solveLinearSystem< ReactionsBase::maxNumPrimarySpecies >( m_numPrimarySpecies, matrix, rhs, solution );
+    GEOS_ERROR_IF( !solved, "Equilibrium reactions: singular Jacobian matrix." );
 
     updatePrimarySpeciesConcentrations( solution, primarySpeciesConcentration );
   }
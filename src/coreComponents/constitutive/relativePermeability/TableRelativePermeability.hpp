@@ -83,7 +83,8 @@ public:
                           integer const ipNonWetting,
                           arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseVolFraction,
                           arraySlice1d< real64, constitutive::relperm::USD_RELPERM - 2 > const & phaseRelPerm,
-                          arraySlice2d< real64, constitutive::relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac ) const;
+                          arraySlice2d< real64, constitutive::relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac,
+                          TableFunction::AxisPosition const * const phaseVolFracPositions = nullptr ) const;
 
     GEOS_HOST_DEVICE
     void computeThreePhase( integer const ipWetting,
@@ -91,19 +92,62 @@ public:
                             integer const ipNonWetting,
                             arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseVolFraction,
                             arraySlice1d< real64, constitutive::relperm::USD_RELPERM - 2 > const & phaseRelPerm,
-                            arraySlice2d< real64, constitutive::relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac ) const;
-
+                            arraySlice2d< real64, constitutive::relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac,
+                            TableFunction::AxisPosition const * const phaseVolFracPositions = nullptr ) const;
+
+    /**
+     * @brief Compute the relative permeabilities
+     * @param[in] phaseVolFraction the phase volume fractions
+     * @param[out] phaseTrappedVolFrac the trapped phase volume fractions
+     * @param[out] phaseRelPerm the phase relative permeabilities
+     * @param[out] dPhaseRelPerm_dPhaseVolFrac the derivatives of the phase relative permeabilities wrt the phase volume fractions
+     * @param[in] phaseVolFracPositions the positions of the phase volume fractions on the table axes (see locatePhaseVolFraction),
+     *            or nullptr to search for them in each table
+     */
     GEOS_HOST_DEVICE
     void compute( arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseVolFraction,
                   arraySlice1d< real64, constitutive::relperm::USD_RELPERM - 2 > const & phaseTrappedVolFrac,
                   arraySlice1d< real64, constitutive::relperm::USD_RELPERM - 2 > const & phaseRelPerm,
-                  arraySlice2d< real64, constitutive::relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac ) const;
+                  arraySlice2d< real64, constitutive::relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac,
+                  TableFunction::AxisPosition const * const phaseVolFracPositions = nullptr ) const;
 
     GEOS_HOST_DEVICE
     virtual void update( localIndex const k,
                          localIndex const q,
                          arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseVolFraction ) const override;
 
+    /**
+     * @brief Update the relative permeabilities, reusing the positions of the phase volume fractions on the table axes
+     * @param[in] k the element index
+     * @param[in] q the gauss point index
+     * @param[in] phaseVolFraction the phase volume fractions
+     * @param[in] phaseVolFracPositions the positions of the phase volume fractions on the table axes (see locatePhaseVolFraction)
+     */
+    GEOS_HOST_DEVICE
+    void update( localIndex const k,
+                 localIndex const q,
+                 arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseVolFraction,
+                 TableFunction::AxisPosition const * const phaseVolFracPositions ) const;
+
+    /**
+     * @brief Find the position of the volume fraction of each phase on the axis of the first table evaluated at this volume fraction
+     * @param[in] phaseVolFraction the phase volume fractions
+     * @param[out] phaseVolFracPositions the positions of the phase volume fractions, one per phase
+     * @note The positions can be reused by all the tables defined on the same axes (see getPhaseVolFractionTables)
+     */
+    GEOS_HOST_DEVICE
+    void locatePhaseVolFraction( arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseVolFraction,
+                                 TableFunction::AxisPosition * const phaseVolFracPositions ) const;
+
+    /**
+     * @brief Get the tables evaluated at the volume fraction of a phase, the first one being used by locatePhaseVolFraction
+     * @param[in] ip the phase index
+     * @param[inout] tables the tables evaluated at the volume fraction of phase @p ip, appended to the existing ones
+     * @note This function reads the table kernel wrappers on the host.
+     */
+    void getPhaseVolFractionTables( integer const ip,
+                                    std::vector< TableFunction::KernelWrapper const * > & tables ) const;
+
 private:
 
     /// Kernel wrappers for relative permeabilities in the following order:
@@ -191,19 +235,22 @@ TableRelativePermeability::KernelWrapper::
                    integer const ipNonWetting,
                    arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseVolFraction,
                    arraySlice1d< real64, constitutive::relperm::USD_RELPERM - 2 > const & phaseRelPerm,
-                   arraySlice2d< real64, constitutive::relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac ) const
+                   arraySlice2d< real64, constitutive::relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac,
+                   TableFunction::AxisPosition const * const phaseVolFracPositions ) const
 {
   using TPT = TableRelativePermeability::TwoPhasePairPhaseType;
 
   // water rel perm
   phaseRelPerm[ipWetting] =
-    m_relPermKernelWrappers[TPT::WETTING].compute( &(phaseVolFraction)[ipWetting],
-                                                   &(dPhaseRelPerm_dPhaseVolFrac)[ipWetting][ipWetting] );
+    m_relPermKernelWrappers[TPT::WETTING].compute( phaseVolFraction[ipWetting],
+                                                   TableFunction::AxisPosition::at( phaseVolFracPositions, ipWetting ),
+                                                   dPhaseRelPerm_dPhaseVolFrac[ipWetting][ipWetting] );
 
   // oil rel perm
   phaseRelPerm[ipNonWetting] =
-    m_relPermKernelWrappers[TPT::NONWETTING].compute( &(phaseVolFraction)[ipNonWetting],
-                                                      &(dPhaseRelPerm_dPhaseVolFrac)[ipNonWetting][ipNonWetting] );
+    m_relPermKernelWrappers[TPT::NONWETTING].compute( phaseVolFraction[ipNonWetting],
+                                                      TableFunction::AxisPosition::at( phaseVolFracPositions, ipNonWetting ),
+                                                      dPhaseRelPerm_dPhaseVolFrac[ipNonWetting][ipNonWetting] );
 
 }
 
@@ -217,7 +264,8 @@ TableRelativePermeability::KernelWrapper::
                      integer const ipNonWetting,
                      arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseVolFraction,
                      arraySlice1d< real64, constitutive::relperm::USD_RELPERM - 2 > const & phaseRelPerm,
-                     arraySlice2d< real64, constitutive::relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac ) const
+                     arraySlice2d< real64, constitutive::relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac,
+                     TableFunction::AxisPosition const * const phaseVolFracPositions ) const
 {
   real64 interRelPerm_wi = 0; // oil rel perm using two-phase gas-oil data
   real64 dInterRelPerm_wi_dInterVolFrac = 0; // derivative w.r.t to So
@@ -229,26 +277,30 @@ TableRelativePermeability::KernelWrapper::
 
   // wetting rel perm
   phaseRelPerm[ipWetting] =
-    m_relPermKernelWrappers[TPT::WETTING].compute( &(phaseVolFraction)[ipWetting],
-                                                   &(dPhaseRelPerm_dPhaseVolFrac)[ipWetting][ipWetting] );
+    m_relPermKernelWrappers[TPT::WETTING].compute( phaseVolFraction[ipWetting],
+                                                   TableFunction::AxisPosition::at( phaseVolFracPositions, ipWetting ),
+                                                   dPhaseRelPerm_dPhaseVolFrac[ipWetting][ipWetting] );
 
   // intermediate rel perm
   interRelPerm_wi =
-    m_relPermKernelWrappers[TPT::INTERMEDIATE_WETTING].compute( &(phaseVolFraction)[ipInter],
-                                                                &dInterRelPerm_wi_dInterVolFrac );
+    m_relPermKernelWrappers[TPT::INTERMEDIATE_WETTING].compute( phaseVolFraction[ipInter],
+                                                                TableFunction::AxisPosition::at( phaseVolFracPositions, ipInter ),
+                                                                dInterRelPerm_wi_dInterVolFrac );
 
 
   // 2) Non-wetting and intermediate phase relative permeabilities using two-phase non-wetting-intermediate data
 
   // gas rel perm
   phaseRelPerm[ipNonWetting] =
-    m_relPermKernelWrappers[TPT::NONWETTING].compute( &(phaseVolFraction)[ipNonWetting],
-                                                      &(dPhaseRelPerm_dPhaseVolFrac)[ipNonWetting][ipNonWetting] );
+    m_relPermKernelWrappers[TPT::NONWETTING].compute( phaseVolFraction[ipNonWetting],
+                                                      TableFunction::AxisPosition::at( phaseVolFracPositions, ipNonWetting ),
+                                                      dPhaseRelPerm_dPhaseVolFrac[ipNonWetting][ipNonWetting] );
 
   // oil rel perm
   interRelPerm_nwi =
-    m_relPermKernelWrappers[TPT::INTERMEDIATE_NONWETTING].compute( &(phaseVolFraction)[ipInter],
-                                                                   &dInterRelPerm_nwi_dInterVolFrac );
+    m_relPermKernelWrappers[TPT::INTERMEDIATE_NONWETTING].compute( phaseVolFraction[ipInter],
+                                                                   TableFunction::AxisPosition::at( phaseVolFracPositions, ipInter ),
+                                                                   dInterRelPerm_nwi_dInterVolFrac );
 
   // 3) Compute the "three-phase" oil relperm
 
@@ -297,7 +349,8 @@ TableRelativePermeability::KernelWrapper::
   compute( arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseVolFraction,
            arraySlice1d< real64, constitutive::relperm::USD_RELPERM - 2 > const & phaseTrappedVolFrac,
            arraySlice1d< real64, constitutive::relperm::USD_RELPERM - 2 > const & phaseRelPerm,
-           arraySlice2d< real64, constitutive::relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac ) const
+           arraySlice2d< real64, constitutive::relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac,
+           TableFunction::AxisPosition const * const phaseVolFracPositions ) const
 {
   LvArray::forValuesInSlice( dPhaseRelPerm_dPhaseVolFrac, []( real64 & val ){ val = 0.0; } );
 
@@ -313,7 +366,8 @@ TableRelativePermeability::KernelWrapper::
                        ipGas, // non-wetting
                        phaseVolFraction,
                        phaseRelPerm,
-                       dPhaseRelPerm_dPhaseVolFrac );
+                       dPhaseRelPerm_dPhaseVolFrac,
+                       phaseVolFracPositions );
 
   }
   else if( ipWater < 0 )
@@ -322,7 +376,8 @@ TableRelativePermeability::KernelWrapper::
                      ipGas, // non-wetting
                      phaseVolFraction,
                      phaseRelPerm,
-                     dPhaseRelPerm_dPhaseVolFrac );
+                     dPhaseRelPerm_dPhaseVolFrac,
+                     phaseVolFracPositions );
   }
   else if( ipOil < 0 )
   {
@@ -330,7 +385,8 @@ TableRelativePermeability::KernelWrapper::
                      ipGas, // non-wetting
                      phaseVolFraction,
                      phaseRelPerm,
-                     dPhaseRelPerm_dPhaseVolFrac );
+                     dPhaseRelPerm_dPhaseVolFrac,
+                     phaseVolFracPositions );
   }
   else if( ipGas < 0 )
   {
@@ -338,7 +394,8 @@ TableRelativePermeability::KernelWrapper::
                      ipOil, // non-wetting
                      phaseVolFraction,
                      phaseRelPerm,
-                     dPhaseRelPerm_dPhaseVolFrac );
+                     dPhaseRelPerm_dPhaseVolFrac,
+                     phaseVolFracPositions );
   }
 
   // update trapped phase volume fraction
@@ -371,6 +428,92 @@ TableRelativePermeability::KernelWrapper::
 
 }
 
+GEOS_HOST_DEVICE
+inline void
+TableRelativePermeability::KernelWrapper::
+  update( localIndex const k,
+          localIndex const q,
+          arraySlice1d< geos::real64 const, compflow::USD_PHASE - 1 > const & phaseVolFraction,
+          TableFunction::AxisPosition const * const phaseVolFracPositions ) const
+{
+  compute( phaseVolFraction,
+           m_phaseTrappedVolFrac[k][q],
+           m_phaseRelPerm[k][q],
+           m_dPhaseRelPerm_dPhaseVolFrac[k][q],
+           phaseVolFracPositions );
+}
+
+GEOS_HOST_DEVICE
+inline void
+TableRelativePermeability::KernelWrapper::
+  locatePhaseVolFraction( arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseVolFraction,
+                          TableFunction::AxisPosition * const phaseVolFracPositions ) const
+{
+  using PT = RelativePermeabilityBase::PhaseType;
+  integer const ipWater = m_phaseOrder[PT::WATER];
+  integer const ipOil   = m_phaseOrder[PT::OIL];
+  integer const ipGas   = m_phaseOrder[PT::GAS];
+
+  if( ipWater >= 0 && ipOil >= 0 && ipGas >= 0 )
+  {
+    using TPT = TableRelativePermeability::ThreePhasePairPhaseType;
+    m_relPermKernelWrappers[TPT::WETTING].locate( phaseVolFraction[ipWater], phaseVolFracPositions[ipWater] );
+    m_relPermKernelWrappers[TPT::INTERMEDIATE_WETTING].locate( phaseVolFraction[ipOil], phaseVolFracPositions[ipOil] );
+    m_relPermKernelWrappers[TPT::NONWETTING].locate( phaseVolFraction[ipGas], phaseVolFracPositions[ipGas] );
+  }
+  else
+  {
+    using TPT = TableRelativePermeability::TwoPhasePairPhaseType;
+    integer const ipWetting = ( ipWater < 0 ) ? ipOil : ipWater;
+    integer const ipNonWetting = ( ipGas < 0 ) ? ipOil : ipGas;
+    m_relPermKernelWrappers[TPT::WETTING].locate( phaseVolFraction[ipWetting], phaseVolFracPositions[ipWetting] );
+    m_relPermKernelWrappers[TPT::NONWETTING].locate( phaseVolFraction[ipNonWetting], phaseVolFracPositions[ipNonWetting] );
+  }
+}
+
+inline void
+TableRelativePermeability::KernelWrapper::
+  getPhaseVolFractionTables( integer const ip,
+                             std::vector< TableFunction::KernelWrapper const * > & tables ) const
+{
+  using PT = RelativePermeabilityBase::PhaseType;
+  integer const ipWater = m_phaseOrder[PT::WATER];
+  integer const ipOil   = m_phaseOrder[PT::OIL];
+  integer const ipGas   = m_phaseOrder[PT::GAS];
+
+  if( ipWater >= 0 && ipOil >= 0 && ipGas >= 0 )
+  {
+    using TPT = TableRelativePermeability::ThreePhasePairPhaseType;
+    if( ip == ipWater )
+    {
+      tables.push_back( &m_relPermKernelWrappers[TPT::WETTING] );
+    }
+    else if( ip == ipOil )
+    {
+      tables.push_back( &m_relPermKernelWrappers[TPT::INTERMEDIATE_WETTING] );
+      tables.push_back( &m_relPermKernelWrappers[TPT::INTERMEDIATE_NONWETTING] );
+    }
+    else if( ip == ipGas )
+    {
+      tables.push_back( &m_relPermKernelWrappers[TPT::NONWETTING] );
+    }
+  }
+  else
+  {
+    using TPT = TableRelativePermeability::TwoPhasePairPhaseType;
+    integer const ipWetting = ( ipWater < 0 ) ? ipOil : ipWater;
+    integer const ipNonWetting = ( ipGas < 0 ) ? ipOil : ipGas;
+    if( ip == ipWetting )
+    {
+      tables.push_back( &m_relPermKernelWrappers[TPT::WETTING] );
+    }
+    else if( ip == ipNonWetting )
+    {
+      tables.push_back( &m_relPermKernelWrappers[TPT::NONWETTING] );
+    }
+  }
+}
+
 } // namespace constitutive
 
 } // namespace geos
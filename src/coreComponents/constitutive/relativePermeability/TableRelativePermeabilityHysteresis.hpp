@@ -143,6 +143,7 @@ public:
      * @brief Function updating the relperm (and derivative) for a phase using the drainage table
      * @param[in] drainageRelPermKernelWrapper kernel wrapper storing the drainage relperm table for the phase we want to update here
      * @param[in] phaseVolFraction volume fraction of the phase we want to update here
+     * @param[in] phaseVolFracPosition position of the phase volume fraction on the table axis, or nullptr to search for it
      * @param[out] phaseRelPerm relative permeability of the phase we want to update here
      * @param[out] dPhaseRelPerm_dPhaseVolFrac derivative of the relative permeability wrt phase volume fraction for the phase we want to
      * update here
@@ -150,6 +151,7 @@ public:
     GEOS_HOST_DEVICE
     void computeDrainageRelPerm( TableFunction::KernelWrapper const & drainageRelPermKernelWrapper,
                                  real64 const & phaseVolFraction,
+                                 TableFunction::AxisPosition const * const phaseVolFracPosition,
                                  real64 & phaseRelPerm,
                                  real64 & dPhaseRelPerm_dPhaseVolFrac ) const;
 
@@ -247,6 +249,7 @@ public:
      * @param[in] phaseMinHistoricalVolFraction
      * @param[out] phaseRelPerm
      * @param[out] dPhaseRelPerm_dPhaseVolFrac
+     * @param[in] phaseVolFracPositions
      * @detail depending of the flow direction for a given phase, this function updates the phase relative permeability
      *         using computeDrainageRelPerm (in drainage) or using one of the imbibition update functions implementing Killough's method
      */
@@ -259,7 +262,8 @@ public:
                           arraySlice1d< real64, constitutive::relperm::USD_RELPERM - 2 > const & phaseTrappedVolFrac,
                           arraySlice1d< real64, constitutive::relperm::USD_RELPERM - 2 > const & phaseRelPerm,
                           arraySlice2d< real64,
-                                        constitutive::relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac ) const;
+                                        constitutive::relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac,
+                          TableFunction::AxisPosition const * const phaseVolFracPositions = nullptr ) const;
 
     /**
      * @brief Function updating all the phase relperms (and derivatives) for three-phase flow
@@ -271,6 +275,7 @@ public:
      * @param[in] phaseMinHistoricalVolFraction min historical volume fractions for the three phases
      * @param[out] phaseRelPerm relative permeabilities for the three phases
      * @param[out] dPhaseRelPerm_dPhaseVolFrac derivatives of relative permeabilities wrt phase volume fraction for the three phases
+     * @param[in] phaseVolFracPositions positions of the phase volume fractions on the drainage table axes, or nullptr
      * @detail depending of the flow direction for a given phase, this function updates the phase relative permeability
      *         using computeDrainageRelPerm (in drainage) or using one of the imbibition update functions implementing Killough's method
      */
@@ -284,7 +289,8 @@ public:
                             arraySlice1d< real64, constitutive::relperm::USD_RELPERM - 2 > const & phaseTrappedVolFrac,
                             arraySlice1d< real64, constitutive::relperm::USD_RELPERM - 2 > const & phaseRelPerm,
                             arraySlice2d< real64,
-                                          constitutive::relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac ) const;
+                                          constitutive::relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac,
+                            TableFunction::AxisPosition const * const phaseVolFracPositions = nullptr ) const;
 
     /**
      * @brief Main function updating all the phase relperms (and derivatives)
@@ -293,6 +299,8 @@ public:
      * @param[in] phaseMinHistoricalVolFraction min historical volume fractions for all the phases
      * @param[out] phaseRelPerm relative permeabilities for all the phases
      * @param[out] dPhaseRelPerm_dPhaseVolFrac derivatives of relative permeabilities wrt phase volume fraction for all the phases
+     * @param[in] phaseVolFracPositions positions of the phase volume fractions on the drainage table axes (see locatePhaseVolFraction),
+     *            or nullptr to search for them in each table
      */
     GEOS_HOST_DEVICE
     void compute( arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseVolFraction,
@@ -300,7 +308,8 @@ public:
                   arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseMinHistoricalVolFraction,
                   arraySlice1d< real64, constitutive::relperm::USD_RELPERM - 2 > const & phaseTrappedVolFrac,
                   arraySlice1d< real64, constitutive::relperm::USD_RELPERM - 2 > const & phaseRelPerm,
-                  arraySlice2d< real64, constitutive::relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac ) const;
+                  arraySlice2d< real64, constitutive::relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac,
+                  TableFunction::AxisPosition const * const phaseVolFracPositions = nullptr ) const;
 
     GEOS_HOST_DEVICE
     virtual void update( localIndex const k,
@@ -308,6 +317,38 @@ public:
                          arraySlice1d< real64 const,
                                        compflow::USD_PHASE - 1 > const & phaseVolFraction ) const override;
 
+    /**
+     * @brief Update the relperms, reusing the positions of the phase volume fractions on the drainage table axes
+     * @param[in] k the element index
+     * @param[in] q the gauss point index
+     * @param[in] phaseVolFraction the phase volume fractions
+     * @param[in] phaseVolFracPositions the positions of the phase volume fractions on the drainage table axes (see locatePhaseVolFraction)
+     */
+    GEOS_HOST_DEVICE
+    void update( localIndex const k,
+                 localIndex const q,
+                 arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseVolFraction,
+                 TableFunction::AxisPosition const * const phaseVolFracPositions ) const;
+
+    /**
+     * @brief Find the position of the volume fraction of each phase on the axis of the first drainage table evaluated at this volume fraction
+     * @param[in] phaseVolFraction the phase volume fractions
+     * @param[out] phaseVolFracPositions the positions of the phase volume fractions, one per phase
+     * @note The imbibition tables are evaluated at scaled volume fractions, so they do their own bracket searches
+     */
+    GEOS_HOST_DEVICE
+    void locatePhaseVolFraction( arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseVolFraction,
+                                 TableFunction::AxisPosition * const phaseVolFracPositions ) const;
+
+    /**
+     * @brief Get the drainage tables evaluated at the volume fraction of a phase, the first one being used by locatePhaseVolFraction
+     * @param[in] ip the phase index
+     * @param[inout] tables the tables evaluated at the volume fraction of phase @p ip, appended to the existing ones
+     * @note This function reads the table kernel wrappers on the host.
+     */
+    void getPhaseVolFractionTables( integer const ip,
+                                    std::vector< TableFunction::KernelWrapper const * > & tables ) const;
+
 
 private:
 
@@ -579,12 +620,14 @@ void
 TableRelativePermeabilityHysteresis::KernelWrapper::
   computeDrainageRelPerm( TableFunction::KernelWrapper const & drainageRelPermKernelWrapper,
                           real64 const & phaseVolFraction,
+                          TableFunction::AxisPosition const * const phaseVolFracPosition,
                           real64 & phaseRelPerm,
                           real64 & dPhaseRelPerm_dPhaseVolFrac ) const
 {
   phaseRelPerm =
-    drainageRelPermKernelWrapper.compute( &phaseVolFraction,
-                                          &dPhaseRelPerm_dPhaseVolFrac );
+    drainageRelPermKernelWrapper.compute( phaseVolFraction,
+                                          phaseVolFracPosition,
+                                          dPhaseRelPerm_dPhaseVolFrac );
 }
 
 GEOS_HOST_DEVICE
@@ -782,7 +825,8 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
                    arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseMinHistoricalVolFraction,
                    arraySlice1d< real64, constitutive::relperm::USD_RELPERM - 2 > const & phaseTrappedVolFrac,
                    arraySlice1d< real64, constitutive::relperm::USD_RELPERM - 2 > const & phaseRelPerm,
-                   arraySlice2d< real64, constitutive::relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac ) const
+                   arraySlice2d< real64, constitutive::relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac,
+                   TableFunction::AxisPosition const * const phaseVolFracPositions ) const
 {
   using TPT = constitutive::TableRelativePermeabilityHysteresis::TwoPhasePairPhaseType;
   using IPT = constitutive::TableRelativePermeabilityHysteresis::ImbibitionPhasePairPhaseType;
@@ -795,6 +839,7 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
       LvArray::math::min( phaseVolFraction[ipWetting], m_drainagePhaseMinVolFraction[ipWetting] );
     computeDrainageRelPerm( m_drainageRelPermKernelWrappers[TPT::WETTING],
                             phaseVolFraction[ipWetting],
+                            TableFunction::AxisPosition::at( phaseVolFracPositions, ipWetting ),
                             phaseRelPerm[ipWetting],
                             dPhaseRelPerm_dPhaseVolFrac[ipWetting][ipWetting] );
   }
@@ -838,6 +883,7 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
     // then compute the non-wetting phase relperm on the drainage curve
     computeDrainageRelPerm( m_drainageRelPermKernelWrappers[TPT::NONWETTING],
                             phaseVolFraction[ipNonWetting],
+                            TableFunction::AxisPosition::at( phaseVolFracPositions, ipNonWetting ),
                             phaseRelPerm[ipNonWetting],
                             dPhaseRelPerm_dPhaseVolFrac[ipNonWetting][ipNonWetting] );
   }
@@ -872,7 +918,8 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
                      arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseMinHistoricalVolFraction,
                      arraySlice1d< real64, constitutive::relperm::USD_RELPERM - 2 > const & phaseTrappedVolFrac,
                      arraySlice1d< real64, constitutive::relperm::USD_RELPERM - 2 > const & phaseRelPerm,
-                     arraySlice2d< real64, constitutive::relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac ) const
+                     arraySlice2d< real64, constitutive::relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac,
+                     TableFunction::AxisPosition const * const phaseVolFracPositions ) const
 {
   real64 interRelPerm_wi = 0; // oil rel perm using two-phase gas-oil data
   real64 dInterRelPerm_wi_dInterVolFrac = 0; // derivative w.r.t to So
@@ -892,6 +939,7 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
       LvArray::math::min( m_drainagePhaseMinVolFraction[ipWetting], phaseVolFraction[ipWetting] );
     computeDrainageRelPerm( m_drainageRelPermKernelWrappers[TPT::WETTING],
                             phaseVolFraction[ipWetting],
+                            TableFunction::AxisPosition::at( phaseVolFracPositions, ipWetting ),
                             phaseRelPerm[ipWetting],
                             dPhaseRelPerm_dPhaseVolFrac[ipWetting][ipWetting] );
   }
@@ -916,8 +964,9 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
 
   // ---------- intermediate rel perm (ALWAYS DRAINAGE!)
   interRelPerm_wi =
-    m_drainageRelPermKernelWrappers[TPT::INTERMEDIATE_WETTING].compute( &( phaseVolFraction )[ipInter],
-                                                                        &dInterRelPerm_wi_dInterVolFrac );
+    m_drainageRelPermKernelWrappers[TPT::INTERMEDIATE_WETTING].compute( phaseVolFraction[ipInter],
+                                                                        TableFunction::AxisPosition::at( phaseVolFracPositions, ipInter ),
+                                                                        dInterRelPerm_wi_dInterVolFrac );
 
 
   // 2) Non-wetting and intermediate phase relative permeabilities using two-phase non-wetting-intermediate data
@@ -943,6 +992,7 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
     // 2.b) then compute the non-wetting phase relperm on the drainage curve
     computeDrainageRelPerm( m_drainageRelPermKernelWrappers[TPT::NONWETTING],
                             phaseVolFraction[ipNonWetting],
+                            TableFunction::AxisPosition::at( phaseVolFracPositions, ipNonWetting ),
                             phaseRelPerm[ipNonWetting],
                             dPhaseRelPerm_dPhaseVolFrac[ipNonWetting][ipNonWetting] );
   }
@@ -966,8 +1016,9 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
 
   // ---------- intermediate rel perm (ALWAYS DRAINAGE!)
   interRelPerm_nwi =
-    m_drainageRelPermKernelWrappers[TPT::INTERMEDIATE_NONWETTING].compute( &( phaseVolFraction )[ipInter],
-                                                                           &dInterRelPerm_nwi_dInterVolFrac );
+    m_drainageRelPermKernelWrappers[TPT::INTERMEDIATE_NONWETTING].compute( phaseVolFraction[ipInter],
+                                                                           TableFunction::AxisPosition::at( phaseVolFracPositions, ipInter ),
+                                                                           dInterRelPerm_nwi_dInterVolFrac );
 
   // 3) Compute the "three-phase" oil relperm
 
@@ -1015,7 +1066,8 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
            arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseMinHistoricalVolFraction,
            arraySlice1d< real64, constitutive::relperm::USD_RELPERM - 2 > const & phaseTrappedVolFrac,
            arraySlice1d< real64, constitutive::relperm::USD_RELPERM - 2 > const & phaseRelPerm,
-           arraySlice2d< real64, constitutive::relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac ) const
+           arraySlice2d< real64, constitutive::relperm::USD_RELPERM_DS - 2 > const & dPhaseRelPerm_dPhaseVolFrac,
+           TableFunction::AxisPosition const * const phaseVolFracPositions ) const
 {
   LvArray::forValuesInSlice( dPhaseRelPerm_dPhaseVolFrac, []( real64 & val )
   { val = 0.0; } );
@@ -1035,7 +1087,8 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
                        phaseMinHistoricalVolFraction,
                        phaseTrappedVolFrac,
                        phaseRelPerm,
-                       dPhaseRelPerm_dPhaseVolFrac );
+                       dPhaseRelPerm_dPhaseVolFrac,
+                       phaseVolFracPositions );
 
   }
   else if( ipWater < 0 )
@@ -1047,7 +1100,8 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
                      phaseMinHistoricalVolFraction,
                      phaseTrappedVolFrac,
                      phaseRelPerm,
-                     dPhaseRelPerm_dPhaseVolFrac );
+                     dPhaseRelPerm_dPhaseVolFrac,
+                     phaseVolFracPositions );
   }
   else if( ipOil < 0 )
   {
@@ -1058,7 +1112,8 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
                      phaseMinHistoricalVolFraction,
                      phaseTrappedVolFrac,
                      phaseRelPerm,
-                     dPhaseRelPerm_dPhaseVolFrac );
+                     dPhaseRelPerm_dPhaseVolFrac,
+                     phaseVolFracPositions );
   }
   else if( ipGas < 0 )
   {
@@ -1069,7 +1124,8 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
                      phaseMinHistoricalVolFraction,
                      phaseTrappedVolFrac,
                      phaseRelPerm,
-                     dPhaseRelPerm_dPhaseVolFrac );
+                     dPhaseRelPerm_dPhaseVolFrac,
+                     phaseVolFracPositions );
   }
 }
 
@@ -1089,6 +1145,97 @@ TableRelativePermeabilityHysteresis::KernelWrapper::
            m_dPhaseRelPerm_dPhaseVolFrac[k][q] );
 }
 
+GEOS_HOST_DEVICE
+inline
+void
+TableRelativePermeabilityHysteresis::KernelWrapper::
+  update( localIndex const k,
+          localIndex const q,
+          arraySlice1d< geos::real64 const, compflow::USD_PHASE - 1 > const & phaseVolFraction,
+          TableFunction::AxisPosition const * const phaseVolFracPositions ) const
+{
+  compute( phaseVolFraction,
+           m_phaseMaxHistoricalVolFraction[k],
+           m_phaseMinHistoricalVolFraction[k],
+           m_phaseTrappedVolFrac[k][q],
+           m_phaseRelPerm[k][q],
+           m_dPhaseRelPerm_dPhaseVolFrac[k][q],
+           phaseVolFracPositions );
+}
+
+GEOS_HOST_DEVICE
+inline
+void
+TableRelativePermeabilityHysteresis::KernelWrapper::
+  locatePhaseVolFraction( arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseVolFraction,
+                          TableFunction::AxisPosition * const phaseVolFracPositions ) const
+{
+  using PT = RelativePermeabilityBase::PhaseType;
+  integer const ipWater = m_phaseOrder[PT::WATER];
+  integer const ipOil = m_phaseOrder[PT::OIL];
+  integer const ipGas = m_phaseOrder[PT::GAS];
+
+  if( ipWater >= 0 && ipOil >= 0 && ipGas >= 0 )
+  {
+    using TPT = constitutive::TableRelativePermeabilityHysteresis::ThreePhasePairPhaseType;
+    m_drainageRelPermKernelWrappers[TPT::WETTING].locate( phaseVolFraction[ipWater], phaseVolFracPositions[ipWater] );
+    m_drainageRelPermKernelWrappers[TPT::INTERMEDIATE_WETTING].locate( phaseVolFraction[ipOil], phaseVolFracPositions[ipOil] );
+    m_drainageRelPermKernelWrappers[TPT::NONWETTING].locate( phaseVolFraction[ipGas], phaseVolFracPositions[ipGas] );
+  }
+  else
+  {
+    using TPT = constitutive::TableRelativePermeabilityHysteresis::TwoPhasePairPhaseType;
+    integer const ipWetting = ( ipWater < 0 ) ? ipOil : ipWater;
+    integer const ipNonWetting = ( ipGas < 0 ) ? ipOil : ipGas;
+    m_drainageRelPermKernelWrappers[TPT::WETTING].locate( phaseVolFraction[ipWetting], phaseVolFracPositions[ipWetting] );
+    m_drainageRelPermKernelWrappers[TPT::NONWETTING].locate( phaseVolFraction[ipNonWetting], phaseVolFracPositions[ipNonWetting] );
+  }
+}
+
+inline
+void
+TableRelativePermeabilityHysteresis::KernelWrapper::
+  getPhaseVolFractionTables( integer const ip,
+                             std::vector< TableFunction::KernelWrapper const * > & tables ) const
+{
+  using PT = RelativePermeabilityBase::PhaseType;
+  integer const ipWater = m_phaseOrder[PT::WATER];
+  integer const ipOil = m_phaseOrder[PT::OIL];
+  integer const ipGas = m_phaseOrder[PT::GAS];
+
+  if( ipWater >= 0 && ipOil >= 0 && ipGas >= 0 )
+  {
+    using TPT = constitutive::TableRelativePermeabilityHysteresis::ThreePhasePairPhaseType;
+    if( ip == ipWater )
+    {
+      tables.push_back( &m_drainageRelPermKernelWrappers[TPT::WETTING] );
+    }
+    else if( ip == ipOil )
+    {
+      tables.push_back( &m_drainageRelPermKernelWrappers[TPT::INTERMEDIATE_WETTING] );
+      tables.push_back( &m_drainageRelPermKernelWrappers[TPT::INTERMEDIATE_NONWETTING] );
+    }
+    else if( ip == ipGas )
+    {
+      tables.push_back( &m_drainageRelPermKernelWrappers[TPT::NONWETTING] );
+    }
+  }
+  else
+  {
+    using TPT = constitutive::TableRelativePermeabilityHysteresis::TwoPhasePairPhaseType;
+    integer const ipWetting = ( ipWater < 0 ) ? ipOil : ipWater;
+    integer const ipNonWetting = ( ipGas < 0 ) ? ipOil : ipGas;
+    if( ip == ipWetting )
+    {
+      tables.push_back( &m_drainageRelPermKernelWrappers[TPT::WETTING] );
+    }
+    else if( ip == ipNonWetting )
+    {
+      tables.push_back( &m_drainageRelPermKernelWrappers[TPT::NONWETTING] );
+    }
+  }
+}
+
 } // namespace constitutive
 
 } // namespace geos
@@ -95,12 +95,6 @@ void CeramicDamage::postInputInitialization()
 }
 
 
-void CeramicDamage::saveConvergedState() const
-{
-  SolidBase::saveConvergedState();
-}
-
-
 REGISTER_CATALOG_ENTRY( ConstitutiveBase, CeramicDamage, std::string const &, Group * const )
 }
 } /* namespace geos */
@@ -92,6 +92,8 @@ DelftEgg::DelftEgg( string const & name, Group * const parent ):
   registerWrapper( viewKeyStruct::oldPreConsolidationPressureString(), &m_oldPreConsolidationPressure ).
     setApplyDefaultValue( -1 ).
     setDescription( "Old preconsolidation pressure" );
+
+  registerStateVariable( m_newPreConsolidationPressure, m_oldPreConsolidationPressure );
 }
 
 
@@ -144,25 +146,6 @@ void DelftEgg::postInputInitialization()
 }
 
 
-void DelftEgg::saveConvergedState() const
-{
-  SolidBase::saveConvergedState(); // TODO: not ideal, as we have separate loops for base and derived data
-
-  localIndex const numE = numElem();
-  localIndex const numQ = numQuad();
-
-  arrayView2d< real64 const > newPreConsolidationPressure = m_newPreConsolidationPressure;
-  arrayView2d< real64 > oldPreConsolidationPressure = m_oldPreConsolidationPressure;
-
-  forAll< parallelDevicePolicy<> >( numE, [=] GEOS_HOST_DEVICE ( localIndex const k )
-  {
-    for( localIndex q = 0; q < numQ; ++q )
-    {
-      oldPreConsolidationPressure( k, q ) = newPreConsolidationPressure( k, q );
-    }
-  } );
-}
-
 REGISTER_CATALOG_ENTRY( ConstitutiveBase, DelftEgg, string const &, Group * const )
 }
 } /* namespace geos */
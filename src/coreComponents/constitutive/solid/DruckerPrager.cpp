@@ -81,6 +81,8 @@ DruckerPrager::DruckerPrager( string const & name, Group * const parent ):
   registerWrapper( viewKeyStruct::oldCohesionString(), &m_oldCohesion ).
     setApplyDefaultValue( -1 ).
     setDescription( "Old cohesion state" );
+
+  registerStateVariable( m_newCohesion, m_oldCohesion );
 }
 
 
@@ -141,26 +143,6 @@ void DruckerPrager::postInputInitialization()
 }
 
 
-void DruckerPrager::saveConvergedState() const
-{
-  SolidBase::saveConvergedState(); // TODO: not ideal, as we have separate loops for base and derived data
-
-  localIndex const numE = numElem();
-  localIndex const numQ = numQuad();
-
-  arrayView2d< real64 const > newCohesion = m_newCohesion;
-  arrayView2d< real64 > oldCohesion = m_oldCohesion;
-
-  forAll< parallelDevicePolicy<> >( numE, [=] GEOS_HOST_DEVICE ( localIndex const k )
-  {
-    for( localIndex q = 0; q < numQ; ++q )
-    {
-      oldCohesion( k, q ) = newCohesion( k, q );
-    }
-  } );
-}
-
-
 REGISTER_CATALOG_ENTRY( ConstitutiveBase, DruckerPrager, std::string const &, Group * const )
 }
 } /* namespace geos */
@@ -369,8 +369,6 @@ public:
   virtual void allocateConstitutiveData( dataRepository::Group & parent,
                                          localIndex const numConstitutivePointsPerParentIndex ) override;
 
-  virtual void saveConvergedState() const override;
-
   /**
    * @name Static Factory Catalog members and functions
    */
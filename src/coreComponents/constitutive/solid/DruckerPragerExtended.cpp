@@ -97,6 +97,8 @@ DruckerPragerExtended::DruckerPragerExtended( string const & name, Group * const
   registerWrapper( viewKeyStruct::oldStateString(), &m_oldState ).
     setApplyDefaultValue( 0.0 ).
     setDescription( "Old equivalent plastic shear strain" );
+
+  registerStateVariable( m_newState, m_oldState );
 }
 
 
@@ -161,26 +163,6 @@ void DruckerPragerExtended::postInputInitialization()
 }
 
 
-void DruckerPragerExtended::saveConvergedState() const
-{
-  SolidBase::saveConvergedState(); // TODO: not ideal, as we have separate loops for base and derived data
-
-  localIndex const numE = numElem();
-  localIndex const numQ = numQuad();
-
-  arrayView2d< real64 const > newState = m_newState;
-  arrayView2d< real64 > oldState = m_oldState;
-
-  forAll< parallelDevicePolicy<> >( numE, [=] GEOS_HOST_DEVICE ( localIndex const k )
-  {
-    for( localIndex q = 0; q < numQ; ++q )
-    {
-      oldState( k, q ) = newState( k, q );
-    }
-  } );
-}
-
-
 REGISTER_CATALOG_ENTRY( ConstitutiveBase, DruckerPragerExtended, string const &, Group * const )
 }
 } /* namespace geos */
@@ -64,12 +64,6 @@ void PerfectlyPlastic::postInputInitialization()
 }
 
 
-void PerfectlyPlastic::saveConvergedState() const
-{
-  SolidBase::saveConvergedState();
-}
-
-
 REGISTER_CATALOG_ENTRY( ConstitutiveBase, PerfectlyPlastic, std::string const &, Group * const )
 }
 } /* namespace geos */
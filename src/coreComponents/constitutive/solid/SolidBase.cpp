@@ -88,6 +88,48 @@ void SolidBase::allocateConstitutiveData( dataRepository::Group & parent,
   m_oldStress.resize( 0, numConstitutivePointsPerParentIndex, 6 );
 
   ConstitutiveBase::allocateConstitutiveData( parent, numConstitutivePointsPerParentIndex );
+
+  // the registered history variables are saved in the stress loop, they must be sized like the stress
+  for( auto const & [newValue, oldValue] : m_stateVariables )
+  {
+    GEOS_ERROR_IF( newValue == nullptr || oldValue == nullptr || newValue == oldValue,
+                   getFullName() << ": invalid history variable registered" );
+    GEOS_ERROR_IF( newValue->size( 0 ) != m_newStress.size( 0 ) || newValue->size( 1 ) != numConstitutivePointsPerParentIndex ||
+                   oldValue->size( 0 ) != m_newStress.size( 0 ) || oldValue->size( 1 ) != numConstitutivePointsPerParentIndex,
+                   getFullName() << ": the history variables must be allocated with " << m_newStress.size( 0 ) << " x "
+                                 << numConstitutivePointsPerParentIndex << " values" );
+  }
+  updateStateVariableViews();
+}
+
+
+void SolidBase::registerStateVariable( array2d< real64 > const & newValue,
+                                       array2d< real64 > & oldValue )
+{
+  m_stateVariables.emplace_back( &newValue, &oldValue );
+}
+
+
+void SolidBase::resize( localIndex const newSize )
+{
+  ConstitutiveBase::resize( newSize );
+
+  // resizing may reallocate the history variables
+  updateStateVariableViews();
+}
+
+
+void SolidBase::updateStateVariableViews()
+{
+  integer const numStateVariables = LvArray::integerConversion< integer >( m_stateVariables.size() );
+
+  m_newStateVariableViews.resize( numStateVariables );
+  m_oldStateVariableViews.resize( numStateVariables );
+  for( integer i = 0; i < numStateVariables; ++i )
+  {
+    m_newStateVariableViews[i] = m_stateVariables[i].first->toViewConst();
+    m_oldStateVariableViews[i] = m_stateVariables[i].second->toView();
+  }
 }
 
 
@@ -95,15 +137,23 @@ void SolidBase::saveConvergedState() const
 {
   localIndex const numE = numElem();
   localIndex const numQ = numQuad();
+  integer const numStateVariables = LvArray::integerConversion< integer >( m_newStateVariableViews.size() );
 
   arrayView3d< real64 const, solid::STRESS_USD > newStress = m_newStress;
   arrayView3d< real64, solid::STRESS_USD > oldStress = m_oldStress;
 
+  auto const newState = m_newStateVariableViews.toNestedViewConst();
+  auto const oldState = m_oldStateVariableViews.toNestedView();
+
   forAll< parallelDevicePolicy<> >( numE, [=] GEOS_HOST_DEVICE ( localIndex const k )
   {
     for( localIndex q = 0; q < numQ; ++q )
     {
       LvArray::tensorOps::copy< 6 >( oldStress[k][q], newStress[k][q] );
+      for( integer i = 0; i < numStateVariables; ++i )
+      {
+        oldState[i]( k, q ) = newState[i]( k, q );
+      }
     }
   } );
 }
@@ -578,6 +578,12 @@ public:
   /// Save state data in preparation for next timestep
   virtual void saveConvergedState() const override;
 
+  /**
+   * @brief Resize the constitutive data, and update the views on the history variables
+   * @param newSize the new number of elements
+   */
+  virtual void resize( localIndex const newSize ) override;
+
   /**
    * @brief Enable/disable inelasticity
    * @param flag Flag to disable (if true) or enable (if false) inelastic response
@@ -680,6 +686,17 @@ protected:
   /// Post-process XML input
   virtual void postInputInitialization() override;
 
+  /**
+   * @brief Register a history variable of the model, saved along with the stress in saveConvergedState.
+   * @param newValue the current value of the variable at the quadrature points
+   * @param oldValue the value of the variable at the previous time step
+   *
+   * The stress and all the registered variables are saved in a single kernel, so derived models
+   * do not need to override saveConvergedState to save their own history variables.
+   */
+  void registerStateVariable( array2d< real64 > const & newValue,
+                              array2d< real64 > & oldValue );
+
   /// The current stress at a quadrature point (i.e. at timestep n, global newton iteration k)
   array3d< real64, solid::STRESS_PERMUTATION > m_newStress;
 
@@ -698,6 +715,20 @@ protected:
   /// The default value of the thermal expansion coefficient for any new allocations.
   real64 m_defaultThermalExpansionCoefficient = 0;
 
+  /// The history variables (current and previous values) saved along with the stress
+  std::vector< std::pair< array2d< real64 > const *, array2d< real64 > * > > m_stateVariables;
+
+  /// Views on the current values of the history variables, rebuilt when the variables are reallocated
+  array1d< arrayView2d< real64 const > > m_newStateVariableViews;
+
+  /// Views on the previous values of the history variables, rebuilt when the variables are reallocated
+  array1d< arrayView2d< real64 > > m_oldStateVariableViews;
+
+private:
+
+  /// Build the views on the registered history variables used in saveConvergedState
+  void updateStateVariableViews();
+
   /// Flag to disable inelasticity (plasticity, damage, etc.)
   bool m_disableInelasticity = false;
 };
@@ -202,6 +202,51 @@ public:
     }
   }
 
+  // The density specialized on the number of components must agree with the generic one
+  void testSpecializedDensity( DensityData< NC > const & data )
+  {
+    real64 const pressure = std::get< 0 >( data );
+    real64 const temperature = std::get< 1 >( data );
+    stackArray1d< real64, numComps > phaseComposition;
+    TestFluid< NC >::createArray( phaseComposition, std::get< 2 >( data ));
+
+    auto componentProperties = m_fluid->createKernelWrapper();
+    auto kernelWrapper = m_density->createKernelWrapper();
+
+    real64 molarDensity[2] = { 0.0, 0.0 };
+    real64 massDensity[2] = { 0.0, 0.0 };
+    stackArray2d< real64, 2 * numDofs > molarDensityDerivs( 2, numDofs );
+    stackArray2d< real64, 2 * numDofs > massDensityDerivs( 2, numDofs );
+
+    kernelWrapper.compute< 0 >( componentProperties,
+                                pressure,
+                                temperature,
+                                phaseComposition.toSliceConst(),
+                                molarDensity[0],
+                                molarDensityDerivs[0],
+                                massDensity[0],
+                                massDensityDerivs[0],
+                                false );
+    kernelWrapper.compute< NC >( componentProperties,
+                                 pressure,
+                                 temperature,
+                                 phaseComposition.toSliceConst(),
+                                 molarDensity[1],
+                                 molarDensityDerivs[1],
+                                 massDensity[1],
+                                 massDensityDerivs[1],
+                                 false );
+
+    real64 constexpr tol = 1.0e-12;
+    checkRelativeError( molarDensity[1], molarDensity[0], tol, tol );
+    checkRelativeError( massDensity[1], massDensity[0], tol, tol );
+    for( integer kc = 0; kc < numDofs; ++kc )
+    {
+      checkRelativeError( molarDensityDerivs( 1, kc ), molarDensityDerivs( 0, kc ), tol, tol );
+      checkRelativeError( massDensityDerivs( 1, kc ), massDensityDerivs( 0, kc ), tol, tol );
+    }
+  }
+
 protected:
   std::unique_ptr< CompositionalDensity > m_density{};
   std::unique_ptr< TestFluid< NC > > m_fluid{};
@@ -221,6 +266,16 @@ TEST_P( SoaveRedlichKwong, testDensityDerivatives )
   testDensityDerivatives( GetParam() );
 }
 
+TEST_P( PengRobinson, testSpecializedDensity )
+{
+  testSpecializedDensity( GetParam() );
+}
+
+TEST_P( SoaveRedlichKwong, testSpecializedDensity )
+{
+  testSpecializedDensity( GetParam() );
+}
+
 /* UNCRUSTIFY-OFF */
 
 INSTANTIATE_TEST_SUITE_P(
@@ -205,7 +205,6 @@ private:
                             arraySlice1d< real64 > const molarDensityDerivs ) const
   {
     auto const componentProperties = this->m_fluid->createKernelWrapper();
-    auto const binaryInteractionCoefficients = componentProperties.m_componentBinaryCoeff;
     auto const volumeShift = componentProperties.m_componentVolumeShift;
 
     real64 compressibilityFactor = 0.0;
@@ -244,9 +243,6 @@ private:
     CubicEOSPhaseModel< EOS_TYPE >::
     computeCompressibilityFactor( numComps,
                                   composition,
-                                  binaryInteractionCoefficients,
-                                  aPureCoefficient.toSliceConst(),
-                                  bPureCoefficient.toSliceConst(),
                                   aMixtureCoefficient,
                                   bMixtureCoefficient,
                                   compressibilityFactor );
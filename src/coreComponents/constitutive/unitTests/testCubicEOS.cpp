@@ -546,7 +546,6 @@ public:
   void testNumericalDerivatives( ParamType const & testData ) const
   {
     auto const componentProperties = this->m_fluid->createKernelWrapper();
-    auto const binaryInteractionCoefficients = componentProperties.m_componentBinaryCoeff;
 
     stackArray1d< real64, numComps > aPureCoefficient( numComps );
     stackArray1d< real64, numComps > bPureCoefficient( numComps );
@@ -575,9 +574,6 @@ public:
       CubicEOSPhaseModel< EOS >::computeCompressibilityFactor(
         numComps,
         zmf.toSliceConst(),
-        binaryInteractionCoefficients,
-        aPureCoefficient.toSliceConst(),
-        bPureCoefficient.toSliceConst(),
         aMixtureCoefficient,
         bMixtureCoefficient,
         z );
@@ -824,3 +820,187 @@ INSTANTIATE_TEST_SUITE_P(
   FugacityDerivativeSRK4TestFixture,
   ::testing::ValuesIn( generateTestData< 4 >())
   );
+
+// Residual of the cubic m3 * x^3 + m2 * x^2 + m1 * x + m0, relative to the magnitude of its terms
+real64 cubicResidual( real64 const m3, real64 const m2, real64 const m1, real64 const m0, real64 const x )
+{
+  real64 const residual = ( ( m3 * x + m2 ) * x + m1 ) * x + m0;
+  real64 const scale = LvArray::math::abs( m3 * x * x * x ) + LvArray::math::abs( m2 * x * x )
+                       + LvArray::math::abs( m1 * x ) + LvArray::math::abs( m0 );
+  return LvArray::math::abs( residual ) / scale;
+}
+
+TEST( CubicEOSTest, testSolveCubicPolynomial )
+{
+  // the roots of the cubics, including close roots
+  std::array< std::array< real64, 3 >, 4 > const expectedRoots = {
+    std::array< real64, 3 >{ 0.05, 0.3, 1.2 },
+    std::array< real64, 3 >{ 0.1, 0.1 + 1.0e-6, 0.9 },
+    std::array< real64, 3 >{ 0.02, 0.75, 0.75 + 1.0e-7 },
+    std::array< real64, 3 >{ 0.3, 0.3 + 1.0e-4, 0.31 } };
+
+  for( auto const & [r0, r1, r2] : expectedRoots )
+  {
+    real64 const m3 = 2.0;
+    real64 const m2 = -m3 * ( r0 + r1 + r2 );
+    real64 const m1 = m3 * ( r0 * r1 + r1 * r2 + r0 * r2 );
+    real64 const m0 = -m3 * r0 * r1 * r2;
+
+    real64 roots[3]{};
+    integer numRoots = 0;
+    CubicEOSPhaseModel< PengRobinsonEOS >::solveCubicPolynomial( m3, m2, m1, m0, roots, numRoots );
+
+    for( integer i = 0; i < numRoots; ++i )
+    {
+      EXPECT_LT( cubicResidual( m3, m2, m1, m0, roots[i] ), 1.0e-12 ) << "root " << roots[i];
+      real64 const distance = LvArray::math::min( LvArray::math::abs( roots[i] - r0 ),
+                                                  LvArray::math::min( LvArray::math::abs( roots[i] - r1 ),
+                                                                      LvArray::math::abs( roots[i] - r2 ) ) );
+      EXPECT_LT( distance, 1.0e-5 ) << "root " << roots[i];
+    }
+  }
+
+  // a single real root
+  real64 roots[3]{};
+  integer numRoots = 0;
+  // (x - 0.5) * (x^2 + 0.1)
+  CubicEOSPhaseModel< PengRobinsonEOS >::solveCubicPolynomial( 1.0, -0.5, 0.1, -0.05, roots, numRoots );
+  ASSERT_EQ( numRoots, 1 );
+  EXPECT_NEAR( roots[0], 0.5, 1.0e-14 );
+}
+
+template< typename EOS, int NC >
+class RootSelectionTestFixture : public DerivativeTestFixture< EOS, NC >
+{
+public:
+  using DerivativeTestFixture< EOS, NC >::numComps;
+  using ParamType = typename DerivativeTestFixture< EOS, NC >::ParamType;
+public:
+  // Sweep the low pressures at which the cubic has a liquid and a vapour root, and check that the selection with
+  // the reduced Gibbs energy gives the root selected by the Gibbs energy computed with the fugacity coefficients
+  void testRootSelection( ParamType const & testData ) const
+  {
+    auto const componentProperties = this->m_fluid->createKernelWrapper();
+    auto const binaryInteractionCoefficients = componentProperties.m_componentBinaryCoeff;
+
+    stackArray1d< real64, numComps > composition;
+    real64 const temperature = std::get< 1 >( testData );
+    TestFluid< NC >::createArray( composition, std::get< 2 >( testData ));
+    real64 sumComposition = 0.0;
+    for( integer ic = 0; ic < numComps; ++ic )
+    {
+      sumComposition += composition[ic];
+    }
+
+    stackArray1d< real64, numComps > aPureCoefficient( numComps );
+    stackArray1d< real64, numComps > bPureCoefficient( numComps );
+    stackArray1d< real64, numComps > logFugacityCoefficientsMin( numComps );
+    stackArray1d< real64, numComps > logFugacityCoefficientsMax( numComps );
+
+    integer numSelections = 0;
+    for( integer ip = 0; ip <= 20; ++ip )
+    {
+      real64 const pressure = 1.0e4 * pow( 10.0, 0.1 * ip );
+      real64 aMixtureCoefficient = 0.0;
+      real64 bMixtureCoefficient = 0.0;
+      CubicEOSPhaseModel< EOS >::computeMixtureCoefficients( numComps,
+                                                             pressure,
+                                                             temperature,
+                                                             composition.toSliceConst(),
+                                                             componentProperties,
+                                                             aPureCoefficient.toSlice(),
+                                                             bPureCoefficient.toSlice(),
+                                                             aMixtureCoefficient,
+                                                             bMixtureCoefficient );
+
+      // the polished roots satisfy the cubic
+      real64 const B = bMixtureCoefficient;
+      real64 const m2 = ( EOS::delta1 + EOS::delta2 - 1.0 ) * B - 1.0;
+      real64 const m1 = aMixtureCoefficient + EOS::delta1 * EOS::delta2 * B * B - ( EOS::delta1 + EOS::delta2 ) * B * ( B + 1.0 );
+      real64 const m0 = -( aMixtureCoefficient * B + EOS::delta1 * EOS::delta2 * B * B * ( B + 1.0 ) );
+      real64 roots[3]{};
+      integer numRoots = 0;
+      CubicEOSPhaseModel< EOS >::solveCubicPolynomial( 1.0, m2, m1, m0, roots, numRoots );
+      for( integer i = 0; i < numRoots; ++i )
+      {
+        EXPECT_LT( cubicResidual( 1.0, m2, m1, m0, roots[i] ), 1.0e-12 ) << "pressure " << pressure << ", root " << roots[i];
+      }
+
+      real64 compressibilityFactor = 0.0;
+      CubicEOSPhaseModel< EOS >::computeCompressibilityFactor( numComps,
+                                                               composition.toSliceConst(),
+                                                               aMixtureCoefficient,
+                                                               bMixtureCoefficient,
+                                                               compressibilityFactor );
+
+      real64 zMin = LvArray::NumericLimits< real64 >::max;
+      real64 zMax = -LvArray::NumericLimits< real64 >::max;
+      for( integer i = 0; i < numRoots; ++i )
+      {
+        if( roots[i] > B )
+        {
+          zMin = LvArray::math::min( zMin, roots[i] );
+          zMax = LvArray::math::max( zMax, roots[i] );
+        }
+      }
+      if( numRoots < 3 || !( zMin < zMax ) )
+      {
+        continue;
+      }
+
+      // Gibbs energy difference computed with the fugacity coefficients of all the components
+      CubicEOSPhaseModel< EOS >::computeLogFugacityCoefficients( numComps, composition.toSliceConst(), binaryInteractionCoefficients,
+                                                                 zMin, aPureCoefficient.toSliceConst(), bPureCoefficient.toSliceConst(),
+                                                                 aMixtureCoefficient, bMixtureCoefficient,
+                                                                 logFugacityCoefficientsMin.toSlice() );
+      CubicEOSPhaseModel< EOS >::computeLogFugacityCoefficients( numComps, composition.toSliceConst(), binaryInteractionCoefficients,
+                                                                 zMax, aPureCoefficient.toSliceConst(), bPureCoefficient.toSliceConst(),
+                                                                 aMixtureCoefficient, bMixtureCoefficient,
+                                                                 logFugacityCoefficientsMax.toSlice() );
+      real64 gibbsEnergyMin = 0.0;
+      real64 gibbsEnergyMax = 0.0;
+      for( integer ic = 0; ic < numComps; ++ic )
+      {
+        gibbsEnergyMin += composition[ic] * logFugacityCoefficientsMin[ic];
+        gibbsEnergyMax += composition[ic] * logFugacityCoefficientsMax[ic];
+      }
+
+      real64 const reducedGibbsEnergyMin =
+        CubicEOSPhaseModel< EOS >::computeReducedGibbsEnergy( sumComposition, zMin, aMixtureCoefficient, bMixtureCoefficient );
+      real64 const reducedGibbsEnergyMax =
+        CubicEOSPhaseModel< EOS >::computeReducedGibbsEnergy( sumComposition, zMax, aMixtureCoefficient, bMixtureCoefficient );
+      EXPECT_NEAR( reducedGibbsEnergyMin, gibbsEnergyMin, 1.0e-10 * ( 1.0 + LvArray::math::abs( gibbsEnergyMin ) ) );
+      EXPECT_NEAR( reducedGibbsEnergyMax, gibbsEnergyMax, 1.0e-10 * ( 1.0 + LvArray::math::abs( gibbsEnergyMax ) ) );
+
+      real64 const expectedCompressibilityFactor = ( gibbsEnergyMin - gibbsEnergyMax < 0 ) ? zMin : zMax;
+      EXPECT_EQ( compressibilityFactor, expectedCompressibilityFactor ) << "pressure " << pressure;
+      ++numSelections;
+    }
+
+    // the sweep goes through the two-root region of these fluids
+    EXPECT_GT( numSelections, 0 );
+  }
+};
+
+using RootSelectionPR4TestFixture = RootSelectionTestFixture< PengRobinsonEOS, 4 >;
+using RootSelectionSRK4TestFixture = RootSelectionTestFixture< SoaveRedlichKwongEOS, 4 >;
+
+TEST_P( RootSelectionPR4TestFixture, testRootSelection )
+{
+  testRootSelection( GetParam() );
+}
+TEST_P( RootSelectionSRK4TestFixture, testRootSelection )
+{
+  testRootSelection( GetParam() );
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  CubicEOSTest,
+  RootSelectionPR4TestFixture,
+  ::testing::ValuesIn( generateTestData< 4 >())
+  );
+INSTANTIATE_TEST_SUITE_P(
+  CubicEOSTest,
+  RootSelectionSRK4TestFixture,
+  ::testing::ValuesIn( generateTestData< 4 >())
+  );
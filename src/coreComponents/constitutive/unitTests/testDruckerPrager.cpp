@@ -159,6 +159,97 @@ TEST( DruckerPragerTests, testDruckerPragerHost )
 }
 
 
+TEST( DruckerPragerTests, testDruckerPragerSaveConvergedState )
+{
+  // create a Drucker-Prager model whose cohesion degrades under plastic loading
+  conduit::Node node;
+  dataRepository::Group rootGroup( "root", node );
+  ConstitutiveManager constitutiveManager( "constitutive", &rootGroup );
+
+  string const inputStream =
+    "<Constitutive>"
+    "   <DruckerPrager"
+    "      name=\"granite\" "
+    "      defaultDensity=\"2700\" "
+    "      defaultBulkModulus=\"1000.0\" "
+    "      defaultShearModulus=\"1000.0\" "
+    "      defaultFrictionAngle=\"30.0\" "
+    "      defaultDilationAngle=\"15.0\" "
+    "      defaultHardeningRate=\"-2000.0\" "
+    "      defaultCohesion=\"1\"/>"
+    "</Constitutive>";
+
+  xmlWrapper::xmlDocument xmlDocument;
+  xmlWrapper::xmlResult xmlResult = xmlDocument.loadString( inputStream );
+  ASSERT_TRUE( xmlResult );
+
+  xmlWrapper::xmlNode xmlConstitutiveNode = xmlDocument.getChild( "Constitutive" );
+  constitutiveManager.processInputFileRecursive( xmlDocument, xmlConstitutiveNode );
+  constitutiveManager.postInputInitializationRecursive();
+
+  localIndex constexpr numElem = 3;
+  localIndex constexpr numQuad = 2;
+
+  dataRepository::Group disc( "discretization", &rootGroup );
+  disc.resize( numElem );
+
+  DruckerPrager & cm = constitutiveManager.getConstitutiveRelation< DruckerPrager >( "granite" );
+  cm.allocateConstitutiveData( disc, numQuad );
+
+  array3d< real64, solid::STRESS_PERMUTATION > & newStress =
+    cm.getReference< array3d< real64, solid::STRESS_PERMUTATION > >( SolidBase::viewKeyStruct::stressString() );
+  array3d< real64, solid::STRESS_PERMUTATION > & oldStress =
+    cm.getReference< array3d< real64, solid::STRESS_PERMUTATION > >( SolidBase::viewKeyStruct::oldStressString() );
+  array2d< real64 > & newCohesion = cm.getReference< array2d< real64 > >( DruckerPrager::viewKeyStruct::newCohesionString() );
+  array2d< real64 > & oldCohesion = cm.getReference< array2d< real64 > >( DruckerPrager::viewKeyStruct::oldCohesionString() );
+
+  DruckerPrager::KernelWrapper cmw = cm.createKernelUpdates();
+  bool cohesionChanged = false;
+
+  for( localIndex loadstep = 0; loadstep < 10; ++loadstep )
+  {
+    // load each element with a different strain increment, so that the history differs between elements
+    forAll< serialPolicy >( numElem, [=] ( localIndex const k )
+    {
+      real64 strainIncrement[6] = { -1e-4 * ( k + 1 ), 0, 0, 0, 0, 0 };
+      for( localIndex q = 0; q < numQuad; ++q )
+      {
+        real64 stress[6] = {0};
+        real64 stiffness[6][6] = {{0}};
+        cmw.smallStrainUpdate( k, q, 0.0, strainIncrement, stress, stiffness );
+      }
+    } );
+
+    // the cohesion changed by the plastic loading is only saved below
+    newCohesion.move( hostMemorySpace, false );
+    oldCohesion.move( hostMemorySpace, false );
+    for( localIndex k = 0; k < numElem; ++k )
+    {
+      cohesionChanged = cohesionChanged || newCohesion( k, 0 ) < oldCohesion( k, 0 );
+    }
+
+    cm.saveConvergedState();
+
+    newStress.move( hostMemorySpace, false );
+    oldStress.move( hostMemorySpace, false );
+    newCohesion.move( hostMemorySpace, false );
+    oldCohesion.move( hostMemorySpace, false );
+    for( localIndex k = 0; k < numElem; ++k )
+    {
+      for( localIndex q = 0; q < numQuad; ++q )
+      {
+        EXPECT_EQ( oldCohesion( k, q ), newCohesion( k, q ) );
+        for( localIndex i = 0; i < 6; ++i )
+        {
+          EXPECT_EQ( oldStress( k, q, i ), newStress( k, q, i ) );
+        }
+      }
+    }
+  }
+  EXPECT_TRUE( cohesionChanged );
+}
+
+
 
 template< typename POLICY >
 void testDruckerPragerExtendedDriver()
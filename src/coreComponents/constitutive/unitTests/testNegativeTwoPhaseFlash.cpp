@@ -267,6 +267,83 @@ public:
     }
   }
 
+  // The flash specialized on the number of components must agree with the generic one
+  void testSpecializedFlash( FlashData< NC > const & data )
+  {
+    auto componentProperties = this->m_fluid->createKernelWrapper();
+
+    bool const expectedStatus = std::get< 3 >( data );
+    if( !expectedStatus ) return;
+
+    real64 const pressure = std::get< 0 >( data );
+    real64 const temperature = std::get< 1 >( data );
+    stackArray1d< real64, numComps > composition;
+    TestFluid< NC >::createArray( composition, std::get< 2 >( data ));
+
+    real64 vapourFraction[2] = { -1.0, -1.0 };
+    stackArray2d< real64, 2 * numComps > liquidComposition( 2, numComps );
+    stackArray2d< real64, 2 * numComps > vapourComposition( 2, numComps );
+    stackArray2d< real64, 2 * numDofs > vapourFractionDerivs( 2, numDofs );
+    stackArray3d< real64, 2 * numComps * numDofs > liquidCompositionDerivs( 2, numComps, numDofs );
+    stackArray3d< real64, 2 * numComps * numDofs > vapourCompositionDerivs( 2, numComps, numDofs );
+
+    auto const evaluateFlash = [&]( auto const numComponents, integer const k )
+    {
+      integer constexpr NUM_COMP = numComponents();
+      stackArray2d< real64, numComps > kValues( 1, numComps );
+      kValues.zero();
+
+      bool const status = NegativeTwoPhaseFlash::compute< NUM_COMP >(
+        numComps,
+        pressure,
+        temperature,
+        composition.toSliceConst(),
+        componentProperties,
+        EOS_TYPE,
+        EOS_TYPE,
+        kValues.toSlice(),
+        vapourFraction[k],
+        liquidComposition[k],
+        vapourComposition[k] );
+      ASSERT_EQ( expectedStatus, status );
+
+      NegativeTwoPhaseFlash::computeDerivatives< NUM_COMP >(
+        numComps,
+        pressure,
+        temperature,
+        composition.toSliceConst(),
+        componentProperties,
+        EOS_TYPE,
+        EOS_TYPE,
+        vapourFraction[k],
+        liquidComposition[k].toSliceConst(),
+        vapourComposition[k].toSliceConst(),
+        vapourFractionDerivs[k],
+        liquidCompositionDerivs[k],
+        vapourCompositionDerivs[k] );
+    };
+
+    evaluateFlash( std::integral_constant< integer, 0 >(), 0 );
+    evaluateFlash( std::integral_constant< integer, NC >(), 1 );
+
+    real64 constexpr tol = 1.0e-12;
+    checkRelativeError( vapourFraction[1], vapourFraction[0], tol, tol );
+    for( integer ic = 0; ic < numComps; ++ic )
+    {
+      checkRelativeError( liquidComposition( 1, ic ), liquidComposition( 0, ic ), tol, tol );
+      checkRelativeError( vapourComposition( 1, ic ), vapourComposition( 0, ic ), tol, tol );
+    }
+    for( integer kc = 0; kc < numDofs; ++kc )
+    {
+      checkRelativeError( vapourFractionDerivs( 1, kc ), vapourFractionDerivs( 0, kc ), tol, tol );
+      for( integer ic = 0; ic < numComps; ++ic )
+      {
+        checkRelativeError( liquidCompositionDerivs( 1, ic, kc ), liquidCompositionDerivs( 0, ic, kc ), tol, tol );
+        checkRelativeError( vapourCompositionDerivs( 1, ic, kc ), vapourCompositionDerivs( 0, ic, kc ), tol, tol );
+      }
+    }
+  }
+
 protected:
   std::unique_ptr< TestFluid< NC > > m_fluid{};
 };
@@ -316,6 +393,26 @@ TEST_P( NegativeTwoPhaseFlash4CompSRK, testNegativeFlashDerivatives )
   testFlashDerivatives( GetParam() );
 }
 
+TEST_P( NegativeTwoPhaseFlash2CompPR, testSpecializedFlash )
+{
+  testSpecializedFlash( GetParam() );
+}
+
+TEST_P( NegativeTwoPhaseFlash2CompSRK, testSpecializedFlash )
+{
+  testSpecializedFlash( GetParam() );
+}
+
+TEST_P( NegativeTwoPhaseFlash4CompPR, testSpecializedFlash )
+{
+  testSpecializedFlash( GetParam() );
+}
+
+TEST_P( NegativeTwoPhaseFlash4CompSRK, testSpecializedFlash )
+{
+  testSpecializedFlash( GetParam() );
+}
+
 //-------------------------------------------------------------------------------
 // Data generated by PVTPackage
 //-------------------------------------------------------------------------------
@@ -431,6 +431,46 @@ public:
     static void copy( U const &, localIndex const, localIndex const )
     {}
 
+    template< typename U, int NDIM, typename PERMUTATION >
+    static bool permute( Array< U, NDIM, PERMUTATION > & array, arrayView1d< localIndex const > const & newToOld )
+    {
+      GEOS_ERROR_IF_NE( array.size( 0 ), newToOld.size() );
+
+      // gather from a copy of the old values
+      Array< U, NDIM, PERMUTATION > const oldArray( array );
+      for( localIndex i = 0; i < newToOld.size(); ++i )
+      {
+        LvArray::forValuesInSliceWithIndices( oldArray[ newToOld[ i ] ],
+                                              [i, &array]( U const & oldVal, auto const ... indices )
+        {
+          array( i, indices ... ) = oldVal;
+        } );
+      }
+      return true;
+    }
+
+    static bool permute( string &, arrayView1d< localIndex const > const & )
+    {
+      // a string input is resizable, but does not hold an entry per object
+      return true;
+    }
+
+    template< typename U >
+    static std::enable_if_t< traits::HasMemberFunction_resize< U >, bool >
+    permute( U &, arrayView1d< localIndex const > const & )
+    {
+      // resized with the parent, but without a per-entry gather
+      return false;
+    }
+
+    template< typename U >
+    static std::enable_if_t< !traits::HasMemberFunction_resize< U >, bool >
+    permute( U &, arrayView1d< localIndex const > const & )
+    {
+      // not resized with the parent, there is nothing to reorder
+      return true;
+    }
+
     template< typename U=T >
     static std::enable_if_t< traits::hasCopyAssignmentOp< U > >
     copyData( U & destinationData, U const & sourceData )
@@ -451,6 +491,15 @@ public:
     copy_wrapper::copy( reference(), sourceIndex, destIndex );
   }
 
+  ///////////////////////////////////////////////////////////////////////////////////////////////////
+  virtual void permute( arrayView1d< localIndex const > const & newToOld ) override
+  {
+    wrapperHelpers::move( *m_data, hostMemorySpace, true );
+    GEOS_ERROR_IF( !copy_wrapper::permute( *m_data, newToOld ),
+                   GEOS_FMT( "{}: the entries of a wrapper of type {} cannot be permuted",
+                             getDataContext(), LvArray::system::demangleType< T >() ) );
+  }
+
 
 
   virtual void copyData( WrapperBase const & source ) override
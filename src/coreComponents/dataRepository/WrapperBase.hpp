@@ -153,6 +153,14 @@ public:
    */
   virtual void copy( localIndex const sourceIndex, localIndex const destIndex ) = 0;
 
+  /**
+   * @brief Reorders the entries of the first dimension of the wrapped object.
+   * @param[in] newToOld the old index of the entry moved to each new index
+   * @note Objects that cannot be resized (scalars, maps...) are left untouched, an error is raised for the resizable
+   *       objects other than Array, which cannot be gathered entry by entry.
+   */
+  virtual void permute( arrayView1d< localIndex const > const & newToOld ) = 0;
+
   /**
    * @brief Calls T::erase(indicesToErase)
    * @param[in] indicesToErase indices to erase
@@ -0,0 +1,406 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file denseLASolvers.hpp
+ *
+ * Direct solvers for the small dense systems that are assembled and solved inside kernels.
+ * The matrices live on the stack, their maximum size is known at compile time, and the work
+ * is done in place, so that they can be called in host and device code alike, contrary to
+ * the LAPACK wrappers of BlasLapackLA.
+ *
+ * The matrix and vector arguments can be of any type indexable as @c A[i][j] and @c b[i]
+ * (C arrays, stack arrays, slices).
+ *
+ * The rank tests are relative to the scale of the matrix, so that a well-conditioned matrix
+ * with small entries is not reported as singular, and a numerically singular matrix with
+ * large entries is.
+ */
+#ifndef GEOS_DENSELINEARALGEBRA_DENSELASOLVERS_HPP_
+#define GEOS_DENSELINEARALGEBRA_DENSELASOLVERS_HPP_
+
+#include "common/DataTypes.hpp"
+
+namespace geos
+{
+
+namespace denseLinearAlgebra
+{
+
+/**
+ * @brief Compute in place the LU factorization with partial pivoting of a square matrix.
+ * @tparam MAX_N the maximum size of the matrix
+ * @tparam MATRIX the type of the matrix
+ * @param[in] n the size of the matrix
+ * @param[inout] A the matrix, overwritten by its factors (unit lower part L, upper part U)
+ * @param[out] pivots the row interchanges, row k was interchanged with row pivots[k]
+ * @return @c false if the matrix is singular, @c true otherwise
+ *
+ * The matrix is singular if a pivot is smaller than n * epsilon times the largest entry of the matrix.
+ */
+template< integer MAX_N, typename MATRIX >
+GEOS_HOST_DEVICE
+inline
+bool factorizeLU( integer const n,
+                  MATRIX && A,
+                  integer ( & pivots )[MAX_N] )
+{
+  real64 constexpr epsilon = LvArray::NumericLimits< real64 >::epsilon;
+
+  real64 maxEntry = 0.0;
+  for( integer i = 0; i < n; ++i )
+  {
+    for( integer j = 0; j < n; ++j )
+    {
+      maxEntry = LvArray::math::max( maxEntry, LvArray::math::abs( A[i][j] ) );
+    }
+  }
+  real64 const pivotTolerance = n * epsilon * maxEntry;
+
+  for( integer k = 0; k < n; ++k )
+  {
+    integer p = k;
+    real64 maxPivot = LvArray::math::abs( A[k][k] );
+    for( integer i = k + 1; i < n; ++i )
+    {
+      if( LvArray::math::abs( A[i][k] ) > maxPivot )
+      {
+        maxPivot = LvArray::math::abs( A[i][k] );
+        p = i;
+      }
+    }
+    pivots[k] = p;
+    if( maxPivot <= pivotTolerance )
+    {
+      return false;
+    }
+
+    if( p != k )
+    {
+      for( integer j = 0; j < n; ++j )
+      {
+        real64 const tmp = A[k][j];
+        A[k][j] = A[p][j];
+        A[p][j] = tmp;
+      }
+    }
+
+    real64 const invPivot = 1.0 / A[k][k];
+    for( integer i = k + 1; i < n; ++i )
+    {
+      A[i][k] *= invPivot;
+      for( integer j = k + 1; j < n; ++j )
+      {
+        A[i][j] -= A[i][k] * A[k][j];
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Solve a linear system with the LU factors computed by factorizeLU.
+ * @tparam MAX_N the maximum size of the matrix
+ * @tparam MATRIX the type of the factors
+ * @tparam RHS the type of the right-hand side
+ * @tparam SOLUTION the type of the solution
+ * @param[in] n the size of the system
+ * @param[in] LU the factors
+ * @param[in] pivots the row interchanges
+ * @param[in] b the right-hand side
+ * @param[out] x the solution (may alias @p b)
+ */
+template< integer MAX_N, typename MATRIX, typename RHS, typename SOLUTION >
+GEOS_HOST_DEVICE
+inline
+void solveLU( integer const n,
+              MATRIX const & LU,
+              integer const ( &pivots )[MAX_N],
+              RHS const & b,
+              SOLUTION && x )
+{
+  real64 y[MAX_N];
+  for( integer i = 0; i < n; ++i )
+  {
+    y[i] = b[i];
+  }
+  for( integer k = 0; k < n; ++k )
+  {
+    real64 const tmp = y[k];
+    y[k] = y[pivots[k]];
+    y[pivots[k]] = tmp;
+  }
+
+  // forward substitution with the unit lower factor
+  for( integer i = 1; i < n; ++i )
+  {
+    for( integer j = 0; j < i; ++j )
+    {
+      y[i] -= LU[i][j] * y[j];
+    }
+  }
+
+  // backward substitution with the upper factor
+  for( integer i = n - 1; i >= 0; --i )
+  {
+    for( integer j = i + 1; j < n; ++j )
+    {
+      y[i] -= LU[i][j] * y[j];
+    }
+    y[i] /= LU[i][i];
+  }
+
+  for( integer i = 0; i < n; ++i )
+  {
+    x[i] = y[i];
+  }
+}
+
+/**
+ * @brief Solve a square linear system by LU factorization with partial pivoting.
+ * @tparam MAX_N the maximum size of the system
+ * @tparam MATRIX the type of the matrix
+ * @tparam RHS the type of the right-hand side
+ * @tparam SOLUTION the type of the solution
+ * @param[in] n the size of the system
+ * @param[in] A the matrix, left untouched
+ * @param[in] b the right-hand side
+ * @param[out] x the solution
+ * @return @c false if the matrix is singular, @c true otherwise
+ */
+template< integer MAX_N, typename MATRIX, typename RHS, typename SOLUTION >
+GEOS_HOST_DEVICE
+inline
+bool solveLinearSystem( integer const n,
+                        MATRIX const & A,
+                        RHS const & b,
+                        SOLUTION && x )
+{
+  real64 LU[MAX_N][MAX_N];
+  for( integer i = 0; i < n; ++i )
+  {
+    for( integer j = 0; j < n; ++j )
+    {
+      LU[i][j] = A[i][j];
+    }
+  }
+
+  integer pivots[MAX_N];
+  if( !factorizeLU< MAX_N >( n, LU, pivots ) )
+  {
+    return false;
+  }
+  solveLU< MAX_N >( n, LU, pivots, b, x );
+  return true;
+}
+
+/**
+ * @brief Compute in place the Cholesky factorization of a symmetric positive definite matrix.
+ * @tparam MATRIX the type of the matrix
+ * @param[in] n the size of the matrix
+ * @param[inout] A the matrix, whose lower part is overwritten by the factor L such that A = L L^T
+ * @return @c false if the matrix is not positive definite, @c true otherwise
+ *
+ * Only the lower part of @p A is read. The matrix is not positive definite if the square of
+ * a diagonal entry of L is smaller than n * epsilon times the diagonal entry of A.
+ */
+template< typename MATRIX >
+GEOS_HOST_DEVICE
+inline
+bool factorizeCholesky( integer const n,
+                        MATRIX && A )
+{
+  real64 constexpr epsilon = LvArray::NumericLimits< real64 >::epsilon;
+
+  for( integer j = 0; j < n; ++j )
+  {
+    real64 diag = A[j][j];
+    for( integer k = 0; k < j; ++k )
+    {
+      diag -= A[j][k] * A[j][k];
+    }
+    if( diag <= n * epsilon * LvArray::math::abs( A[j][j] ) )
+    {
+      return false;
+    }
+    A[j][j] = LvArray::math::sqrt( diag );
+
+    real64 const invDiag = 1.0 / A[j][j];
+    for( integer i = j + 1; i < n; ++i )
+    {
+      real64 value = A[i][j];
+      for( integer k = 0; k < j; ++k )
+      {
+        value -= A[i][k] * A[j][k];
+      }
+      A[i][j] = value * invDiag;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Solve a linear system with the Cholesky factor computed by factorizeCholesky.
+ * @tparam MATRIX the type of the factor
+ * @tparam RHS the type of the right-hand side
+ * @tparam SOLUTION the type of the solution
+ * @param[in] n the size of the system
+ * @param[in] L the factor, stored in the lower part
+ * @param[in] b the right-hand side
+ * @param[out] x the solution (may alias @p b)
+ */
+template< typename MATRIX, typename RHS, typename SOLUTION >
+GEOS_HOST_DEVICE
+inline
+void solveCholesky( integer const n,
+                    MATRIX const & L,
+                    RHS const & b,
+                    SOLUTION && x )
+{
+  // forward substitution with L
+  for( integer i = 0; i < n; ++i )
+  {
+    real64 value = b[i];
+    for( integer j = 0; j < i; ++j )
+    {
+      value -= L[i][j] * x[j];
+    }
+    x[i] = value / L[i][i];
+  }
+
+  // backward substitution with L^T
+  for( integer i = n - 1; i >= 0; --i )
+  {
+    real64 value = x[i];
+    for( integer j = i + 1; j < n; ++j )
+    {
+      value -= L[j][i] * x[j];
+    }
+    x[i] = value / L[i][i];
+  }
+}
+
+/**
+ * @brief Solve a full-rank linear least-squares problem min ||A x - b|| by Householder QR factorization.
+ * @tparam M the number of rows of the matrix
+ * @tparam N the number of columns of the matrix (N <= M)
+ * @tparam MATRIX the type of the matrix
+ * @tparam RHS the type of the right-hand side
+ * @tparam SOLUTION the type of the solution
+ * @param[in] A the M x N matrix, left untouched
+ * @param[in] b the right-hand side of size M
+ * @param[out] x the solution of size N
+ * @return @c false if the matrix is rank deficient, @c true otherwise
+ *
+ * The matrix is rank deficient if the part of a column that is orthogonal to the previous
+ * columns is smaller than M * epsilon times the norm of the column.
+ */
+template< integer M, integer N, typename MATRIX, typename RHS, typename SOLUTION >
+GEOS_HOST_DEVICE
+inline
+bool solveLeastSquares( MATRIX const & A,
+                        RHS const & b,
+                        SOLUTION && x )
+{
+  static_assert( N <= M, "The least-squares problem must not be underdetermined" );
+
+  real64 constexpr epsilon = LvArray::NumericLimits< real64 >::epsilon;
+
+  real64 R[M][N];
+  real64 y[M];
+  real64 columnNormSq[N]{};
+  for( integer i = 0; i < M; ++i )
+  {
+    for( integer j = 0; j < N; ++j )
+    {
+      R[i][j] = A[i][j];
+      columnNormSq[j] += R[i][j] * R[i][j];
+    }
+    y[i] = b[i];
+  }
+
+  // reduce A to upper triangular form with Householder reflections H = I - 2 v v^T / (v^T v), applied to b as well
+  real64 v[M];
+  for( integer k = 0; k < N; ++k )
+  {
+    real64 normSq = 0.0;
+    for( integer i = k; i < M; ++i )
+    {
+      normSq += R[i][k] * R[i][k];
+    }
+    if( normSq <= ( M * epsilon ) * ( M * epsilon ) * columnNormSq[k] || normSq <= 0.0 )
+    {
+      return false;
+    }
+    real64 const alpha = R[k][k] > 0.0 ? -LvArray::math::sqrt( normSq ) : LvArray::math::sqrt( normSq );
+
+    // v = R_k:M,k - alpha e_k, whose squared norm is ||R_k:M,k||^2 - 2 alpha R_kk + alpha^2
+    for( integer i = k; i < M; ++i )
+    {
+      v[i] = R[i][k];
+    }
+    v[k] -= alpha;
+    real64 const vNormSq = normSq - 2.0 * alpha * R[k][k] + alpha * alpha;
+    real64 const scale = 2.0 / vNormSq;
+
+    R[k][k] = alpha;
+    for( integer i = k + 1; i < M; ++i )
+    {
+      R[i][k] = 0.0;
+    }
+    for( integer j = k + 1; j < N; ++j )
+    {
+      real64 dot = 0.0;
+      for( integer i = k; i < M; ++i )
+      {
+        dot += v[i] * R[i][j];
+      }
+      dot *= scale;
+      for( integer i = k; i < M; ++i )
+      {
+        R[i][j] -= dot * v[i];
+      }
+    }
+
+    real64 dot = 0.0;
+    for( integer i = k; i < M; ++i )
+    {
+      dot += v[i] * y[i];
+    }
+    dot *= scale;
+    for( integer i = k; i < M; ++i )
+    {
+      y[i] -= dot * v[i];
+    }
+  }
+
+  // backward substitution with the N x N upper block of R
+  for( integer i = N - 1; i >= 0; --i )
+  {
+    real64 value = y[i];
+    for( integer j = i + 1; j < N; ++j )
+    {
+      value -= R[i][j] * x[j];
+    }
+    x[i] = value / R[i][i];
+  }
+  return true;
+}
+
+} // namespace denseLinearAlgebra
+
+} // namespace geos
+
+#endif /*GEOS_DENSELINEARALGEBRA_DENSELASOLVERS_HPP_*/
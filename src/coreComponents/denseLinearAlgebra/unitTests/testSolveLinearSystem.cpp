@@ -19,6 +19,7 @@
 
 // Source includes
 #include "denseLinearAlgebra/interfaces/blaslapack/BlasLapackLA.hpp"
+#include "denseLinearAlgebra/denseLASolvers.hpp"
 #include "common/logger/Logger.hpp"
 
 #include "gtest/gtest.h"
@@ -455,3 +456,282 @@ TYPED_TEST( LinearSolveFixture, matrix_matrix_solve_sampling )
   this->template test_matrix_matrix_solve< TestMatrixType::SAMPLING, 5, 12 >();
   this->template test_matrix_matrix_solve_inplace< TestMatrixType::SAMPLING, 5, 12 >();
 }
+
+// Tests of the in-kernel solvers of denseLASolvers.hpp against LAPACK
+
+using DenseMatrix = StackArray< real64, 2, MAX_SIZE *MAX_SIZE, MatrixLayout::ROW_MAJOR_PERM >;
+using DenseVector = StackArray< real64, 1, MAX_SIZE >;
+
+// Hilbert matrix, symmetric positive definite and ill-conditioned (condition number of 1.5e10 for N = 8)
+template< int USD >
+void createHilbert( arraySlice2d< real64, USD > const & A )
+{
+  int const N = LvArray::integerConversion< int >( A.size( 0 ) );
+  for( int i = 0; i < N; ++i )
+  {
+    for( int j = 0; j < N; ++j )
+    {
+      A( i, j ) = 1.0 / ( i + j + 1 );
+    }
+  }
+}
+
+// ||x - y||_inf / ||y||_inf
+real64 relativeError( DenseVector const & x, DenseVector const & y )
+{
+  real64 error = 0.0;
+  real64 norm = 0.0;
+  for( int i = 0; i < y.size(); ++i )
+  {
+    error = LvArray::math::max( error, LvArray::math::abs( x( i ) - y( i ) ) );
+    norm = LvArray::math::max( norm, LvArray::math::abs( y( i ) ) );
+  }
+  return error / norm;
+}
+
+// Backward error ||A x - b||_inf / ( ||A||_inf ||x||_inf ), small for a backward stable solver whatever the conditioning
+real64 backwardError( DenseMatrix const & A, DenseVector const & x, DenseVector const & b )
+{
+  int const M = LvArray::integerConversion< int >( A.size( 0 ) );
+  int const N = LvArray::integerConversion< int >( A.size( 1 ) );
+  real64 residual = 0.0;
+  for( int i = 0; i < M; ++i )
+  {
+    real64 ri = -b( i );
+    for( int j = 0; j < N; ++j )
+    {
+      ri += A( i, j ) * x( j );
+    }
+    residual = LvArray::math::max( residual, LvArray::math::abs( ri ) );
+  }
+  return residual / ( BlasLapackLA::matrixNormInf( A.toSliceConst() ) * BlasLapackLA::vectorNormInf( x.toSliceConst() ) );
+}
+
+// Solve with the LU and Cholesky (if spd) solvers and with LAPACK, and compare the solutions
+void checkSquareSolveAgainstLapack( DenseMatrix const & A, bool const spd, real64 const tolerance )
+{
+  int const N = LvArray::integerConversion< int >( A.size( 0 ) );
+  DenseVector b( N );
+  BlasLapackLA::vectorRand( b.toSlice(), BlasLapackLA::RandomNumberDistribution::UNIFORM_m1p1 );
+
+  DenseVector xLapack( N );
+  BlasLapackLA::solveLinearSystem( A.toSliceConst(), b.toSliceConst(), xLapack.toSlice() );
+
+  DenseVector x( N );
+  EXPECT_TRUE( denseLinearAlgebra::solveLinearSystem< MAX_SIZE >( N, A.toSliceConst(), b.toSliceConst(), x.toSlice() ) );
+  EXPECT_LT( relativeError( x, xLapack ), tolerance );
+  EXPECT_LT( backwardError( A, x, b ), machinePrecision );
+
+  // the factors can be reused for several right-hand sides
+  real64 LU[MAX_SIZE][MAX_SIZE];
+  for( int i = 0; i < N; ++i )
+  {
+    for( int j = 0; j < N; ++j )
+    {
+      LU[i][j] = A( i, j );
+    }
+  }
+  integer pivots[MAX_SIZE];
+  EXPECT_TRUE( denseLinearAlgebra::factorizeLU< MAX_SIZE >( N, LU, pivots ) );
+  for( int k = 0; k < 2; ++k )
+  {
+    BlasLapackLA::solveLinearSystem( A.toSliceConst(), b.toSliceConst(), xLapack.toSlice() );
+    denseLinearAlgebra::solveLU< MAX_SIZE >( N, LU, pivots, b.toSliceConst(), x.toSlice() );
+    EXPECT_LT( relativeError( x, xLapack ), tolerance );
+    BlasLapackLA::vectorRand( b.toSlice(), BlasLapackLA::RandomNumberDistribution::UNIFORM_m1p1 );
+  }
+
+  if( spd )
+  {
+    real64 L[MAX_SIZE][MAX_SIZE];
+    for( int i = 0; i < N; ++i )
+    {
+      for( int j = 0; j < N; ++j )
+      {
+        L[i][j] = A( i, j );
+      }
+    }
+    EXPECT_TRUE( denseLinearAlgebra::factorizeCholesky( N, L ) );
+    BlasLapackLA::solveLinearSystem( A.toSliceConst(), b.toSliceConst(), xLapack.toSlice() );
+    denseLinearAlgebra::solveCholesky( N, L, b.toSliceConst(), x.toSlice() );
+    EXPECT_LT( relativeError( x, xLapack ), tolerance );
+    EXPECT_LT( backwardError( A, x, b ), machinePrecision );
+  }
+}
+
+TEST( DenseLASolvers, square_solve_against_lapack )
+{
+  real64 const tolerance = 1.0e3 * machinePrecision;
+
+  DenseMatrix A( 5, 5 );
+  TestMatrix< TestMatrixType::LAPLACE >::create( A.toSlice() );
+  checkSquareSolveAgainstLapack( A, true, tolerance );
+  random_permutation( A.toSlice() );
+  checkSquareSolveAgainstLapack( A, false, tolerance );
+
+  A.resize( 12, 12 );
+  TestMatrix< TestMatrixType::LAPLACE >::create( A.toSlice() );
+  checkSquareSolveAgainstLapack( A, true, tolerance );
+
+  A.resize( 10, 10 );
+  TestMatrix< TestMatrixType::GRCAR >::create( A.toSlice() );
+  random_permutation( A.toSlice() );
+  checkSquareSolveAgainstLapack( A, false, tolerance );
+
+  A.resize( MAX_SIZE, MAX_SIZE );
+  TestMatrix< TestMatrixType::SAMPLING >::create( A.toSlice() );
+  random_permutation( A.toSlice() );
+  checkSquareSolveAgainstLapack( A, false, tolerance );
+
+  // random symmetric positive definite matrix B B^T + N I
+  int const N = 9;
+  DenseMatrix B( N, N );
+  BlasLapackLA::matrixRand( B.toSlice(), BlasLapackLA::RandomNumberDistribution::UNIFORM_m1p1 );
+  A.resize( N, N );
+  BlasLapackLA::matrixMatrixTMultiply( B.toSliceConst(), B.toSliceConst(), A.toSlice() );
+  for( int i = 0; i < N; ++i )
+  {
+    A( i, i ) += N;
+  }
+  checkSquareSolveAgainstLapack( A, true, tolerance );
+}
+
+TEST( DenseLASolvers, scaled_square_solve_against_lapack )
+{
+  // the rank test is relative to the scale of the matrix: tiny and huge well-conditioned matrices are not singular
+  for( real64 const scale : { 1.0e-200, 1.0e-20, 1.0e20, 1.0e200 } )
+  {
+    DenseMatrix A( 6, 6 );
+    TestMatrix< TestMatrixType::LAPLACE >::create( A.toSlice() );
+    LvArray::forValuesInSlice( A.toSlice(), [scale]( real64 & a ){ a *= scale; } );
+    checkSquareSolveAgainstLapack( A, true, 1.0e3 * machinePrecision );
+  }
+}
+
+TEST( DenseLASolvers, ill_conditioned_square_solve_against_lapack )
+{
+  // the forward error grows with the condition number, but the backward error stays at machine precision
+  DenseMatrix A( 8, 8 );
+  createHilbert( A.toSlice() );
+  checkSquareSolveAgainstLapack( A, true, 1.0e-4 );
+}
+
+TEST( DenseLASolvers, singular_square_solve )
+{
+  integer pivots[MAX_SIZE];
+
+  // zero matrix
+  {
+    real64 A[MAX_SIZE][MAX_SIZE]{};
+    EXPECT_FALSE( denseLinearAlgebra::factorizeLU< MAX_SIZE >( 4, A, pivots ) );
+  }
+
+  // two equal rows
+  {
+    DenseMatrix A( 6, 6 );
+    TestMatrix< TestMatrixType::GRCAR >::create( A.toSlice() );
+    for( int j = 0; j < 6; ++j )
+    {
+      A( 4, j ) = A( 1, j );
+    }
+    EXPECT_FALSE( denseLinearAlgebra::factorizeLU< MAX_SIZE >( 6, A.toSlice(), pivots ) );
+  }
+
+  // numerically singular with large entries: a rank-one matrix perturbed far below the machine precision
+  {
+    real64 A[MAX_SIZE][MAX_SIZE]{};
+    for( int i = 0; i < 5; ++i )
+    {
+      for( int j = 0; j < 5; ++j )
+      {
+        A[i][j] = 1.0e10 * ( i + 1 ) * ( j + 2 );
+      }
+      A[i][i] += 1.0e-10;
+    }
+    EXPECT_FALSE( denseLinearAlgebra::factorizeLU< MAX_SIZE >( 5, A, pivots ) );
+  }
+
+  // Cholesky: negative definite and positive semi-definite matrices
+  {
+    DenseMatrix A( 5, 5 );
+    TestMatrix< TestMatrixType::LAPLACE >::create( A.toSlice() );
+    LvArray::forValuesInSlice( A.toSlice(), []( real64 & a ){ a = -a; } );
+    EXPECT_FALSE( denseLinearAlgebra::factorizeCholesky( 5, A.toSlice() ) );
+
+    LvArray::forValuesInSlice( A.toSlice(), []( real64 & a ){ a = 1.0; } );
+    EXPECT_FALSE( denseLinearAlgebra::factorizeCholesky( 5, A.toSlice() ) );
+  }
+}
+
+// Solve a least-squares problem with the QR solver and with LAPACK, and compare the solutions
+template< int M, int N >
+void checkLeastSquaresAgainstLapack( DenseMatrix const & A, real64 const tolerance )
+{
+  DenseVector b( M );
+  BlasLapackLA::vectorRand( b.toSlice(), BlasLapackLA::RandomNumberDistribution::UNIFORM_m1p1 );
+
+  DenseVector xLapack( N );
+  BlasLapackLA::matrixLeastSquaresSolutionSolve( A.toSliceConst(), b.toSliceConst(), xLapack.toSlice() );
+
+  DenseVector x( N );
+  EXPECT_TRUE( ( denseLinearAlgebra::solveLeastSquares< M, N >( A.toSliceConst(), b.toSliceConst(), x.toSlice() ) ) );
+  EXPECT_LT( relativeError( x, xLapack ), tolerance );
+}
+
+TEST( DenseLASolvers, least_squares_against_lapack )
+{
+  // the shape of the average pressure gradient of the hybrid FVM on hexahedra
+  {
+    DenseMatrix A( 7, 4 );
+    BlasLapackLA::matrixRand( A.toSlice(), BlasLapackLA::RandomNumberDistribution::UNIFORM_m1p1 );
+    for( int i = 0; i < 7; ++i )
+    {
+      A( i, 3 ) = 1.0;
+    }
+    checkLeastSquaresAgainstLapack< 7, 4 >( A, 1.0e3 * machinePrecision );
+  }
+
+  // square problem
+  {
+    DenseMatrix A( 5, 5 );
+    TestMatrix< TestMatrixType::GRCAR >::create( A.toSlice() );
+    checkLeastSquaresAgainstLapack< 5, 5 >( A, 1.0e3 * machinePrecision );
+  }
+
+  // ill-conditioned Vandermonde matrix
+  {
+    DenseMatrix A( 12, 5 );
+    for( int i = 0; i < 12; ++i )
+    {
+      for( int j = 0; j < 5; ++j )
+      {
+        A( i, j ) = std::pow( i / 11.0, j );
+      }
+    }
+    checkLeastSquaresAgainstLapack< 12, 5 >( A, 1.0e-6 );
+  }
+}
+
+TEST( DenseLASolvers, rank_deficient_least_squares )
+{
+  DenseMatrix A( 8, 4 );
+  DenseVector b( 8 );
+  DenseVector x( 4 );
+  BlasLapackLA::vectorRand( b.toSlice() );
+
+  // one column is a multiple of another one
+  BlasLapackLA::matrixRand( A.toSlice(), BlasLapackLA::RandomNumberDistribution::UNIFORM_m1p1 );
+  for( int i = 0; i < 8; ++i )
+  {
+    A( i, 2 ) = 2.0 * A( i, 0 );
+  }
+  EXPECT_FALSE( ( denseLinearAlgebra::solveLeastSquares< 8, 4 >( A.toSliceConst(), b.toSliceConst(), x.toSlice() ) ) );
+
+  // zero column
+  BlasLapackLA::matrixRand( A.toSlice(), BlasLapackLA::RandomNumberDistribution::UNIFORM_m1p1 );
+  for( int i = 0; i < 8; ++i )
+  {
+    A( i, 3 ) = 0.0;
+  }
+  EXPECT_FALSE( ( denseLinearAlgebra::solveLeastSquares< 8, 4 >( A.toSliceConst(), b.toSliceConst(), x.toSlice() ) ) );
+}
@@ -86,6 +86,9 @@ FieldSpecificationBase::FieldSpecificationBase( string const & name, Group * par
     setDescription( "Time at which the boundary condition will stop being applied." );
 
   enableLogLevelInput();
+
+  // the object is created to be registered in the manager: drop the plans built without it
+  invalidateApplicationPlans();
 }
 
 
@@ -106,6 +109,7 @@ void FieldSpecificationBase::setMeshObjectPath( Group const & meshBodies )
   try
   {
     m_meshObjectPaths = std::make_unique< MeshObjectPath >( m_objectPath, meshBodies );
+    invalidateApplicationPlans();
   }
   catch( std::exception const & e )
   {
@@ -114,6 +118,18 @@ void FieldSpecificationBase::setMeshObjectPath( Group const & meshBodies )
   }
 }
 
+void FieldSpecificationBase::invalidateApplicationPlans() const
+{
+  if( hasParent() )
+  {
+    FieldSpecificationManager const * const manager = dynamic_cast< FieldSpecificationManager const * >( &getParent() );
+    if( manager != nullptr )
+    {
+      manager->invalidateApplicationPlans();
+    }
+  }
+}
+
 
 
 REGISTER_CATALOG_ENTRY( FieldSpecificationBase, FieldSpecificationBase, string const &, Group * const )
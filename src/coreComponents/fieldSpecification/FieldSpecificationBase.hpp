@@ -131,12 +131,13 @@ public:
     {
       {
         dataRepository::Group const & setGroup = object.getGroup( ObjectManagerBase::groupKeyStruct::setsString() );
-        string_array setNames = this->getSetNames();
-        for( auto & setName : setNames )
+        for( string const & setName : this->getSetNames() )
         {
-          if( setGroup.hasWrapper( setName ) )
+          dataRepository::Wrapper< SortedArray< localIndex > > const * const setWrapper =
+            setGroup.getWrapperPointer< SortedArray< localIndex > >( setName );
+          if( setWrapper != nullptr )
           {
-            SortedArrayView< localIndex const > const & targetSet = setGroup.getReference< SortedArray< localIndex > >( setName );
+            SortedArrayView< localIndex const > const & targetSet = setWrapper->reference();
             lambda( dynamic_cast< BC_TYPE const & >(*this), setName, targetSet, object, getFieldName() );
           }
         }
@@ -493,6 +494,7 @@ public:
   void setFieldName( string const & fieldName )
   {
     m_fieldName = fieldName;
+    invalidateApplicationPlans();
   }
 
   /**
@@ -502,6 +504,7 @@ public:
   void setObjectPath( string const & objectPath )
   {
     m_objectPath = objectPath;
+    invalidateApplicationPlans();
   }
 
   /**
@@ -520,6 +523,27 @@ public:
   void initialCondition( bool isInitialCondition )
   {
     m_initialCondition = isInitialCondition;
+    invalidateApplicationPlans();
+  }
+
+  /**
+   * Mutator
+   * @param[in] startTime Time at which the boundary condition starts being applied
+   */
+  void setStartTime( real64 const startTime )
+  {
+    m_beginTime = startTime;
+    invalidateApplicationPlans();
+  }
+
+  /**
+   * Mutator
+   * @param[in] endTime Time at which the boundary condition stops being applied
+   */
+  void setEndTime( real64 const endTime )
+  {
+    m_endTime = endTime;
+    invalidateApplicationPlans();
   }
 
   /**
@@ -554,6 +578,9 @@ protected:
 
 private:
 
+  /// Drop the application plans of the parent FieldSpecificationManager, which depend on the inputs of this object
+  void invalidateApplicationPlans() const;
+
 
   /// the names of the sets that the boundary condition is applied to
   string_array m_setNames;
@@ -55,6 +55,22 @@ Group * FieldSpecificationManager::createChild( string const & childKey, string
   return &this->registerGroup( childName, std::move( bc ) );
 }
 
+void FieldSpecificationManager::deregisterFieldSpecification( string const & name )
+{
+  invalidateApplicationPlans();
+  this->deregisterGroup( name );
+}
+
+void FieldSpecificationManager::invalidateApplicationPlans() const
+{
+  m_applicationPlans.clear();
+}
+
+void FieldSpecificationManager::postInputInitialization()
+{
+  invalidateApplicationPlans();
+}
+
 
 void FieldSpecificationManager::expandObjectCatalogs()
 {
@@ -211,6 +227,55 @@ void FieldSpecificationManager::validateBoundaryConditions( MeshLevel & mesh ) c
   } );
 }
 
+std::vector< FieldSpecificationBase const * > const &
+FieldSpecificationManager::getActiveSpecifications( real64 const time,
+                                                    MeshLevel const & mesh,
+                                                    string const & fieldName ) const
+{
+  string const & meshBodyName = mesh.getParent().getParent().getName();
+  string const & meshLevelName = mesh.getName();
+  map< string, ApplicationPlan > & fieldPlans = m_applicationPlans[meshBodyName][meshLevelName];
+
+  auto planIter = fieldPlans.find( fieldName );
+  if( planIter == fieldPlans.end() )
+  {
+    ApplicationPlan plan;
+    this->forSubGroups< FieldSpecificationBase >( [&] ( FieldSpecificationBase const & fs )
+    {
+      if( !fs.initialCondition() &&
+          fs.getFieldName() == fieldName &&
+          fs.getMeshObjectPaths().containsMeshLevel( mesh ) )
+      {
+        plan.specs.emplace_back( &fs );
+        plan.eventTimes.emplace_back( fs.getStartTime() );
+        plan.eventTimes.emplace_back( fs.getEndTime() );
+      }
+    } );
+    std::sort( plan.eventTimes.begin(), plan.eventTimes.end() );
+    plan.eventTimes.erase( std::unique( plan.eventTimes.begin(), plan.eventTimes.end() ), plan.eventTimes.end() );
+    planIter = fieldPlans.emplace( fieldName, std::move( plan ) ).first;
+  }
+
+  ApplicationPlan & plan = planIter->second;
+
+  // (startTime <= time < endTime) has the same value for all the times between two consecutive event times
+  std::ptrdiff_t const interval = std::upper_bound( plan.eventTimes.begin(), plan.eventTimes.end(), time ) - plan.eventTimes.begin();
+  if( interval != plan.activeInterval )
+  {
+    plan.activeSpecs.clear();
+    for( FieldSpecificationBase const * const fs : plan.specs )
+    {
+      if( time >= fs->getStartTime() && time < fs->getEndTime() )
+      {
+        plan.activeSpecs.emplace_back( fs );
+      }
+    }
+    plan.activeInterval = interval;
+  }
+
+  return plan.activeSpecs;
+}
+
 void FieldSpecificationManager::applyInitialConditions( MeshLevel & mesh ) const
 {
   this->forSubGroups< FieldSpecificationBase >( [&] ( FieldSpecificationBase const & fs )
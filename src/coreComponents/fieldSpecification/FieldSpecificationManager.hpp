@@ -76,6 +76,22 @@ public:
   /// This function is used to expand any catalogs in the data structure
   virtual void expandObjectCatalogs() override;
 
+  /**
+   * @brief Deregister a FieldSpecificationBase object.
+   * @param name the name of the FieldSpecificationBase object in the repository
+   *
+   * This function must be used instead of deregisterGroup, since the application plans refer to the objects.
+   */
+  void deregisterFieldSpecification( string const & name );
+
+  /**
+   * @brief Drop the application plans, so that they are rebuilt at the next call to getActiveSpecifications.
+   *
+   * This function is called when FieldSpecificationBase objects are registered, deregistered or modified
+   * through their mutators, and after the input of the objects has been processed.
+   */
+  void invalidateApplicationPlans() const;
+
   /**
    * @brief Function to apply a value directly to a field variable.
    * @tparam POLICY the policy for kernels launched inside this function.
@@ -205,6 +221,8 @@ public:
    * should be applied, and applies them. More specifically, this function simply checks
    * values of fieldPath,fieldName, against each FieldSpecificationBase object contained in the
    * FieldSpecificationManager and decides on whether or not to call the user defined lambda.
+   * For a non-empty @p fieldName, the candidate FieldSpecificationBase objects are taken from
+   * the application plan of the mesh level and field (see getActiveSpecifications()).
    */
   template< typename OBJECT_TYPE=dataRepository::Group,
             typename BCTYPE = FieldSpecificationBase,
@@ -216,24 +234,77 @@ public:
   {
     GEOS_MARK_FUNCTION;
 
-    string const meshBodyName = mesh.getParent().getParent().getName();
-    string const meshLevelName = mesh.getName();
+    if( fieldName.empty() )
+    {
+      // loop over all FieldSpecificationBase objects
+      this->forSubGroups< BCTYPE >( [&] ( BCTYPE const & fs )
+      {
+        integer const isInitialCondition = fs.initialCondition();
+        if( ( isInitialCondition && fieldName=="") || // this only use case for this line is in the unit test for field specification
+            ( !isInitialCondition && time >= fs.getStartTime() && time < fs.getEndTime() && fieldName == fs.getFieldName() ) )
+        {
+          fs.template apply< OBJECT_TYPE, BCTYPE, LAMBDA >( mesh, std::forward< LAMBDA >( lambda ) );
+        }
+      } );
+      return;
+    }
 
-    // loop over all FieldSpecificationBase objects
-    this->forSubGroups< BCTYPE >( [&] ( BCTYPE const & fs )
+    // loop over the FieldSpecificationBase objects of this field that are active at this time on this mesh level
+    for( FieldSpecificationBase const * const spec : getActiveSpecifications( time, mesh, fieldName ) )
     {
-      integer const isInitialCondition = fs.initialCondition();
-      if( ( isInitialCondition && fieldName=="") || // this only use case for this line is in the unit test for field specification
-          ( !isInitialCondition && time >= fs.getStartTime() && time < fs.getEndTime() && fieldName == fs.getFieldName() ) )
+      BCTYPE const * const fs = dynamic_cast< BCTYPE const * >( spec );
+      if( fs != nullptr )
       {
-        fs.template apply< OBJECT_TYPE, BCTYPE, LAMBDA >( mesh, std::forward< LAMBDA >( lambda ) );
+        fs->template apply< OBJECT_TYPE, BCTYPE, LAMBDA >( mesh, std::forward< LAMBDA >( lambda ) );
       }
-    } );
+    }
   }
 
+  /**
+   * @brief Get the FieldSpecificationBase objects that apply to a field on a mesh level at a given time.
+   * @param time The time at which the field will be evaluated.
+   * @param mesh The MeshLevel object.
+   * @param fieldName The name of the field/variable that the value will be applied to.
+   * @return The active (non-initial-condition) FieldSpecificationBase objects of @p fieldName whose object path
+   *         contains @p mesh, in the order in which they are stored in the manager.
+   *
+   * The selection is done with an application plan built once per mesh level and field, and rebuilt only when
+   * the plans are invalidated (see invalidateApplicationPlans()). The activity of the objects of a plan only changes
+   * at their start and end times, so that the active objects are only selected again when @p time moves to
+   * another interval between two of these event times.
+   */
+  std::vector< FieldSpecificationBase const * > const & getActiveSpecifications( real64 const time,
+                                                                                 MeshLevel const & mesh,
+                                                                                 string const & fieldName ) const;
+
+protected:
+
+  /// Invalidate the application plans once the input of the FieldSpecificationBase objects has been processed
+  virtual void postInputInitialization() override;
+
 private:
+
+  /**
+   * @struct ApplicationPlan
+   * @brief The FieldSpecificationBase objects that may be applied to a field on a mesh level.
+   */
+  struct ApplicationPlan
+  {
+    /// The non-initial-condition objects of the field whose object path contains the mesh level
+    std::vector< FieldSpecificationBase const * > specs;
+    /// The sorted and unique start and end times of the objects
+    std::vector< real64 > eventTimes;
+    /// The objects that are active between two consecutive event times
+    std::vector< FieldSpecificationBase const * > activeSpecs;
+    /// The number of event times before or at the times for which activeSpecs is valid, -1 if not selected yet
+    std::ptrdiff_t activeInterval = -1;
+  };
+
   static FieldSpecificationManager * m_instance;
 
+  /// The application plans, by mesh body name, mesh level name and field name
+  mutable map< string, map< string, map< string, ApplicationPlan > > > m_applicationPlans;
+
 };
 
 template< typename POLICY, typename LAMBDA >
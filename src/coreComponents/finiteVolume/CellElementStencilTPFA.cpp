@@ -88,6 +88,52 @@ void CellElementStencilTPFA::addVectors( real64 const & transMultiplier,
   }
 }
 
+localIndex CellElementStencilTPFA::appendConnections( arrayView1d< localIndex const > const & connectorIndices )
+{
+  localIndex const oldSize = m_elementRegionIndices.size( 0 );
+  localIndex const newSize = oldSize + connectorIndices.size();
+  m_elementRegionIndices.resize( newSize, maxStencilSize );
+  m_elementSubRegionIndices.resize( newSize, maxStencilSize );
+  m_elementIndices.resize( newSize, maxStencilSize );
+  m_weights.resize( newSize, maxStencilSize );
+
+  m_faceNormal.resize( newSize );
+  m_cellToFaceVec.resize( newSize );
+  m_transMultiplier.resize( newSize );
+  m_geometricStabilizationCoef.resize( newSize );
+
+  m_connectorIndices.reserve( m_connectorIndices.size() + connectorIndices.size() );
+  for( localIndex i = 0; i < connectorIndices.size(); ++i )
+  {
+    m_connectorIndices[connectorIndices[i]] = oldSize + i;
+  }
+  return oldSize;
+}
+
+void CellElementStencilTPFA::setConnection( localIndex const index,
+                                            localIndex const (&elementRegionIndices)[2],
+                                            localIndex const (&elementSubRegionIndices)[2],
+                                            localIndex const (&elementIndices)[2],
+                                            real64 const (&weights)[2],
+                                            real64 const transMultiplier,
+                                            real64 const geometricStabilizationCoef,
+                                            real64 const (&faceNormal)[3],
+                                            real64 const (&cellToFaceVec)[2][3] )
+{
+  for( localIndex a=0; a<2; ++a )
+  {
+    m_elementRegionIndices( index, a ) = elementRegionIndices[a];
+    m_elementSubRegionIndices( index, a ) = elementSubRegionIndices[a];
+    m_elementIndices( index, a ) = elementIndices[a];
+    m_weights( index, a ) = weights[a];
+    LvArray::tensorOps::copy< 3 >( m_cellToFaceVec[index][a], cellToFaceVec[a] );
+  }
+
+  m_transMultiplier[index] = transMultiplier;
+  m_geometricStabilizationCoef[index] = geometricStabilizationCoef;
+  LvArray::tensorOps::copy< 3 >( m_faceNormal[index], faceNormal );
+}
+
 CellElementStencilTPFA::KernelWrapper
 CellElementStencilTPFA::createKernelWrapper() const
 {
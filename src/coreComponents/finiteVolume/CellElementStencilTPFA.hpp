@@ -170,6 +170,38 @@ public:
                    real64 const (&faceNormal)[3],
                    real64 const (&cellToFaceVec)[2][3] );
 
+  /**
+   * @brief Append connections to the Stencil, to be filled with setConnection().
+   * @param[in] connectorIndices the indices of the faces of the new connections
+   * @return the index of the first new connection
+   *
+   * Unlike add() and addVectors(), setConnection() does not resize the Stencil,
+   * so that the new connections can be filled concurrently.
+   */
+  localIndex appendConnections( arrayView1d< localIndex const > const & connectorIndices );
+
+  /**
+   * @brief Fill a connection appended with appendConnections().
+   * @param[in] index the index of the connection in the Stencil
+   * @param[in] elementRegionIndices the region indices of the two cells
+   * @param[in] elementSubRegionIndices the subregion indices of the two cells
+   * @param[in] elementIndices the indices of the two cells
+   * @param[in] weights the weights of the two cells
+   * @param[in] transMultiplier the transmissibility multiplier
+   * @param[in] geometricStabilizationCoef the stabilization weight
+   * @param[in] faceNormal the normal to the face
+   * @param[in] cellToFaceVec distance vector between the cell center and the face
+   */
+  void setConnection( localIndex const index,
+                      localIndex const (&elementRegionIndices)[2],
+                      localIndex const (&elementSubRegionIndices)[2],
+                      localIndex const (&elementIndices)[2],
+                      real64 const (&weights)[2],
+                      real64 const transMultiplier,
+                      real64 const geometricStabilizationCoef,
+                      real64 const (&faceNormal)[3],
+                      real64 const (&cellToFaceVec)[2][3] );
+
   /**
    * @brief Return the stencil size.
    * @return the stencil size
@@ -203,6 +235,30 @@ public:
    */
   KernelWrapper createKernelWrapper() const;
 
+  /**
+   * @brief Const access to the face normals.
+   * @return A view to const
+   */
+  arrayView2d< real64 const > getFaceNormal() const { return m_faceNormal.toViewConst(); }
+
+  /**
+   * @brief Const access to the cell center to face center vectors.
+   * @return A view to const
+   */
+  arrayView3d< real64 const > getCellToFaceVec() const { return m_cellToFaceVec.toViewConst(); }
+
+  /**
+   * @brief Const access to the transmissibility multipliers.
+   * @return A view to const
+   */
+  arrayView1d< real64 const > getTransMultiplier() const { return m_transMultiplier.toViewConst(); }
+
+  /**
+   * @brief Const access to the geometric stabilization coefficients.
+   * @return A view to const
+   */
+  arrayView1d< real64 const > getGeometricStabilizationCoef() const { return m_geometricStabilizationCoef.toViewConst(); }
+
 private:
 
   array2d< real64 > m_faceNormal;
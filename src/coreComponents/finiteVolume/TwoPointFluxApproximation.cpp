@@ -111,14 +111,20 @@ void TwoPointFluxApproximation::computeCellStencil( MeshLevel & mesh ) const
   arrayView1d< real64 const > const & transMultiplier =
     faceManager.getReference< array1d< real64 > >( m_coeffName + viewKeyStruct::transMultiplierString() );
 
-  ElementRegionManager::ElementViewAccessor< arrayView2d< real64 const > > const elemCenter =
+  ElementRegionManager::ElementViewAccessor< arrayView2d< real64 const > > const elemCenterAccessor =
     elemManager.constructArrayViewAccessor< real64, 2 >( CellElementSubRegion::viewKeyStruct::elementCenterString() );
+  ElementRegionManager::ElementViewConst< arrayView2d< real64 const > > const elemCenter =
+    elemCenterAccessor.toNestedViewConst();
 
-  ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > > const elemGlobalIndex =
+  ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > > const elemGlobalIndexAccessor =
     elemManager.constructArrayViewAccessor< globalIndex, 1 >( ObjectManagerBase::viewKeyStruct::localToGlobalMapString() );
+  ElementRegionManager::ElementViewConst< arrayView1d< globalIndex const > > const elemGlobalIndex =
+    elemGlobalIndexAccessor.toNestedViewConst();
 
-  ElementRegionManager::ElementViewAccessor< arrayView1d< integer const > > const elemGhostRank =
+  ElementRegionManager::ElementViewAccessor< arrayView1d< integer const > > const elemGhostRankAccessor =
     elemManager.constructArrayViewAccessor< integer, 1 >( ObjectManagerBase::viewKeyStruct::ghostRankString() );
+  ElementRegionManager::ElementViewConst< arrayView1d< integer const > > const elemGhostRank =
+    elemGhostRankAccessor.toNestedViewConst();
 
   ArrayOfArraysView< localIndex const > const faceToNodes = faceManager.nodeList().toViewConst();
 
@@ -133,13 +139,25 @@ void TwoPointFluxApproximation::computeCellStencil( MeshLevel & mesh ) const
     regionFilter.insert( ei );
   } );
 
-  stencil.reserve( faceManager.size() );
+  SortedArrayView< localIndex const > const regionFilterView = regionFilter.toViewConst();
 
   real64 const lengthTolerance = m_lengthScale * m_areaRelTol;
   real64 const areaTolerance = lengthTolerance * lengthTolerance;
 
-  forAll< serialPolicy >( faceManager.size(), [=, &stencil]( localIndex const kf )
+  // 1) flag the faces that define a connection of the stencil, and keep their center, normal and area for 2)
+  localIndex const numFaces = faceManager.size();
+  array1d< localIndex > isConnection( numFaces );
+  array2d< real64 > faceCenters( numFaces, 3 );
+  array2d< real64 > faceNormals( numFaces, 3 );
+  array1d< real64 > faceAreas( numFaces );
+  arrayView1d< localIndex > const isConnectionView = isConnection.toView();
+  arrayView2d< real64 > const faceCentersView = faceCenters.toView();
+  arrayView2d< real64 > const faceNormalsView = faceNormals.toView();
+  arrayView1d< real64 > const faceAreasView = faceAreas.toView();
+  forAll< parallelHostPolicy >( numFaces, [=]( localIndex const kf )
   {
+    isConnectionView[kf] = 0;
+
     // Filter out boundary faces
     if( elemList[kf][0] < 0 || elemList[kf][1] < 0 || isZero( transMultiplier[kf] ) )
     {
@@ -154,25 +172,60 @@ void TwoPointFluxApproximation::computeCellStencil( MeshLevel & mesh ) const
     }
 
     // Filter out faces where either of two cells is outside of target regions
-    if( !( regionFilter.contains( elemRegionList[kf][0] ) && regionFilter.contains( elemRegionList[kf][1] ) ) )
+    if( !( regionFilterView.contains( elemRegionList[kf][0] ) && regionFilterView.contains( elemRegionList[kf][1] ) ) )
     {
       return;
     }
 
-    real64 faceCenter[ 3 ], faceNormal[ 3 ], cellToFaceVec[2][ 3 ];
-    real64 const faceArea = computationalGeometry::centroid_3DPolygon( faceToNodes[kf], X, faceCenter, faceNormal, areaTolerance );
+    faceAreasView[kf] = computationalGeometry::centroid_3DPolygon( faceToNodes[kf],
+                                                                   X,
+                                                                   faceCentersView[kf],
+                                                                   faceNormalsView[kf],
+                                                                   areaTolerance );
 
-    if( faceArea < areaTolerance )
+    if( faceAreasView[kf] < areaTolerance )
     {
       return;
     }
 
-    stackArray1d< localIndex, 2 > regionIndex( 2 );
-    stackArray1d< localIndex, 2 > subRegionIndex( 2 );
-    stackArray1d< localIndex, 2 > elementIndex( 2 );
-    stackArray1d< real64, 2 > stencilWeights( 2 );
-    stackArray1d< real64, 2 > stencilStabilizationWeights( 2 );
-    stackArray1d< globalIndex, 2 > stencilCellsGlobalIndex( 2 );
+    isConnectionView[kf] = 1;
+  } );
+
+  // compute the index of the connection of each face with a prefix sum
+  array1d< localIndex > connectionOffsets( numFaces + 1 );
+  connectionOffsets[0] = 0;
+  RAJA::inclusive_scan< parallelHostPolicy >( RAJA::make_span( isConnection.data(), numFaces ),
+                                              RAJA::make_span( connectionOffsets.data() + 1, numFaces ) );
+  localIndex const numConnections = connectionOffsets[numFaces];
+
+  array1d< localIndex > connectionFaces( numConnections );
+  arrayView1d< localIndex > const connectionFacesView = connectionFaces.toView();
+  arrayView1d< localIndex const > const connectionOffsetsView = connectionOffsets.toViewConst();
+  forAll< parallelHostPolicy >( numFaces, [=]( localIndex const kf )
+  {
+    if( isConnectionView[kf] == 1 )
+    {
+      connectionFacesView[connectionOffsetsView[kf]] = kf;
+    }
+  } );
+
+  // 2) allocate the connections in the stencil, then compute and fill them concurrently
+  localIndex const firstConnection = stencil.appendConnections( connectionFaces.toViewConst() );
+
+  forAll< parallelHostPolicy >( numConnections, [=, &stencil]( localIndex const iconn )
+  {
+    localIndex const kf = connectionFacesView[iconn];
+
+    real64 const faceArea = faceAreasView[kf];
+    real64 faceNormal[ 3 ], cellToFaceVec[2][ 3 ];
+    LvArray::tensorOps::copy< 3 >( faceNormal, faceNormalsView[kf] );
+
+    localIndex regionIndex[2];
+    localIndex subRegionIndex[2];
+    localIndex elementIndex[2];
+    real64 stencilWeights[2];
+    real64 stencilStabilizationWeights[2];
+    globalIndex stencilCellsGlobalIndex[2];
 
     for( localIndex ke = 0; ke < 2; ++ke )
     {
@@ -185,7 +238,7 @@ void TwoPointFluxApproximation::computeCellStencil( MeshLevel & mesh ) const
       elementIndex[ke] = ei;
       stencilCellsGlobalIndex[ke] = elemGlobalIndex[er][esr][ei];
 
-      LvArray::tensorOps::copy< 3 >( cellToFaceVec[ke], faceCenter );
+      LvArray::tensorOps::copy< 3 >( cellToFaceVec[ke], faceCentersView[kf] );
       LvArray::tensorOps::subtract< 3 >( cellToFaceVec[ke], elemCenter[er][esr][ei] );
 
       real64 const c2fDistance = LvArray::tensorOps::normalize< 3 >( cellToFaceVec[ke] );
@@ -210,14 +263,15 @@ void TwoPointFluxApproximation::computeCellStencil( MeshLevel & mesh ) const
       std::swap( cellToFaceVec[0][2], cellToFaceVec[1][2] );
     }
 
-    stencil.add( 2,
-                 regionIndex.data(),
-                 subRegionIndex.data(),
-                 elementIndex.data(),
-                 stencilWeights.data(),
-                 kf );
-
-    stencil.addVectors( transMultiplier[kf], sumStabilizationWeight, faceNormal, cellToFaceVec );
+    stencil.setConnection( firstConnection + iconn,
+                           regionIndex,
+                           subRegionIndex,
+                           elementIndex,
+                           stencilWeights,
+                           transMultiplier[kf],
+                           sumStabilizationWeight,
+                           faceNormal,
+                           cellToFaceVec );
   } );
 }
 
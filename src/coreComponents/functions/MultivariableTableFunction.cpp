@@ -21,6 +21,7 @@
 
 #include "common/DataTypes.hpp"
 #include <algorithm>
+#include <exception>
 
 namespace geos
 {
@@ -33,14 +34,78 @@ MultivariableTableFunction::MultivariableTableFunction( const string & name,
 {}
 
 void MultivariableTableFunction::initializeFunctionFromFile( string const & filename )
+{
+  integer numDims = 0;
+  integer numOps = 0;
+  real64_array axisMinimums, axisMaximums;
+  integer_array axisPoints;
+
+#if defined(GEOS_USE_DEVICE)
+  bool const readFile = true;
+#else
+  // a single copy of the table is stored per node (see initializeFunction): only the node leader reads the file
+  m_sharedHypercubeData.joinNode();
+  bool const readFile = m_sharedHypercubeData.isNodeLeader();
+#endif
+
+  // the errors are reported on all the ranks of the node, which would otherwise wait for the node leader
+  std::exception_ptr readException;
+  integer readFailed = 0;
+  if( readFile )
+  {
+    try
+    {
+      readTableFile( filename, numDims, numOps, axisMinimums, axisMaximums, axisPoints );
+    }
+    catch( ... )
+    {
+      readException = std::current_exception();
+      readFailed = 1;
+    }
+  }
+
+#if !defined(GEOS_USE_DEVICE)
+  m_sharedHypercubeData.broadcastFromLeader( &readFailed, 1 );
+  if( readException )
+  {
+    std::rethrow_exception( readException );
+  }
+  GEOS_THROW_IF( readFailed != 0,
+                 catalogName() << " " << getDataContext() << ": the node leader could not read input file " << filename,
+                 InputError );
+
+  // the other ranks of the node only need the table coordinates
+  m_sharedHypercubeData.broadcastFromLeader( &numDims, 1 );
+  m_sharedHypercubeData.broadcastFromLeader( &numOps, 1 );
+  axisMinimums.resize( numDims );
+  axisMaximums.resize( numDims );
+  axisPoints.resize( numDims );
+  m_sharedHypercubeData.broadcastFromLeader( axisMinimums.data(), numDims );
+  m_sharedHypercubeData.broadcastFromLeader( axisMaximums.data(), numDims );
+  m_sharedHypercubeData.broadcastFromLeader( axisPoints.data(), numDims );
+#else
+  GEOS_UNUSED_VAR( readFailed );
+  if( readException )
+  {
+    std::rethrow_exception( readException );
+  }
+#endif
+
+  setTableCoordinates( numDims, numOps, axisMinimums, axisMaximums, axisPoints );
+  initializeFunction();
+}
+
+void MultivariableTableFunction::readTableFile( string const & filename,
+                                                integer & numDims,
+                                                integer & numOps,
+                                                real64_array & axisMinimums,
+                                                real64_array & axisMaximums,
+                                                integer_array & axisPoints )
 {
   std::ifstream file( filename.c_str() );
   GEOS_THROW_IF( !file, catalogName() << " " << getDataContext() << ": could not read input file " << filename, InputError );
 
-  integer numDims, numOps;
   globalIndex numPointsTotal = 1;
-  real64_array axisMinimums, axisMaximums;
-  integer_array axisPoints;
 
   // 1. Read numDims and numOps
 
@@ -104,9 +169,6 @@ void MultivariableTableFunction::initializeFunctionFromFile( string const & file
   GEOS_THROW_IF( file, catalogName() << " " << getDataContext() << ": table file is longer than expected", InputError );
 
   file.close();
-
-  setTableCoordinates( numDims, numOps, axisMinimums, axisMaximums, axisPoints );
-  initializeFunction();
 }
 
 
@@ -129,6 +191,12 @@ void MultivariableTableFunction::setTableValues( real64_array values )
 {
   m_pointData = std::move( values );
 }
+
+void MultivariableTableFunction::setOperatorEvaluator( OperatorEvaluator evaluator )
+{
+  m_operatorEvaluator = std::move( evaluator );
+}
+
 void MultivariableTableFunction::getHypercubePoints( globalIndex const hypercubeIndex, globalIndex_array & hypercubePoints ) const
 {
   auto remainder = hypercubeIndex;
@@ -203,9 +271,30 @@ void MultivariableTableFunction::initializeFunction()
   }
 
 
+  m_hypercubeKeys.clear();
+  m_hypercubeSlots.clear();
+  m_evaluatedPoints.clear();
+  m_evaluatedPointData.clear();
+
+  if( isAdaptive() )
+  {
+    // hypercubes are generated on demand
+    m_hypercubeData.clear();
+    m_sharedHypercubeData.free();
+    return;
+  }
+
+  // the ranks that do not fill the hypercube data may not have the point data (see initializeFunctionFromFile)
+  bool fillHypercubeData = true;
+#if !defined(GEOS_USE_DEVICE)
+  m_sharedHypercubeData.joinNode();
+  fillHypercubeData = m_sharedHypercubeData.isNodeLeader();
+#endif
+
   // check is point data size is correct
-  GEOS_THROW_IF_NE_MSG( globalIndex( numTablePoints ) * m_numOps, m_pointData.size(), catalogName() << " " << getDataContext() <<
-                        ": table values array is expected to have length of " + std::to_string( globalIndex( numTablePoints ) * m_numOps ), InputError );
+  GEOS_THROW_IF( fillHypercubeData && globalIndex( numTablePoints ) * m_numOps != m_pointData.size(),
+                 catalogName() << " " << getDataContext() <<
+                 ": table values array is expected to have length of " + std::to_string( globalIndex( numTablePoints ) * m_numOps ), InputError );
 
   // lets limit the hypercube storage size with 16 Gb
   real64 hypercubeStorageMemoryLimitGB = 16;
@@ -217,22 +306,131 @@ void MultivariableTableFunction::initializeFunction()
                         InputError );
 
   // initialize hypercube data storage
-  m_hypercubeData.resize( numTableHypercubes * m_numVerts * m_numOps );
+  globalIndex const hypercubeDataSize = numTableHypercubes * m_numVerts * m_numOps;
+  real64 * hypercubeData = nullptr;
+#if defined(GEOS_USE_DEVICE)
+  // the table is interpolated in device kernels: each rank stores its copy
+  m_hypercubeData.resize( hypercubeDataSize );
+  hypercubeData = m_hypercubeData.data();
+#else
+  // the table is interpolated in host kernels: a single copy is stored per node, filled by the node leader
+  m_hypercubeData.clear();
+  m_sharedHypercubeData.allocate( hypercubeDataSize * sizeof( real64 ) );
+  hypercubeData = m_sharedHypercubeData.data< real64 >();
+#endif
+
+  // fill each hypercube with corresponding data from m_pointData
+  if( fillHypercubeData )
+  {
+    globalIndex_array points( m_numVerts );
+    for( globalIndex i = 0; i < numTableHypercubes; i++ )
+    {
+      getHypercubePoints( i, points );
+
+      for( auto j = 0; j < m_numVerts; ++j )
+      {
+        std::copy( m_pointData.begin() + points[j] * m_numOps,
+                   m_pointData.begin() + (points[j] + 1) * m_numOps,
+                   hypercubeData + m_numOps * (i * m_numVerts + j));
+      }
+    }
+  }
+
+#if !defined(GEOS_USE_DEVICE)
+  m_sharedHypercubeData.sync();
+#endif
+
+  // all the values are now stored per hypercube
+  m_pointData = real64_array();
+}
+
+void MultivariableTableFunction::generateHypercubes( arrayView1d< globalIndex const > const & hypercubeIndices ) const
+{
+  GEOS_ERROR_IF( !isAdaptive(), catalogName() << " " << getDataContext() << ": hypercubes can only be generated in adaptive mode" );
+
+  // 1. find the visited hypercubes that are not stored yet
+  SortedArray< globalIndex > newHypercubes;
+  for( localIndex i = 0; i < hypercubeIndices.size(); ++i )
+  {
+    globalIndex const * const key = std::lower_bound( m_hypercubeKeys.begin(), m_hypercubeKeys.end(), hypercubeIndices[i] );
+    if( key == m_hypercubeKeys.end() || *key != hypercubeIndices[i] )
+    {
+      newHypercubes.insert( hypercubeIndices[i] );
+    }
+  }
+  if( newHypercubes.empty() )
+  {
+    return;
+  }
+
+  // 2. evaluate the operators at the vertices of the new hypercubes that have not been evaluated yet
   globalIndex_array points( m_numVerts );
+  array1d< globalIndex > newPoints;
+  for( globalIndex const hypercubeIndex : newHypercubes )
+  {
+    getHypercubePoints( hypercubeIndex, points );
+    for( integer j = 0; j < m_numVerts; ++j )
+    {
+      if( m_evaluatedPoints.emplace( points[j], LvArray::integerConversion< localIndex >( m_evaluatedPoints.size() ) ).second )
+      {
+        newPoints.emplace_back( points[j] );
+      }
+    }
+  }
 
-  // fill each hypercube directly on the device with corresponding data from m_pointData
-  for( auto i = 0; i < numTableHypercubes; i++ )
+  localIndex const numOldPoints = m_evaluatedPointData.size( 0 );
+  m_evaluatedPointData.resize( numOldPoints + newPoints.size(), m_numOps );
+  real64_array coordinates( m_numDims );
+  for( localIndex i = 0; i < newPoints.size(); ++i )
   {
-    getHypercubePoints( i, points );
+    globalIndex remainder = newPoints[i];
+    for( integer dim = 0; dim < m_numDims; ++dim )
+    {
+      coordinates[dim] = m_axisMinimums[dim] + ( remainder / m_axisPointMults[dim] ) * m_axisSteps[dim];
+      remainder = remainder % m_axisPointMults[dim];
+    }
+    m_operatorEvaluator( coordinates.toSliceConst(), m_evaluatedPointData[numOldPoints + i] );
+  }
 
-    for( auto j = 0; j < m_numVerts; ++j )
+  // 3. copy the vertex values of the new hypercubes in their slots, appended to the hypercube storage
+  globalIndex const numOldHypercubes = m_hypercubeKeys.size();
+  m_hypercubeData.resize( ( numOldHypercubes + newHypercubes.size() ) * m_numVerts * m_numOps );
+  globalIndex slot = numOldHypercubes;
+  for( globalIndex const hypercubeIndex : newHypercubes )
+  {
+    getHypercubePoints( hypercubeIndex, points );
+    for( integer j = 0; j < m_numVerts; ++j )
     {
-      std::copy( m_pointData.begin() + points[j] * m_numOps,
-                 m_pointData.begin() + (points[j] + 1) * m_numOps,
-                 m_hypercubeData.begin() + m_numOps * (i * m_numVerts + j));
+      arraySlice1d< real64 const > const pointValues = m_evaluatedPointData[m_evaluatedPoints.at( points[j] )];
+      std::copy( pointValues.begin(),
+                 pointValues.end(),
+                 m_hypercubeData.begin() + m_numOps * ( slot * m_numVerts + j ) );
     }
+    ++slot;
   }
 
+  // 4. merge the new hypercubes into the sorted lookup arrays used by the kernels
+  globalIndex_array keys( numOldHypercubes + newHypercubes.size() );
+  globalIndex_array slots( numOldHypercubes + newHypercubes.size() );
+  localIndex iOld = 0;
+  localIndex iNew = 0;
+  for( localIndex i = 0; i < keys.size(); ++i )
+  {
+    if( iNew == newHypercubes.size() || ( iOld < numOldHypercubes && m_hypercubeKeys[iOld] < newHypercubes[iNew] ) )
+    {
+      keys[i] = m_hypercubeKeys[iOld];
+      slots[i] = m_hypercubeSlots[iOld];
+      ++iOld;
+    }
+    else
+    {
+      keys[i] = newHypercubes[iNew];
+      slots[i] = numOldHypercubes + iNew;
+      ++iNew;
+    }
+  }
+  m_hypercubeKeys = std::move( keys );
+  m_hypercubeSlots = std::move( slots );
 }
 
 REGISTER_CATALOG_ENTRY( FunctionBase, MultivariableTableFunction, string const &, Group * const )
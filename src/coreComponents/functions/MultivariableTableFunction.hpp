@@ -21,10 +21,15 @@
 #define GEOS_FUNCTIONS_MULTIVARIABLETABLEFUNCTION_HPP_
 
 #include "FunctionBase.hpp"
+#include "MultivariableTableFunctionKernels.hpp"
 
 #include "codingUtilities/EnumStrings.hpp"
+#include "common/NodeSharedBuffer.hpp"
 #include "LvArray/src/tensorOps.hpp"
 
+#include <functional>
+#include <unordered_map>
+
 namespace geos
 {
 
@@ -33,6 +38,10 @@ namespace geos
  *
  * An interface class for multivariable table function (function with multiple inputs and outputs) with uniform discretization
  * Prepares input data for MultivariableStaticInterpolatorKernel, which performes actual interpolation
+ *
+ * The table is either static, with the values at all the points given upfront, or adaptive: the values at the
+ * vertices of a hypercube are then computed by an operator evaluator the first time the hypercube is visited,
+ * and only the visited hypercubes are stored.
  */
 
 class MultivariableTableFunction : public FunctionBase
@@ -53,6 +62,10 @@ public:
    */
   static string catalogName() { return "MultivariableTableFunction"; }
 
+  /// Type of the function computing the values of all the operators at a table point (adaptive mode)
+  using OperatorEvaluator = std::function< void ( arraySlice1d< real64 const > const & point,
+                                                  arraySlice1d< real64 > const & values ) >;
+
   /**
    * @brief Set table coordinates
    *
@@ -74,16 +87,39 @@ public:
    */
   void setTableValues( real64_array const values );
 
+  /**
+   * @brief Set the operator evaluator, switching the table to adaptive mode
+   * @param[in] evaluator the function computing the values of all the operators at a table point
+   *
+   * In adaptive mode the table values are not set: they are computed on demand by generateHypercubes.
+   * The evaluator must be set before initializeFunction is called.
+   * No evaluator is provided by GEOS: the caller setting up the table (e.g. a driver script) must provide it.
+   */
+  void setOperatorEvaluator( OperatorEvaluator evaluator );
+
+  /**
+   * @brief Generate the data of the hypercubes that are not stored yet (adaptive mode only)
+   * @param[in] hypercubeIndices the indices of the hypercubes about to be interpolated in
+   *
+   * The operators are evaluated once per table point, the points shared by several hypercubes being cached.
+   */
+  void generateHypercubes( arrayView1d< globalIndex const > const & hypercubeIndices ) const;
 
 
   /**
    * @brief Initialize the table function after setting table coordinates and values
+   *
+   * In host-only builds, the data of a static table is stored once per compute node and filled by one rank of the node:
+   * this function is then collective over MPI_COMM_GEOS.
    */
   virtual void initializeFunction() override;
 
   /**
    * @brief Initialize the table function using data from file
    * @param[in] filename The name of the file to read.
+   *
+   * In host-only builds, the file is only read by the node leader, which sends the table coordinates
+   * to the other ranks of its node: this function is then collective over MPI_COMM_GEOS.
    */
   void initializeFunctionFromFile( string const & filename );
 
@@ -165,6 +201,45 @@ public:
    */
   arrayView1d< real64 const > getHypercubeData() const { return m_hypercubeData.toViewConst(); }
 
+  /**
+   * @brief Get the sorted indices of the stored hypercubes (adaptive mode, empty otherwise)
+   * @return a reference to an array of sorted hypercube indices
+   */
+  arrayView1d< globalIndex const > getHypercubeKeys() const { return m_hypercubeKeys.toViewConst(); }
+
+  /**
+   * @brief Get the storage slots of the hypercubes listed by getHypercubeKeys (adaptive mode, empty otherwise)
+   * @return a reference to an array of hypercube slots in the per-hypercube data
+   */
+  arrayView1d< globalIndex const > getHypercubeSlots() const { return m_hypercubeSlots.toViewConst(); }
+
+  /**
+   * @brief Create an instance of the kernel wrapper interpolating in the table
+   * @tparam NUM_DIMS number of dimensions (inputs)
+   * @tparam NUM_OPS number of interpolated functions (outputs)
+   * @return the kernel wrapper
+   */
+  template< integer NUM_DIMS, integer NUM_OPS >
+  MultivariableTableFunctionStaticKernel< NUM_DIMS, NUM_OPS > createKernelWrapper() const
+  {
+    return MultivariableTableFunctionStaticKernel< NUM_DIMS, NUM_OPS >( getAxisMinimums(),
+                                                                        getAxisMaximums(),
+                                                                        getAxisPoints(),
+                                                                        getAxisSteps(),
+                                                                        getAxisStepInvs(),
+                                                                        getAxisHypercubeMults(),
+                                                                        getHypercubeData(),
+                                                                        getHypercubeKeys(),
+                                                                        getHypercubeSlots(),
+                                                                        m_sharedHypercubeData.data< real64 const >() );
+  }
+
+  /**
+   * @brief Check whether the table values are computed on demand
+   * @return true if an operator evaluator is set
+   */
+  bool isAdaptive() const { return static_cast< bool >( m_operatorEvaluator ); }
+
   /**
    * @brief Get the number of table dimensions
    * @return the number of table dimensions
@@ -179,6 +254,23 @@ public:
 
 private:
 
+  /**
+   * @brief Read the table coordinates and the table values (stored in m_pointData) from a file
+   *
+   * @param[in] filename the name of the file to read
+   * @param[out] numDims number of table dimensions
+   * @param[out] numOps number of operators
+   * @param[out] axisMinimums minimum coordinate for each axis
+   * @param[out] axisMaximums maximum coordinate for each axis
+   * @param[out] axisPoints number of discretization points for each axis
+   */
+  void readTableFile( string const & filename,
+                      integer & numDims,
+                      integer & numOps,
+                      real64_array & axisMinimums,
+                      real64_array & axisMaximums,
+                      integer_array & axisPoints );
+
   /**
    * @brief Get indexes of all vertices of a hypercube
    *
@@ -225,7 +317,28 @@ private:
   real64_array m_pointData;
 
   ///  Main table data stored per hypercube: all values required for interpolation withing give hypercube are stored contiguously
-  real64_array m_hypercubeData;
+  ///  (in adaptive mode, grows as hypercubes are generated)
+  mutable real64_array m_hypercubeData;
+
+  ///  Main table data stored per hypercube, once per compute node (static table in host-only builds, replaces m_hypercubeData)
+  NodeSharedBuffer m_sharedHypercubeData;
+
+  // adaptive mode
+
+  /// Function computing the operator values at a table point
+  OperatorEvaluator m_operatorEvaluator;
+
+  /// Sorted indices of the generated hypercubes
+  mutable globalIndex_array m_hypercubeKeys;
+
+  /// Slots of the generated hypercubes in m_hypercubeData, in the order of m_hypercubeKeys
+  mutable globalIndex_array m_hypercubeSlots;
+
+  /// Map from the index of an evaluated table point to its row in m_evaluatedPointData
+  mutable std::unordered_map< globalIndex, localIndex > m_evaluatedPoints;
+
+  /// Array [numEvaluatedPoints, numOps] of operator values at the evaluated table points
+  mutable array2d< real64 > m_evaluatedPointData;
 };
 
 
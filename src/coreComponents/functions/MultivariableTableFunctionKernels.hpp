@@ -65,6 +65,9 @@ public:
    * @param[in] axisStepInvs inversions of axis interval lengths (axes are discretized uniformly)
    * @param[in] axisHypercubeMults  hypercube index mult factors for each axis
    * @param[in] hypercubeData table data stored per hypercube
+   * @param[in] hypercubeKeys sorted indices of the stored hypercubes (adaptive tables only)
+   * @param[in] hypercubeSlots slots of the stored hypercubes in @p hypercubeData (adaptive tables only)
+   * @param[in] sharedHypercubeData table data stored per hypercube in node-shared memory, replacing @p hypercubeData if not null
    */
   MultivariableTableFunctionStaticKernel( arrayView1d< real64 const > const & axisMinimums,
                                           arrayView1d< real64 const > const & axisMaximums,
@@ -72,16 +75,43 @@ public:
                                           arrayView1d< real64 const > const & axisSteps,
                                           arrayView1d< real64 const > const & axisStepInvs,
                                           arrayView1d< globalIndex const > const & axisHypercubeMults,
-                                          arrayView1d< real64 const > const & hypercubeData ):
+                                          arrayView1d< real64 const > const & hypercubeData,
+                                          arrayView1d< globalIndex const > const & hypercubeKeys = arrayView1d< globalIndex const >(),
+                                          arrayView1d< globalIndex const > const & hypercubeSlots = arrayView1d< globalIndex const >(),
+                                          real64 const * const sharedHypercubeData = nullptr ):
     m_axisMinimums ( axisMinimums ),
     m_axisMaximums ( axisMaximums ),
     m_axisPoints ( axisPoints ),
     m_axisSteps ( axisSteps ),
     m_axisStepInvs ( axisStepInvs ),
     m_axisHypercubeMults ( axisHypercubeMults ),
-    m_hypercubeData ( hypercubeData )
+    m_hypercubeData ( hypercubeData ),
+    m_hypercubeKeys ( hypercubeKeys ),
+    m_hypercubeSlots ( hypercubeSlots ),
+    m_sharedHypercubeData ( sharedHypercubeData )
   {};
 
+  /**
+   * @brief Get the index of the hypercube a given point is interpolated in
+   *
+   * @param[in] coordinates point coordinates
+   * @return the hypercube index
+   */
+  template< typename IN_ARRAY >
+  GEOS_HOST_DEVICE
+  globalIndex
+  getHypercubeIndex( IN_ARRAY const & coordinates ) const
+  {
+    globalIndex hypercubeIndex = 0;
+    for( int i = 0; i < numDims; ++i )
+    {
+      integer axisIntervalIndex = integer( (coordinates[i] - m_axisMinimums[i]) * m_axisStepInvs[i] );
+      axisIntervalIndex = LvArray::math::min( LvArray::math::max( axisIntervalIndex, 0 ), m_axisPoints[i] - 2 );
+      hypercubeIndex += axisIntervalIndex * m_axisHypercubeMults[i];
+    }
+    return hypercubeIndex;
+  }
+
 /**
  * @brief interpolate all operators at a given point
  *
@@ -163,7 +193,33 @@ protected:
   real64 const *
   getHypercubeData( globalIndex const hypercubeIndex ) const
   {
-    return &m_hypercubeData[hypercubeIndex * numVerts * numOps];
+    if( m_sharedHypercubeData != nullptr )
+    {
+      return m_sharedHypercubeData + hypercubeIndex * numVerts * numOps;
+    }
+    if( m_hypercubeKeys.size() == 0 )
+    {
+      return &m_hypercubeData[hypercubeIndex * numVerts * numOps];
+    }
+
+    // adaptive storage: binary search of the hypercube among the stored ones
+    localIndex first = 0;
+    localIndex count = m_hypercubeKeys.size();
+    while( count > 0 )
+    {
+      localIndex const step = count / 2;
+      if( m_hypercubeKeys[first + step] < hypercubeIndex )
+      {
+        first += step + 1;
+        count -= step + 1;
+      }
+      else
+      {
+        count = step;
+      }
+    }
+    GEOS_ASSERT( first < m_hypercubeKeys.size() && m_hypercubeKeys[first] == hypercubeIndex );
+    return &m_hypercubeData[m_hypercubeSlots[first] * numVerts * numOps];
   }
 
   /**
@@ -373,6 +429,15 @@ protected:
   ///  Main table data stored per hypercube: all values required for interpolation withing give hypercube are stored contiguously
   arrayView1d< real64 const > m_hypercubeData;
 
+  ///  Sorted indices of the stored hypercubes, empty if all the hypercubes are stored (static table)
+  arrayView1d< globalIndex const > m_hypercubeKeys;
+
+  ///  Slots of the stored hypercubes in m_hypercubeData, in the order of m_hypercubeKeys
+  arrayView1d< globalIndex const > m_hypercubeSlots;
+
+  ///  Table data stored per hypercube in node-shared host memory (null if stored in m_hypercubeData)
+  real64 const * m_sharedHypercubeData;
+
   // inputs: where to interpolate
 
   /// Coordinates in numDims-dimensional space where interpolation is requested
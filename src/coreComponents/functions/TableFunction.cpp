@@ -277,6 +277,30 @@ TableFunction::KernelWrapper::KernelWrapper( InterpolationType const interpolati
   m_values( values )
 {}
 
+bool TableFunction::KernelWrapper::hasSameAxis( KernelWrapper const & other ) const
+{
+  if( m_interpolationMethod != InterpolationType::Linear || other.m_interpolationMethod != InterpolationType::Linear ||
+      m_coordinates.size() != 1 || other.m_coordinates.size() != 1 )
+  {
+    return false;
+  }
+
+  arraySlice1d< real64 const > const coords = m_coordinates[0];
+  arraySlice1d< real64 const > const otherCoords = other.m_coordinates[0];
+  if( coords.size() != otherCoords.size() )
+  {
+    return false;
+  }
+  for( localIndex i = 0; i < coords.size(); ++i )
+  {
+    if( coords[i] != otherCoords[i] )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 REGISTER_CATALOG_ENTRY( FunctionBase, TableFunction, string const &, Group * const )
 
 } // end of namespace geos
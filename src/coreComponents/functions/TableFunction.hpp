@@ -50,6 +50,32 @@ public:
   /// maximum dimensions for the coordinates in the table
   static constexpr integer maxDimensions = 4;
 
+  /**
+   * @struct AxisPosition
+   *
+   * Position of an input value on the axis of a 1D table with linear interpolation.
+   * The position is found with a bracket search, and can be reused to interpolate in all the tables defined on the same axis.
+   */
+  struct AxisPosition
+  {
+    /// Indices of the axis points surrounding the input value
+    localIndex bounds[2]{};
+    /// Interpolation weights of the two axis points
+    real64 weights[2]{};
+    /// Derivatives of the interpolation weights wrt the input value
+    real64 dWeights_dInput[2]{};
+
+    /**
+     * @brief Get a position in an optional array of positions
+     * @param[in] positions the array of positions, or nullptr
+     * @param[in] i the index of the position in the array
+     * @return the position at index @p i, or nullptr if the array is not given
+     */
+    GEOS_HOST_DEVICE
+    static AxisPosition const * at( AxisPosition const * const positions, integer const i )
+    { return positions != nullptr ? positions + i : nullptr; }
+  };
+
   /**
    * @class KernelWrapper
    *
@@ -100,6 +126,44 @@ public:
     GEOS_HOST_DEVICE
     real64 compute( IN_ARRAY const & input, OUT_ARRAY && derivatives ) const;
 
+    /**
+     * @brief Find the position of an input value on the axis of a 1D table with linear interpolation.
+     * @param[in] input the input value
+     * @param[out] position the position of the input value on the axis
+     */
+    GEOS_HOST_DEVICE
+    void locate( real64 const input, AxisPosition & position ) const;
+
+    /**
+     * @brief Interpolate with derivatives in a 1D table with linear interpolation, at a position found on the axis of this table.
+     * @param[in] position the position of the input value on the axis, found by this table or by a table with the same axis
+     * @param[out] derivative the derivative of the interpolated value wrt the input value
+     * @return interpolated value
+     */
+    GEOS_HOST_DEVICE
+    real64 compute( AxisPosition const & position, real64 & derivative ) const;
+
+    /**
+     * @brief Interpolate with derivatives in a 1D table, reusing the position of the input value on the axis when it is given.
+     * @param[in] input the input value
+     * @param[in] position the position of the input value on the axis of this table, or nullptr to search for it
+     * @param[out] derivative the derivative of the interpolated value wrt the input value
+     * @return interpolated value
+     */
+    GEOS_HOST_DEVICE
+    real64 compute( real64 const & input, AxisPosition const * const position, real64 & derivative ) const
+    {
+      return position != nullptr ? compute( *position, derivative ) : compute( &input, &derivative );
+    }
+
+    /**
+     * @brief Check whether a position found on the axis of this table can be used to interpolate in another table.
+     * @param[in] other the other table
+     * @return true if both tables are 1D tables with linear interpolation defined on the same axis points
+     * @note This function reads the table axes on the host.
+     */
+    bool hasSameAxis( KernelWrapper const & other ) const;
+
     /**
      * @brief Move the KernelWrapper to the given execution space, optionally touching it.
      * @param space the space to move the KernelWrapper to
@@ -654,6 +718,63 @@ TableFunction::KernelWrapper::interpolateLinear( IN_ARRAY const & input, OUT_ARR
   return value;
 }
 
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+void
+TableFunction::KernelWrapper::locate( real64 const input, AxisPosition & position ) const
+{
+  arraySlice1d< real64 const > const coords = m_coordinates[0];
+  if( input <= coords[0] )
+  {
+    // Coordinate is to the left of the axis
+    position.bounds[0] = 0;
+    position.bounds[1] = 0;
+    position.weights[0] = 0;
+    position.weights[1] = 1;
+    position.dWeights_dInput[0] = 0;
+    position.dWeights_dInput[1] = 0;
+  }
+  else if( input >= coords[coords.size() - 1] )
+  {
+    // Coordinate is to the right of the axis
+    position.bounds[0] = coords.size() - 1;
+    position.bounds[1] = position.bounds[0];
+    position.weights[0] = 1;
+    position.weights[1] = 0;
+    position.dWeights_dInput[0] = 0;
+    position.dWeights_dInput[1] = 0;
+  }
+  else
+  {
+    // Same bracket search and weights as interpolateLinear, so that the interpolated values are identical
+    auto const lower = LvArray::sortedArrayManipulation::find( coords.begin(), coords.size(), input );
+    position.bounds[1] = LvArray::integerConversion< localIndex >( lower );
+    position.bounds[0] = position.bounds[1] - 1;
+
+    real64 const dx = coords[position.bounds[1]] - coords[position.bounds[0]];
+    position.weights[0] = 1.0 - ( input - coords[position.bounds[0]] ) / dx;
+    position.weights[1] = 1.0 - position.weights[0];
+    position.dWeights_dInput[0] = -1.0 / dx;
+    position.dWeights_dInput[1] = -position.dWeights_dInput[0];
+  }
+}
+
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+real64
+TableFunction::KernelWrapper::compute( AxisPosition const & position, real64 & derivative ) const
+{
+  real64 value = 0.0;
+  derivative = 0.0;
+  for( integer corner = 0; corner < 2; ++corner )
+  {
+    real64 const cornerValue = m_values[position.bounds[corner]];
+    derivative += cornerValue * position.dWeights_dInput[corner];
+    value += cornerValue * position.weights[corner];
+  }
+  return value;
+}
+
 template< typename IN_ARRAY, typename OUT_ARRAY >
 GEOS_HOST_DEVICE
 GEOS_FORCE_INLINE
@@ -27,6 +27,7 @@
   #include "functions/SymbolicFunction.hpp"
 #endif
 
+#include <algorithm>
 #include <random>
 
 using namespace geos;
@@ -643,14 +644,7 @@ void testMutivariableFunction( MultivariableTableFunction & function,
   arrayView2d< real64 > evaluatedDerivativesView = evaluatedDerivatives.toView();
 
 
-  MultivariableTableFunctionStaticKernel< NUM_DIMS, NUM_OPS > kernel( function.getAxisMinimums(),
-                                                                      function.getAxisMaximums(),
-                                                                      function.getAxisPoints(),
-                                                                      function.getAxisSteps(),
-                                                                      function.getAxisStepInvs(),
-                                                                      function.getAxisHypercubeMults(),
-                                                                      function.getHypercubeData()
-                                                                      );
+  MultivariableTableFunctionStaticKernel< NUM_DIMS, NUM_OPS > kernel = function.createKernelWrapper< NUM_DIMS, NUM_OPS >();
   // Test values evaluation first
   forAll< geos::parallelDevicePolicy< > >( numElems, [=] GEOS_HOST_DEVICE
                                              ( localIndex const elemIndex )
@@ -887,6 +881,142 @@ TEST( FunctionTests, MultivariableTableFromFile )
 }
 
 
+TEST( FunctionTests, AdaptiveMultivariableTable )
+{
+  FunctionManager * functionManager = &FunctionManager::getInstance();
+
+  localIndex constexpr nDims = 2;
+  localIndex constexpr nOps = 3;
+
+  array1d< real64 > axisMins( nDims );
+  array1d< real64 > axisMaxs( nDims );
+  integer_array axisPoints( nDims );
+  axisMins[0] = 1;
+  axisMins[1] = 0;
+  axisMaxs[0] = 2;
+  axisMaxs[1] = 1;
+  axisPoints[0] = 41;
+  axisPoints[1] = 53;
+
+  // a static table storing the operators at all the points, and an adaptive table evaluating them on demand
+  MultivariableTableFunction & staticTable =
+    dynamicCast< MultivariableTableFunction & >( *functionManager->createChild( "MultivariableTableFunction", "table_static" ) );
+  staticTable.setTableCoordinates( nDims, nOps, axisMins, axisMaxs, axisPoints );
+
+  MultivariableTableFunction & adaptiveTable =
+    dynamicCast< MultivariableTableFunction & >( *functionManager->createChild( "MultivariableTableFunction", "table_adaptive" ) );
+  adaptiveTable.setTableCoordinates( nDims, nOps, axisMins, axisMaxs, axisPoints );
+  integer numEvaluations = 0;
+  adaptiveTable.setOperatorEvaluator( [&]( arraySlice1d< real64 const > const & point,
+                                           arraySlice1d< real64 > const & values )
+  {
+    ++numEvaluations;
+    values[0] = operator1( point[0], point[1] );
+    values[1] = operator2( point[0], point[1] );
+    values[2] = operator3( point[0], point[1] );
+  } );
+  adaptiveTable.initializeFunction();
+  EXPECT_TRUE( adaptiveTable.isAdaptive() );
+  EXPECT_EQ( adaptiveTable.getHypercubeKeys().size(), 0 );
+
+  // the static values are computed at the same coordinates as the ones given to the evaluator
+  arrayView1d< real64 const > const axisSteps = adaptiveTable.getAxisSteps();
+  array1d< real64 > values( axisPoints[0] * axisPoints[1] * nOps );
+  for( integer i = 0; i < axisPoints[0]; i++ )
+  {
+    for( integer j = 0; j < axisPoints[1]; j++ )
+    {
+      real64 const x = axisMins[0] + i * axisSteps[0];
+      real64 const y = axisMins[1] + j * axisSteps[1];
+      values[( i * axisPoints[1] + j ) * nOps] = operator1( x, y );
+      values[( i * axisPoints[1] + j ) * nOps + 1] = operator2( x, y );
+      values[( i * axisPoints[1] + j ) * nOps + 2] = operator3( x, y );
+    }
+  }
+  staticTable.setTableValues( values );
+  staticTable.initializeFunction();
+  EXPECT_FALSE( staticTable.isAdaptive() );
+
+  // two batches of points, some of them outside of the table and some of them in the same hypercubes
+  std::mt19937 generator( 2024 );
+  std::uniform_real_distribution< real64 > xDistribution( 0.9, 2.1 );
+  std::uniform_real_distribution< real64 > yDistribution( -0.1, 1.1 );
+  localIndex constexpr nTest = 200;
+  for( integer batch = 0; batch < 2; ++batch )
+  {
+    array1d< real64 > testCoordinates( nTest * nDims );
+    for( localIndex i = 0; i < nTest; ++i )
+    {
+      // the second half of the batch repeats the first half, shifted within the hypercubes
+      bool const repeat = i >= nTest / 2;
+      testCoordinates[i * nDims] = repeat ? testCoordinates[( i - nTest / 2 ) * nDims] + 0.1 * axisSteps[0] : xDistribution( generator );
+      testCoordinates[i * nDims + 1] = repeat ? testCoordinates[( i - nTest / 2 ) * nDims + 1] : yDistribution( generator );
+    }
+
+    // generate the hypercubes visited by the points
+    array1d< globalIndex > hypercubeIndices( nTest );
+    SortedArray< globalIndex > visitedHypercubes;
+    {
+      MultivariableTableFunctionStaticKernel< nDims, nOps > const kernel = adaptiveTable.createKernelWrapper< nDims, nOps >();
+      for( localIndex i = 0; i < nTest; ++i )
+      {
+        hypercubeIndices[i] = kernel.getHypercubeIndex( &testCoordinates[i * nDims] );
+        visitedHypercubes.insert( hypercubeIndices[i] );
+      }
+    }
+    localIndex const numOldHypercubes = adaptiveTable.getHypercubeKeys().size();
+    adaptiveTable.generateHypercubes( hypercubeIndices.toViewConst() );
+
+    // only the visited hypercubes are stored, sorted, and each table point is evaluated once
+    arrayView1d< globalIndex const > const keys = adaptiveTable.getHypercubeKeys();
+    EXPECT_GE( keys.size(), numOldHypercubes );
+    EXPECT_LE( keys.size(), numOldHypercubes + visitedHypercubes.size() );
+    for( globalIndex const hypercubeIndex : visitedHypercubes )
+    {
+      EXPECT_TRUE( std::binary_search( keys.begin(), keys.end(), hypercubeIndex ) );
+    }
+    EXPECT_TRUE( std::is_sorted( keys.begin(), keys.end() ) );
+    EXPECT_TRUE( std::adjacent_find( keys.begin(), keys.end() ) == keys.end() );
+    SortedArray< globalIndex > vertices;
+    for( globalIndex const hypercubeIndex : keys )
+    {
+      globalIndex const i = hypercubeIndex / ( axisPoints[1] - 1 );
+      globalIndex const j = hypercubeIndex % ( axisPoints[1] - 1 );
+      vertices.insert( i * axisPoints[1] + j );
+      vertices.insert( i * axisPoints[1] + j + 1 );
+      vertices.insert( ( i + 1 ) * axisPoints[1] + j );
+      vertices.insert( ( i + 1 ) * axisPoints[1] + j + 1 );
+    }
+    EXPECT_EQ( numEvaluations, vertices.size() );
+
+    // generating the same hypercubes again does not evaluate the operators
+    adaptiveTable.generateHypercubes( hypercubeIndices.toViewConst() );
+    EXPECT_EQ( adaptiveTable.getHypercubeKeys().size(), keys.size() );
+    EXPECT_EQ( numEvaluations, vertices.size() );
+
+    // the adaptive lookups are identical to the static ones
+    MultivariableTableFunctionStaticKernel< nDims, nOps > const staticKernel = staticTable.createKernelWrapper< nDims, nOps >();
+    MultivariableTableFunctionStaticKernel< nDims, nOps > const adaptiveKernel = adaptiveTable.createKernelWrapper< nDims, nOps >();
+    for( localIndex i = 0; i < nTest; ++i )
+    {
+      real64 staticValues[nOps];
+      real64 adaptiveValues[nOps];
+      real64 staticDerivatives[nOps][nDims];
+      real64 adaptiveDerivatives[nOps][nDims];
+      staticKernel.compute( &testCoordinates[i * nDims], staticValues, staticDerivatives );
+      adaptiveKernel.compute( &testCoordinates[i * nDims], adaptiveValues, adaptiveDerivatives );
+      for( integer op = 0; op < nOps; ++op )
+      {
+        EXPECT_EQ( staticValues[op], adaptiveValues[op] ) << "point " << i << ", operator " << op;
+        for( integer dim = 0; dim < nDims; ++dim )
+        {
+          EXPECT_EQ( staticDerivatives[op][dim], adaptiveDerivatives[op][dim] ) << "point " << i << ", operator " << op;
+        }
+      }
+    }
+  }
+}
+
 // The `ENUM_STRING` implementation relies on consistency between the order of the `enum`,
 // and the order of the `string` array provided. Since this consistency is not enforced, it can be corrupted anytime.
 // This unit test aims at preventing from this implicit relationship to bring a bug.
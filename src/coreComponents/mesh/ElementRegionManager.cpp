@@ -25,6 +25,7 @@
 #include "constitutive/ConstitutiveManager.hpp"
 #include "mesh/NodeManager.hpp"
 #include "mesh/MeshLevel.hpp"
+#include "mesh/utilities/ElementCenterIndex.hpp"
 #include "mesh/utilities/MeshMapUtilities.hpp"
 #include "schema/schemaUtilities.hpp"
 #include "mesh/generators/LineBlockABC.hpp"
@@ -168,6 +169,9 @@ void ElementRegionManager::generateWells( CellBlockManagerABC const & cellBlockM
   globalIndex wellElemCount = 0;
   globalIndex wellNodeCount = 0;
 
+  // bin the reservoir elements once, to match the well elements and perforations of all the wells with them
+  ElementCenterIndex const resElemCenterIndex( meshLevel );
+
   // construct the wells one by one
   forElementRegions< WellElementRegion >( [&]( WellElementRegion & wellRegion )
   {
@@ -179,7 +183,7 @@ void ElementRegionManager::generateWells( CellBlockManagerABC const & cellBlockM
     // generate the local data (well elements, nodes, perforations) on this well
     // note: each MPI rank knows the global info on the entire well (constructed earlier in InternalWellGenerator)
     // so we only need node and element offsets to construct the local-to-global maps in each wellElemSubRegion
-    wellRegion.generateWell( meshLevel, lineBlock, nodeOffsetGlobal + wellNodeCount, elemOffsetGlobal + wellElemCount );
+    wellRegion.generateWell( meshLevel, lineBlock, resElemCenterIndex, nodeOffsetGlobal + wellNodeCount, elemOffsetGlobal + wellElemCount );
 
     // increment counters with global number of nodes and elements
     wellElemCount += lineBlock.numElements();
@@ -216,16 +220,17 @@ void ElementRegionManager::buildSets( NodeManager const & nodeManager )
   {
     string const & name = wrapper.second->getName();
     nodeInSet[name].resize( nodeManager.size() );
-    nodeInSet[name].setValues< serialPolicy >( false );
+    nodeInSet[name].setValues< parallelHostPolicy >( false );
 
     if( nodeSets.hasWrapper( name ) )
     {
       setNames.emplace_back( name );
-      SortedArrayView< localIndex const > const & set = nodeSets.getReference< SortedArray< localIndex > >( name );
-      for( localIndex const a: set )
+      SortedArrayView< localIndex const > const set = nodeSets.getReference< SortedArray< localIndex > >( name ).toViewConst();
+      arrayView1d< bool > const nodeInCurSet = nodeInSet[name];
+      forAll< parallelHostPolicy >( set.size(), [=]( localIndex const i )
       {
-        nodeInSet[name][a] = true;
-      }
+        nodeInCurSet[set[i]] = true;
+      } );
     }
   }
 
@@ -236,16 +241,19 @@ void ElementRegionManager::buildSets( NodeManager const & nodeManager )
 
     auto const & elemToNodeMap = subRegion.nodeList();
 
+    array1d< integer > isElementInSet( subRegion.size() );
+    array1d< localIndex > elementsInSet;
+
     for( string const & setName: setNames )
     {
       arrayView1d< bool const > const nodeInCurSet = nodeInSet[setName];
 
       SortedArray< localIndex > & targetSet = elementSets.registerWrapper< SortedArray< localIndex > >( setName ).reference();
-      for( localIndex k = 0; k < subRegion.size(); ++k )
+      forAll< parallelHostPolicy >( subRegion.size(), [&]( localIndex const k )
       {
         localIndex const numNodes = subRegion.numNodesPerElement( k );
 
-        localIndex elementInSet = true;
+        integer elementInSet = true;
         for( localIndex i = 0; i < numNodes; ++i )
         {
           if( !nodeInCurSet( elemToNodeMap[k][i] ) )
@@ -254,12 +262,19 @@ void ElementRegionManager::buildSets( NodeManager const & nodeManager )
             break;
           }
         }
+        isElementInSet[k] = elementInSet;
+      } );
 
-        if( elementInSet )
+      // the selected elements are sorted and unique, so that they are inserted in bulk
+      elementsInSet.clear();
+      for( localIndex k = 0; k < subRegion.size(); ++k )
+      {
+        if( isElementInSet[k] )
         {
-          targetSet.insert( k );
+          elementsInSet.emplace_back( k );
         }
       }
+      targetSet.insert( elementsInSet.begin(), elementsInSet.end() );
     }
   } );
 }
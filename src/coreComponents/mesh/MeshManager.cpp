@@ -21,6 +21,7 @@
 #include "mesh/mpiCommunications/SpatialPartition.hpp"
 #include "generators/CellBlockManagerABC.hpp"
 #include "generators/MeshGeneratorBase.hpp"
+#include "generators/ParticleMeshGenerator.hpp"
 #include "mesh/mpiCommunications/CommunicationTools.hpp"
 #include "common/TimingMacros.hpp"
 
@@ -61,11 +62,18 @@ void MeshManager::expandObjectCatalogs()
 
 void MeshManager::generateMeshes( DomainPartition & domain )
 {
+  SpatialPartition & partition = dynamic_cast< SpatialPartition & >(domain.getReference< PartitionBase >( keys::partitionManager ) );
+
+  // The partition boundaries balanced on the particles must be known before the background grid is generated
+  forSubGroups< ParticleMeshGenerator >( [&]( ParticleMeshGenerator const & particleMeshGen )
+  {
+    particleMeshGen.balancePartition( partition );
+  } );
+
   forSubGroups< MeshGeneratorBase >( [&]( MeshGeneratorBase & meshGen )
   {
     MeshBody & meshBody = domain.getMeshBodies().registerGroup< MeshBody >( meshGen.getName() );
     meshBody.createMeshLevel( 0 );
-    SpatialPartition & partition = dynamic_cast< SpatialPartition & >(domain.getReference< PartitionBase >( keys::partitionManager ) );
 
     meshGen.generateMesh( meshBody, partition );
 
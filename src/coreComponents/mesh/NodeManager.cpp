@@ -25,6 +25,11 @@
 #include "mesh/ElementRegionManager.hpp"
 #include "mesh/FaceManager.hpp"
 #include "mesh/ToElementRelation.hpp"
+#include "mesh/simpleGeometricObjects/Box.hpp"
+#include "mesh/simpleGeometricObjects/Cylinder.hpp"
+#include "mesh/simpleGeometricObjects/Disc.hpp"
+#include "mesh/simpleGeometricObjects/Rectangle.hpp"
+#include "mesh/simpleGeometricObjects/ThickPlane.hpp"
 #include "mesh/utilities/MeshMapUtilities.hpp"
 
 namespace geos
@@ -96,18 +101,41 @@ void NodeManager::buildGeometricSets( GeometricObjectManager const & geometries
   arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = this->referencePosition();
   localIndex const numNodes = this->size();
 
-  geometries.forSubGroups< SimpleGeometricObjectBase >( [&]( SimpleGeometricObjectBase const & object )
+  array1d< integer > isNodeInObject( numNodes );
+
+  // the concrete object types are listed first, so that isCoordInObject (final in these types) is not a virtual call
+  geometries.forSubGroups< Box, Cylinder, Disc, Rectangle, ThickPlane, SimpleGeometricObjectBase >( [&]( auto const & object )
   {
     string const & name = object.getName();
     SortedArray< localIndex > & targetSet = m_sets.registerWrapper< SortedArray< localIndex > >( name ).reference();
+
+    // nodes outside of the bounding box of the object (if it is bounded) are not tested
+    real64 boxMin[3]{};
+    real64 boxMax[3]{};
+    bool const isBounded = object.getBoundingBox( boxMin, boxMax );
+
+    forAll< parallelHostPolicy >( numNodes, [&]( localIndex const a )
+    {
+      real64 const nodeCoord[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( X[a] );
+      bool inBox = true;
+      for( int i = 0; isBounded && i < 3; ++i )
+      {
+        inBox = inBox && nodeCoord[i] >= boxMin[i] && nodeCoord[i] <= boxMax[i];
+      }
+      isNodeInObject[a] = inBox && object.isCoordInObject( nodeCoord );
+    } );
+
+    // the selected nodes are sorted and unique, so that they are inserted in bulk
+    array1d< localIndex > nodesInObject;
+    nodesInObject.reserve( numNodes );
     for( localIndex a = 0; a < numNodes; ++a )
     {
-      real64 nodeCoord[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( X[a] );
-      if( object.isCoordInObject( nodeCoord ) )
+      if( isNodeInObject[a] )
       {
-        targetSet.insert( a );
+        nodesInObject.emplace_back( a );
       }
     }
+    targetSet.insert( nodesInObject.begin(), nodesInObject.end() );
   } );
 }
 
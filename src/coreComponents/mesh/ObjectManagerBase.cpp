@@ -856,6 +856,47 @@ void ObjectManagerBase::eraseObject( std::set< localIndex > const & indicesToEra
   }
 }
 
+void ObjectManagerBase::permuteObjects( arrayView1d< localIndex const > const & newToOld )
+{
+  GEOS_ERROR_IF_NE( newToOld.size(), size() );
+
+  permuteWrappers( *this, newToOld );
+
+  array1d< localIndex > oldToNew( newToOld.size() );
+  for( localIndex i=0; i<newToOld.size(); ++i )
+  {
+    oldToNew[ newToOld[ i ] ] = i;
+  }
+
+  for( localIndex i=0; i<m_sets.wrappers().size(); ++i )
+  {
+    SortedArray< localIndex > & targetSet = m_sets.getReference< SortedArray< localIndex > >( i );
+    targetSet.move( hostMemorySpace, true );
+
+    array1d< localIndex > newIndices;
+    newIndices.reserve( targetSet.size() );
+    for( localIndex const oldIndex : targetSet )
+    {
+      newIndices.emplace_back( oldToNew[ oldIndex ] );
+    }
+    targetSet.clear();
+    targetSet.insert( newIndices.begin(), newIndices.end() );
+  }
+}
+
+void ObjectManagerBase::permuteWrappers( dataRepository::Group & group,
+                                         arrayView1d< localIndex const > const & newToOld )
+{
+  for( auto & nameToWrapper: group.wrappers() )
+  {
+    WrapperBase * wrapper = nameToWrapper.second;
+    if( wrapper->sizedFromParent() )
+    {
+      wrapper->permute( newToOld );
+    }
+  }
+}
+
 void ObjectManagerBase::setMaxGlobalIndex()
 {
   m_maxGlobalIndex = MpiWrapper::max( m_localMaxGlobalIndex, MPI_COMM_GEOS );
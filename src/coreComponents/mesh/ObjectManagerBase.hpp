@@ -431,6 +431,22 @@ public:
    */
   void eraseObject( std::set< localIndex > const & indicesToErase );
 
+  /**
+   * @brief Reorder the objects of this object manager, permuting every field sized from it and the sets.
+   * @param newToOld The old local index of the object moved to each new local index, a permutation of [0, size()).
+   */
+  void permuteObjects( arrayView1d< localIndex const > const & newToOld );
+
+  /**
+   * @brief Reorder the first index of the wrappers of @p group that are sized from their parent.
+   * @param group The group holding the wrappers, e.g. a constitutive model sized from this object manager.
+   * @param newToOld The old index of the entry moved to each new index.
+   *
+   * The reordering goes through WrapperBase::permute, which raises an error for a resizable wrapper that is not an Array.
+   */
+  static void permuteWrappers( dataRepository::Group & group,
+                               arrayView1d< localIndex const > const & newToOld );
+
   /**
    * @brief Computes the maximum global index allong all the MPI ranks.
    */
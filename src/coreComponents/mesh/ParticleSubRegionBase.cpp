@@ -41,7 +41,8 @@ ParticleSubRegionBase::ParticleSubRegionBase( string const & name, Group * const
   m_particleMaterialDirection(),
   m_particleVolume(),
   m_particleType(),
-  m_particleRVectors()
+  m_particleRVectors(),
+  m_particleIndicesVersion( 0 )
 {
   registerGroup( groupKeyStruct::constitutiveModelsString(), &m_constitutiveModels ).
     setSizedFromParent( 1 );
@@ -127,6 +128,13 @@ void ParticleSubRegionBase::particleUnpack( buffer_type & buffer,
 
   // Unpack
   this->unpack( receiveBufferPtr, indices, 0, false, events );
+  m_particleIndicesVersion++;
+}
+
+void ParticleSubRegionBase::resize( localIndex const newSize )
+{
+  ObjectManagerBase::resize( newSize );
+  m_particleIndicesVersion++;
 }
 
 void ParticleSubRegionBase::erase( std::set< localIndex > const & indicesToErase )
@@ -147,6 +155,24 @@ void ParticleSubRegionBase::erase( std::set< localIndex > const & indicesToErase
   }
 }
 
+void ParticleSubRegionBase::permute( arrayView1d< localIndex const > const & newToOld )
+{
+  // Reorder the particle fields and sets, then the constitutive model fields which are sized by the number of particles
+  this->permuteObjects( newToOld );
+  m_constitutiveModels.forSubGroups( [&]( Group & constitutiveModel )
+  {
+    permuteWrappers( constitutiveModel, newToOld );
+  } );
+
+  // The neighbor list refers to the old particle indices
+  m_neighborList.resize( 0, 0 );
+  m_neighborList.resize( this->size() );
+
+  this->setActiveParticleIndices();
+  this->updateMaps();
+  m_particleIndicesVersion++;
+}
+
 void ParticleSubRegionBase::setActiveParticleIndices()
 {
   m_activeParticleIndices.move( LvArray::MemorySpace::host ); // TODO: Is this needed?
@@ -401,12 +401,37 @@ public:
                        int const & startingIndex,
                        int const & numberOfIncomingParticles );
 
+  using ObjectManagerBase::resize;
+
+  /**
+   * @brief Resizes the particle fields, and records that the particle indices have changed
+   * @param newSize the new number of particles
+   */
+  virtual void resize( localIndex const newSize ) override;
+
+  /**
+   * @brief Returns a counter incremented whenever particles are added to, removed from or reordered in this subregion
+   * @return the version of the particle indices
+   */
+  localIndex particleIndicesVersion() const
+  {
+    return m_particleIndicesVersion;
+  }
+
   /**
    * @brief Erases particle field data at the provided local indices
    * @param indicesToErase the local particle indices whose data should be erased
    */
   void erase( std::set< localIndex > const & indicesToErase );
 
+  /**
+   * @brief Reorders the particles of this subregion, including their constitutive model data
+   * @param newToOld the old local index of the particle moved to each new local index
+   *
+   * The active particle indices and the global-to-local map are rebuilt, the neighbor list is cleared.
+   */
+  void permute( arrayView1d< localIndex const > const & newToOld );
+
   /**
    * @brief Identifies the local indices of non-ghost particles
    */
@@ -479,6 +504,9 @@ protected:
   /// Neighbor list
   OrderedVariableToManyParticleRelation m_neighborList;
 
+  /// Counter incremented whenever the local particle indices change
+  localIndex m_particleIndicesVersion;
+
 };
 
 
@@ -48,6 +48,7 @@ WellElementRegion::~WellElementRegion()
 
 void WellElementRegion::generateWell( MeshLevel & mesh,
                                       LineBlockABC const & lineBlock,
+                                      ElementCenterIndex const & resElemCenterIndex,
                                       globalIndex nodeOffsetGlobal,
                                       globalIndex elemOffsetGlobal )
 {
@@ -65,7 +66,7 @@ void WellElementRegion::generateWell( MeshLevel & mesh,
   globalIndex const numPerforationsGlobal = lineBlock.numPerforations();
 
   // 1) select the local perforations based on connectivity to the local reservoir elements
-  subRegion.connectPerforationsToMeshElements( mesh, lineBlock );
+  subRegion.connectPerforationsToMeshElements( mesh, lineBlock, resElemCenterIndex );
 
   globalIndex const matchedPerforations = MpiWrapper::sum( perforationData->size() );
   GEOS_THROW_IF( matchedPerforations != numPerforationsGlobal,
@@ -103,6 +104,7 @@ void WellElementRegion::generateWell( MeshLevel & mesh,
   // 3) select the local well elements and mark boundary nodes (for ghosting)
   subRegion.generate( mesh,
                       lineBlock,
+                      resElemCenterIndex,
                       elemStatusGlobal,
                       nodeOffsetGlobal,
                       elemOffsetGlobal );
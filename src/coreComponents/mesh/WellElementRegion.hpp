@@ -28,6 +28,7 @@ namespace geos
 {
 
 class MeshLevel;
+class ElementCenterIndex;
 
 /**
  * @class WellElementRegion
@@ -128,11 +129,13 @@ public:
    * @brief Build the local well elements and perforations from global well geometry.
    * @param[in] mesh the mesh object (single level only)
    * @param[in] lineBlock the LineBlockABC containing the global well topology
+   * @param[in] resElemCenterIndex the spatial index of the reservoir element centers of @p mesh
    * @param[in] nodeOffsetGlobal the offset of the first global well node ( = offset of last global mesh node + 1 )
    * @param[in] elemOffsetGlobal the offset of the first global well element ( = offset of last global mesh elem + 1 )
    */
   void generateWell( MeshLevel & mesh,
                      LineBlockABC const & lineBlock,
+                     ElementCenterIndex const & resElemCenterIndex,
                      globalIndex nodeOffsetGlobal,
                      globalIndex elemOffsetGlobal );
 
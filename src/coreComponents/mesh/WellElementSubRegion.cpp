@@ -17,7 +17,7 @@
 
 #include "mesh/MeshLevel.hpp"
 #include "mesh/NodeManager.hpp"
-#include "mesh/MeshForLoopInterface.hpp"
+#include "mesh/utilities/ElementCenterIndex.hpp"
 #include "common/MpiWrapper.hpp"
 #include "LvArray/src/output.hpp"
 
@@ -247,38 +247,22 @@ bool visitNeighborElements( MeshLevel const & mesh,
           Note that this reservoir element does not necessarily contain the center of the well element.
           This "init" reservoir element will be used in SearchLocalElements to find the reservoir element that
           contains the well element.
- * @param[in] meshLevel the mesh object (single level only)
+ * @param[in] resElemCenterIndex the spatial index of the reservoir element centers
  * @param[in] location the location of that we are trying to match with a reservoir element
  * @param[inout] erInit the region index of the reservoir element from which we start the search
  * @param[inout] esrInit the subregion index of the reservoir element from which we start the search
  * @param[inout] eiInit the element index of the reservoir element from which we start the search
  */
-void initializeLocalSearch( MeshLevel const & mesh,
+void initializeLocalSearch( ElementCenterIndex const & resElemCenterIndex,
                             real64 const (&location)[3],
                             localIndex & erInit,
                             localIndex & esrInit,
                             localIndex & eiInit )
 {
-  ElementRegionManager::ElementViewAccessor< arrayView2d< real64 const > >
-  resElemCenter = mesh.getElemManager().constructViewAccessor< array2d< real64 >,
-                                                               arrayView2d< real64 const > >( ElementSubRegionBase::viewKeyStruct::elementCenterString() );
   // to initialize the local search for the reservoir element that contains "location",
   // we find the reservoir element that minimizes the distance from "location" to the reservoir element center
-  auto ret = minLocOverElemsInMesh( mesh, [&] ( localIndex const er,
-                                                localIndex const esr,
-                                                localIndex const ei )
-  {
-    real64 v[3] = { location[0], location[1], location[2] };
-    LvArray::tensorOps::subtract< 3 >( v, resElemCenter[er][esr][ei] );
-    return LvArray::tensorOps::l2Norm< 3 >( v );
-  } );
-
-  // save the region, subregion and index of the reservoir element
   // note that this reservoir element does not necessarily contains "location"
-  erInit  = std::get< 0 >( ret.second );
-  esrInit = std::get< 1 >( ret.second );
-  eiInit  = std::get< 2 >( ret.second );
-
+  resElemCenterIndex.findClosestElement( location, erInit, esrInit, eiInit );
 }
 
 /**
@@ -347,6 +331,7 @@ bool searchLocalElements( MeshLevel const & mesh,
 
 void WellElementSubRegion::generate( MeshLevel & mesh,
                                      LineBlockABC const & lineBlock,
+                                     ElementCenterIndex const & resElemCenterIndex,
                                      arrayView1d< integer > & elemStatusGlobal,
                                      globalIndex nodeOffsetGlobal,
                                      globalIndex elemOffsetGlobal )
@@ -386,6 +371,7 @@ void WellElementSubRegion::generate( MeshLevel & mesh,
   //      then the well element is assigned to rank k
   assignUnownedElementsInReservoir( mesh,
                                     lineBlock,
+                                    resElemCenterIndex,
                                     unownedElems,
                                     localElems,
                                     elemStatusGlobal );
@@ -438,6 +424,7 @@ void WellElementSubRegion::generate( MeshLevel & mesh,
 
 void WellElementSubRegion::assignUnownedElementsInReservoir( MeshLevel & mesh,
                                                              LineBlockABC const & lineBlock,
+                                                             ElementCenterIndex const & resElemCenterIndex,
                                                              SortedArray< globalIndex >      const & unownedElems,
                                                              SortedArray< globalIndex > & localElems,
                                                              arrayView1d< integer > & elemStatusGlobal ) const
@@ -470,7 +457,7 @@ void WellElementSubRegion::assignUnownedElementsInReservoir( MeshLevel & mesh,
     //         note that this reservoir element does not necessarily contain the center of the well element
     //         this "init" reservoir element will be used in SearchLocalElements to find the reservoir element that
     //         contains the well element
-    initializeLocalSearch( mesh, location,
+    initializeLocalSearch( resElemCenterIndex, location,
                            erInit, esrInit, eiInit );
 
     // Step 2: then, search for the reservoir element that contains the well element
@@ -754,7 +741,8 @@ void WellElementSubRegion::updateNodeManagerNodeToElementMap( MeshLevel & mesh )
 }
 
 void WellElementSubRegion::connectPerforationsToMeshElements( MeshLevel & mesh,
-                                                              LineBlockABC const & lineBlock )
+                                                              LineBlockABC const & lineBlock,
+                                                              ElementCenterIndex const & resElemCenterIndex )
 {
   arrayView2d< real64 const > const perfCoordsGlobal = lineBlock.getPerfCoords();
   arrayView1d< real64 const > const perfWellTransmissibilityGlobal = lineBlock.getPerfTransmissibility();
@@ -786,7 +774,7 @@ void WellElementSubRegion::connectPerforationsToMeshElements( MeshLevel & mesh,
     //         note that this reservoir element does not necessarily contain the center of the well element
     //         this "init" reservoir element will be used in SearchLocalElements to find the reservoir element that
     //         contains the well element
-    initializeLocalSearch( mesh, location,
+    initializeLocalSearch( resElemCenterIndex, location,
                            erInit, esrInit, eiInit );
 
     // Step 2: then, search for the reservoir element that contains the well element
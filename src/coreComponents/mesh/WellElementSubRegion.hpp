@@ -24,6 +24,8 @@
 namespace geos
 {
 
+class ElementCenterIndex;
+
 /**
  * @class WellElementSubRegion
  * @brief This class describes a collection of local well elements and perforations.
@@ -188,6 +190,7 @@ public:
    * @brief Build the local well elements from global well element data.
    * @param[in] mesh the mesh object (single level only)
    * @param[in] lineBlock the LineBlockABC containing the global well topology
+   * @param[in] resElemCenterIndex the spatial index of the reservoir element centers of @p mesh
    * @param[in] elemStatus list of well element status, as determined by perforations connected
    *                       to local or remote mesh partitions. Status values are defined in
    *                       enum SegmentStatus. They are used to partition well elements.
@@ -196,6 +199,7 @@ public:
    */
   void generate( MeshLevel & mesh,
                  LineBlockABC const & lineBlock,
+                 ElementCenterIndex const & resElemCenterIndex,
                  arrayView1d< integer > & elemStatus,
                  globalIndex nodeOffsetGlobal,
                  globalIndex elemOffsetGlobal );
@@ -204,9 +208,11 @@ public:
    * @brief For each perforation, find the reservoir element that contains the perforation.
    * @param[in] mesh the mesh object (single level only)
    * @param[in] lineBlock the LineBlockABC containing the global well topology
+   * @param[in] resElemCenterIndex the spatial index of the reservoir element centers of @p mesh
    */
   void connectPerforationsToMeshElements( MeshLevel & mesh,
-                                          LineBlockABC const & lineBlock );
+                                          LineBlockABC const & lineBlock,
+                                          ElementCenterIndex const & resElemCenterIndex );
 
   /**
    * @brief Reconstruct the (local) map nextWellElemId using nextWellElemIdGlobal after the ghost exchange.
@@ -305,6 +311,7 @@ private:
             in the reservoir (and that can therefore be matched with a reservoir element) to an MPI rank.
    * @param[in] meshLevel the mesh object (single level only)
    * @param[in] lineBlock the LineBlockABC containing the global well topology
+   * @param[in] resElemCenterIndex the spatial index of the reservoir element centers of @p mesh
    * @param[in] unownedElems set of unowned well elems.
    * @param[out] localElems set of local well elems. It contains the perforated well elements
                             connected to local mesh elements before the call, and is filled
@@ -314,6 +321,7 @@ private:
    */
   void assignUnownedElementsInReservoir( MeshLevel & mesh,
                                          LineBlockABC const & lineBlock,
+                                         ElementCenterIndex const & resElemCenterIndex,
                                          SortedArray< globalIndex >           const & unownedElems,
                                          SortedArray< globalIndex > & localElems,
                                          arrayView1d< integer > & elemStatusGlobal ) const;
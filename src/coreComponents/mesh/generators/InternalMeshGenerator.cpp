@@ -556,6 +556,17 @@ void InternalMeshGenerator::fillCellBlockManager( CellBlockManager & cellBlockMa
     m_max[1] = m_vertices[1].back();
     m_max[2] = m_vertices[2].back();
 
+    // Partition boundaries balanced on the particles are moved onto the element boundaries
+    integer numElems[3] = { 0, 0, 0 };
+    for( int dim = 0; dim < 3; ++dim )
+    {
+      for( int block = 0; block < m_nElems[dim].size(); ++block )
+      {
+        numElems[dim] += m_nElems[dim][block];
+      }
+    }
+    partition.alignPartitionLocations( m_min, m_max, numElems );
+
     partition.setSizes( m_min, m_max );
   }
 
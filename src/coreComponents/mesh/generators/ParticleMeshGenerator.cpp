@@ -35,7 +35,8 @@ ParticleMeshGenerator::ParticleMeshGenerator( string const & name, Group * const
   MeshGeneratorBase( name, parent ),
   m_dim( 3 ),
   m_min(),
-  m_max()
+  m_max(),
+  m_balancePartition( 0 )
 {
   registerWrapper( viewKeyStruct::particleFilePathString(), &m_particleFilePath ).
     setInputFlag( InputFlags::REQUIRED ).
@@ -56,6 +57,11 @@ ParticleMeshGenerator::ParticleMeshGenerator( string const & name, Group * const
     setInputFlag( InputFlags::REQUIRED ).
     setSizedFromParent( 0 ).
     setDescription( "Particle types of each particle block" );
+
+  registerWrapper( viewKeyStruct::balancePartitionString(), &m_balancePartition ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Flag to balance the partition boundaries on the particle counts before generating the background grid" );
 }
 
 Group * ParticleMeshGenerator::createChild( string const & GEOS_UNUSED_PARAM( childKey ),
@@ -65,6 +71,64 @@ Group * ParticleMeshGenerator::createChild( string const & GEOS_UNUSED_PARAM( ch
 }
 
 
+void ParticleMeshGenerator::balancePartition( SpatialPartition & partition ) const
+{
+  GEOS_MARK_FUNCTION;
+
+  if( m_balancePartition == 0 )
+  {
+    return;
+  }
+
+  std::ifstream headerFile( m_headerFilePath );
+  std::ifstream particleFile( m_particleFilePath );
+  GEOS_THROW_IF( !headerFile.is_open() || !particleFile.is_open(),
+                 getName() << ": could not open the header or particle file to balance the partition",
+                 InputError );
+  std::string line;
+
+  // Read the number of particles in the header, skipping the material key
+  int numMaterials, numParticleTypes;
+  std::getline( headerFile, line );
+  std::istringstream iss1( line );
+  iss1 >> numMaterials >> numParticleTypes;
+  for( int i=0; i<numMaterials; i++ )
+  {
+    std::getline( headerFile, line );
+  }
+  int numParticles = 0;
+  for( int i=0; i<numParticleTypes; i++ )
+  {
+    std::getline( headerFile, line );
+    std::istringstream iss2( line );
+    std::string particleType;
+    int np;
+    iss2 >> particleType >> np;
+    numParticles += np;
+  }
+
+  // Read the particle positions (columns 1, 2 and 3 of the particle file)
+  std::vector< real64 > particleCoordinates[3];
+  for( int i=0; i<3; i++ )
+  {
+    particleCoordinates[i].reserve( numParticles );
+  }
+  for( int p=0; p<numParticles && std::getline( particleFile, line ); p++ )
+  {
+    std::istringstream lineStream( line );
+    double globalID, x, y, z;
+    if( lineStream >> globalID >> x >> y >> z )
+    {
+      particleCoordinates[0].push_back( x );
+      particleCoordinates[1].push_back( y );
+      particleCoordinates[2].push_back( z );
+    }
+  }
+
+  // Every rank reads the whole particle file, so the boundaries are identical on all ranks
+  partition.balancePartitionLocations( particleCoordinates );
+}
+
 void ParticleMeshGenerator::fillParticleBlockManager( ParticleBlockManager & particleBlockManager, ParticleManager & particleManager, SpatialPartition const & partition )
 {
   GEOS_MARK_FUNCTION;
@@ -63,6 +63,13 @@ public:
 
   virtual void fillParticleBlockManager( ParticleBlockManager & particleBlockManager, ParticleManager & particleManager, SpatialPartition const & partition ) override;
 
+  /**
+   * @brief Place the partition boundaries so that the partitions along each direction hold the same number of particles.
+   * @param[inout] partition the partition, whose boundaries are used by the background grid generated afterwards
+   * @note This does nothing unless the balancePartition flag is set.
+   */
+  void balancePartition( SpatialPartition & partition ) const;
+
   void importFieldOnArray( Block block,
                            string const & blockName,
                            string const & meshFieldName,
@@ -78,6 +85,7 @@ protected:
     constexpr static char const * headerFilePathString() { return "headerFile"; }
     constexpr static char const * particleBlockNamesString() { return "particleBlockNames"; }
     constexpr static char const * particleTypesString() { return "particleTypes"; }
+    constexpr static char const * balancePartitionString() { return "balancePartition"; }
   };
   /// @endcond
 
@@ -106,6 +114,9 @@ private:
   /// String array listing the particle types present
   array1d< string > m_particleType;
 
+  /// Flag to balance the partition boundaries on the particle counts
+  integer m_balancePartition;
+
 public:
 
 };
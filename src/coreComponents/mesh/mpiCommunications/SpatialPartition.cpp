@@ -18,6 +18,7 @@
 #include "LvArray/src/genericTensorOps.hpp"
 #include "mesh/mpiCommunications/MPI_iCommData.hpp"
 
+#include <algorithm>
 #include <cmath>
 
 namespace geos
@@ -45,6 +46,46 @@ real64 MapValueToRange( real64 value, real64 min, real64 max )
   return Mod( value-min, max-min )+min;
 }
 
+// BisectCoordinates
+// places the boundaries between the partitions [firstPartition, lastPartition) so that each partition
+// gets the same share of the sorted coordinates [first, last), found in the range [lower, upper]
+void BisectCoordinates( std::vector< real64 > const & sortedCoords,
+                        std::size_t const first,
+                        std::size_t const last,
+                        real64 const lower,
+                        real64 const upper,
+                        int const firstPartition,
+                        int const lastPartition,
+                        array1d< real64 > & locations )
+{
+  int const numPartitions = lastPartition - firstPartition;
+  if( numPartitions <= 1 )
+  {
+    return;
+  }
+
+  // the lower slab gets numPartitions / 2 partitions, and the matching share of the coordinates
+  int const midPartition = firstPartition + numPartitions / 2;
+  real64 location;
+  std::size_t mid;
+  if( last - first < 2 )
+  {
+    // not enough coordinates to bisect, split the range evenly
+    location = lower + ( upper - lower ) * ( midPartition - firstPartition ) / numPartitions;
+    mid = std::lower_bound( sortedCoords.begin() + first, sortedCoords.begin() + last, location ) - sortedCoords.begin();
+  }
+  else
+  {
+    mid = first + ( last - first ) * ( midPartition - firstPartition ) / numPartitions;
+    mid = std::min( std::max( mid, first + 1 ), last - 1 );
+    location = 0.5 * ( sortedCoords[mid - 1] + sortedCoords[mid] );
+  }
+  locations[midPartition - 1] = location;
+
+  BisectCoordinates( sortedCoords, first, mid, lower, location, firstPartition, midPartition, locations );
+  BisectCoordinates( sortedCoords, mid, last, location, upper, midPartition, lastPartition, locations );
+}
+
 }
 
 SpatialPartition::SpatialPartition():
@@ -57,6 +98,7 @@ SpatialPartition::SpatialPartition():
   m_gridSize{ 0.0 },
   m_gridMin{ 0.0 },
   m_gridMax{ 0.0 },
+  m_alignPartitionLocations( false ),
   m_Partitions()
 {
   m_size = 0;
@@ -157,6 +199,58 @@ void SpatialPartition::addNeighbors( const unsigned int idim,
   }
 }
 
+void SpatialPartition::balancePartitionLocations( std::vector< real64 > ( &coordinates )[ 3 ] )
+{
+  for( int i = 0; i < nsdof; ++i )
+  {
+    if( m_Partitions( i ) == 1 || coordinates[i].empty() )
+    {
+      continue;
+    }
+
+    std::vector< real64 > & sortedCoords = coordinates[i];
+    std::sort( sortedCoords.begin(), sortedCoords.end() );
+
+    m_PartitionLocations[i].resize( m_Partitions( i ) - 1 );
+    BisectCoordinates( sortedCoords, 0, sortedCoords.size(), sortedCoords.front(), sortedCoords.back(),
+                       0, m_Partitions( i ), m_PartitionLocations[i] );
+    m_alignPartitionLocations = true;
+  }
+}
+
+void SpatialPartition::alignPartitionLocations( real64 const ( &min )[ 3 ],
+                                                real64 const ( &max )[ 3 ],
+                                                integer const ( &numElems )[ 3 ] )
+{
+  if( !m_alignPartitionLocations )
+  {
+    return;
+  }
+
+  for( int i = 0; i < nsdof; ++i )
+  {
+    integer const numLocations = LvArray::integerConversion< integer >( m_PartitionLocations[i].size() );
+    if( numLocations == 0 )
+    {
+      continue;
+    }
+    GEOS_ERROR_IF( numLocations >= numElems[i],
+                   "Number of partitions in a direction should not exceed the number of elements in that direction" );
+
+    // snap each boundary to the nearest element boundary, leaving at least one element in each partition
+    real64 const elemSize = ( max[i] - min[i] ) / numElems[i];
+    integer previousIndex = 0;
+    for( integer j = 0; j < numLocations; ++j )
+    {
+      integer index = LvArray::integerConversion< integer >( std::lround( ( m_PartitionLocations[i][j] - min[i] ) / elemSize ) );
+      index = std::min( std::max( index, previousIndex + 1 ), numElems[i] - numLocations + j );
+      m_PartitionLocations[i][j] = min[i] + index * elemSize;
+      previousIndex = index;
+    }
+  }
+  m_alignPartitionLocations = false;
+}
+
 void SpatialPartition::updateSizes( arrayView1d< real64 > const domainL,
                                     real64 const dt )
 {
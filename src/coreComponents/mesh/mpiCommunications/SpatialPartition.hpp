@@ -74,6 +74,29 @@ public:
 
   int getColor() override;
 
+  /**
+   * @brief Place the partition boundaries so that each slab of partitions along a direction holds the same number of objects.
+   * @param[in] coordinates the coordinates of the objects (e.g., particles) along each direction
+   *
+   * The boundaries are found by recursive coordinate bisection of the object counts, restricted to the
+   * cartesian partition: along each direction, the slabs of partitions are bisected until each slab is a single
+   * partition. The boundaries replace the even spacing in the next call to setSizes, after being aligned on the
+   * elements of the generated mesh by alignPartitionLocations. The directions without objects keep the even spacing.
+   */
+  void balancePartitionLocations( std::vector< real64 > ( &coordinates )[ 3 ] );
+
+  /**
+   * @brief Move the partition boundaries placed by balancePartitionLocations onto the element boundaries of a regular mesh.
+   * @param[in] min the minimum extent of the mesh
+   * @param[in] max the maximum extent of the mesh
+   * @param[in] numElems the number of elements of the mesh along each direction
+   *
+   * Each partition keeps at least one element along each direction. The boundaries set by setSizes are not modified.
+   */
+  void alignPartitionLocations( real64 const ( &min )[ 3 ],
+                                real64 const ( &max )[ 3 ],
+                                integer const ( &numElems )[ 3 ] );
+
   void repartitionMasterParticles( ParticleSubRegion & subRegion,
                                    MPI_iCommData & commData );
 
@@ -168,6 +191,9 @@ private:
   /// Locations of partition boundaries
   array1d< real64 > m_PartitionLocations[3];
 
+  /// Flag indicating whether the partition boundaries were placed by balancePartitionLocations and must still be aligned
+  bool m_alignPartitionLocations;
+
   /// Length of partition dimensions (excluding ghost objects).
   real64 m_blockSize[3];
 
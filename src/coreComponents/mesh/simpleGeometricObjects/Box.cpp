@@ -111,6 +111,26 @@ bool Box::isCoordInObject( real64 const ( &coord ) [3] ) const
   return true;
 }
 
+bool Box::getBoundingBox( real64 ( &min ) [3], real64 ( &max ) [3] ) const
+{
+  LvArray::tensorOps::copy< 3 >( min, m_min );
+  LvArray::tensorOps::copy< 3 >( max, m_max );
+  if( std::fabs( m_strikeAngle ) >= 1e-20 )
+  {
+    // rotate the corners of the box back around the vertical axis through its center
+    real64 const halfLength[2] = { 0.5 * ( m_max[0] - m_min[0] ), 0.5 * ( m_max[1] - m_min[1] ) };
+    for( int i = 0; i < 2; ++i )
+    {
+      // pad the extent to make sure that round-off does not exclude points on the faces of the box
+      real64 const halfExtent = ( std::fabs( m_cosStrike ) * halfLength[i] + std::fabs( m_sinStrike ) * halfLength[1-i] )
+                                * ( 1.0 + 1e-12 ) + 1e-12 * std::fabs( m_boxCenter[i] );
+      min[i] = m_boxCenter[i] - halfExtent;
+      max[i] = m_boxCenter[i] + halfExtent;
+    }
+  }
+  return true;
+}
+
 REGISTER_CATALOG_ENTRY( SimpleGeometricObjectBase, Box, string const &, Group * const )
 
 } /* namespace geos */
@@ -99,6 +99,24 @@ bool Cylinder::isCoordInObject( real64 const ( &targetPt ) [3] ) const
   return rval;
 }
 
+bool Cylinder::getBoundingBox( real64 ( &min ) [3], real64 ( &max ) [3] ) const
+{
+  real64 axis[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( m_point2 );
+  LvArray::tensorOps::subtract< 3 >( axis, m_point1 );
+  LvArray::tensorOps::normalize< 3 >( axis );
+
+  // the extent of a disc of normal n and radius r in direction i is r * sqrt( 1 - n_i^2 ),
+  // padded to make sure that round-off does not exclude points on the surface of the cylinder
+  for( int i = 0; i < 3; ++i )
+  {
+    real64 const halfExtent = m_radius * std::sqrt( LvArray::math::max( 1.0 - axis[i] * axis[i], 0.0 ) ) * ( 1.0 + 1e-12 )
+                              + 1e-12 * ( std::fabs( m_point1[i] ) + std::fabs( m_point2[i] ) );
+    min[i] = LvArray::math::min( m_point1[i], m_point2[i] ) - halfExtent;
+    max[i] = LvArray::math::max( m_point1[i], m_point2[i] ) + halfExtent;
+  }
+  return true;
+}
+
 REGISTER_CATALOG_ENTRY( SimpleGeometricObjectBase, Cylinder, string const &, Group * const )
 
 } /* namespace geos */
@@ -80,6 +80,19 @@ bool Disc::isCoordInObject( real64 const ( &coord ) [3] ) const
   return isInside;
 }
 
+bool Disc::getBoundingBox( real64 ( &min ) [3], real64 ( &max ) [3] ) const
+{
+  // the disc is in the ball of radius m_radius around its center,
+  // padded to make sure that round-off does not exclude points on the edge of the disc
+  for( int i = 0; i < 3; ++i )
+  {
+    real64 const halfExtent = m_radius * ( 1.0 + 1e-12 ) + 1e-12 * std::fabs( m_center[i] );
+    min[i] = m_center[i] - halfExtent;
+    max[i] = m_center[i] + halfExtent;
+  }
+  return true;
+}
+
 REGISTER_CATALOG_ENTRY( SimpleGeometricObjectBase, Disc, string const &, Group * const )
 
 } /* namespace geos */
@@ -68,6 +68,8 @@ public:
 
   bool isCoordInObject( real64 const ( &coord ) [3] ) const override final;
 
+  bool getBoundingBox( real64 ( &min ) [3], real64 ( &max ) [3] ) const override final;
+
   /**
    * @name Getters
    */
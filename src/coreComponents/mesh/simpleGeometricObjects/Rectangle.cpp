@@ -169,6 +169,26 @@ bool Rectangle::isCoordInObject( real64 const ( &coord ) [3] ) const
   return isInside;
 }
 
+bool Rectangle::getBoundingBox( real64 ( &min ) [3], real64 ( &max ) [3] ) const
+{
+  // the rectangle is in the box of its corners, enlarged by the distance tolerance to its plane
+  // and padded to make sure that round-off does not exclude points on its edges
+  for( int i = 0; i < 3; ++i )
+  {
+    min[i] = m_points[0][i];
+    max[i] = m_points[0][i];
+    for( int p = 1; p < 4; ++p )
+    {
+      min[i] = LvArray::math::min( min[i], m_points[p][i] );
+      max[i] = LvArray::math::max( max[i], m_points[p][i] );
+    }
+    real64 const pad = m_tolerance + 1e-12 * ( max[i] - min[i] + std::fabs( min[i] ) + std::fabs( max[i] ) );
+    min[i] -= pad;
+    max[i] += pad;
+  }
+  return true;
+}
+
 REGISTER_CATALOG_ENTRY( SimpleGeometricObjectBase, Rectangle, string const &, Group * const )
 
 } /* namespace geos */
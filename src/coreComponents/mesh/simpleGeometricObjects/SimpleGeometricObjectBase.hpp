@@ -94,6 +94,21 @@ public:
    */
   virtual bool isCoordInObject( real64 const ( &coord ) [3] ) const = 0;
 
+  /**
+   * @brief Get an axis-aligned box that contains the object.
+   * @param[out] min the minimum (x,y,z) coordinates of the box
+   * @param[out] max the maximum (x,y,z) coordinates of the box
+   * @return true if the object is bounded and the box was set, false otherwise
+   *
+   * All the coordinates for which isCoordInObject returns true are in the box, so that
+   * the coordinates outside of the box can be discarded without testing them.
+   */
+  virtual bool getBoundingBox( real64 ( &min ) [3], real64 ( &max ) [3] ) const
+  {
+    GEOS_UNUSED_VAR( min, max );
+    return false;
+  }
+
 };
 
 
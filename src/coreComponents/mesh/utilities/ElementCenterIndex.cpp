@@ -0,0 +1,211 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file ElementCenterIndex.cpp
+ */
+
+#include "ElementCenterIndex.hpp"
+
+#include "mesh/MeshLevel.hpp"
+#include "LvArray/src/tensorOps.hpp"
+
+namespace geos
+{
+
+ElementCenterIndex::ElementCenterIndex( MeshLevel const & mesh ):
+  m_min{ 0.0, 0.0, 0.0 },
+  m_binSize{ 1.0, 1.0, 1.0 },
+  m_numBins{ 1, 1, 1 }
+{
+  ElementRegionManager const & elemManager = mesh.getElemManager();
+
+  // 1) gather the centers of the cell elements, ordered by region, subregion and index
+  localIndex numElems = 0;
+  elemManager.forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion const & subRegion )
+  {
+    numElems += subRegion.size();
+  } );
+
+  m_elemRegion.resize( numElems );
+  m_elemSubRegion.resize( numElems );
+  m_elemIndex.resize( numElems );
+  m_elemCenter.resize( numElems, 3 );
+
+  localIndex e = 0;
+  for( localIndex er = 0; er < elemManager.numRegions(); ++er )
+  {
+    elemManager.getRegion( er ).forElementSubRegionsIndex< CellElementSubRegion >( [&]( localIndex const esr,
+                                                                                         CellElementSubRegion const & subRegion )
+    {
+      arrayView2d< real64 const > const elemCenter = subRegion.getElementCenter();
+      for( localIndex ei = 0; ei < subRegion.size(); ++ei, ++e )
+      {
+        m_elemRegion[e] = er;
+        m_elemSubRegion[e] = esr;
+        m_elemIndex[e] = ei;
+        LvArray::tensorOps::copy< 3 >( m_elemCenter[e], elemCenter[ei] );
+      }
+    } );
+  }
+
+  if( numElems == 0 )
+  {
+    return;
+  }
+
+  // 2) size the bins to hold about two elements each, in the directions in which the centers are spread
+  real64 max[3];
+  LvArray::tensorOps::copy< 3 >( m_min, m_elemCenter[0] );
+  LvArray::tensorOps::copy< 3 >( max, m_elemCenter[0] );
+  for( e = 1; e < numElems; ++e )
+  {
+    for( int i = 0; i < 3; ++i )
+    {
+      m_min[i] = LvArray::math::min( m_min[i], m_elemCenter[e][i] );
+      max[i] = LvArray::math::max( max[i], m_elemCenter[e][i] );
+    }
+  }
+
+  real64 volume = 1.0;
+  int numDims = 0;
+  for( int i = 0; i < 3; ++i )
+  {
+    if( max[i] > m_min[i] )
+    {
+      volume *= max[i] - m_min[i];
+      ++numDims;
+    }
+  }
+  real64 const binSize = numDims > 0 ? std::pow( 2.0 * volume / numElems, 1.0 / numDims ) : 1.0;
+  for( int i = 0; i < 3; ++i )
+  {
+    if( max[i] > m_min[i] )
+    {
+      real64 const numBins = LvArray::math::min( std::ceil( ( max[i] - m_min[i] ) / binSize ), real64( numElems ) );
+      m_numBins[i] = LvArray::math::max( static_cast< int >( numBins ), 1 );
+      m_binSize[i] = ( max[i] - m_min[i] ) / m_numBins[i];
+    }
+  }
+
+  // 3) sort the elements into the bins
+  localIndex const numBins = localIndex( m_numBins[0] ) * m_numBins[1] * m_numBins[2];
+  array1d< localIndex > elemBin( numElems );
+  array1d< localIndex > binCounts( numBins );
+  for( e = 0; e < numElems; ++e )
+  {
+    elemBin[e] = binIndex( m_elemCenter[e][0], 0 )
+                 + binIndex( m_elemCenter[e][1], 1 ) * m_numBins[0]
+                 + binIndex( m_elemCenter[e][2], 2 ) * m_numBins[0] * m_numBins[1];
+    ++binCounts[elemBin[e]];
+  }
+
+  m_bins.resizeFromCapacities< serialPolicy >( numBins, binCounts.data() );
+  for( e = 0; e < numElems; ++e )
+  {
+    m_bins.emplaceBack( elemBin[e], e );
+  }
+}
+
+int ElementCenterIndex::binIndex( real64 const x, int const dir ) const
+{
+  int const bin = static_cast< int >( std::floor( ( x - m_min[dir] ) / m_binSize[dir] ) );
+  return LvArray::math::min( LvArray::math::max( bin, 0 ), m_numBins[dir] - 1 );
+}
+
+void ElementCenterIndex::findClosestElement( real64 const (&location)[3],
+                                             localIndex & er,
+                                             localIndex & esr,
+                                             localIndex & ei ) const
+{
+  er = -1;
+  esr = -1;
+  ei = -1;
+
+  // the elements that are r rings of bins away from the bin of the location are at least (r-1) bin sizes away
+  real64 minBinSize = std::numeric_limits< real64 >::max();
+  for( int i = 0; i < 3; ++i )
+  {
+    if( m_numBins[i] > 1 )
+    {
+      minBinSize = LvArray::math::min( minBinSize, m_binSize[i] );
+    }
+  }
+
+  int const c[3] = { binIndex( location[0], 0 ), binIndex( location[1], 1 ), binIndex( location[2], 2 ) };
+  int const maxRing = LvArray::math::max( m_numBins[0], LvArray::math::max( m_numBins[1], m_numBins[2] ) ) - 1;
+
+  real64 minDist = std::numeric_limits< real64 >::max();
+  localIndex minElem = -1;
+
+  auto visitBin = [&]( int const i, int const j, int const k )
+  {
+    for( localIndex const e : m_bins[ i + j * m_numBins[0] + k * m_numBins[0] * m_numBins[1] ] )
+    {
+      real64 v[3] = { location[0], location[1], location[2] };
+      LvArray::tensorOps::subtract< 3 >( v, m_elemCenter[e] );
+      real64 const dist = LvArray::tensorOps::l2Norm< 3 >( v );
+      if( dist < minDist || ( dist == minDist && e < minElem ) )
+      {
+        minDist = dist;
+        minElem = e;
+      }
+    }
+  };
+
+  for( int r = 0; r <= maxRing; ++r )
+  {
+    // visit the bins on the surface of the cube of half-width r centered on the bin of the location
+    for( int i = LvArray::math::max( c[0] - r, 0 ); i <= LvArray::math::min( c[0] + r, m_numBins[0] - 1 ); ++i )
+    {
+      for( int j = LvArray::math::max( c[1] - r, 0 ); j <= LvArray::math::min( c[1] + r, m_numBins[1] - 1 ); ++j )
+      {
+        if( std::abs( i - c[0] ) == r || std::abs( j - c[1] ) == r )
+        {
+          for( int k = LvArray::math::max( c[2] - r, 0 ); k <= LvArray::math::min( c[2] + r, m_numBins[2] - 1 ); ++k )
+          {
+            visitBin( i, j, k );
+          }
+        }
+        else
+        {
+          if( c[2] - r >= 0 )
+          {
+            visitBin( i, j, c[2] - r );
+          }
+          if( r > 0 && c[2] + r < m_numBins[2] )
+          {
+            visitBin( i, j, c[2] + r );
+          }
+        }
+      }
+    }
+
+    // stop when no element in the next rings can be closer (or as close) as the current closest element
+    if( minElem >= 0 && minDist < r * minBinSize )
+    {
+      break;
+    }
+  }
+
+  if( minElem >= 0 )
+  {
+    er = m_elemRegion[minElem];
+    esr = m_elemSubRegion[minElem];
+    ei = m_elemIndex[minElem];
+  }
+}
+
+} // namespace geos
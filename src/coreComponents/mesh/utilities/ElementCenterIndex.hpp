@@ -0,0 +1,101 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file ElementCenterIndex.hpp
+ */
+
+#ifndef GEOS_MESH_UTILITIES_ELEMENTCENTERINDEX_HPP_
+#define GEOS_MESH_UTILITIES_ELEMENTCENTERINDEX_HPP_
+
+#include "common/DataTypes.hpp"
+
+namespace geos
+{
+
+class MeshLevel;
+
+/**
+ * @class ElementCenterIndex
+ * @brief Spatial index over the centers of the cell elements of a mesh level.
+ *
+ * The element centers are sorted into a uniform grid of bins holding a couple of elements each,
+ * so that the element closest to a point is found by visiting the bins around that point
+ * instead of all the elements of the mesh.
+ */
+class ElementCenterIndex
+{
+public:
+
+  /**
+   * @brief Bin the centers of the cell elements of a mesh level.
+   * @param[in] mesh the mesh object (single level only)
+   */
+  explicit ElementCenterIndex( MeshLevel const & mesh );
+
+  /**
+   * @brief Find the cell element whose center is the closest to a location.
+   * @param[in] location the location
+   * @param[out] er the region index of the closest element, -1 if the mesh has no cell element
+   * @param[out] esr the subregion index of the closest element, -1 if the mesh has no cell element
+   * @param[out] ei the index of the closest element, -1 if the mesh has no cell element
+   *
+   * Among elements at the same distance, the one with the lowest (region, subregion, index) is returned,
+   * as would be by a loop over all the elements.
+   */
+  void findClosestElement( real64 const (&location)[3],
+                           localIndex & er,
+                           localIndex & esr,
+                           localIndex & ei ) const;
+
+private:
+
+  /**
+   * @brief Compute the bin containing a coordinate, clamped to the grid.
+   * @param[in] x the coordinate
+   * @param[in] dir the direction of the coordinate
+   * @return the bin index in direction @p dir
+   */
+  int binIndex( real64 const x, int const dir ) const;
+
+  /// Lower corner of the bin grid
+  real64 m_min[3];
+
+  /// Size of the bins in each direction
+  real64 m_binSize[3];
+
+  /// Number of bins in each direction
+  int m_numBins[3];
+
+  /// Elements in each bin, as indices in the arrays below
+  ArrayOfArrays< localIndex > m_bins;
+
+  /// Region index of the binned elements
+  array1d< localIndex > m_elemRegion;
+
+  /// Subregion index of the binned elements
+  array1d< localIndex > m_elemSubRegion;
+
+  /// Index of the binned elements in their subregion
+  array1d< localIndex > m_elemIndex;
+
+  /// Center of the binned elements
+  array2d< real64 > m_elemCenter;
+
+};
+
+} // namespace geos
+
+#endif // GEOS_MESH_UTILITIES_ELEMENTCENTERINDEX_HPP_
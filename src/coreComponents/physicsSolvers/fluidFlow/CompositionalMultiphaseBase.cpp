@@ -68,7 +68,8 @@ CompositionalMultiphaseBase::CompositionalMultiphaseBase( const string & name,
   m_allowCompDensChopping( 1 ),
   m_useTotalMassEquation( 1 ),
   m_useSimpleAccumulation( 1 ),
-  m_minCompDens( isothermalCompositionalMultiphaseBaseKernels::minDensForDivision )
+  m_minCompDens( isothermalCompositionalMultiphaseBaseKernels::minDensForDivision ),
+  m_stateUpdateTolerance( -1.0 )
 {
 //START_SPHINX_INCLUDE_00
   this->registerWrapper( viewKeyStruct::inputTemperatureString(), &m_inputTemperature ).
@@ -171,6 +172,15 @@ CompositionalMultiphaseBase::CompositionalMultiphaseBase( const string & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setApplyDefaultValue( 0.01 ).
     setDescription( "Minimum value for solution scaling factor" );
+
+  this->registerWrapper( viewKeyStruct::stateUpdateToleranceString(), &m_stateUpdateTolerance ).
+    setSizedFromParent( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( -1.0 ). // disabled by default
+    setDescription( "Relative change in the primary variables of a cell in a Newton iteration below which "
+                    "the fluid, relperm and capillary pressure models of the cell are not updated. "
+                    "With 0, only the cells whose primary variables did not change at all are skipped. "
+                    "A negative value disables the skipping" );
 }
 
 void CompositionalMultiphaseBase::postInputInitialization()
@@ -372,6 +382,13 @@ void CompositionalMultiphaseBase::registerDataOnMesh( Group & meshBodies )
           setDimLabels( 1, fluid.componentNames() ).
           reference().resizeDimension< 1 >( m_numComponents );
       }
+      if( m_stateUpdateTolerance >= 0.0 )
+      {
+        subRegion.registerField< stateUpdatePressure >( getName() );
+        subRegion.registerField< stateUpdateTemperature >( getName() );
+        subRegion.registerField< stateUpdateGlobalCompDensity >( getName() ).
+          reference().resizeDimension< 1 >( m_numComponents );
+      }
 
       subRegion.registerField< globalCompFraction >( getName() ).
         setDimLabels( 1, fluid.componentNames() ).
@@ -658,7 +675,8 @@ real64 CompositionalMultiphaseBase::updatePhaseVolumeFraction( ObjectManagerBase
   return maxDeltaPhaseVolFrac;
 }
 
-void CompositionalMultiphaseBase::updateFluidModel( ObjectManagerBase & dataGroup ) const
+void CompositionalMultiphaseBase::updateFluidModel( ObjectManagerBase & dataGroup,
+                                                    arrayView1d< localIndex const > const * const targetSet ) const
 {
   GEOS_MARK_FUNCTION;
 
@@ -676,17 +694,31 @@ void CompositionalMultiphaseBase::updateFluidModel( ObjectManagerBase & dataGrou
     using ExecPolicy = typename FluidType::exec_policy;
     typename FluidType::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
 
-    thermalCompositionalMultiphaseBaseKernels::
-      FluidUpdateKernel::
-      launch< ExecPolicy >( dataGroup.size(),
-                            fluidWrapper,
-                            pres,
-                            temp,
-                            compFrac );
+    if( targetSet != nullptr )
+    {
+      thermalCompositionalMultiphaseBaseKernels::
+        FluidUpdateKernel::
+        launch< ExecPolicy >( *targetSet,
+                              fluidWrapper,
+                              pres,
+                              temp,
+                              compFrac );
+    }
+    else
+    {
+      thermalCompositionalMultiphaseBaseKernels::
+        FluidUpdateKernel::
+        launch< ExecPolicy >( dataGroup.size(),
+                              fluidWrapper,
+                              pres,
+                              temp,
+                              compFrac );
+    }
   } );
 }
 
-void CompositionalMultiphaseBase::updateRelPermModel( ObjectManagerBase & dataGroup ) const
+void CompositionalMultiphaseBase::updateRelPermModel( ObjectManagerBase & dataGroup,
+                                                      arrayView1d< localIndex const > const * const targetSet ) const
 {
   GEOS_MARK_FUNCTION;
 
@@ -700,15 +732,27 @@ void CompositionalMultiphaseBase::updateRelPermModel( ObjectManagerBase & dataGr
   {
     typename TYPEOFREF( castedRelPerm ) ::KernelWrapper relPermWrapper = castedRelPerm.createKernelWrapper();
 
-    isothermalCompositionalMultiphaseBaseKernels::
-      RelativePermeabilityUpdateKernel::
-      launch< parallelDevicePolicy<> >( dataGroup.size(),
-                                        relPermWrapper,
-                                        phaseVolFrac );
+    if( targetSet != nullptr )
+    {
+      isothermalCompositionalMultiphaseBaseKernels::
+        RelativePermeabilityUpdateKernel::
+        launch< parallelDevicePolicy<> >( *targetSet,
+                                          relPermWrapper,
+                                          phaseVolFrac );
+    }
+    else
+    {
+      isothermalCompositionalMultiphaseBaseKernels::
+        RelativePermeabilityUpdateKernel::
+        launch< parallelDevicePolicy<> >( dataGroup.size(),
+                                          relPermWrapper,
+                                          phaseVolFrac );
+    }
   } );
 }
 
-void CompositionalMultiphaseBase::updateCapPressureModel( ObjectManagerBase & dataGroup ) const
+void CompositionalMultiphaseBase::updateCapPressureModel( ObjectManagerBase & dataGroup,
+                                                          arrayView1d< localIndex const > const * const targetSet ) const
 {
   GEOS_MARK_FUNCTION;
 
@@ -724,11 +768,22 @@ void CompositionalMultiphaseBase::updateCapPressureModel( ObjectManagerBase & da
     {
       typename TYPEOFREF( castedCapPres ) ::KernelWrapper capPresWrapper = castedCapPres.createKernelWrapper();
 
-      isothermalCompositionalMultiphaseBaseKernels::
-        CapillaryPressureUpdateKernel::
-        launch< parallelDevicePolicy<> >( dataGroup.size(),
-                                          capPresWrapper,
-                                          phaseVolFrac );
+      if( targetSet != nullptr )
+      {
+        isothermalCompositionalMultiphaseBaseKernels::
+          CapillaryPressureUpdateKernel::
+          launch< parallelDevicePolicy<> >( *targetSet,
+                                            capPresWrapper,
+                                            phaseVolFrac );
+      }
+      else
+      {
+        isothermalCompositionalMultiphaseBaseKernels::
+          CapillaryPressureUpdateKernel::
+          launch< parallelDevicePolicy<> >( dataGroup.size(),
+                                            capPresWrapper,
+                                            phaseVolFrac );
+      }
     } );
   }
 }
@@ -802,23 +857,108 @@ void CompositionalMultiphaseBase::updateSolidInternalEnergyModel( ObjectManagerB
                                       temp );
 }
 
-real64 CompositionalMultiphaseBase::updateFluidState( ElementSubRegionBase & subRegion ) const
+void CompositionalMultiphaseBase::updateSaturationFunctions( ObjectManagerBase & dataGroup,
+                                                             arrayView1d< localIndex const > const * const targetSet ) const
+{
+  updateRelPermModel( dataGroup, targetSet );
+  updatePhaseMobility( dataGroup );
+  updateCapPressureModel( dataGroup, targetSet );
+}
+
+real64 CompositionalMultiphaseBase::updateFluidState( ElementSubRegionBase & subRegion,
+                                                      arrayView1d< localIndex const > const * const targetSet ) const
 {
   GEOS_MARK_FUNCTION;
 
   updateGlobalComponentFraction( subRegion );
-  updateFluidModel( subRegion );
+  updateFluidModel( subRegion, targetSet );
   updateCompAmount( subRegion );
   real64 const maxDeltaPhaseVolFrac = updatePhaseVolumeFraction( subRegion );
-  updateRelPermModel( subRegion );
-  updatePhaseMobility( subRegion );
-  updateCapPressureModel( subRegion );
+  updateSaturationFunctions( subRegion, targetSet );
+
+  // when all the elements are updated, save their primary variables for the next selection of changed elements
+  if( targetSet == nullptr && m_stateUpdateTolerance >= 0.0 )
+  {
+    subRegion.getField< fields::flow::stateUpdatePressure >().
+      setValues< parallelDevicePolicy<> >( subRegion.getField< fields::flow::pressure >().toViewConst() );
+    subRegion.getField< fields::flow::stateUpdateTemperature >().
+      setValues< parallelDevicePolicy<> >( subRegion.getField< fields::flow::temperature >().toViewConst() );
+    subRegion.getField< fields::flow::stateUpdateGlobalCompDensity >().
+      setValues< parallelDevicePolicy<> >( subRegion.getField< fields::flow::globalCompDensity >().toViewConst() );
+  }
 
   // note1: for now, thermal conductivity is treated explicitly, so no update here
   // note2: for now, diffusion and dispersion are also treated explicitly
   return maxDeltaPhaseVolFrac;
 }
 
+void CompositionalMultiphaseBase::selectChangedElements( ElementSubRegionBase & subRegion,
+                                                         array1d< localIndex > & changedElements ) const
+{
+  GEOS_MARK_FUNCTION;
+
+  arrayView1d< real64 const > const pres = subRegion.getField< fields::flow::pressure >();
+  arrayView1d< real64 const > const temp = subRegion.getField< fields::flow::temperature >();
+  arrayView2d< real64 const, compflow::USD_COMP > const compDens = subRegion.getField< fields::flow::globalCompDensity >();
+
+  arrayView1d< real64 > const updatePres = subRegion.getField< fields::flow::stateUpdatePressure >();
+  arrayView1d< real64 > const updateTemp = subRegion.getField< fields::flow::stateUpdateTemperature >();
+  arrayView2d< real64, compflow::USD_COMP > const updateCompDens = subRegion.getField< fields::flow::stateUpdateGlobalCompDensity >();
+
+  integer const numComp = m_numComponents;
+  real64 const tolerance = m_stateUpdateTolerance;
+
+  // 1) flag the elements whose primary variables moved away from the values of the last update,
+  //    and save the new values for these elements only, so that small changes cannot accumulate.
+  //    The flag of element ei is stored at position ei+1, to be turned into offsets by the scan below
+  localIndex const numElems = subRegion.size();
+  array1d< localIndex > offsets( numElems + 1 );
+  arrayView1d< localIndex > const offsetsView = offsets.toView();
+  RAJA::ReduceSum< parallelDeviceReduce, localIndex > numChanged( 0 );
+  forAll< parallelDevicePolicy<> >( numElems, [=] GEOS_HOST_DEVICE ( localIndex const ei )
+  {
+    bool changed = LvArray::math::abs( pres[ei] - updatePres[ei] ) > tolerance * LvArray::math::abs( pres[ei] )
+                   || LvArray::math::abs( temp[ei] - updateTemp[ei] ) > tolerance * LvArray::math::abs( temp[ei] );
+
+    // component densities are compared to the total density, as some of them can be zero
+    real64 totalDens = 0.0;
+    for( integer ic = 0; ic < numComp; ++ic )
+    {
+      totalDens += LvArray::math::abs( compDens[ei][ic] );
+    }
+    for( integer ic = 0; ic < numComp && !changed; ++ic )
+    {
+      changed = LvArray::math::abs( compDens[ei][ic] - updateCompDens[ei][ic] ) > tolerance * totalDens;
+    }
+
+    if( changed )
+    {
+      updatePres[ei] = pres[ei];
+      updateTemp[ei] = temp[ei];
+      for( integer ic = 0; ic < numComp; ++ic )
+      {
+        updateCompDens[ei][ic] = compDens[ei][ic];
+      }
+      numChanged += 1;
+    }
+    offsetsView[ei+1] = changed ? 1 : 0;
+  } );
+
+  // 2) compact the flags into the list of elements to update, keeping the elements in increasing order
+  offsets.move( parallelDeviceMemorySpace, true );
+  RAJA::inclusive_scan_inplace< parallelDevicePolicy<> >( RAJA::make_span( offsets.data(), offsets.size() ) );
+
+  changedElements.resize( numChanged.get() );
+  arrayView1d< localIndex > const changedElementsView = changedElements.toView();
+  forAll< parallelDevicePolicy<> >( numElems, [=] GEOS_HOST_DEVICE ( localIndex const ei )
+  {
+    if( offsetsView[ei+1] != offsetsView[ei] )
+    {
+      changedElementsView[offsetsView[ei]] = ei;
+    }
+  } );
+}
+
 void CompositionalMultiphaseBase::initializeFluidState( MeshLevel & mesh,
                                                         DomainPartition & domain,
                                                         arrayView1d< string const > const & regionNames )
@@ -2597,8 +2737,19 @@ void CompositionalMultiphaseBase::updateState( DomainPartition & domain )
     {
       // update porosity, permeability, and solid internal energy
       updatePorosityAndPermeability( subRegion );
-      // update all fluid properties
-      real64 const deltaPhaseVolFrac = updateFluidState( subRegion );
+      // update all fluid properties, only in the cells whose primary variables changed if requested
+      real64 deltaPhaseVolFrac = 0.0;
+      if( m_stateUpdateTolerance >= 0.0 )
+      {
+        array1d< localIndex > changedElements;
+        selectChangedElements( subRegion, changedElements );
+        arrayView1d< localIndex const > const changedElementsView = changedElements.toViewConst();
+        deltaPhaseVolFrac = updateFluidState( subRegion, &changedElementsView );
+      }
+      else
+      {
+        deltaPhaseVolFrac = updateFluidState( subRegion );
+      }
       maxDeltaPhaseVolFrac = LvArray::math::max( maxDeltaPhaseVolFrac, deltaPhaseVolFrac );
       // for thermal, update solid internal energy
       if( m_isThermal )
@@ -119,20 +119,26 @@ public:
   /**
    * @brief Update all relevant fluid models using current values of pressure and composition
    * @param dataGroup the group storing the required fields
+   * @param targetSet the elements to update (all the elements if null)
    */
-  void updateFluidModel( ObjectManagerBase & dataGroup ) const;
+  void updateFluidModel( ObjectManagerBase & dataGroup,
+                         arrayView1d< localIndex const > const * const targetSet = nullptr ) const;
 
   /**
    * @brief Update all relevant relperm models using current values of phase volume fraction
    * @param dataGroup the group storing the required fields
+   * @param targetSet the elements to update (all the elements if null)
    */
-  void updateRelPermModel( ObjectManagerBase & dataGroup ) const;
+  void updateRelPermModel( ObjectManagerBase & dataGroup,
+                           arrayView1d< localIndex const > const * const targetSet = nullptr ) const;
 
   /**
    * @brief Update all relevant capillary pressure models using current values of phase volume fraction
    * @param dataGroup the group storing the required fields
+   * @param targetSet the elements to update (all the elements if null)
    */
-  void updateCapPressureModel( ObjectManagerBase & dataGroup ) const;
+  void updateCapPressureModel( ObjectManagerBase & dataGroup,
+                               arrayView1d< localIndex const > const * const targetSet = nullptr ) const;
 
   /**
    * @brief Update components mass/moles
@@ -158,7 +164,40 @@ public:
    */
   virtual void updatePhaseMobility( ObjectManagerBase & dataGroup ) const = 0;
 
-  real64 updateFluidState( ElementSubRegionBase & subRegion ) const;
+  /**
+   * @brief Update the relperm, phase mobility, and capillary pressure using current values of phase volume fraction
+   * @param dataGroup the group storing the required fields
+   * @param targetSet the elements whose relperm and capillary pressure models are updated (all the elements if null)
+   *
+   * The phase mobility is recomputed on all the elements, after the relperm update and before the capillary pressure update.
+   */
+  virtual void updateSaturationFunctions( ObjectManagerBase & dataGroup,
+                                          arrayView1d< localIndex const > const * const targetSet ) const;
+
+  /**
+   * @brief Update the fluid state (fluid, relperm, capillary pressure models and derived quantities)
+   * @param subRegion the subregion storing the required fields
+   * @param targetSet the elements whose constitutive models are updated (all the elements if null)
+   * @return the maximum change in phase volume fraction
+   *
+   * The quantities derived from the constitutive models (phase volume fractions, mobilities) are recomputed
+   * on all the elements, the constitutive models are only updated on the elements of @p targetSet.
+   * The constitutive models saving converged states (e.g., hysteresis) rely on the full updates done
+   * at the beginning of each time step.
+   */
+  real64 updateFluidState( ElementSubRegionBase & subRegion,
+                           arrayView1d< localIndex const > const * const targetSet = nullptr ) const;
+
+  /**
+   * @brief Select the elements whose primary variables changed since their constitutive models were last updated
+   * @param subRegion the subregion storing the required fields
+   * @param[out] changedElements the elements whose relative change exceeds the state update tolerance, in increasing order
+   *
+   * The primary variables of the selected elements are saved, to be compared with at the next update.
+   * The selection is done on the device, the flags being compacted with a prefix sum.
+   */
+  void selectChangedElements( ElementSubRegionBase & subRegion,
+                              array1d< localIndex > & changedElements ) const;
 
   virtual void saveConvergedState( ElementSubRegionBase & subRegion ) const override final;
 
@@ -271,6 +310,7 @@ public:
     static constexpr char const * minCompDensString() { return "minCompDens"; }
     static constexpr char const * maxSequentialCompDensChangeString() { return "maxSequentialCompDensChange"; }
     static constexpr char const * minScalingFactorString() { return "minScalingFactor"; }
+    static constexpr char const * stateUpdateToleranceString() { return "stateUpdateTolerance"; }
 
   };
 
@@ -485,6 +525,9 @@ protected:
   /// minimum allowed global component density
   real64 m_minCompDens;
 
+  /// relative change in the primary variables of a cell below which its constitutive models are not updated (disabled if negative)
+  real64 m_stateUpdateTolerance;
+
   /// name of the fluid constitutive model used as a reference for component/phase description
   string m_referenceFluidModelName;
 
@@ -64,6 +64,30 @@ DECLARE_FIELD( globalCompDensity_k,
                NO_WRITE,
                "Global component density updates at the previous sequential iteration" );
 
+DECLARE_FIELD( stateUpdatePressure,
+               "stateUpdatePressure",
+               array1d< real64 >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Pressure at which the constitutive models were last updated" );
+
+DECLARE_FIELD( stateUpdateTemperature,
+               "stateUpdateTemperature",
+               array1d< real64 >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Temperature at which the constitutive models were last updated" );
+
+DECLARE_FIELD( stateUpdateGlobalCompDensity,
+               "stateUpdateGlobalCompDensity",
+               array2dLayoutComp,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Global component density at which the constitutive models were last updated" );
+
 DECLARE_FIELD( globalCompFraction,
                "globalCompFraction",
                array2dLayoutComp,
@@ -20,8 +20,11 @@
 #include "CompositionalMultiphaseFVM.hpp"
 
 #include "common/MpiWrapper.hpp"
+#include "constitutive/capillaryPressure/TableCapillaryPressure.hpp"
 #include "constitutive/fluid/multifluid/MultiFluidBase.hpp"
 #include "constitutive/relativePermeability/RelativePermeabilityBase.hpp"
+#include "constitutive/relativePermeability/TableRelativePermeability.hpp"
+#include "constitutive/relativePermeability/TableRelativePermeabilityHysteresis.hpp"
 #include "constitutive/solid/CoupledSolidBase.hpp"
 #include "dataRepository/Group.hpp"
 #include "discretizationMethods/NumericalMethodsManager.hpp"
@@ -87,6 +90,14 @@ CompositionalMultiphaseFVM::CompositionalMultiphaseFVM( const string & name,
     setApplyDefaultValue( ScalingType::Global ).
     setDescription( "Solution scaling type."
                     "Valid options:\n* " + EnumStrings< ScalingType >::concat( "\n* " ) );
+
+  registerWrapper( viewKeyStruct::fuseSaturationFunctionsString(), &m_fuseSaturationFunctions ).
+    setApplyDefaultValue( 1 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag to update the relative permeability, the phase mobility, and the capillary pressure in a single kernel "
+                    "sharing the search of the phase volume fractions in the tables. "
+                    "This is only used with a TableRelativePermeability or TableRelativePermeabilityHysteresis model and "
+                    "a TableCapillaryPressure model defined on the same phase volume fraction axes" );
 }
 
 void CompositionalMultiphaseFVM::postInputInitialization()
@@ -755,6 +766,148 @@ void CompositionalMultiphaseFVM::updatePhaseMobility( ObjectManagerBase & dataGr
   }
 }
 
+namespace
+{
+
+/**
+ * @brief Check that all the tables evaluated at the volume fraction of a phase are defined on the same axis, for all the phases
+ * @tparam RELPERM_WRAPPER the type of the table relperm kernel wrapper
+ * @param[in] numPhases the number of fluid phases
+ * @param[in] relPermWrapper the table relperm kernel wrapper
+ * @param[in] capPresWrapper the table capillary pressure kernel wrapper
+ * @return true if the positions of the phase volume fractions found on the relperm axes can be reused by all the tables
+ */
+template< typename RELPERM_WRAPPER >
+bool haveSamePhaseVolFractionAxes( integer const numPhases,
+                                   RELPERM_WRAPPER const & relPermWrapper,
+                                   TableCapillaryPressure::KernelWrapper const & capPresWrapper )
+{
+  for( integer ip = 0; ip < numPhases; ++ip )
+  {
+    std::vector< TableFunction::KernelWrapper const * > tables;
+    relPermWrapper.getPhaseVolFractionTables( ip, tables );
+    capPresWrapper.getPhaseVolFractionTables( ip, tables );
+    for( TableFunction::KernelWrapper const * const table : tables )
+    {
+      if( !tables[0]->hasSameAxis( *table ) )
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}
+
+void CompositionalMultiphaseFVM::updateSaturationFunctions( ObjectManagerBase & dataGroup,
+                                                            arrayView1d< localIndex const > const * const targetSet ) const
+{
+  GEOS_MARK_FUNCTION;
+
+  if( m_fuseSaturationFunctions == 0 || m_hasCapPressure == 0 )
+  {
+    CompositionalMultiphaseBase::updateSaturationFunctions( dataGroup, targetSet );
+    return;
+  }
+
+  string const & fluidName = dataGroup.getReference< string >( viewKeyStruct::fluidNamesString() );
+  MultiFluidBase const & fluid = getConstitutiveModel< MultiFluidBase >( dataGroup, fluidName );
+
+  string const & relPermName = dataGroup.getReference< string >( viewKeyStruct::relPermNamesString() );
+  RelativePermeabilityBase & relPerm = getConstitutiveModel< RelativePermeabilityBase >( dataGroup, relPermName );
+
+  string const & cappresName = dataGroup.getReference< string >( viewKeyStruct::capPressureNamesString() );
+  CapillaryPressureBase & capPressure = getConstitutiveModel< CapillaryPressureBase >( dataGroup, cappresName );
+
+  arrayView2d< real64 const, compflow::USD_PHASE > const phaseVolFrac =
+    dataGroup.getField< fields::flow::phaseVolumeFraction >();
+
+  // the fused kernel is only available for table models sharing the phase volume fraction axes,
+  // otherwise the relperm, phase mobility, and capillary pressure are updated by separate kernels
+  TableCapillaryPressure * const tableCapPressure = dynamicCast< TableCapillaryPressure * >( &capPressure );
+  auto const launchFusedKernel = [&] ( auto & castedRelPerm )
+  {
+    typename TYPEOFREF( castedRelPerm ) ::KernelWrapper relPermWrapper = castedRelPerm.createKernelWrapper();
+    TableCapillaryPressure::KernelWrapper capPresWrapper = tableCapPressure->createKernelWrapper();
+    if( !haveSamePhaseVolFractionAxes( m_numPhases, relPermWrapper, capPresWrapper ) )
+    {
+      return false;
+    }
+
+    auto const launch = [&] ( auto const & mobilityKernel )
+    {
+      if( targetSet != nullptr )
+      {
+        isothermalCompositionalMultiphaseFVMKernels::
+          SaturationFunctionsKernel::
+          launch< parallelDevicePolicy<> >( dataGroup.size(),
+                                            *targetSet,
+                                            mobilityKernel,
+                                            relPermWrapper,
+                                            capPresWrapper,
+                                            phaseVolFrac );
+      }
+      else
+      {
+        isothermalCompositionalMultiphaseFVMKernels::
+          SaturationFunctionsKernel::
+          launch< parallelDevicePolicy<> >( dataGroup.size(),
+                                            mobilityKernel,
+                                            relPermWrapper,
+                                            capPresWrapper,
+                                            phaseVolFrac );
+      }
+    };
+
+    isothermalCompositionalMultiphaseBaseKernels::internal::kernelLaunchSelectorCompSwitch( m_numComponents, [&] ( auto NC )
+    {
+      integer constexpr NUM_COMP = NC();
+      if( m_numPhases == 2 )
+      {
+        if( m_isThermal )
+        {
+          launch( thermalCompositionalMultiphaseFVMKernels::PhaseMobilityKernel< NUM_COMP, 2 >( dataGroup, fluid, relPerm ) );
+        }
+        else
+        {
+          launch( isothermalCompositionalMultiphaseFVMKernels::PhaseMobilityKernel< NUM_COMP, 2 >( dataGroup, fluid, relPerm ) );
+        }
+      }
+      else if( m_numPhases == 3 )
+      {
+        if( m_isThermal )
+        {
+          launch( thermalCompositionalMultiphaseFVMKernels::PhaseMobilityKernel< NUM_COMP, 3 >( dataGroup, fluid, relPerm ) );
+        }
+        else
+        {
+          launch( isothermalCompositionalMultiphaseFVMKernels::PhaseMobilityKernel< NUM_COMP, 3 >( dataGroup, fluid, relPerm ) );
+        }
+      }
+    } );
+    return true;
+  };
+
+  bool isFused = false;
+  if( tableCapPressure != nullptr )
+  {
+    if( TableRelativePermeability * const tableRelPerm = dynamicCast< TableRelativePermeability * >( &relPerm ) )
+    {
+      isFused = launchFusedKernel( *tableRelPerm );
+    }
+    else if( TableRelativePermeabilityHysteresis * const tableRelPermHyst = dynamicCast< TableRelativePermeabilityHysteresis * >( &relPerm ) )
+    {
+      isFused = launchFusedKernel( *tableRelPermHyst );
+    }
+  }
+
+  if( !isFused )
+  {
+    CompositionalMultiphaseBase::updateSaturationFunctions( dataGroup, targetSet );
+  }
+}
+
 void CompositionalMultiphaseFVM::applyBoundaryConditions( real64 time_n,
                                                           real64 dt,
                                                           DomainPartition & domain,
@@ -1095,7 +1248,8 @@ void CompositionalMultiphaseFVM::applyAquiferBC( real64 const time,
                                                                         multiFluidAccessors.get( fields::multifluid::phaseDensity{} ),
                                                                         multiFluidAccessors.get( fields::multifluid::dPhaseDensity{} ),
                                                                         multiFluidAccessors.get( fields::multifluid::phaseCompFraction{} ),
-                                                                        multiFluidAccessors.get( fields::multifluid::dPhaseCompFraction{} ),
+                                                                        { multiFluidAccessors.get( fields::multifluid::dPhaseCompFraction{} ),
+                                                                          multiFluidAccessors.get( fields::multifluid::dPhaseCompFraction_float{} ) },
                                                                         time,
                                                                         dt,
                                                                         localMatrix.toViewConstSizes(),
@@ -142,6 +142,10 @@ public:
   virtual void
   updatePhaseMobility( ObjectManagerBase & dataGroup ) const override;
 
+  virtual void
+  updateSaturationFunctions( ObjectManagerBase & dataGroup,
+                             arrayView1d< localIndex const > const * const targetSet ) const override;
+
   virtual void
   applyAquiferBC( real64 const time,
                   real64 const dt,
@@ -163,6 +167,9 @@ public:
 
     // nonlinear solver parameters
     static constexpr char const * scalingTypeString()               { return "scalingType"; }
+
+    // constitutive update parameters
+    static constexpr char const * fuseSaturationFunctionsString()   { return "fuseSaturationFunctions"; }
   };
 
   /**
@@ -202,6 +209,9 @@ protected:
   /// Solution scaling type
   ScalingType m_scalingType;
 
+  /// Flag to update the table relperm, phase mobility, and table capillary pressure in a single kernel
+  integer m_fuseSaturationFunctions;
+
 private:
 
   /**
@@ -402,7 +402,8 @@ void CompositionalMultiphaseHybridFVM::assembleFluxTerms( real64 const dt,
                                          multiFluidAccessors.get( fields::multifluid::phaseMassDensity{} ),
                                          multiFluidAccessors.get( fields::multifluid::dPhaseMassDensity{} ),
                                          multiFluidAccessors.get( fields::multifluid::phaseCompFraction{} ),
-                                         multiFluidAccessors.get( fields::multifluid::dPhaseCompFraction{} ),
+                                         { multiFluidAccessors.get( fields::multifluid::dPhaseCompFraction{} ),
+                                           multiFluidAccessors.get( fields::multifluid::dPhaseCompFraction_float{} ) },
                                          elemDofNumber.toNestedViewConst(),
                                          dofManager.rankOffset(),
                                          lengthTolerance,
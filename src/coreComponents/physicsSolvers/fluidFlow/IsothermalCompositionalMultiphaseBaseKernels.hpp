@@ -176,10 +176,27 @@ public:
   void compute( localIndex const ei,
                 FUNC && compFractionKernelOp = NoOpFunc{} ) const
   {
-    arraySlice1d< real64 const, compflow::USD_COMP - 1 > const compDens = m_compDens[ei];
     arraySlice1d< real64, compflow::USD_COMP - 1 > const compFrac = m_compFrac[ei];
     arraySlice2d< real64, compflow::USD_COMP_DC - 1 > const dCompFrac_dCompDens = m_dCompFrac_dCompDens[ei];
 
+    computeGlobalComponentFraction( m_compDens[ei], compFrac, dCompFrac_dCompDens );
+
+    compFractionKernelOp( compFrac, dCompFrac_dCompDens );
+  }
+
+  /**
+   * @brief Compute the global component fractions from the component densities
+   * @param[in] compDens the component densities
+   * @param[out] compFrac the global component fractions
+   * @param[out] dCompFrac_dCompDens the derivatives of the global component fractions wrt the component densities
+   */
+  GEOS_HOST_DEVICE
+  inline
+  static void
+  computeGlobalComponentFraction( arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & compDens,
+                                  arraySlice1d< real64, compflow::USD_COMP - 1 > const & compFrac,
+                                  arraySlice2d< real64, compflow::USD_COMP_DC - 1 > const & dCompFrac_dCompDens )
+  {
     real64 totalDensity = 0.0;
 
     for( integer ic = 0; ic < numComp; ++ic )
@@ -198,8 +215,6 @@ public:
       }
       dCompFrac_dCompDens[ic][ic] += totalDensityInv;
     }
-
-    compFractionKernelOp( compFrac, dCompFrac_dCompDens );
   }
 
 protected:
@@ -488,7 +503,7 @@ struct RelativePermeabilityUpdateKernel
 
   template< typename POLICY, typename RELPERM_WRAPPER >
   static void
-  launch( SortedArrayView< localIndex const > const & targetSet,
+  launch( arrayView1d< localIndex const > const & targetSet,
           RELPERM_WRAPPER const & relPermWrapper,
           arrayView2d< real64 const, compflow::USD_PHASE > const & phaseVolFrac )
   {
@@ -524,7 +539,7 @@ struct CapillaryPressureUpdateKernel
 
   template< typename POLICY, typename CAPPRES_WRAPPER >
   static void
-  launch( SortedArrayView< localIndex const > const & targetSet,
+  launch( arrayView1d< localIndex const > const & targetSet,
           CAPPRES_WRAPPER const & capPresWrapper,
           arrayView2d< real64 const, compflow::USD_PHASE > const & phaseVolFrac )
   {
@@ -712,7 +727,7 @@ public:
       arraySlice2d< real64 const, constitutive::multifluid::USD_PHASE_DC - 2 > dPhaseDens = m_dPhaseDens[ei][0];
 
       arraySlice2d< real64 const, constitutive::multifluid::USD_PHASE_COMP - 2 > phaseCompFrac = m_phaseCompFrac[ei][0];
-      arraySlice3d< real64 const, constitutive::multifluid::USD_PHASE_COMP_DC - 2 > dPhaseCompFrac = m_dPhaseCompFrac[ei][0];
+      constitutive::multifluid::PhaseCompDerivsSlice dPhaseCompFrac = m_dPhaseCompFrac[ei][0];
 
       // temporary work arrays
       real64 dPhaseAmount_dC[numComp]{};
@@ -919,7 +934,7 @@ protected:
 
   /// Views on the phase component fraction
   arrayView4d< real64 const, constitutive::multifluid::USD_PHASE_COMP > const m_phaseCompFrac;
-  arrayView5d< real64 const, constitutive::multifluid::USD_PHASE_COMP_DC > const m_dPhaseCompFrac;
+  constitutive::multifluid::PhaseCompDerivsView const m_dPhaseCompFrac;
 
   // View on component densities
   arrayView2d< real64 const, compflow::USD_COMP > m_compDens;
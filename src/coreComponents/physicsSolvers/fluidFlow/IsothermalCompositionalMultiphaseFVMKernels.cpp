@@ -54,7 +54,8 @@ FaceBasedAssemblyKernelBase::FaceBasedAssemblyKernelBase( integer const numPhase
   m_dCompFrac_dCompDens( compFlowAccessors.get( fields::flow::dGlobalCompFraction_dGlobalCompDensity {} ) ),
   m_dPhaseVolFrac( compFlowAccessors.get( fields::flow::dPhaseVolumeFraction {} ) ),
   m_phaseCompFrac( multiFluidAccessors.get( fields::multifluid::phaseCompFraction {} ) ),
-  m_dPhaseCompFrac( multiFluidAccessors.get( fields::multifluid::dPhaseCompFraction {} ) ),
+  m_dPhaseCompFrac( multiFluidAccessors.get( fields::multifluid::dPhaseCompFraction {} ),
+                    multiFluidAccessors.get( fields::multifluid::dPhaseCompFraction_float {} ) ),
   m_localMatrix( localMatrix ),
   m_localRhs( localRhs ),
   m_kernelFlags( kernelFlags )
@@ -475,7 +476,7 @@ AquiferBCKernel::
            arraySlice1d< real64 const, compflow::USD_PHASE - 1 > phaseVolFrac,
            arraySlice2d< real64 const, compflow::USD_PHASE_DC - 1 > dPhaseVolFrac,
            arraySlice2d< real64 const, multifluid::USD_PHASE_COMP - 2 > phaseCompFrac,
-           arraySlice3d< real64 const, multifluid::USD_PHASE_COMP_DC - 2 > dPhaseCompFrac,
+           multifluid::PhaseCompDerivsSlice dPhaseCompFrac,
            arraySlice2d< real64 const, compflow::USD_COMP_DC - 1 > dCompFrac_dCompDens,
            real64 const dt,
            real64 (& localFlux)[NC],
@@ -562,7 +563,7 @@ AquiferBCKernel::
           ElementViewConst< arrayView3d< real64 const, multifluid::USD_PHASE > > const & phaseDens,
           ElementViewConst< arrayView4d< real64 const, multifluid::USD_PHASE_DC > > const & dPhaseDens,
           ElementViewConst< arrayView4d< real64 const, multifluid::USD_PHASE_COMP > > const & phaseCompFrac,
-          ElementViewConst< arrayView5d< real64 const, multifluid::USD_PHASE_COMP_DC > > const & dPhaseCompFrac,
+          multifluid::PhaseCompDerivsAccessor< ElementViewConst > const & dPhaseCompFrac,
           real64 const timeAtBeginningOfStep,
           real64 const dt,
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
@@ -678,7 +679,7 @@ AquiferBCKernel::
                   ElementViewConst< arrayView3d< real64 const, multifluid::USD_PHASE > > const & phaseDens, \
                   ElementViewConst< arrayView4d< real64 const, multifluid::USD_PHASE_DC > > const & dPhaseDens, \
                   ElementViewConst< arrayView4d< real64 const, multifluid::USD_PHASE_COMP > > const & phaseCompFrac, \
-                  ElementViewConst< arrayView5d< real64 const, multifluid::USD_PHASE_COMP_DC > > const & dPhaseCompFrac, \
+                  multifluid::PhaseCompDerivsAccessor< ElementViewConst > const & dPhaseCompFrac, \
                   real64 const timeAtBeginningOfStep, \
                   real64 const dt, \
                   CRSMatrixView< real64, globalIndex const > const & localMatrix, \
@@ -49,6 +49,7 @@
 #include "physicsSolvers/fluidFlow/IsothermalCompositionalMultiphaseFVMKernelUtilities.hpp"
 #include "physicsSolvers/fluidFlow/StencilAccessors.hpp"
 #include "finiteVolume/FluxApproximationBase.hpp"
+#include "functions/TableFunction.hpp"
 
 namespace geos
 {
@@ -279,6 +280,110 @@ public:
 };
 
 
+/******************************** SaturationFunctionsKernel ********************************/
+
+/**
+ * @class SaturationFunctionsKernel
+ * @brief Define the interface for the kernel updating the relperm, the phase mobilities, and the capillary pressures
+ *        in a single pass over the elements
+ *
+ * The phase volume fractions are searched once per phase on the table axes of the relperm model, and the positions are
+ * reused by the relperm and capillary pressure tables (which must be defined on the same axes). In each element, the
+ * relperm, the phase mobilities, and the capillary pressures are updated in this order, as in the separate kernels.
+ */
+struct SaturationFunctionsKernel
+{
+  /**
+   * @brief Update the relperm, the phase mobilities, and the capillary pressures in an element
+   * @tparam MOBILITY_KERNEL the type of the phase mobility kernel
+   * @tparam RELPERM_WRAPPER the type of the relperm kernel wrapper
+   * @tparam CAPPRES_WRAPPER the type of the capillary pressure kernel wrapper
+   * @param[in] k the element index
+   * @param[in] mobilityKernel the phase mobility kernel
+   * @param[in] relPermWrapper the relperm kernel wrapper
+   * @param[in] capPresWrapper the capillary pressure kernel wrapper
+   * @param[in] phaseVolFrac the phase volume fractions in the element
+   */
+  template< typename MOBILITY_KERNEL, typename RELPERM_WRAPPER, typename CAPPRES_WRAPPER >
+  GEOS_HOST_DEVICE
+  static void
+  compute( localIndex const k,
+           MOBILITY_KERNEL const & mobilityKernel,
+           RELPERM_WRAPPER const & relPermWrapper,
+           CAPPRES_WRAPPER const & capPresWrapper,
+           arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseVolFrac )
+  {
+    TableFunction::AxisPosition phaseVolFracPositions[MOBILITY_KERNEL::numPhase]{};
+    relPermWrapper.locatePhaseVolFraction( phaseVolFrac, phaseVolFracPositions );
+
+    for( localIndex q = 0; q < relPermWrapper.numGauss(); ++q )
+    {
+      relPermWrapper.update( k, q, phaseVolFrac, phaseVolFracPositions );
+    }
+    mobilityKernel.compute( k );
+    for( localIndex q = 0; q < capPresWrapper.numGauss(); ++q )
+    {
+      capPresWrapper.update( k, q, phaseVolFrac, phaseVolFracPositions );
+    }
+  }
+
+  /**
+   * @brief Update all the elements
+   * @tparam POLICY the policy used in the RAJA kernel
+   * @param[in] size the number of elements
+   * @param[in] mobilityKernel the phase mobility kernel
+   * @param[in] relPermWrapper the relperm kernel wrapper
+   * @param[in] capPresWrapper the capillary pressure kernel wrapper
+   * @param[in] phaseVolFrac the phase volume fractions
+   */
+  template< typename POLICY, typename MOBILITY_KERNEL, typename RELPERM_WRAPPER, typename CAPPRES_WRAPPER >
+  static void
+  launch( localIndex const size,
+          MOBILITY_KERNEL const & mobilityKernel,
+          RELPERM_WRAPPER const & relPermWrapper,
+          CAPPRES_WRAPPER const & capPresWrapper,
+          arrayView2d< real64 const, compflow::USD_PHASE > const & phaseVolFrac )
+  {
+    forAll< POLICY >( size, [=] GEOS_HOST_DEVICE ( localIndex const k )
+    {
+      compute( k, mobilityKernel, relPermWrapper, capPresWrapper, phaseVolFrac[k] );
+    } );
+  }
+
+  /**
+   * @brief Update the relperm and the capillary pressures of the elements of a target set, and the phase mobilities of all the elements
+   * @tparam POLICY the policy used in the RAJA kernel
+   * @param[in] size the number of elements
+   * @param[in] targetSet the elements whose relperm and capillary pressures are updated, in increasing order
+   * @param[in] mobilityKernel the phase mobility kernel
+   * @param[in] relPermWrapper the relperm kernel wrapper
+   * @param[in] capPresWrapper the capillary pressure kernel wrapper
+   * @param[in] phaseVolFrac the phase volume fractions
+   */
+  template< typename POLICY, typename MOBILITY_KERNEL, typename RELPERM_WRAPPER, typename CAPPRES_WRAPPER >
+  static void
+  launch( localIndex const size,
+          arrayView1d< localIndex const > const & targetSet,
+          MOBILITY_KERNEL const & mobilityKernel,
+          RELPERM_WRAPPER const & relPermWrapper,
+          CAPPRES_WRAPPER const & capPresWrapper,
+          arrayView2d< real64 const, compflow::USD_PHASE > const & phaseVolFrac )
+  {
+    forAll< POLICY >( size, [=] GEOS_HOST_DEVICE ( localIndex const k )
+    {
+      if( LvArray::sortedArrayManipulation::contains( targetSet.data(), targetSet.size(), k ) )
+      {
+        compute( k, mobilityKernel, relPermWrapper, capPresWrapper, phaseVolFrac[k] );
+      }
+      else
+      {
+        mobilityKernel.compute( k );
+      }
+    } );
+  }
+};
+
+
 /******************************** FaceBasedAssemblyKernel ********************************/
 
 /**
@@ -316,7 +421,8 @@ public:
                               fields::multifluid::phaseMassDensity,
                               fields::multifluid::dPhaseMassDensity,
                               fields::multifluid::phaseCompFraction,
-                              fields::multifluid::dPhaseCompFraction >;
+                              fields::multifluid::dPhaseCompFraction,
+                              fields::multifluid::dPhaseCompFraction_float >;
 
   using CapPressureAccessors =
     StencilMaterialAccessors< constitutive::CapillaryPressureBase,
@@ -379,7 +485,7 @@ protected:
 
   /// Views on phase component fractions
   ElementViewConst< arrayView4d< real64 const, constitutive::multifluid::USD_PHASE_COMP > > const m_phaseCompFrac;
-  ElementViewConst< arrayView5d< real64 const, constitutive::multifluid::USD_PHASE_COMP_DC > > const m_dPhaseCompFrac;
+  constitutive::multifluid::PhaseCompDerivsAccessor< ElementViewConst > const m_dPhaseCompFrac;
 
   // Residual and jacobian
 
@@ -1952,7 +2058,7 @@ public:
         // slice some constitutive arrays to avoid too much indexing in component loop
         arraySlice1d< real64 const, constitutive::multifluid::USD_PHASE_COMP-3 > phaseCompFracSub =
           m_phaseCompFrac[er][esr][ei][0][ip];
-        arraySlice2d< real64 const, constitutive::multifluid::USD_PHASE_COMP_DC-3 > dPhaseCompFracSub =
+        constitutive::multifluid::PhaseCompDerivsPhaseSlice dPhaseCompFracSub =
           m_dPhaseCompFrac[er][esr][ei][0][ip];
 
         // compute component fluxes and derivatives using element composition
@@ -2323,7 +2429,8 @@ struct AquiferBCKernel
                               fields::multifluid::phaseDensity,
                               fields::multifluid::dPhaseDensity,
                               fields::multifluid::phaseCompFraction,
-                              fields::multifluid::dPhaseCompFraction >;
+                              fields::multifluid::dPhaseCompFraction,
+                              fields::multifluid::dPhaseCompFraction_float >;
 
   template< integer NC >
   GEOS_HOST_DEVICE
@@ -2341,7 +2448,7 @@ struct AquiferBCKernel
              arraySlice1d< real64 const, compflow::USD_PHASE - 1 > phaseVolFrac,
              arraySlice2d< real64 const, compflow::USD_PHASE_DC - 1 > dPhaseVolFrac,
              arraySlice2d< real64 const, constitutive::multifluid::USD_PHASE_COMP - 2 > phaseCompFrac,
-             arraySlice3d< real64 const, constitutive::multifluid::USD_PHASE_COMP_DC - 2 > dPhaseCompFrac,
+             constitutive::multifluid::PhaseCompDerivsSlice dPhaseCompFrac,
              arraySlice2d< real64 const, compflow::USD_COMP_DC - 1 > dCompFrac_dCompDens,
              real64 const dt,
              real64 ( &localFlux )[NC],
@@ -2369,7 +2476,7 @@ struct AquiferBCKernel
           ElementViewConst< arrayView3d< real64 const, constitutive::multifluid::USD_PHASE > > const & phaseDens,
           ElementViewConst< arrayView4d< real64 const, constitutive::multifluid::USD_PHASE_DC > > const & dPhaseDens,
           ElementViewConst< arrayView4d< real64 const, constitutive::multifluid::USD_PHASE_COMP > > const & phaseCompFrac,
-          ElementViewConst< arrayView5d< real64 const, constitutive::multifluid::USD_PHASE_COMP_DC > > const & dPhaseCompFrac,
+          constitutive::multifluid::PhaseCompDerivsAccessor< ElementViewConst > const & dPhaseCompFrac,
           real64 const timeAtBeginningOfStep,
           real64 const dt,
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
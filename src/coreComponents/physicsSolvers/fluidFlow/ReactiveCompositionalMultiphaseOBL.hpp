@@ -36,10 +36,12 @@ namespace geos
  * - Does not work with wells and aquifers (will require introduction of additional operator tables)
  * - Uses a single operator table for the whole reservoir (introduction of several tables will allow to support different fluid properties
  * in different reservoir regions)
- * - Since only static MultivariableTableFunction is currently implemented, all operator values have to be stored, which limits OBL
+ * - With a static MultivariableTableFunction (read from OBLOperatorsTableFile), all operator values have to be stored, which limits OBL
  * discretization:
- *    only 3-5 components with 32-64 points is now viable. Adative MultivariableTableFunction with sparse storage will allow for much more
- * refined OBL parametrizations
+ *    only 3-5 components with 32-64 points is viable. An adaptive MultivariableTableFunction (with an operator evaluator) registered
+ * in the FunctionManager as "OBL_operators_table" only stores the visited hypercubes, allowing for much more refined OBL parametrizations.
+ * Since this solver does not use fluid models, GEOS does not provide an operator evaluator: the adaptive table and its evaluator
+ * must be registered before the solver is initialized, otherwise the static table is read from OBLOperatorsTableFile
  * - Does not use any fluid model, and solid models are only needed to get initial porosity
  */
 //START_SPHINX_INCLUDE_00
@@ -195,11 +195,47 @@ public:
   inline
   void compute( localIndex const ei ) const
   {
-    arraySlice1d< real64 const, compflow::USD_COMP - 1 > const compFrac = m_compFrac[ei];
     arraySlice1d< real64, compflow::USD_OBL_VAL - 1 > const & OBLVals = m_OBLOperatorValues[ei];
     arraySlice2d< real64, compflow::USD_OBL_DER - 1 > const & OBLDers = m_OBLOperatorDerivatives[ei];
     real64 state[numDofs];
 
+    computeState( ei, state );
+
+    m_OBLOperatorsTable.compute( state, OBLVals, OBLDers );
+
+    // we do not perform derivatives unit conversion here:
+    // instead we postpone it till all the derivatives are fully formed, and only then apply the factor only once in 'complete' function
+    // scaling the whole system might be even better solution (every pressure column needs to be multiplied by pascalToBarMult)
+  }
+
+  /**
+   * @brief Get the index of the table hypercube the state of an element is interpolated in
+   * @param[in] ei the element index
+   * @return the hypercube index
+   */
+  GEOS_HOST_DEVICE
+  inline
+  globalIndex hypercubeIndex( localIndex const ei ) const
+  {
+    real64 state[numDofs];
+    computeState( ei, state );
+    return m_OBLOperatorsTable.getHypercubeIndex( state );
+  }
+
+private:
+
+  /**
+   * @brief Compute the OBL state (table coordinates) of an element
+   * @param[in] ei the element index
+   * @param[out] state the state
+   */
+  GEOS_HOST_DEVICE
+  inline
+  void computeState( localIndex const ei,
+                     real64 ( & state )[numDofs] ) const
+  {
+    arraySlice1d< real64 const, compflow::USD_COMP - 1 > const compFrac = m_compFrac[ei];
+
     // we need to convert pressure from Pa (internal unit in GEOSX) to bar (internal unit in DARTS)
     state[0] = m_pressure[ei] * pascalToBarMult;
 
@@ -213,16 +249,8 @@ public:
     {
       state[numDofs - 1] = m_temperature[ei];
     }
-
-    m_OBLOperatorsTable.compute( state, OBLVals, OBLDers );
-
-    // we do not perform derivatives unit conversion here:
-    // instead we postpone it till all the derivatives are fully formed, and only then apply the factor only once in 'complete' function
-    // scaling the whole system might be even better solution (every pressure column needs to be multiplied by pascalToBarMult)
   }
 
-private:
-
   // inputs
   MultivariableTableFunctionStaticKernel< numDofs, numOps > m_OBLOperatorsTable;
 
@@ -270,17 +298,23 @@ public:
       integer constexpr NUM_DIMS = ENABLE_ENERGY + NUM_COMPS;
       integer constexpr NUM_OPS  = COMPUTE_NUM_OPS( NUM_PHASES, NUM_COMPS, ENABLE_ENERGY );
 
-      OBLOperatorsKernel< NUM_PHASES, NUM_COMPS, ENABLE_ENERGY >
-      kernel( subRegion,
-              MultivariableTableFunctionStaticKernel< NUM_DIMS, NUM_OPS >( function.getAxisMinimums(),
-                                                                           function.getAxisMaximums(),
-                                                                           function.getAxisPoints(),
-                                                                           function.getAxisSteps(),
-                                                                           function.getAxisStepInvs(),
-                                                                           function.getAxisHypercubeMults(),
-                                                                           function.getHypercubeData()
-                                                                           ) );
-      OBLOperatorsKernel< NUM_PHASES, NUM_COMPS, ENABLE_ENERGY >::template launch< POLICY >( subRegion.size(), kernel );
+      using KernelType = OBLOperatorsKernel< NUM_PHASES, NUM_COMPS, ENABLE_ENERGY >;
+
+      if( function.isAdaptive() )
+      {
+        // generate the table data in the hypercubes visited by the current states before interpolating in them
+        array1d< globalIndex > hypercubeIndices( subRegion.size() );
+        arrayView1d< globalIndex > const hypercubeIndicesView = hypercubeIndices.toView();
+        KernelType const indexKernel( subRegion, function.createKernelWrapper< NUM_DIMS, NUM_OPS >() );
+        forAll< parallelHostPolicy >( subRegion.size(), [=] ( localIndex const ei )
+        {
+          hypercubeIndicesView[ei] = indexKernel.hypercubeIndex( ei );
+        } );
+        function.generateHypercubes( hypercubeIndices.toViewConst() );
+      }
+
+      KernelType kernel( subRegion, function.createKernelWrapper< NUM_DIMS, NUM_OPS >() );
+      KernelType::template launch< POLICY >( subRegion.size(), kernel );
     } );
   }
 
@@ -32,7 +32,7 @@
 #include "finiteVolume/mimeticInnerProducts/QuasiRTInnerProduct.hpp"
 #include "finiteVolume/mimeticInnerProducts/SimpleInnerProduct.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
-#include "denseLinearAlgebra/interfaces/blaslapack/BlasLapackLA.hpp"
+#include "denseLinearAlgebra/denseLASolvers.hpp"
 #include "mesh/MeshLevel.hpp"
 #include "physicsSolvers/fluidFlow/FlowSolverBaseFields.hpp"
 #include "physicsSolvers/fluidFlow/HybridFVMHelperKernels.hpp"
@@ -123,6 +123,7 @@ public:
   };
 
 
+  GEOS_HOST_DEVICE
   inline
   void compute( localIndex const elemIndex,
                 StackVariables stack ) const
@@ -152,7 +153,9 @@ public:
       stack.coordinates( fi+1, 3 ) = 1.0;
     }
 
-    BlasLapackLA::matrixLeastSquaresSolutionSolve( stack.coordinates, stack.pressures, stack.presGradientLocal );
+    bool const solved =
+      denseLinearAlgebra::solveLeastSquares< NUM_FACES + 1, 4 >( stack.coordinates, stack.pressures, stack.presGradientLocal );
+    GEOS_ERROR_IF( !solved, "Average pressure gradient: the element and face centers do not span a 3D affine space." );
 
     for( integer dim=0; dim<3; ++dim )
     {
@@ -167,7 +170,7 @@ public:
   {
     GEOS_MARK_FUNCTION;
 
-    forAll< POLICY >( numElems, [=] ( localIndex const ei )
+    forAll< POLICY >( numElems, [=] GEOS_HOST_DEVICE ( localIndex const ei )
     {
       typename KERNEL_TYPE::StackVariables stack;
       kernelComponent.compute( ei, stack );
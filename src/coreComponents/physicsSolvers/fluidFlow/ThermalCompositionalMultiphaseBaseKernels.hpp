@@ -289,7 +289,7 @@ public:
       arraySlice1d< real64 const, constitutive::multifluid::USD_PHASE - 2 > phaseDens = m_phaseDens[ei][0];
       arraySlice2d< real64 const, constitutive::multifluid::USD_PHASE_DC - 2 > dPhaseDens = m_dPhaseDens[ei][0];
       arraySlice2d< real64 const, constitutive::multifluid::USD_PHASE_COMP - 2 > phaseCompFrac = m_phaseCompFrac[ei][0];
-      arraySlice3d< real64 const, constitutive::multifluid::USD_PHASE_COMP_DC - 2 > dPhaseCompFrac = m_dPhaseCompFrac[ei][0];
+      constitutive::multifluid::PhaseCompDerivsSlice dPhaseCompFrac = m_dPhaseCompFrac[ei][0];
       arraySlice1d< real64 const, constitutive::multifluid::USD_PHASE - 2 > phaseInternalEnergy = m_phaseInternalEnergy[ei][0];
       arraySlice2d< real64 const, constitutive::multifluid::USD_PHASE_DC - 2 > dPhaseInternalEnergy = m_dPhaseInternalEnergy[ei][0];
 
@@ -458,12 +458,10 @@ struct FluidUpdateKernel
           arrayView1d< real64 const > const & temp,
           arrayView2d< real64 const, compflow::USD_COMP > const & compFrac )
   {
-    forAll< POLICY >( size, [=] GEOS_HOST_DEVICE ( localIndex const k )
+    // the number of components is dispatched once here, rather than in each cell
+    constitutive::fluidComponentCountSwitch( fluidWrapper, [&] ( auto NC )
     {
-      for( localIndex q = 0; q < fluidWrapper.numGauss(); ++q )
-      {
-        fluidWrapper.update( k, q, pres[k], temp[k], compFrac[k] );
-      }
+      launchOnAll< POLICY, NC() >( size, fluidWrapper, pres, temp, compFrac );
     } );
   }
 
@@ -474,13 +472,60 @@ struct FluidUpdateKernel
           arrayView1d< real64 const > const & pres,
           arrayView1d< real64 const > const & temp,
           arrayView2d< real64 const, compflow::USD_COMP > const & compFrac )
+  {
+    constitutive::fluidComponentCountSwitch( fluidWrapper, [&] ( auto NC )
+    {
+      launchOnSet< POLICY, NC() >( targetSet, fluidWrapper, pres, temp, compFrac );
+    } );
+  }
+
+  template< typename POLICY, typename FLUID_WRAPPER >
+  static void
+  launch( arrayView1d< localIndex const > const & targetSet,
+          FLUID_WRAPPER const & fluidWrapper,
+          arrayView1d< real64 const > const & pres,
+          arrayView1d< real64 const > const & temp,
+          arrayView2d< real64 const, compflow::USD_COMP > const & compFrac )
+  {
+    constitutive::fluidComponentCountSwitch( fluidWrapper, [&] ( auto NC )
+    {
+      launchOnSet< POLICY, NC() >( targetSet, fluidWrapper, pres, temp, compFrac );
+    } );
+  }
+
+private:
+
+  template< typename POLICY, integer NC, typename FLUID_WRAPPER >
+  static void
+  launchOnAll( localIndex const size,
+               FLUID_WRAPPER const & fluidWrapper,
+               arrayView1d< real64 const > const & pres,
+               arrayView1d< real64 const > const & temp,
+               arrayView2d< real64 const, compflow::USD_COMP > const & compFrac )
+  {
+    forAll< POLICY >( size, [=] GEOS_HOST_DEVICE ( localIndex const k )
+    {
+      for( localIndex q = 0; q < fluidWrapper.numGauss(); ++q )
+      {
+        constitutive::updateFluid< NC >( fluidWrapper, k, q, pres[k], temp[k], compFrac[k] );
+      }
+    } );
+  }
+
+  template< typename POLICY, integer NC, typename FLUID_WRAPPER, typename TARGET_SET >
+  static void
+  launchOnSet( TARGET_SET const & targetSet,
+               FLUID_WRAPPER const & fluidWrapper,
+               arrayView1d< real64 const > const & pres,
+               arrayView1d< real64 const > const & temp,
+               arrayView2d< real64 const, compflow::USD_COMP > const & compFrac )
   {
     forAll< POLICY >( targetSet.size(), [=] GEOS_HOST_DEVICE ( localIndex const a )
     {
       localIndex const k = targetSet[a];
       for( localIndex q = 0; q < fluidWrapper.numGauss(); ++q )
       {
-        fluidWrapper.update( k, q, pres[k], temp[k], compFrac[k] );
+        constitutive::updateFluid< NC >( fluidWrapper, k, q, pres[k], temp[k], compFrac[k] );
       }
     } );
   }
@@ -416,7 +416,7 @@ public:
       // slice some constitutive arrays to avoid too much indexing in component loop
       arraySlice1d< real64 const, constitutive::multifluid::USD_PHASE_COMP - 3 > phaseCompFracSub =
         m_phaseCompFrac[er_up][esr_up][ei_up][0][ip];
-      arraySlice2d< real64 const, constitutive::multifluid::USD_PHASE_COMP_DC - 3 > dPhaseCompFracSub =
+      constitutive::multifluid::PhaseCompDerivsPhaseSlice dPhaseCompFracSub =
         m_dPhaseCompFrac[er_up][esr_up][ei_up][0][ip];
 
       for( integer ic = 0; ic < numComp; ++ic )
@@ -1211,7 +1211,7 @@ public:
         // slice some constitutive arrays to avoid too much indexing in component loop
         arraySlice1d< real64 const, constitutive::multifluid::USD_PHASE_COMP - 3 > phaseCompFracSub =
           m_phaseCompFrac[er][esr][ei][0][ip];
-        arraySlice2d< real64 const, constitutive::multifluid::USD_PHASE_COMP_DC - 3 > dPhaseCompFracSub =
+        constitutive::multifluid::PhaseCompDerivsPhaseSlice dPhaseCompFracSub =
           m_dPhaseCompFrac[er][esr][ei][0][ip];
 
         for( integer ic = 0; ic < numComp; ++ic )
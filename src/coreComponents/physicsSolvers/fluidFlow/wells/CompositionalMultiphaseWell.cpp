@@ -901,6 +901,64 @@ void CompositionalMultiphaseWell::updateSubRegionState( WellElementSubRegion & s
   // note: the perforation rates are updated separately
 }
 
+void CompositionalMultiphaseWell::updateState( DomainPartition & domain )
+{
+  GEOS_MARK_FUNCTION;
+
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                MeshLevel & mesh,
+                                                                arrayView1d< string const > const & regionNames )
+  {
+    ElementRegionManager & elemManager = mesh.getElemManager();
+
+    // update the global component fractions of all the wells in one launch
+    isothermalCompositionalMultiphaseBaseKernels::
+      KernelLaunchSelector1< BatchedGlobalComponentFractionKernel >( numFluidComponents(),
+                                                                     m_batchWellElemRegion.toViewConst(),
+                                                                     m_batchWellElemSubRegion.toViewConst(),
+                                                                     m_batchWellElemIndex.toViewConst(),
+                                                                     m_batchWellElemCompDens.toNestedViewConst(),
+                                                                     m_batchWellElemCompFrac.toNestedView(),
+                                                                     m_batchDWellElemCompFrac_dCompDens.toNestedView() );
+
+    // the fluid update depends on the fluid model of each well, and the volumetric rates on its controls
+    elemManager.forElementSubRegions< WellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                WellElementSubRegion & subRegion )
+    {
+      // note: this must be called before updateFluidModel
+      updateVolRatesForConstraint( subRegion );
+
+      updateFluidModel( subRegion );
+      updatePhaseVolumeFraction( subRegion );
+    } );
+
+    // update the total mass densities of all the wells in one launch
+    isothermalCompositionalMultiphaseBaseKernels::
+      KernelLaunchSelector2< BatchedTotalMassDensityKernel >( numFluidComponents(),
+                                                              numFluidPhases(),
+                                                              m_batchWellElemRegion.toViewConst(),
+                                                              m_batchWellElemSubRegion.toViewConst(),
+                                                              m_batchWellElemIndex.toViewConst(),
+                                                              m_batchWellElemPhaseVolFrac.toNestedViewConst(),
+                                                              m_batchDWellElemPhaseVolFrac.toNestedViewConst(),
+                                                              m_batchDWellElemCompFrac_dCompDens.toNestedViewConst(),
+                                                              m_batchWellElemPhaseMassDens.toNestedViewConst(),
+                                                              m_batchDWellElemPhaseMassDens.toNestedViewConst(),
+                                                              m_batchWellElemTotalMassDens.toNestedView(),
+                                                              m_batchDWellElemTotalMassDens_dPres.toNestedView(),
+                                                              m_batchDWellElemTotalMassDens_dCompDens.toNestedView() );
+
+    // update the current BHP pressure
+    elemManager.forElementSubRegions< WellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                WellElementSubRegion & subRegion )
+    {
+      updateBHPForConstraint( subRegion );
+    } );
+  } );
+
+  // note: the perforation rates are updated separately
+}
+
 void CompositionalMultiphaseWell::initializeWells( DomainPartition & domain )
 {
   GEOS_MARK_FUNCTION;
@@ -1113,7 +1171,7 @@ void CompositionalMultiphaseWell::assembleAccumulationTerms( DomainPartition con
       arrayView3d< real64 const, multifluid::USD_PHASE > const & wellElemPhaseDens = fluid.phaseDensity();
       arrayView4d< real64 const, multifluid::USD_PHASE_DC > const & dWellElemPhaseDens = fluid.dPhaseDensity();
       arrayView4d< real64 const, multifluid::USD_PHASE_COMP > const & wellElemPhaseCompFrac = fluid.phaseCompFraction();
-      arrayView5d< real64 const, multifluid::USD_PHASE_COMP_DC > const & dWellElemPhaseCompFrac = fluid.dPhaseCompFraction();
+      multifluid::PhaseCompDerivsView const & dWellElemPhaseCompFrac = fluid.dPhaseCompFraction();
       arrayView3d< real64 const, multifluid::USD_PHASE > const & wellElemPhaseDens_n = fluid.phaseDensity_n();
       arrayView4d< real64 const, multifluid::USD_PHASE_COMP > const & wellElemPhaseCompFrac_n = fluid.phaseCompFraction_n();
 
@@ -1353,7 +1411,7 @@ void CompositionalMultiphaseWell::computePerforationRates( DomainPartition & dom
 
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
                                                                 MeshLevel & mesh,
-                                                                arrayView1d< string const > const & regionNames )
+                                                                arrayView1d< string const > const & )
   {
 
     // TODO: change the way we access the flowSolver here
@@ -1362,97 +1420,108 @@ void CompositionalMultiphaseWell::computePerforationRates( DomainPartition & dom
     PerforationKernel::MultiFluidAccessors resMultiFluidAccessors( mesh.getElemManager(), flowSolver.getName() );
     PerforationKernel::RelPermAccessors resRelPermAccessors( mesh.getElemManager(), flowSolver.getName() );
 
-    mesh.getElemManager().forElementSubRegions< WellElementSubRegion >( regionNames, [&]( localIndex const,
-                                                                                          WellElementSubRegion & subRegion )
-    {
-
-      WellControls const & wellControls = getWellControls( subRegion );
-      bool const disableReservoirToWellFlow = wellControls.isInjector() and !wellControls.isCrossflowEnabled();
-
-      PerforationData * const perforationData = subRegion.getPerforationData();
-
-      // get depth
-      arrayView1d< real64 const > const & wellElemGravCoef = subRegion.getField< fields::well::gravityCoefficient >();
-
-      // get well primary variables on well elements
-      arrayView1d< real64 const > const & wellElemPres =
-        subRegion.getField< fields::well::pressure >();
-      arrayView2d< real64 const, compflow::USD_COMP > const & wellElemCompDens =
-        subRegion.getField< fields::well::globalCompDensity >();
-
-      arrayView1d< real64 const > const & wellElemTotalMassDens =
-        subRegion.getField< fields::well::totalMassDensity >();
-      arrayView1d< real64 const > const & dWellElemTotalMassDens_dPres =
-        subRegion.getField< fields::well::dTotalMassDensity_dPressure >();
-      arrayView2d< real64 const, compflow::USD_FLUID_DC > const & dWellElemTotalMassDens_dCompDens =
-        subRegion.getField< fields::well::dTotalMassDensity_dGlobalCompDensity >();
-
-      arrayView2d< real64 const, compflow::USD_COMP > const & wellElemCompFrac =
-        subRegion.getField< fields::well::globalCompFraction >();
-      arrayView3d< real64 const, compflow::USD_COMP_DC > const & dWellElemCompFrac_dCompDens =
-        subRegion.getField< fields::well::dGlobalCompFraction_dGlobalCompDensity >();
-
-      // get well variables on perforations
-      arrayView1d< real64 const > const & perfGravCoef =
-        perforationData->getField< fields::well::gravityCoefficient >();
-      arrayView1d< localIndex const > const perfWellElemIndex =
-        perforationData->getField< fields::perforation::wellElementIndex >();
-      arrayView1d< real64 const > const perfTrans =
-        perforationData->getField< fields::perforation::wellTransmissibility >();
-
-      arrayView2d< real64 > const & compPerfRate =
-        perforationData->getField< fields::well::compPerforationRate >();
-      arrayView3d< real64 > const & dCompPerfRate_dPres =
-        perforationData->getField< fields::well::dCompPerforationRate_dPres >();
-      arrayView4d< real64 > const & dCompPerfRate_dComp =
-        perforationData->getField< fields::well::dCompPerforationRate_dComp >();
-
-      // get the element region, subregion, index
-      arrayView1d< localIndex const > const resElementRegion =
-        perforationData->getField< fields::perforation::reservoirElementRegion >();
-      arrayView1d< localIndex const > const resElementSubRegion =
-        perforationData->getField< fields::perforation::reservoirElementSubRegion >();
-      arrayView1d< localIndex const > const resElementIndex =
-        perforationData->getField< fields::perforation::reservoirElementIndex >();
+    // compute the rates of the perforations of all the wells in one launch
+    isothermalCompositionalMultiphaseBaseKernels::
+      KernelLaunchSelector2< PerforationKernel >( numFluidComponents(),
+                                                  numFluidPhases(),
+                                                  m_batchPerfWellRegion.toViewConst(),
+                                                  m_batchPerfWellSubRegion.toViewConst(),
+                                                  m_batchPerfIndex.toViewConst(),
+                                                  m_batchPerfDisableReservoirToWellFlow.toViewConst(),
+                                                  resCompFlowAccessors.get( fields::flow::pressure{} ),
+                                                  resCompFlowAccessors.get( fields::flow::phaseVolumeFraction{} ),
+                                                  resCompFlowAccessors.get( fields::flow::dPhaseVolumeFraction{} ),
+                                                  resCompFlowAccessors.get( fields::flow::dGlobalCompFraction_dGlobalCompDensity{} ),
+                                                  resMultiFluidAccessors.get( fields::multifluid::phaseDensity{} ),
+                                                  resMultiFluidAccessors.get( fields::multifluid::dPhaseDensity{} ),
+                                                  resMultiFluidAccessors.get( fields::multifluid::phaseViscosity{} ),
+                                                  resMultiFluidAccessors.get( fields::multifluid::dPhaseViscosity{} ),
+                                                  resMultiFluidAccessors.get( fields::multifluid::phaseCompFraction{} ),
+                                                  { resMultiFluidAccessors.get( fields::multifluid::dPhaseCompFraction{} ),
+                                                    resMultiFluidAccessors.get( fields::multifluid::dPhaseCompFraction_float{} ) },
+                                                  resRelPermAccessors.get( fields::relperm::phaseRelPerm{} ),
+                                                  resRelPermAccessors.get( fields::relperm::dPhaseRelPerm_dPhaseVolFraction{} ),
+                                                  m_batchWellElemGravCoef.toNestedViewConst(),
+                                                  m_batchWellElemPres.toNestedViewConst(),
+                                                  m_batchWellElemCompDens.toNestedViewConst(),
+                                                  m_batchWellElemTotalMassDens.toNestedViewConst(),
+                                                  m_batchDWellElemTotalMassDens_dPres.toNestedViewConst(),
+                                                  m_batchDWellElemTotalMassDens_dCompDens.toNestedViewConst(),
+                                                  m_batchWellElemCompFrac.toNestedViewConst(),
+                                                  m_batchDWellElemCompFrac_dCompDens.toNestedViewConst(),
+                                                  m_batchPerfGravCoef.toNestedViewConst(),
+                                                  m_batchPerfWellElemIndex.toNestedViewConst(),
+                                                  m_batchPerfTransmissibility.toNestedViewConst(),
+                                                  m_batchPerfResElementRegion.toNestedViewConst(),
+                                                  m_batchPerfResElementSubRegion.toNestedViewConst(),
+                                                  m_batchPerfResElementIndex.toNestedViewConst(),
+                                                  m_batchCompPerfRate.toNestedView(),
+                                                  m_batchDCompPerfRate_dPres.toNestedView(),
+                                                  m_batchDCompPerfRate_dComp.toNestedView() );
+  } );
+}
 
-      isothermalCompositionalMultiphaseBaseKernels::
-        KernelLaunchSelector2< PerforationKernel >( numFluidComponents(),
-                                                    numFluidPhases(),
-                                                    perforationData->size(),
-                                                    disableReservoirToWellFlow,
-                                                    resCompFlowAccessors.get( fields::flow::pressure{} ),
-                                                    resCompFlowAccessors.get( fields::flow::phaseVolumeFraction{} ),
-                                                    resCompFlowAccessors.get( fields::flow::dPhaseVolumeFraction{} ),
-                                                    resCompFlowAccessors.get( fields::flow::dGlobalCompFraction_dGlobalCompDensity{} ),
-                                                    resMultiFluidAccessors.get( fields::multifluid::phaseDensity{} ),
-                                                    resMultiFluidAccessors.get( fields::multifluid::dPhaseDensity{} ),
-                                                    resMultiFluidAccessors.get( fields::multifluid::phaseViscosity{} ),
-                                                    resMultiFluidAccessors.get( fields::multifluid::dPhaseViscosity{} ),
-                                                    resMultiFluidAccessors.get( fields::multifluid::phaseCompFraction{} ),
-                                                    resMultiFluidAccessors.get( fields::multifluid::dPhaseCompFraction{} ),
-                                                    resRelPermAccessors.get( fields::relperm::phaseRelPerm{} ),
-                                                    resRelPermAccessors.get( fields::relperm::dPhaseRelPerm_dPhaseVolFraction{} ),
-                                                    wellElemGravCoef,
-                                                    wellElemPres,
-                                                    wellElemCompDens,
-                                                    wellElemTotalMassDens,
-                                                    dWellElemTotalMassDens_dPres,
-                                                    dWellElemTotalMassDens_dCompDens,
-                                                    wellElemCompFrac,
-                                                    dWellElemCompFrac_dCompDens,
-                                                    perfGravCoef,
-                                                    perfWellElemIndex,
-                                                    perfTrans,
-                                                    resElementRegion,
-                                                    resElementSubRegion,
-                                                    resElementIndex,
-                                                    compPerfRate,
-                                                    dCompPerfRate_dPres,
-                                                    dCompPerfRate_dComp );
+void CompositionalMultiphaseWell::precomputeBatchedAccessors( ElementRegionManager & elemManager,
+                                                              arrayView1d< string const > const & regionNames )
+{
+  m_batchCompPerfRate =
+    constructPerforationFieldAccessor< fields::well::compPerforationRate >( elemManager, regionNames );
+  m_batchDCompPerfRate_dPres =
+    constructPerforationFieldAccessor< fields::well::dCompPerforationRate_dPres >( elemManager, regionNames );
+  m_batchDCompPerfRate_dComp =
+    constructPerforationFieldAccessor< fields::well::dCompPerforationRate_dComp >( elemManager, regionNames );
+
+  m_batchWellElemGravCoef =
+    constructWellElementFieldAccessor< fields::well::gravityCoefficient >( elemManager, regionNames );
+  m_batchWellElemPres =
+    constructWellElementFieldAccessor< fields::well::pressure >( elemManager, regionNames );
+  m_batchWellElemCompDens =
+    constructWellElementFieldAccessor< fields::well::globalCompDensity >( elemManager, regionNames );
+  m_batchWellElemCompFrac =
+    constructWellElementFieldAccessor< fields::well::globalCompFraction >( elemManager, regionNames );
+  m_batchDWellElemCompFrac_dCompDens =
+    constructWellElementFieldAccessor< fields::well::dGlobalCompFraction_dGlobalCompDensity >( elemManager, regionNames );
+  m_batchWellElemPhaseVolFrac =
+    constructWellElementFieldAccessor< fields::well::phaseVolumeFraction >( elemManager, regionNames );
+  m_batchDWellElemPhaseVolFrac =
+    constructWellElementFieldAccessor< fields::well::dPhaseVolumeFraction >( elemManager, regionNames );
+  m_batchWellElemTotalMassDens =
+    constructWellElementFieldAccessor< fields::well::totalMassDensity >( elemManager, regionNames );
+  m_batchDWellElemTotalMassDens_dPres =
+    constructWellElementFieldAccessor< fields::well::dTotalMassDensity_dPressure >( elemManager, regionNames );
+  m_batchDWellElemTotalMassDens_dCompDens =
+    constructWellElementFieldAccessor< fields::well::dTotalMassDensity_dGlobalCompDensity >( elemManager, regionNames );
+
+  // the well fluid is a constitutive model of the well subregions, its views are gathered here
+  m_batchWellElemPhaseMassDens.resize( elemManager.numRegions() );
+  m_batchDWellElemPhaseMassDens.resize( elemManager.numRegions() );
+  for( localIndex er = 0; er < elemManager.numRegions(); ++er )
+  {
+    m_batchWellElemPhaseMassDens[er].resize( elemManager.getRegion( er ).numSubRegions() );
+    m_batchDWellElemPhaseMassDens[er].resize( elemManager.getRegion( er ).numSubRegions() );
+  }
 
-    } );
+  elemManager.forElementSubRegionsComplete< WellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                      localIndex const er,
+                                                                                      localIndex const esr,
+                                                                                      ElementRegionBase &,
+                                                                                      WellElementSubRegion & subRegion )
+  {
+    string const & fluidName = subRegion.getReference< string >( viewKeyStruct::fluidNamesString() );
+    MultiFluidBase const & fluid = subRegion.getConstitutiveModel< MultiFluidBase >( fluidName );
+    m_batchWellElemPhaseMassDens[er][esr] = fluid.phaseMassDensity();
+    m_batchDWellElemPhaseMassDens[er][esr] = fluid.dPhaseMassDensity();
   } );
 
+  // the injectors without crossflow do not let the reservoir fluid enter the well
+  m_batchPerfDisableReservoirToWellFlow.resize( m_batchPerfIndex.size() );
+  for( localIndex ibatch = 0; ibatch < m_batchPerfIndex.size(); ++ibatch )
+  {
+    WellElementSubRegion const & subRegion =
+      elemManager.getRegion( m_batchPerfWellRegion[ibatch] ).getSubRegion< WellElementSubRegion >( m_batchPerfWellSubRegion[ibatch] );
+    WellControls const & wellControls = getWellControls( subRegion );
+    m_batchPerfDisableReservoirToWellFlow[ibatch] = wellControls.isInjector() && !wellControls.isCrossflowEnabled();
+  }
 }
 
 
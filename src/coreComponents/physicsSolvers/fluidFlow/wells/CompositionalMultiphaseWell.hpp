@@ -20,6 +20,7 @@
 #ifndef GEOS_PHYSICSSOLVERS_FLUIDFLOW_WELLS_COMPOSITIONALMULTIPHASEWELL_HPP_
 #define GEOS_PHYSICSSOLVERS_FLUIDFLOW_WELLS_COMPOSITIONALMULTIPHASEWELL_HPP_
 
+#include "constitutive/fluid/multifluid/Layouts.hpp"
 #include "physicsSolvers/fluidFlow/wells/WellSolverBase.hpp"
 #include "physicsSolvers/fluidFlow/CompositionalMultiphaseBase.hpp"
 
@@ -182,6 +183,15 @@ public:
    */
   virtual void updateSubRegionState( WellElementSubRegion & subRegion ) override;
 
+  /**
+   * @brief Recompute all dependent quantities from primary variables in all the wells
+   * @param domain the domain containing the mesh and fields
+   *
+   * The global component fractions and the total mass densities are computed for all the wells in one
+   * launch, the fluid update and the quantities used by the well controls are still computed well by well.
+   */
+  virtual void updateState( DomainPartition & domain ) override;
+
   virtual string wellElementDofName() const override { return viewKeyStruct::dofFieldString(); }
 
   virtual string resElementDofName() const override { return CompositionalMultiphaseBase::viewKeyStruct::elemDofFieldString(); }
@@ -363,6 +373,9 @@ protected:
                    real64 const & dt,
                    DomainPartition & domain ) override;
 
+  virtual void precomputeBatchedAccessors( ElementRegionManager & elemManager,
+                                           arrayView1d< string const > const & regionNames ) override;
+
 private:
 
   /**
@@ -412,6 +425,30 @@ private:
   /// name of the fluid constitutive model used as a reference for component/phase description
   string m_referenceFluidModelName;
 
+  /// Flag disabling the reservoir-to-well flow of the batched perforations (injectors without crossflow)
+  array1d< integer > m_batchPerfDisableReservoirToWellFlow;
+
+  /// Component rates of the perforations of all the wells, and their derivatives
+  ElementRegionManager::ElementViewAccessor< arrayView2d< real64 > > m_batchCompPerfRate;
+  ElementRegionManager::ElementViewAccessor< arrayView3d< real64 > > m_batchDCompPerfRate_dPres;
+  ElementRegionManager::ElementViewAccessor< arrayView4d< real64 > > m_batchDCompPerfRate_dComp;
+
+  /// Well element fields of all the wells, used by the batched kernels
+  ElementRegionManager::ElementViewAccessor< arrayView1d< real64 > > m_batchWellElemGravCoef;
+  ElementRegionManager::ElementViewAccessor< arrayView1d< real64 > > m_batchWellElemPres;
+  ElementRegionManager::ElementViewAccessor< arrayView2d< real64, compflow::USD_COMP > > m_batchWellElemCompDens;
+  ElementRegionManager::ElementViewAccessor< arrayView2d< real64, compflow::USD_COMP > > m_batchWellElemCompFrac;
+  ElementRegionManager::ElementViewAccessor< arrayView3d< real64, compflow::USD_COMP_DC > > m_batchDWellElemCompFrac_dCompDens;
+  ElementRegionManager::ElementViewAccessor< arrayView2d< real64, compflow::USD_PHASE > > m_batchWellElemPhaseVolFrac;
+  ElementRegionManager::ElementViewAccessor< arrayView3d< real64, compflow::USD_PHASE_DC > > m_batchDWellElemPhaseVolFrac;
+  ElementRegionManager::ElementViewAccessor< arrayView1d< real64 > > m_batchWellElemTotalMassDens;
+  ElementRegionManager::ElementViewAccessor< arrayView1d< real64 > > m_batchDWellElemTotalMassDens_dPres;
+  ElementRegionManager::ElementViewAccessor< arrayView2d< real64, compflow::USD_FLUID_DC > > m_batchDWellElemTotalMassDens_dCompDens;
+
+  /// Phase mass densities of the well fluid of all the wells, and their derivatives
+  ElementRegionManager::ElementViewAccessor< arrayView3d< real64 const, constitutive::multifluid::USD_PHASE > > m_batchWellElemPhaseMassDens;
+  ElementRegionManager::ElementViewAccessor< arrayView4d< real64 const, constitutive::multifluid::USD_PHASE_DC > > m_batchDWellElemPhaseMassDens;
+
 };
 
 } // namespace geos
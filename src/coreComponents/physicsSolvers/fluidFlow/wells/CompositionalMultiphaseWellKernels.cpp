@@ -807,7 +807,7 @@ PerforationKernel::
            arraySlice1d< real64 const, multifluid::USD_PHASE - 2 > const & resPhaseVisc,
            arraySlice2d< real64 const, multifluid::USD_PHASE_DC - 2 > const & dResPhaseVisc,
            arraySlice2d< real64 const, multifluid::USD_PHASE_COMP - 2 > const & resPhaseCompFrac,
-           arraySlice3d< real64 const, multifluid::USD_PHASE_COMP_DC - 2 > const & dResPhaseCompFrac,
+           multifluid::PhaseCompDerivsSlice const & dResPhaseCompFrac,
            arraySlice1d< real64 const, relperm::USD_RELPERM - 2 > const & resPhaseRelPerm,
            arraySlice2d< real64 const, relperm::USD_RELPERM_DS - 2 > const & dResPhaseRelPerm_dPhaseVolFrac,
            real64 const & wellElemGravCoef,
@@ -1111,8 +1111,10 @@ PerforationKernel::
 template< integer NC, integer NP >
 void
 PerforationKernel::
-  launch( localIndex const size,
-          bool const disableReservoirToWellFlow,
+  launch( arrayView1d< localIndex const > const & batchPerfWellRegion,
+          arrayView1d< localIndex const > const & batchPerfWellSubRegion,
+          arrayView1d< localIndex const > const & batchPerfIndex,
+          arrayView1d< integer const > const & batchPerfDisableReservoirToWellFlow,
           ElementViewConst< arrayView1d< real64 const > > const & resPres,
           ElementViewConst< arrayView2d< real64 const, compflow::USD_PHASE > > const & resPhaseVolFrac,
           ElementViewConst< arrayView3d< real64 const, compflow::USD_PHASE_DC > > const & dResPhaseVolFrac,
@@ -1122,41 +1124,45 @@ PerforationKernel::
           ElementViewConst< arrayView3d< real64 const, multifluid::USD_PHASE > > const & resPhaseVisc,
           ElementViewConst< arrayView4d< real64 const, multifluid::USD_PHASE_DC > > const & dResPhaseVisc,
           ElementViewConst< arrayView4d< real64 const, multifluid::USD_PHASE_COMP > > const & resPhaseCompFrac,
-          ElementViewConst< arrayView5d< real64 const, multifluid::USD_PHASE_COMP_DC > > const & dResPhaseCompFrac,
+          multifluid::PhaseCompDerivsAccessor< ElementViewConst > const & dResPhaseCompFrac,
           ElementViewConst< arrayView3d< real64 const, relperm::USD_RELPERM > > const & resPhaseRelPerm,
           ElementViewConst< arrayView4d< real64 const, relperm::USD_RELPERM_DS > > const & dResPhaseRelPerm_dPhaseVolFrac,
-          arrayView1d< real64 const > const & wellElemGravCoef,
-          arrayView1d< real64 const > const & wellElemPres,
-          arrayView2d< real64 const, compflow::USD_COMP > const & wellElemCompDens,
-          arrayView1d< real64 const > const & wellElemTotalMassDens,
-          arrayView1d< real64 const > const & dWellElemTotalMassDens_dPres,
-          arrayView2d< real64 const, compflow::USD_FLUID_DC > const & dWellElemTotalMassDens_dCompDens,
-          arrayView2d< real64 const, compflow::USD_COMP > const & wellElemCompFrac,
-          arrayView3d< real64 const, compflow::USD_COMP_DC > const & dWellElemCompFrac_dCompDens,
-          arrayView1d< real64 const > const & perfGravCoef,
-          arrayView1d< localIndex const > const & perfWellElemIndex,
-          arrayView1d< real64 const > const & perfTrans,
-          arrayView1d< localIndex const > const & resElementRegion,
-          arrayView1d< localIndex const > const & resElementSubRegion,
-          arrayView1d< localIndex const > const & resElementIndex,
-          arrayView2d< real64 > const & compPerfRate,
-          arrayView3d< real64 > const & dCompPerfRate_dPres,
-          arrayView4d< real64 > const & dCompPerfRate_dComp )
+          ElementViewConst< arrayView1d< real64 const > > const & wellElemGravCoef,
+          ElementViewConst< arrayView1d< real64 const > > const & wellElemPres,
+          ElementViewConst< arrayView2d< real64 const, compflow::USD_COMP > > const & wellElemCompDens,
+          ElementViewConst< arrayView1d< real64 const > > const & wellElemTotalMassDens,
+          ElementViewConst< arrayView1d< real64 const > > const & dWellElemTotalMassDens_dPres,
+          ElementViewConst< arrayView2d< real64 const, compflow::USD_FLUID_DC > > const & dWellElemTotalMassDens_dCompDens,
+          ElementViewConst< arrayView2d< real64 const, compflow::USD_COMP > > const & wellElemCompFrac,
+          ElementViewConst< arrayView3d< real64 const, compflow::USD_COMP_DC > > const & dWellElemCompFrac_dCompDens,
+          ElementViewConst< arrayView1d< real64 const > > const & perfGravCoef,
+          ElementViewConst< arrayView1d< localIndex const > > const & perfWellElemIndex,
+          ElementViewConst< arrayView1d< real64 const > > const & perfTrans,
+          ElementViewConst< arrayView1d< localIndex const > > const & resElementRegion,
+          ElementViewConst< arrayView1d< localIndex const > > const & resElementSubRegion,
+          ElementViewConst< arrayView1d< localIndex const > > const & resElementIndex,
+          ElementView< arrayView2d< real64 > > const & compPerfRate,
+          ElementView< arrayView3d< real64 > > const & dCompPerfRate_dPres,
+          ElementView< arrayView4d< real64 > > const & dCompPerfRate_dComp )
 {
 
-  // loop over the perforations to compute the perforation rates
-  forAll< parallelDevicePolicy<> >( size, [=] GEOS_HOST_DEVICE ( localIndex const iperf )
+  // loop over the perforations of all the wells to compute the perforation rates
+  forAll< parallelDevicePolicy<> >( batchPerfIndex.size(), [=] GEOS_HOST_DEVICE ( localIndex const ibatch )
   {
+    // get the well and the perforation
+    localIndex const wr = batchPerfWellRegion[ibatch];
+    localIndex const wsr = batchPerfWellSubRegion[ibatch];
+    localIndex const iperf = batchPerfIndex[ibatch];
 
     // get the index of the reservoir elem
-    localIndex const er  = resElementRegion[iperf];
-    localIndex const esr = resElementSubRegion[iperf];
-    localIndex const ei  = resElementIndex[iperf];
+    localIndex const er  = resElementRegion[wr][wsr][iperf];
+    localIndex const esr = resElementSubRegion[wr][wsr][iperf];
+    localIndex const ei  = resElementIndex[wr][wsr][iperf];
 
     // get the index of the well elem
-    localIndex const iwelem = perfWellElemIndex[iperf];
+    localIndex const iwelem = perfWellElemIndex[wr][wsr][iperf];
 
-    compute< NC, NP >( disableReservoirToWellFlow,
+    compute< NC, NP >( batchPerfDisableReservoirToWellFlow[ibatch],
                        resPres[er][esr][ei],
                        resPhaseVolFrac[er][esr][ei],
                        dResPhaseVolFrac[er][esr][ei],
@@ -1169,19 +1175,19 @@ PerforationKernel::
                        dResPhaseCompFrac[er][esr][ei][0],
                        resPhaseRelPerm[er][esr][ei][0],
                        dResPhaseRelPerm_dPhaseVolFrac[er][esr][ei][0],
-                       wellElemGravCoef[iwelem],
-                       wellElemPres[iwelem],
-                       wellElemCompDens[iwelem],
-                       wellElemTotalMassDens[iwelem],
-                       dWellElemTotalMassDens_dPres[iwelem],
-                       dWellElemTotalMassDens_dCompDens[iwelem],
-                       wellElemCompFrac[iwelem],
-                       dWellElemCompFrac_dCompDens[iwelem],
-                       perfGravCoef[iperf],
-                       perfTrans[iperf],
-                       compPerfRate[iperf],
-                       dCompPerfRate_dPres[iperf],
-                       dCompPerfRate_dComp[iperf] );
+                       wellElemGravCoef[wr][wsr][iwelem],
+                       wellElemPres[wr][wsr][iwelem],
+                       wellElemCompDens[wr][wsr][iwelem],
+                       wellElemTotalMassDens[wr][wsr][iwelem],
+                       dWellElemTotalMassDens_dPres[wr][wsr][iwelem],
+                       dWellElemTotalMassDens_dCompDens[wr][wsr][iwelem],
+                       wellElemCompFrac[wr][wsr][iwelem],
+                       dWellElemCompFrac_dCompDens[wr][wsr][iwelem],
+                       perfGravCoef[wr][wsr][iperf],
+                       perfTrans[wr][wsr][iperf],
+                       compPerfRate[wr][wsr][iperf],
+                       dCompPerfRate_dPres[wr][wsr][iperf],
+                       dCompPerfRate_dComp[wr][wsr][iperf] );
 
   } );
 }
@@ -1189,8 +1195,10 @@ PerforationKernel::
 #define INST_PerforationKernel( NC, NP ) \
   template \
   void PerforationKernel:: \
-    launch< NC, NP >( localIndex const size, \
-                      bool const disableReservoirToWellFlow, \
+    launch< NC, NP >( arrayView1d< localIndex const > const & batchPerfWellRegion, \
+                      arrayView1d< localIndex const > const & batchPerfWellSubRegion, \
+                      arrayView1d< localIndex const > const & batchPerfIndex, \
+                      arrayView1d< integer const > const & batchPerfDisableReservoirToWellFlow, \
                       ElementViewConst< arrayView1d< real64 const > > const & resPres, \
                       ElementViewConst< arrayView2d< real64 const, compflow::USD_PHASE > > const & resPhaseVolFrac, \
                       ElementViewConst< arrayView3d< real64 const, compflow::USD_PHASE_DC > > const & dResPhaseVolFrac, \
@@ -1200,26 +1208,26 @@ PerforationKernel::
                       ElementViewConst< arrayView3d< real64 const, multifluid::USD_PHASE > > const & resPhaseVisc, \
                       ElementViewConst< arrayView4d< real64 const, multifluid::USD_PHASE_DC > > const & dResPhaseVisc, \
                       ElementViewConst< arrayView4d< real64 const, multifluid::USD_PHASE_COMP > > const & resPhaseCompFrac, \
-                      ElementViewConst< arrayView5d< real64 const, multifluid::USD_PHASE_COMP_DC > > const & dResPhaseCompFrac, \
+                      multifluid::PhaseCompDerivsAccessor< ElementViewConst > const & dResPhaseCompFrac, \
                       ElementViewConst< arrayView3d< real64 const, relperm::USD_RELPERM > > const & resPhaseRelPerm, \
                       ElementViewConst< arrayView4d< real64 const, relperm::USD_RELPERM_DS > > const & dResPhaseRelPerm_dPhaseVolFrac, \
-                      arrayView1d< real64 const > const & wellElemGravCoef, \
-                      arrayView1d< real64 const > const & wellElemPres, \
-                      arrayView2d< real64 const, compflow::USD_COMP > const & wellElemCompDens, \
-                      arrayView1d< real64 const > const & wellElemTotalMassDens, \
-                      arrayView1d< real64 const > const & dWellElemTotalMassDens_dPres, \
-                      arrayView2d< real64 const, compflow::USD_FLUID_DC > const & dWellElemTotalMassDens_dCompDens, \
-                      arrayView2d< real64 const, compflow::USD_COMP > const & wellElemCompFrac, \
-                      arrayView3d< real64 const, compflow::USD_COMP_DC > const & dWellElemCompFrac_dCompDens, \
-                      arrayView1d< real64 const > const & perfGravCoef, \
-                      arrayView1d< localIndex const > const & perfWellElemIndex, \
-                      arrayView1d< real64 const > const & perfTrans, \
-                      arrayView1d< localIndex const > const & resElementRegion, \
-                      arrayView1d< localIndex const > const & resElementSubRegion, \
-                      arrayView1d< localIndex const > const & resElementIndex, \
-                      arrayView2d< real64 > const & compPerfRate, \
-                      arrayView3d< real64 > const & dCompPerfRate_dPres, \
-                      arrayView4d< real64 > const & dCompPerfRate_dComp )
+                      ElementViewConst< arrayView1d< real64 const > > const & wellElemGravCoef, \
+                      ElementViewConst< arrayView1d< real64 const > > const & wellElemPres, \
+                      ElementViewConst< arrayView2d< real64 const, compflow::USD_COMP > > const & wellElemCompDens, \
+                      ElementViewConst< arrayView1d< real64 const > > const & wellElemTotalMassDens, \
+                      ElementViewConst< arrayView1d< real64 const > > const & dWellElemTotalMassDens_dPres, \
+                      ElementViewConst< arrayView2d< real64 const, compflow::USD_FLUID_DC > > const & dWellElemTotalMassDens_dCompDens, \
+                      ElementViewConst< arrayView2d< real64 const, compflow::USD_COMP > > const & wellElemCompFrac, \
+                      ElementViewConst< arrayView3d< real64 const, compflow::USD_COMP_DC > > const & dWellElemCompFrac_dCompDens, \
+                      ElementViewConst< arrayView1d< real64 const > > const & perfGravCoef, \
+                      ElementViewConst< arrayView1d< localIndex const > > const & perfWellElemIndex, \
+                      ElementViewConst< arrayView1d< real64 const > > const & perfTrans, \
+                      ElementViewConst< arrayView1d< localIndex const > > const & resElementRegion, \
+                      ElementViewConst< arrayView1d< localIndex const > > const & resElementSubRegion, \
+                      ElementViewConst< arrayView1d< localIndex const > > const & resElementIndex, \
+                      ElementView< arrayView2d< real64 > > const & compPerfRate, \
+                      ElementView< arrayView3d< real64 > > const & dCompPerfRate_dPres, \
+                      ElementView< arrayView4d< real64 > > const & dCompPerfRate_dComp )
 
 INST_PerforationKernel( 1, 2 );
 INST_PerforationKernel( 2, 2 );
@@ -1232,6 +1240,106 @@ INST_PerforationKernel( 3, 3 );
 INST_PerforationKernel( 4, 3 );
 INST_PerforationKernel( 5, 3 );
 
+/******************************** BatchedStateKernels ********************************/
+
+template< integer NC >
+void
+BatchedGlobalComponentFractionKernel::
+  launch( arrayView1d< localIndex const > const & batchWellElemRegion,
+          arrayView1d< localIndex const > const & batchWellElemSubRegion,
+          arrayView1d< localIndex const > const & batchWellElemIndex,
+          ElementViewConst< arrayView2d< real64 const, compflow::USD_COMP > > const & compDens,
+          ElementView< arrayView2d< real64, compflow::USD_COMP > > const & compFrac,
+          ElementView< arrayView3d< real64, compflow::USD_COMP_DC > > const & dCompFrac_dCompDens )
+{
+  forAll< parallelDevicePolicy<> >( batchWellElemIndex.size(), [=] GEOS_HOST_DEVICE ( localIndex const ibatch )
+  {
+    localIndex const wr = batchWellElemRegion[ibatch];
+    localIndex const wsr = batchWellElemSubRegion[ibatch];
+    localIndex const iwelem = batchWellElemIndex[ibatch];
+
+    isothermalCompositionalMultiphaseBaseKernels::GlobalComponentFractionKernel< NC >::
+      computeGlobalComponentFraction( compDens[wr][wsr][iwelem],
+                                      compFrac[wr][wsr][iwelem],
+                                      dCompFrac_dCompDens[wr][wsr][iwelem] );
+  } );
+}
+
+#define INST_BatchedGlobalComponentFractionKernel( NC ) \
+  template \
+  void BatchedGlobalComponentFractionKernel:: \
+    launch< NC >( arrayView1d< localIndex const > const & batchWellElemRegion, \
+                  arrayView1d< localIndex const > const & batchWellElemSubRegion, \
+                  arrayView1d< localIndex const > const & batchWellElemIndex, \
+                  ElementViewConst< arrayView2d< real64 const, compflow::USD_COMP > > const & compDens, \
+                  ElementView< arrayView2d< real64, compflow::USD_COMP > > const & compFrac, \
+                  ElementView< arrayView3d< real64, compflow::USD_COMP_DC > > const & dCompFrac_dCompDens )
+
+INST_BatchedGlobalComponentFractionKernel( 1 );
+INST_BatchedGlobalComponentFractionKernel( 2 );
+INST_BatchedGlobalComponentFractionKernel( 3 );
+INST_BatchedGlobalComponentFractionKernel( 4 );
+INST_BatchedGlobalComponentFractionKernel( 5 );
+
+template< integer NC, integer NP >
+void
+BatchedTotalMassDensityKernel::
+  launch( arrayView1d< localIndex const > const & batchWellElemRegion,
+          arrayView1d< localIndex const > const & batchWellElemSubRegion,
+          arrayView1d< localIndex const > const & batchWellElemIndex,
+          ElementViewConst< arrayView2d< real64 const, compflow::USD_PHASE > > const & phaseVolFrac,
+          ElementViewConst< arrayView3d< real64 const, compflow::USD_PHASE_DC > > const & dPhaseVolFrac,
+          ElementViewConst< arrayView3d< real64 const, compflow::USD_COMP_DC > > const & dCompFrac_dCompDens,
+          ElementViewConst< arrayView3d< real64 const, multifluid::USD_PHASE > > const & phaseMassDens,
+          ElementViewConst< arrayView4d< real64 const, multifluid::USD_PHASE_DC > > const & dPhaseMassDens,
+          ElementView< arrayView1d< real64 > > const & totalMassDens,
+          ElementView< arrayView1d< real64 > > const & dTotalMassDens_dPres,
+          ElementView< arrayView2d< real64, compflow::USD_FLUID_DC > > const & dTotalMassDens_dCompDens )
+{
+  forAll< parallelDevicePolicy<> >( batchWellElemIndex.size(), [=] GEOS_HOST_DEVICE ( localIndex const ibatch )
+  {
+    localIndex const wr = batchWellElemRegion[ibatch];
+    localIndex const wsr = batchWellElemSubRegion[ibatch];
+    localIndex const iwelem = batchWellElemIndex[ibatch];
+
+    TotalMassDensityKernel< NC, NP >::
+      computeTotalMassDensity( phaseVolFrac[wr][wsr][iwelem],
+                               dPhaseVolFrac[wr][wsr][iwelem],
+                               dCompFrac_dCompDens[wr][wsr][iwelem],
+                               phaseMassDens[wr][wsr][iwelem][0],
+                               dPhaseMassDens[wr][wsr][iwelem][0],
+                               totalMassDens[wr][wsr][iwelem],
+                               dTotalMassDens_dPres[wr][wsr][iwelem],
+                               dTotalMassDens_dCompDens[wr][wsr][iwelem] );
+  } );
+}
+
+#define INST_BatchedTotalMassDensityKernel( NC, NP ) \
+  template \
+  void BatchedTotalMassDensityKernel:: \
+    launch< NC, NP >( arrayView1d< localIndex const > const & batchWellElemRegion, \
+                      arrayView1d< localIndex const > const & batchWellElemSubRegion, \
+                      arrayView1d< localIndex const > const & batchWellElemIndex, \
+                      ElementViewConst< arrayView2d< real64 const, compflow::USD_PHASE > > const & phaseVolFrac, \
+                      ElementViewConst< arrayView3d< real64 const, compflow::USD_PHASE_DC > > const & dPhaseVolFrac, \
+                      ElementViewConst< arrayView3d< real64 const, compflow::USD_COMP_DC > > const & dCompFrac_dCompDens, \
+                      ElementViewConst< arrayView3d< real64 const, multifluid::USD_PHASE > > const & phaseMassDens, \
+                      ElementViewConst< arrayView4d< real64 const, multifluid::USD_PHASE_DC > > const & dPhaseMassDens, \
+                      ElementView< arrayView1d< real64 > > const & totalMassDens, \
+                      ElementView< arrayView1d< real64 > > const & dTotalMassDens_dPres, \
+                      ElementView< arrayView2d< real64, compflow::USD_FLUID_DC > > const & dTotalMassDens_dCompDens )
+
+INST_BatchedTotalMassDensityKernel( 1, 2 );
+INST_BatchedTotalMassDensityKernel( 2, 2 );
+INST_BatchedTotalMassDensityKernel( 3, 2 );
+INST_BatchedTotalMassDensityKernel( 4, 2 );
+INST_BatchedTotalMassDensityKernel( 5, 2 );
+INST_BatchedTotalMassDensityKernel( 1, 3 );
+INST_BatchedTotalMassDensityKernel( 2, 3 );
+INST_BatchedTotalMassDensityKernel( 3, 3 );
+INST_BatchedTotalMassDensityKernel( 4, 3 );
+INST_BatchedTotalMassDensityKernel( 5, 3 );
+
 /******************************** AccumulationKernel ********************************/
 
 template< integer NC >
@@ -1246,7 +1354,7 @@ AccumulationKernel::
            arraySlice1d< real64 const, multifluid::USD_PHASE - 2 > const & phaseDens,
            arraySlice2d< real64 const, multifluid::USD_PHASE_DC - 2 > const & dPhaseDens,
            arraySlice2d< real64 const, multifluid::USD_PHASE_COMP - 2 > const & phaseCompFrac,
-           arraySlice3d< real64 const, multifluid::USD_PHASE_COMP_DC - 2 > const & dPhaseCompFrac,
+           multifluid::PhaseCompDerivsSlice const & dPhaseCompFrac,
            arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseVolFrac_n,
            arraySlice1d< real64 const, multifluid::USD_PHASE - 2 > const & phaseDens_n,
            arraySlice2d< real64 const, multifluid::USD_PHASE_COMP - 2 > const & phaseCompFrac_n,
@@ -1331,7 +1439,7 @@ AccumulationKernel::
           arrayView3d< real64 const, multifluid::USD_PHASE > const & wellElemPhaseDens,
           arrayView4d< real64 const, multifluid::USD_PHASE_DC > const & dWellElemPhaseDens,
           arrayView4d< real64 const, multifluid::USD_PHASE_COMP > const & wellElemPhaseCompFrac,
-          arrayView5d< real64 const, multifluid::USD_PHASE_COMP_DC > const & dWellElemPhaseCompFrac,
+          multifluid::PhaseCompDerivsView const & dWellElemPhaseCompFrac,
           arrayView2d< real64 const, compflow::USD_PHASE > const & wellElemPhaseVolFrac_n,
           arrayView3d< real64 const, multifluid::USD_PHASE > const & wellElemPhaseDens_n,
           arrayView4d< real64 const, multifluid::USD_PHASE_COMP > const & wellElemPhaseCompFrac_n,
@@ -1417,7 +1525,7 @@ AccumulationKernel::
                   arrayView3d< real64 const, multifluid::USD_PHASE > const & wellElemPhaseDens, \
                   arrayView4d< real64 const, multifluid::USD_PHASE_DC > const & dWellElemPhaseDens, \
                   arrayView4d< real64 const, multifluid::USD_PHASE_COMP > const & wellElemPhaseCompFrac, \
-                  arrayView5d< real64 const, multifluid::USD_PHASE_COMP_DC > const & dWellElemPhaseCompFrac, \
+                  multifluid::PhaseCompDerivsView const & dWellElemPhaseCompFrac, \
                   arrayView2d< real64 const, compflow::USD_PHASE > const & wellElemPhaseVolFrac_n, \
                   arrayView3d< real64 const, multifluid::USD_PHASE > const & wellElemPhaseDens_n, \
                   arrayView4d< real64 const, multifluid::USD_PHASE_COMP > const & wellElemPhaseCompFrac_n, \
@@ -246,7 +246,8 @@ struct PerforationKernel
                               fields::multifluid::phaseViscosity,
                               fields::multifluid::dPhaseViscosity,
                               fields::multifluid::phaseCompFraction,
-                              fields::multifluid::dPhaseCompFraction >;
+                              fields::multifluid::dPhaseCompFraction,
+                              fields::multifluid::dPhaseCompFraction_float >;
 
   using RelPermAccessors =
     StencilMaterialAccessors< constitutive::RelativePermeabilityBase,
@@ -264,6 +265,12 @@ struct PerforationKernel
   template< typename VIEWTYPE >
   using ElementViewConst = ElementRegionManager::ElementViewConst< VIEWTYPE >;
 
+  /**
+   * @brief The type for element-based non-constitutive data parameters that are written by the kernel.
+   */
+  template< typename VIEWTYPE >
+  using ElementView = ElementRegionManager::ElementView< VIEWTYPE >;
+
 
   template< integer NC, integer NP >
   GEOS_HOST_DEVICE
@@ -279,7 +286,7 @@ struct PerforationKernel
            arraySlice1d< real64 const, constitutive::multifluid::USD_PHASE - 2 > const & resPhaseVisc,
            arraySlice2d< real64 const, constitutive::multifluid::USD_PHASE_DC - 2 > const & dResPhaseVisc,
            arraySlice2d< real64 const, constitutive::multifluid::USD_PHASE_COMP - 2 > const & resPhaseCompFrac,
-           arraySlice3d< real64 const, constitutive::multifluid::USD_PHASE_COMP_DC - 2 > const & dResPhaseCompFrac,
+           constitutive::multifluid::PhaseCompDerivsSlice const & dResPhaseCompFrac,
            arraySlice1d< real64 const, constitutive::relperm::USD_RELPERM - 2 > const & resPhaseRelPerm,
            arraySlice2d< real64 const, constitutive::relperm::USD_RELPERM_DS - 2 > const & dResPhaseRelPerm_dPhaseVolFrac,
            real64 const & wellElemGravCoef,
@@ -296,10 +303,22 @@ struct PerforationKernel
            arraySlice2d< real64 > const & dCompPerfRate_dPres,
            arraySlice3d< real64 > const & dCompPerfRate_dComp );
 
+  /**
+   * @brief Compute the rates of the perforations of all the local wells in a single launch
+   * @param[in] batchPerfWellRegion well element region index of each batched perforation
+   * @param[in] batchPerfWellSubRegion well element subregion index of each batched perforation
+   * @param[in] batchPerfIndex index of each batched perforation in the perforation data of its well
+   * @param[in] batchPerfDisableReservoirToWellFlow flag disabling the reservoir-to-well flow of each batched perforation
+   *
+   * The reservoir accessors are indexed by the reservoir element region and subregion, the well element and
+   * perforation accessors are indexed by the well element region and subregion.
+   */
   template< integer NC, integer NP >
   static void
-  launch( localIndex const size,
-          bool const disableReservoirToWellFlow,
+  launch( arrayView1d< localIndex const > const & batchPerfWellRegion,
+          arrayView1d< localIndex const > const & batchPerfWellSubRegion,
+          arrayView1d< localIndex const > const & batchPerfIndex,
+          arrayView1d< integer const > const & batchPerfDisableReservoirToWellFlow,
           ElementViewConst< arrayView1d< real64 const > > const & resPres,
           ElementViewConst< arrayView2d< real64 const, compflow::USD_PHASE > > const & resPhaseVolFrac,
           ElementViewConst< arrayView3d< real64 const, compflow::USD_PHASE_DC > > const & dResPhaseVolFrac_dComp,
@@ -309,26 +328,26 @@ struct PerforationKernel
           ElementViewConst< arrayView3d< real64 const, constitutive::multifluid::USD_PHASE > > const & resPhaseVisc,
           ElementViewConst< arrayView4d< real64 const, constitutive::multifluid::USD_PHASE_DC > > const & dResPhaseVisc,
           ElementViewConst< arrayView4d< real64 const, constitutive::multifluid::USD_PHASE_COMP > > const & resPhaseCompFrac,
-          ElementViewConst< arrayView5d< real64 const, constitutive::multifluid::USD_PHASE_COMP_DC > > const & dResPhaseCompFrac,
+          constitutive::multifluid::PhaseCompDerivsAccessor< ElementViewConst > const & dResPhaseCompFrac,
           ElementViewConst< arrayView3d< real64 const, constitutive::relperm::USD_RELPERM > > const & resPhaseRelPerm,
           ElementViewConst< arrayView4d< real64 const, constitutive::relperm::USD_RELPERM_DS > > const & dResPhaseRelPerm_dPhaseVolFrac,
-          arrayView1d< real64 const > const & wellElemGravCoef,
-          arrayView1d< real64 const > const & wellElemPres,
-          arrayView2d< real64 const, compflow::USD_COMP > const & wellElemCompDens,
-          arrayView1d< real64 const > const & wellElemTotalMassDens,
-          arrayView1d< real64 const > const & dWellElemTotalMassDens_dPres,
-          arrayView2d< real64 const, compflow::USD_FLUID_DC > const & dWellElemTotalMassDens_dCompDens,
-          arrayView2d< real64 const, compflow::USD_COMP > const & wellElemCompFrac,
-          arrayView3d< real64 const, compflow::USD_COMP_DC > const & dWellElemCompFrac_dCompDens,
-          arrayView1d< real64 const > const & perfGravCoef,
-          arrayView1d< localIndex const > const & perfWellElemIndex,
-          arrayView1d< real64 const > const & perfTrans,
-          arrayView1d< localIndex const > const & resElementRegion,
-          arrayView1d< localIndex const > const & resElementSubRegion,
-          arrayView1d< localIndex const > const & resElementIndex,
-          arrayView2d< real64 > const & compPerfRate,
-          arrayView3d< real64 > const & dCompPerfRate_dPres,
-          arrayView4d< real64 > const & dCompPerfRate_dComp );
+          ElementViewConst< arrayView1d< real64 const > > const & wellElemGravCoef,
+          ElementViewConst< arrayView1d< real64 const > > const & wellElemPres,
+          ElementViewConst< arrayView2d< real64 const, compflow::USD_COMP > > const & wellElemCompDens,
+          ElementViewConst< arrayView1d< real64 const > > const & wellElemTotalMassDens,
+          ElementViewConst< arrayView1d< real64 const > > const & dWellElemTotalMassDens_dPres,
+          ElementViewConst< arrayView2d< real64 const, compflow::USD_FLUID_DC > > const & dWellElemTotalMassDens_dCompDens,
+          ElementViewConst< arrayView2d< real64 const, compflow::USD_COMP > > const & wellElemCompFrac,
+          ElementViewConst< arrayView3d< real64 const, compflow::USD_COMP_DC > > const & dWellElemCompFrac_dCompDens,
+          ElementViewConst< arrayView1d< real64 const > > const & perfGravCoef,
+          ElementViewConst< arrayView1d< localIndex const > > const & perfWellElemIndex,
+          ElementViewConst< arrayView1d< real64 const > > const & perfTrans,
+          ElementViewConst< arrayView1d< localIndex const > > const & resElementRegion,
+          ElementViewConst< arrayView1d< localIndex const > > const & resElementSubRegion,
+          ElementViewConst< arrayView1d< localIndex const > > const & resElementIndex,
+          ElementView< arrayView2d< real64 > > const & compPerfRate,
+          ElementView< arrayView3d< real64 > > const & dCompPerfRate_dPres,
+          ElementView< arrayView4d< real64 > > const & dCompPerfRate_dComp );
 
 };
 
@@ -352,7 +371,7 @@ struct AccumulationKernel
              arraySlice1d< real64 const, constitutive::multifluid::USD_PHASE - 2 > const & phaseDens,
              arraySlice2d< real64 const, constitutive::multifluid::USD_PHASE_DC - 2 > const & dPhaseDens,
              arraySlice2d< real64 const, constitutive::multifluid::USD_PHASE_COMP - 2 > const & phaseCompFrac,
-             arraySlice3d< real64 const, constitutive::multifluid::USD_PHASE_COMP_DC - 2 > const & dPhaseCompFrac,
+             constitutive::multifluid::PhaseCompDerivsSlice const & dPhaseCompFrac,
              arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseVolFrac_n,
              arraySlice1d< real64 const, constitutive::multifluid::USD_PHASE - 2 > const & phaseDens_n,
              arraySlice2d< real64 const, constitutive::multifluid::USD_PHASE_COMP - 2 > const & phaseCompFrac_n,
@@ -374,7 +393,7 @@ struct AccumulationKernel
           arrayView3d< real64 const, constitutive::multifluid::USD_PHASE > const & wellElemPhaseDens,
           arrayView4d< real64 const, constitutive::multifluid::USD_PHASE_DC > const & dWellElemPhaseDens,
           arrayView4d< real64 const, constitutive::multifluid::USD_PHASE_COMP > const & wellElemPhaseCompFrac,
-          arrayView5d< real64 const, constitutive::multifluid::USD_PHASE_COMP_DC > const & dWellElemPhaseCompFrac,
+          constitutive::multifluid::PhaseCompDerivsView const & dWellElemPhaseCompFrac,
           arrayView2d< real64 const, compflow::USD_PHASE > const & wellElemPhaseVolFrac_n,
           arrayView3d< real64 const, constitutive::multifluid::USD_PHASE > const & wellElemPhaseDens_n,
           arrayView4d< real64 const, constitutive::multifluid::USD_PHASE_COMP > const & wellElemPhaseCompFrac_n,
@@ -547,16 +566,45 @@ public:
   void compute( localIndex const ei,
                 FUNC && totalMassDensityKernelOp = NoOpFunc{} ) const
   {
-    using Deriv = constitutive::multifluid::DerivativeOffset;
+    computeTotalMassDensity( m_phaseVolFrac[ei],
+                             m_dPhaseVolFrac[ei],
+                             m_dCompFrac_dCompDens[ei],
+                             m_phaseMassDens[ei][0],
+                             m_dPhaseMassDens[ei][0],
+                             m_totalMassDens[ei],
+                             m_dTotalMassDens_dPres[ei],
+                             m_dTotalMassDens_dCompDens[ei],
+                             totalMassDensityKernelOp );
+  }
 
-    arraySlice1d< real64 const, compflow::USD_PHASE - 1 > phaseVolFrac = m_phaseVolFrac[ei];
-    arraySlice2d< real64 const, compflow::USD_PHASE_DC - 1 > dPhaseVolFrac = m_dPhaseVolFrac[ei];
-    arraySlice2d< real64 const, compflow::USD_COMP_DC - 1 > dCompFrac_dCompDens = m_dCompFrac_dCompDens[ei];
-    arraySlice1d< real64 const, constitutive::multifluid::USD_PHASE - 2 > phaseMassDens = m_phaseMassDens[ei][0];
-    arraySlice2d< real64 const, constitutive::multifluid::USD_PHASE_DC - 2 > dPhaseMassDens = m_dPhaseMassDens[ei][0];
-    real64 & totalMassDens = m_totalMassDens[ei];
-    real64 & dTotalMassDens_dPres = m_dTotalMassDens_dPres[ei];
-    arraySlice1d< real64, compflow::USD_FLUID_DC - 1 > dTotalMassDens_dCompDens = m_dTotalMassDens_dCompDens[ei];
+  /**
+   * @brief Compute the total mass density from the phase volume fractions and mass densities
+   * @tparam FUNC the type of the function that can be used to customize the kernel
+   * @param[in] phaseVolFrac the phase volume fractions
+   * @param[in] dPhaseVolFrac the derivatives of the phase volume fractions
+   * @param[in] dCompFrac_dCompDens the derivatives of the global component fractions wrt the component densities
+   * @param[in] phaseMassDens the phase mass densities
+   * @param[in] dPhaseMassDens the derivatives of the phase mass densities
+   * @param[out] totalMassDens the total mass density
+   * @param[out] dTotalMassDens_dPres the derivative of the total mass density wrt pressure
+   * @param[out] dTotalMassDens_dCompDens the derivatives of the total mass density wrt the component densities
+   * @param[in] totalMassDensityKernelOp the function used to customize the kernel
+   */
+  template< typename FUNC = NoOpFunc >
+  GEOS_HOST_DEVICE
+  inline
+  static void
+  computeTotalMassDensity( arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & phaseVolFrac,
+                           arraySlice2d< real64 const, compflow::USD_PHASE_DC - 1 > const & dPhaseVolFrac,
+                           arraySlice2d< real64 const, compflow::USD_COMP_DC - 1 > const & dCompFrac_dCompDens,
+                           arraySlice1d< real64 const, constitutive::multifluid::USD_PHASE - 2 > const & phaseMassDens,
+                           arraySlice2d< real64 const, constitutive::multifluid::USD_PHASE_DC - 2 > const & dPhaseMassDens,
+                           real64 & totalMassDens,
+                           real64 & dTotalMassDens_dPres,
+                           arraySlice1d< real64, compflow::USD_FLUID_DC - 1 > const & dTotalMassDens_dCompDens,
+                           FUNC && totalMassDensityKernelOp = NoOpFunc{} )
+  {
+    using Deriv = constitutive::multifluid::DerivativeOffset;
 
     real64 dMassDens_dC[numComp]{};
 
@@ -650,6 +698,84 @@ public:
 };
 
 
+/******************************** BatchedStateKernels ********************************/
+
+/**
+ * @struct BatchedGlobalComponentFractionKernel
+ * @brief Compute the global component fractions of the well elements of all the local wells in a single launch
+ */
+struct BatchedGlobalComponentFractionKernel
+{
+  template< typename VIEWTYPE >
+  using ElementViewConst = ElementRegionManager::ElementViewConst< VIEWTYPE >;
+
+  template< typename VIEWTYPE >
+  using ElementView = ElementRegionManager::ElementView< VIEWTYPE >;
+
+  /**
+   * @brief Launch the kernel over the batched well elements
+   * @tparam NC the number of fluid components
+   * @param[in] batchWellElemRegion well element region index of each batched well element
+   * @param[in] batchWellElemSubRegion well element subregion index of each batched well element
+   * @param[in] batchWellElemIndex index of each batched well element in its subregion
+   * @param[in] compDens the component densities
+   * @param[out] compFrac the global component fractions
+   * @param[out] dCompFrac_dCompDens the derivatives of the global component fractions wrt the component densities
+   */
+  template< integer NC >
+  static void
+  launch( arrayView1d< localIndex const > const & batchWellElemRegion,
+          arrayView1d< localIndex const > const & batchWellElemSubRegion,
+          arrayView1d< localIndex const > const & batchWellElemIndex,
+          ElementViewConst< arrayView2d< real64 const, compflow::USD_COMP > > const & compDens,
+          ElementView< arrayView2d< real64, compflow::USD_COMP > > const & compFrac,
+          ElementView< arrayView3d< real64, compflow::USD_COMP_DC > > const & dCompFrac_dCompDens );
+};
+
+/**
+ * @struct BatchedTotalMassDensityKernel
+ * @brief Compute the total mass density of the well elements of all the local wells in a single launch
+ */
+struct BatchedTotalMassDensityKernel
+{
+  template< typename VIEWTYPE >
+  using ElementViewConst = ElementRegionManager::ElementViewConst< VIEWTYPE >;
+
+  template< typename VIEWTYPE >
+  using ElementView = ElementRegionManager::ElementView< VIEWTYPE >;
+
+  /**
+   * @brief Launch the kernel over the batched well elements
+   * @tparam NC the number of fluid components
+   * @tparam NP the number of fluid phases
+   * @param[in] batchWellElemRegion well element region index of each batched well element
+   * @param[in] batchWellElemSubRegion well element subregion index of each batched well element
+   * @param[in] batchWellElemIndex index of each batched well element in its subregion
+   * @param[in] phaseVolFrac the phase volume fractions
+   * @param[in] dPhaseVolFrac the derivatives of the phase volume fractions
+   * @param[in] dCompFrac_dCompDens the derivatives of the global component fractions wrt the component densities
+   * @param[in] phaseMassDens the phase mass densities
+   * @param[in] dPhaseMassDens the derivatives of the phase mass densities
+   * @param[out] totalMassDens the total mass density
+   * @param[out] dTotalMassDens_dPres the derivative of the total mass density wrt pressure
+   * @param[out] dTotalMassDens_dCompDens the derivatives of the total mass density wrt the component densities
+   */
+  template< integer NC, integer NP >
+  static void
+  launch( arrayView1d< localIndex const > const & batchWellElemRegion,
+          arrayView1d< localIndex const > const & batchWellElemSubRegion,
+          arrayView1d< localIndex const > const & batchWellElemIndex,
+          ElementViewConst< arrayView2d< real64 const, compflow::USD_PHASE > > const & phaseVolFrac,
+          ElementViewConst< arrayView3d< real64 const, compflow::USD_PHASE_DC > > const & dPhaseVolFrac,
+          ElementViewConst< arrayView3d< real64 const, compflow::USD_COMP_DC > > const & dCompFrac_dCompDens,
+          ElementViewConst< arrayView3d< real64 const, constitutive::multifluid::USD_PHASE > > const & phaseMassDens,
+          ElementViewConst< arrayView4d< real64 const, constitutive::multifluid::USD_PHASE_DC > > const & dPhaseMassDens,
+          ElementView< arrayView1d< real64 > > const & totalMassDens,
+          ElementView< arrayView1d< real64 > > const & dTotalMassDens_dPres,
+          ElementView< arrayView2d< real64, compflow::USD_FLUID_DC > > const & dTotalMassDens_dCompDens );
+};
+
+
 /******************************** ResidualNormKernel ********************************/
 
 /**
@@ -677,79 +677,44 @@ void SinglePhaseWell::computePerforationRates( DomainPartition & domain )
                                                                 MeshLevel & mesh,
                                                                 arrayView1d< string const > const & regionNames )
   {
+    ElementRegionManager & elemManager = mesh.getElemManager();
 
     // TODO: change the way we access the flowSolver here
     SinglePhaseBase const & flowSolver = getParent().getGroup< SinglePhaseBase >( getFlowSolverName() );
-    PerforationKernel::SinglePhaseFlowAccessors resSinglePhaseFlowAccessors( mesh.getElemManager(), flowSolver.getName() );
-    PerforationKernel::SingleFluidAccessors resSingleFluidAccessors( mesh.getElemManager(), flowSolver.getName() );
-
-    mesh.getElemManager().forElementSubRegions< WellElementSubRegion >( regionNames, [&]( localIndex const,
-                                                                                          WellElementSubRegion & subRegion )
-    {
-
-      // get the well data
-      PerforationData * const perforationData = subRegion.getPerforationData();
-
-      // get the degrees of freedom and depth
-      arrayView1d< real64 const > const wellElemGravCoef =
-        subRegion.getField< fields::well::gravityCoefficient >();
-
-      // get well primary variables on well elements
-      arrayView1d< real64 const > const wellElemPressure =
-        subRegion.getField< fields::well::pressure >();
-
-      // get well constitutive data
-      string const & fluidName = subRegion.getReference< string >( viewKeyStruct::fluidNamesString() );
-      SingleFluidBase const & fluid = subRegion.getConstitutiveModel< SingleFluidBase >( fluidName );  arrayView2d< real64 const > const wellElemDensity = fluid.density();
-      arrayView2d< real64 const > const dWellElemDensity_dPres = fluid.dDensity_dPressure();
-      arrayView2d< real64 const > const wellElemViscosity = fluid.viscosity();
-      arrayView2d< real64 const > const dWellElemViscosity_dPres = fluid.dViscosity_dPressure();
-
-      // get well variables on perforations
-      arrayView1d< real64 const > const perfGravCoef =
-        perforationData->getField< fields::well::gravityCoefficient >();
-      arrayView1d< localIndex const > const perfWellElemIndex =
-        perforationData->getField< fields::perforation::wellElementIndex >();
-      arrayView1d< real64 const > const perfTransmissibility =
-        perforationData->getField< fields::perforation::wellTransmissibility >();
-
-      arrayView1d< real64 > const perfRate =
-        perforationData->getField< fields::well::perforationRate >();
-      arrayView2d< real64 > const dPerfRate_dPres =
-        perforationData->getField< fields::well::dPerforationRate_dPres >();
-
-      // get the element region, subregion, index
-      arrayView1d< localIndex const > const resElementRegion =
-        perforationData->getField< fields::perforation::reservoirElementRegion >();
-      arrayView1d< localIndex const > const resElementSubRegion =
-        perforationData->getField< fields::perforation::reservoirElementSubRegion >();
-      arrayView1d< localIndex const > const resElementIndex =
-        perforationData->getField< fields::perforation::reservoirElementIndex >();
-
-      PerforationKernel::launch( perforationData->size(),
-                                 resSinglePhaseFlowAccessors.get( fields::flow::pressure{} ),
-                                 resSingleFluidAccessors.get( fields::singlefluid::density{} ),
-                                 resSingleFluidAccessors.get( fields::singlefluid::dDensity_dPressure{} ),
-                                 resSingleFluidAccessors.get( fields::singlefluid::viscosity{} ),
-                                 resSingleFluidAccessors.get( fields::singlefluid::dViscosity_dPressure{} ),
-                                 wellElemGravCoef,
-                                 wellElemPressure,
-                                 wellElemDensity,
-                                 dWellElemDensity_dPres,
-                                 wellElemViscosity,
-                                 dWellElemViscosity_dPres,
-                                 perfGravCoef,
-                                 perfWellElemIndex,
-                                 perfTransmissibility,
-                                 resElementRegion,
-                                 resElementSubRegion,
-                                 resElementIndex,
-                                 perfRate,
-                                 dPerfRate_dPres );
-    } );
+    PerforationKernel::SinglePhaseFlowAccessors resSinglePhaseFlowAccessors( elemManager, flowSolver.getName() );
+    PerforationKernel::SingleFluidAccessors singleFluidAccessors( elemManager, flowSolver.getName() );
+    PerforationKernel::WellFlowAccessors wellFlowAccessors( elemManager, getName() );
+
+    PerforationKernel::launch( m_batchPerfWellRegion.toViewConst(),
+                               m_batchPerfWellSubRegion.toViewConst(),
+                               m_batchPerfIndex.toViewConst(),
+                               resSinglePhaseFlowAccessors.get( fields::flow::pressure{} ),
+                               singleFluidAccessors.get( fields::singlefluid::density{} ),
+                               singleFluidAccessors.get( fields::singlefluid::dDensity_dPressure{} ),
+                               singleFluidAccessors.get( fields::singlefluid::viscosity{} ),
+                               singleFluidAccessors.get( fields::singlefluid::dViscosity_dPressure{} ),
+                               wellFlowAccessors.get( fields::well::gravityCoefficient{} ),
+                               wellFlowAccessors.get( fields::well::pressure{} ),
+                               m_batchPerfGravCoef.toNestedViewConst(),
+                               m_batchPerfWellElemIndex.toNestedViewConst(),
+                               m_batchPerfTransmissibility.toNestedViewConst(),
+                               m_batchPerfResElementRegion.toNestedViewConst(),
+                               m_batchPerfResElementSubRegion.toNestedViewConst(),
+                               m_batchPerfResElementIndex.toNestedViewConst(),
+                               m_batchPerfRate.toNestedView(),
+                               m_batchDPerfRate_dPres.toNestedView() );
   } );
 }
 
+void SinglePhaseWell::precomputeBatchedAccessors( ElementRegionManager & elemManager,
+                                                  arrayView1d< string const > const & regionNames )
+{
+  m_batchPerfRate =
+    constructPerforationFieldAccessor< fields::well::perforationRate >( elemManager, regionNames );
+  m_batchDPerfRate_dPres =
+    constructPerforationFieldAccessor< fields::well::dPerforationRate_dPres >( elemManager, regionNames );
+}
+
 
 real64
 SinglePhaseWell::calculateResidualNorm( real64 const & time_n,
@@ -260,6 +260,9 @@ protected:
                    real64 const & dt,
                    DomainPartition & domain ) override;
 
+  virtual void precomputeBatchedAccessors( ElementRegionManager & elemManager,
+                                           arrayView1d< string const > const & regionNames ) override;
+
 private:
 
   /**
@@ -278,6 +281,12 @@ private:
                                         real64 const & dt,
                                         WellElementSubRegion const & subRegion ) override;
 
+  /// Rate of the perforations of all the wells
+  ElementRegionManager::ElementViewAccessor< arrayView1d< real64 > > m_batchPerfRate;
+
+  /// Derivatives of the rate of the perforations of all the wells with respect to pressure
+  ElementRegionManager::ElementViewAccessor< arrayView2d< real64 > > m_batchDPerfRate_dPres;
+
 };
 
 } // namespace geos
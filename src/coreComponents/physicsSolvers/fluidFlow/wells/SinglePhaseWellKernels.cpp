@@ -460,54 +460,57 @@ PerforationKernel::
 
 void
 PerforationKernel::
-  launch( localIndex const size,
+  launch( arrayView1d< localIndex const > const & batchPerfWellRegion,
+          arrayView1d< localIndex const > const & batchPerfWellSubRegion,
+          arrayView1d< localIndex const > const & batchPerfIndex,
           ElementViewConst< arrayView1d< real64 const > > const & resPressure,
-          ElementViewConst< arrayView2d< real64 const > > const & resDensity,
-          ElementViewConst< arrayView2d< real64 const > > const & dResDensity_dPres,
-          ElementViewConst< arrayView2d< real64 const > > const & resViscosity,
-          ElementViewConst< arrayView2d< real64 const > > const & dResViscosity_dPres,
-          arrayView1d< real64 const > const & wellElemGravCoef,
-          arrayView1d< real64 const > const & wellElemPressure,
-          arrayView2d< real64 const > const & wellElemDensity,
-          arrayView2d< real64 const > const & dWellElemDensity_dPres,
-          arrayView2d< real64 const > const & wellElemViscosity,
-          arrayView2d< real64 const > const & dWellElemViscosity_dPres,
-          arrayView1d< real64 const > const & perfGravCoef,
-          arrayView1d< localIndex const > const & perfWellElemIndex,
-          arrayView1d< real64 const > const & perfTransmissibility,
-          arrayView1d< localIndex const > const & resElementRegion,
-          arrayView1d< localIndex const > const & resElementSubRegion,
-          arrayView1d< localIndex const > const & resElementIndex,
-          arrayView1d< real64 > const & perfRate,
-          arrayView2d< real64 > const & dPerfRate_dPres )
+          ElementViewConst< arrayView2d< real64 const > > const & density,
+          ElementViewConst< arrayView2d< real64 const > > const & dDensity_dPres,
+          ElementViewConst< arrayView2d< real64 const > > const & viscosity,
+          ElementViewConst< arrayView2d< real64 const > > const & dViscosity_dPres,
+          ElementViewConst< arrayView1d< real64 const > > const & wellElemGravCoef,
+          ElementViewConst< arrayView1d< real64 const > > const & wellElemPressure,
+          ElementViewConst< arrayView1d< real64 const > > const & perfGravCoef,
+          ElementViewConst< arrayView1d< localIndex const > > const & perfWellElemIndex,
+          ElementViewConst< arrayView1d< real64 const > > const & perfTransmissibility,
+          ElementViewConst< arrayView1d< localIndex const > > const & resElementRegion,
+          ElementViewConst< arrayView1d< localIndex const > > const & resElementSubRegion,
+          ElementViewConst< arrayView1d< localIndex const > > const & resElementIndex,
+          ElementView< arrayView1d< real64 > > const & perfRate,
+          ElementView< arrayView2d< real64 > > const & dPerfRate_dPres )
 {
 
-  forAll< parallelDevicePolicy<> >( size, [=] GEOS_HOST_DEVICE ( localIndex const iperf )
+  forAll< parallelDevicePolicy<> >( batchPerfIndex.size(), [=] GEOS_HOST_DEVICE ( localIndex const ibperf )
   {
 
+    // get the well (sub)region and the perforation index in this well
+    localIndex const wr  = batchPerfWellRegion[ibperf];
+    localIndex const wsr = batchPerfWellSubRegion[ibperf];
+    localIndex const iperf = batchPerfIndex[ibperf];
+
     // get the reservoir (sub)region and element indices
-    localIndex const er  = resElementRegion[iperf];
-    localIndex const esr = resElementSubRegion[iperf];
-    localIndex const ei  = resElementIndex[iperf];
+    localIndex const er  = resElementRegion[wr][wsr][iperf];
+    localIndex const esr = resElementSubRegion[wr][wsr][iperf];
+    localIndex const ei  = resElementIndex[wr][wsr][iperf];
 
     // get the local index of the well element
-    localIndex const iwelem = perfWellElemIndex[iperf];
+    localIndex const iwelem = perfWellElemIndex[wr][wsr][iperf];
 
     compute( resPressure[er][esr][ei],
-             resDensity[er][esr][ei][0],
-             dResDensity_dPres[er][esr][ei][0],
-             resViscosity[er][esr][ei][0],
-             dResViscosity_dPres[er][esr][ei][0],
-             wellElemGravCoef[iwelem],
-             wellElemPressure[iwelem],
-             wellElemDensity[iwelem][0],
-             dWellElemDensity_dPres[iwelem][0],
-             wellElemViscosity[iwelem][0],
-             dWellElemViscosity_dPres[iwelem][0],
-             perfGravCoef[iperf],
-             perfTransmissibility[iperf],
-             perfRate[iperf],
-             dPerfRate_dPres[iperf] );
+             density[er][esr][ei][0],
+             dDensity_dPres[er][esr][ei][0],
+             viscosity[er][esr][ei][0],
+             dViscosity_dPres[er][esr][ei][0],
+             wellElemGravCoef[wr][wsr][iwelem],
+             wellElemPressure[wr][wsr][iwelem],
+             density[wr][wsr][iwelem][0],
+             dDensity_dPres[wr][wsr][iwelem][0],
+             viscosity[wr][wsr][iwelem][0],
+             dViscosity_dPres[wr][wsr][iwelem][0],
+             perfGravCoef[wr][wsr][iperf],
+             perfTransmissibility[wr][wsr][iperf],
+             perfRate[wr][wsr][iperf],
+             dPerfRate_dPres[wr][wsr][iperf] );
 
 
   } );
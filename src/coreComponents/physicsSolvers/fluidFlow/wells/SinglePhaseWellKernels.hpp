@@ -28,6 +28,7 @@
 #include "physicsSolvers/fluidFlow/FlowSolverBaseFields.hpp"
 #include "physicsSolvers/fluidFlow/StencilAccessors.hpp"
 #include "physicsSolvers/fluidFlow/wells/WellControls.hpp"
+#include "physicsSolvers/fluidFlow/wells/WellSolverBaseFields.hpp"
 #include "physicsSolvers/SolverBaseKernels.hpp"
 
 namespace geos
@@ -175,6 +176,10 @@ struct PerforationKernel
                               fields::singlefluid::viscosity,
                               fields::singlefluid::dViscosity_dPressure >;
 
+  using WellFlowAccessors =
+    StencilAccessors< fields::well::pressure,
+                      fields::well::gravityCoefficient >;
+
   /**
    * @brief The type for element-based non-constitutive data parameters.
    * Consists entirely of ArrayView's.
@@ -185,6 +190,12 @@ struct PerforationKernel
   template< typename VIEWTYPE >
   using ElementViewConst = ElementRegionManager::ElementViewConst< VIEWTYPE >;
 
+  /**
+   * @brief The type for element-based non-constitutive data parameters that are written by the kernel.
+   */
+  template< typename VIEWTYPE >
+  using ElementView = ElementRegionManager::ElementView< VIEWTYPE >;
+
   GEOS_HOST_DEVICE
   inline
   static
@@ -205,27 +216,34 @@ struct PerforationKernel
            real64 & perfRate,
            arraySlice1d< real64 > const & dPerfRate_dPres );
 
+  /**
+   * @brief Compute the rates of the perforations of all the local wells in a single launch
+   * @param[in] batchPerfWellRegion well element region index of each batched perforation
+   * @param[in] batchPerfWellSubRegion well element subregion index of each batched perforation
+   * @param[in] batchPerfIndex index of each batched perforation in the perforation data of its well
+   *
+   * The fluid accessors index both the reservoir and the well element subregions, the perforation
+   * accessors are indexed by the well element region and subregion.
+   */
   static void
-  launch( localIndex const size,
+  launch( arrayView1d< localIndex const > const & batchPerfWellRegion,
+          arrayView1d< localIndex const > const & batchPerfWellSubRegion,
+          arrayView1d< localIndex const > const & batchPerfIndex,
           ElementViewConst< arrayView1d< real64 const > > const & resPressure,
-          ElementViewConst< arrayView2d< real64 const > > const & resDensity,
-          ElementViewConst< arrayView2d< real64 const > > const & dResDensity_dPres,
-          ElementViewConst< arrayView2d< real64 const > > const & resViscosity,
-          ElementViewConst< arrayView2d< real64 const > > const & dResViscosity_dPres,
-          arrayView1d< real64 const > const & wellElemGravCoef,
-          arrayView1d< real64 const > const & wellElemPressure,
-          arrayView2d< real64 const > const & wellElemDensity,
-          arrayView2d< real64 const > const & dWellElemDensity_dPres,
-          arrayView2d< real64 const > const & wellElemViscosity,
-          arrayView2d< real64 const > const & dWellElemViscosity_dPres,
-          arrayView1d< real64 const > const & perfGravCoef,
-          arrayView1d< localIndex const > const & perfWellElemIndex,
-          arrayView1d< real64 const > const & perfTransmissibility,
-          arrayView1d< localIndex const > const & resElementRegion,
-          arrayView1d< localIndex const > const & resElementSubRegion,
-          arrayView1d< localIndex const > const & resElementIndex,
-          arrayView1d< real64 > const & perfRate,
-          arrayView2d< real64 > const & dPerfRate_dPres );
+          ElementViewConst< arrayView2d< real64 const > > const & density,
+          ElementViewConst< arrayView2d< real64 const > > const & dDensity_dPres,
+          ElementViewConst< arrayView2d< real64 const > > const & viscosity,
+          ElementViewConst< arrayView2d< real64 const > > const & dViscosity_dPres,
+          ElementViewConst< arrayView1d< real64 const > > const & wellElemGravCoef,
+          ElementViewConst< arrayView1d< real64 const > > const & wellElemPressure,
+          ElementViewConst< arrayView1d< real64 const > > const & perfGravCoef,
+          ElementViewConst< arrayView1d< localIndex const > > const & perfWellElemIndex,
+          ElementViewConst< arrayView1d< real64 const > > const & perfTransmissibility,
+          ElementViewConst< arrayView1d< localIndex const > > const & resElementRegion,
+          ElementViewConst< arrayView1d< localIndex const > > const & resElementSubRegion,
+          ElementViewConst< arrayView1d< localIndex const > > const & resElementIndex,
+          ElementView< arrayView1d< real64 > > const & perfRate,
+          ElementView< arrayView2d< real64 > > const & dPerfRate_dPres );
 
 };
 
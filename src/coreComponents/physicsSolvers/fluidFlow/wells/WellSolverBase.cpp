@@ -258,12 +258,24 @@ void WellSolverBase::initializePostInitialConditionsPreSubGroups()
 void WellSolverBase::precomputeData( DomainPartition & domain )
 {
   R1Tensor const gravVector = gravityVector();
+
+  m_batchPerfWellRegion.clear();
+  m_batchPerfWellSubRegion.clear();
+  m_batchPerfIndex.clear();
+  m_batchWellElemRegion.clear();
+  m_batchWellElemSubRegion.clear();
+  m_batchWellElemIndex.clear();
+
+  integer numMeshTargets = 0;
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
                                                                 MeshLevel & mesh,
                                                                 arrayView1d< string const > const & regionNames )
   {
-    mesh.getElemManager().forElementSubRegions< WellElementSubRegion >( regionNames, [&]( localIndex const,
-                                                                                          WellElementSubRegion & subRegion )
+    mesh.getElemManager().forElementSubRegionsComplete< WellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                                  localIndex const er,
+                                                                                                  localIndex const esr,
+                                                                                                  ElementRegionBase &,
+                                                                                                  WellElementSubRegion & subRegion )
     {
       PerforationData & perforationData = *subRegion.getPerforationData();
       WellControls & wellControls = getWellControls( subRegion );
@@ -275,13 +287,13 @@ void WellSolverBase::precomputeData( DomainPartition & domain )
       arrayView2d< real64 const > const perfLocation = perforationData.getField< fields::perforation::location >();
       arrayView1d< real64 > const perfGravCoef = perforationData.getField< fields::well::gravityCoefficient >();
 
-      forAll< serialPolicy >( perforationData.size(), [=]( localIndex const iperf )
+      forAll< parallelDevicePolicy<> >( perforationData.size(), [=] GEOS_HOST_DEVICE ( localIndex const iperf )
       {
         // precompute the depth of the perforations
         perfGravCoef[iperf] = LvArray::tensorOps::AiBi< 3 >( perfLocation[iperf], gravVector );
       } );
 
-      forAll< serialPolicy >( subRegion.size(), [=]( localIndex const iwelem )
+      forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOS_HOST_DEVICE ( localIndex const iwelem )
       {
         // precompute the depth of the well elements
         wellElemGravCoef[iwelem] = LvArray::tensorOps::AiBi< 3 >( wellElemLocation[iwelem], gravVector );
@@ -290,7 +302,42 @@ void WellSolverBase::precomputeData( DomainPartition & domain )
       // set the reference well element where the BHP control is applied
       wellControls.setReferenceGravityCoef( refElev * gravVector[ 2 ] );
 
+      // append the perforations of this well to the batched layout, so that perforation kernels cover all the wells in one launch
+      for( localIndex iperf = 0; iperf < perforationData.size(); ++iperf )
+      {
+        m_batchPerfWellRegion.emplace_back( er );
+        m_batchPerfWellSubRegion.emplace_back( esr );
+        m_batchPerfIndex.emplace_back( iperf );
+      }
+      for( localIndex iwelem = 0; iwelem < subRegion.size(); ++iwelem )
+      {
+        m_batchWellElemRegion.emplace_back( er );
+        m_batchWellElemSubRegion.emplace_back( esr );
+        m_batchWellElemIndex.emplace_back( iwelem );
+      }
+
     } );
+
+    // the batched layouts and accessors are indexed by region and subregion of a single mesh level
+    ++numMeshTargets;
+    GEOS_ERROR_IF( numMeshTargets > 1,
+                   getDataContext() << ": the well solvers only support a single mesh target" );
+
+    ElementRegionManager & elemManager = mesh.getElemManager();
+    m_batchPerfGravCoef =
+      constructPerforationFieldAccessor< fields::well::gravityCoefficient >( elemManager, regionNames );
+    m_batchPerfWellElemIndex =
+      constructPerforationFieldAccessor< fields::perforation::wellElementIndex >( elemManager, regionNames );
+    m_batchPerfTransmissibility =
+      constructPerforationFieldAccessor< fields::perforation::wellTransmissibility >( elemManager, regionNames );
+    m_batchPerfResElementRegion =
+      constructPerforationFieldAccessor< fields::perforation::reservoirElementRegion >( elemManager, regionNames );
+    m_batchPerfResElementSubRegion =
+      constructPerforationFieldAccessor< fields::perforation::reservoirElementSubRegion >( elemManager, regionNames );
+    m_batchPerfResElementIndex =
+      constructPerforationFieldAccessor< fields::perforation::reservoirElementIndex >( elemManager, regionNames );
+
+    precomputeBatchedAccessors( elemManager, regionNames );
   } );
 }
 
@@ -20,6 +20,7 @@
 #ifndef GEOS_PHYSICSSOLVERS_FLUIDFLOW_WELLS_WELLSOLVERBASE_HPP_
 #define GEOS_PHYSICSSOLVERS_FLUIDFLOW_WELLS_WELLSOLVERBASE_HPP_
 
+#include "mesh/ElementRegionManager.hpp"
 #include "physicsSolvers/SolverBase.hpp"
 
 namespace geos
@@ -316,6 +317,41 @@ protected:
                            real64 const & dt,
                            DomainPartition & domain ) = 0;
 
+  /**
+   * @brief Construct an accessor to a perforation field of all the target wells
+   * @tparam FIELD_TRAIT the perforation field trait
+   * @param elemManager the element region manager containing the wells
+   * @param regionNames the target regions of this solver on the mesh level of @p elemManager
+   * @return the accessor, indexed by well element region and subregion (empty views outside of the target wells)
+   */
+  template< typename FIELD_TRAIT >
+  static ElementRegionManager::ElementViewAccessor< traits::ViewType< typename FIELD_TRAIT::type > >
+  constructPerforationFieldAccessor( ElementRegionManager & elemManager,
+                                     arrayView1d< string const > const & regionNames );
+
+  /**
+   * @brief Construct an accessor to a well element field of all the target wells
+   * @tparam FIELD_TRAIT the well element field trait
+   * @param elemManager the element region manager containing the wells
+   * @param regionNames the target regions of this solver on the mesh level of @p elemManager
+   * @return the accessor, indexed by well element region and subregion (empty views outside of the target wells)
+   */
+  template< typename FIELD_TRAIT >
+  static ElementRegionManager::ElementViewAccessor< traits::ViewType< typename FIELD_TRAIT::type > >
+  constructWellElementFieldAccessor( ElementRegionManager & elemManager,
+                                     arrayView1d< string const > const & regionNames );
+
+  /**
+   * @brief Cache the solver-specific accessors used by the batched kernels, once the batched layouts are built
+   * @param elemManager the element region manager containing the wells
+   * @param regionNames the target regions of this solver on the mesh level of @p elemManager
+   */
+  virtual void precomputeBatchedAccessors( ElementRegionManager & elemManager,
+                                           arrayView1d< string const > const & regionNames )
+  {
+    GEOS_UNUSED_VAR( elemManager, regionNames );
+  }
+
   /// name of the flow solver
   string m_flowSolverName;
 
@@ -328,8 +364,95 @@ protected:
   integer m_writeCSV;
   string const m_ratesOutputDir;
 
+  // Batched layouts, built in precomputeData over the target well subregions of the (single) mesh target.
+  // The kernels that loop over them cover all the local wells in one launch; the accessors below are
+  // indexed by well element region and subregion, and are cached since the well fields are not resized
+  // after initialization.
+
+  /// Well element region index of the perforations of all the local wells, concatenated well by well
+  array1d< localIndex > m_batchPerfWellRegion;
+
+  /// Well element subregion index of the perforations of all the local wells, concatenated well by well
+  array1d< localIndex > m_batchPerfWellSubRegion;
+
+  /// Index of the perforations of all the local wells in the perforation data of their well
+  array1d< localIndex > m_batchPerfIndex;
+
+  /// Well element region index of the well elements of all the local wells, concatenated well by well
+  array1d< localIndex > m_batchWellElemRegion;
+
+  /// Well element subregion index of the well elements of all the local wells, concatenated well by well
+  array1d< localIndex > m_batchWellElemSubRegion;
+
+  /// Index of the well elements of all the local wells in their well element subregion
+  array1d< localIndex > m_batchWellElemIndex;
+
+  /// Gravity coefficient of the perforations of all the wells
+  ElementRegionManager::ElementViewAccessor< arrayView1d< real64 > > m_batchPerfGravCoef;
+
+  /// Well element index of the perforations of all the wells
+  ElementRegionManager::ElementViewAccessor< arrayView1d< localIndex > > m_batchPerfWellElemIndex;
+
+  /// Transmissibility of the perforations of all the wells
+  ElementRegionManager::ElementViewAccessor< arrayView1d< real64 > > m_batchPerfTransmissibility;
+
+  /// Reservoir element region index of the perforations of all the wells
+  ElementRegionManager::ElementViewAccessor< arrayView1d< localIndex > > m_batchPerfResElementRegion;
+
+  /// Reservoir element subregion index of the perforations of all the wells
+  ElementRegionManager::ElementViewAccessor< arrayView1d< localIndex > > m_batchPerfResElementSubRegion;
+
+  /// Reservoir element index of the perforations of all the wells
+  ElementRegionManager::ElementViewAccessor< arrayView1d< localIndex > > m_batchPerfResElementIndex;
+
 };
 
+template< typename FIELD_TRAIT >
+ElementRegionManager::ElementViewAccessor< traits::ViewType< typename FIELD_TRAIT::type > >
+WellSolverBase::constructPerforationFieldAccessor( ElementRegionManager & elemManager,
+                                                   arrayView1d< string const > const & regionNames )
+{
+  ElementRegionManager::ElementViewAccessor< traits::ViewType< typename FIELD_TRAIT::type > > accessor;
+  accessor.resize( elemManager.numRegions() );
+  for( localIndex er = 0; er < elemManager.numRegions(); ++er )
+  {
+    accessor[er].resize( elemManager.getRegion( er ).numSubRegions() );
+  }
+
+  elemManager.forElementSubRegionsComplete< WellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                      localIndex const er,
+                                                                                      localIndex const esr,
+                                                                                      ElementRegionBase &,
+                                                                                      WellElementSubRegion & subRegion )
+  {
+    accessor[er][esr] = subRegion.getPerforationData()->getField< FIELD_TRAIT >().toView();
+  } );
+  return accessor;
+}
+
+template< typename FIELD_TRAIT >
+ElementRegionManager::ElementViewAccessor< traits::ViewType< typename FIELD_TRAIT::type > >
+WellSolverBase::constructWellElementFieldAccessor( ElementRegionManager & elemManager,
+                                                   arrayView1d< string const > const & regionNames )
+{
+  ElementRegionManager::ElementViewAccessor< traits::ViewType< typename FIELD_TRAIT::type > > accessor;
+  accessor.resize( elemManager.numRegions() );
+  for( localIndex er = 0; er < elemManager.numRegions(); ++er )
+  {
+    accessor[er].resize( elemManager.getRegion( er ).numSubRegions() );
+  }
+
+  elemManager.forElementSubRegionsComplete< WellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                      localIndex const er,
+                                                                                      localIndex const esr,
+                                                                                      ElementRegionBase &,
+                                                                                      WellElementSubRegion & subRegion )
+  {
+    accessor[er][esr] = subRegion.getField< FIELD_TRAIT >().toView();
+  } );
+  return accessor;
+}
+
 }
 
 #endif //GEOS_PHYSICSSOLVERS_FLUIDFLOW_WELLS_WELLSOLVERBASE_HPP_
@@ -327,7 +327,7 @@ computeFluidIncrement( localIndex const k,
     const phaseCompFrac = m_fluidPhaseCompFrac[k][q];
     arraySlice2d< real64 const, constitutive::multifluid::USD_PHASE_COMP - 2 >
     const phaseCompFrac_n = m_fluidPhaseCompFrac_n[k][q];
-    arraySlice3d< real64 const, constitutive::multifluid::USD_PHASE_COMP_DC - 2 >
+    constitutive::multifluid::PhaseCompDerivsSlice
     const dPhaseCompFrac = m_dFluidPhaseCompFrac[k][q];
     arraySlice1d< real64 const, compflow::USD_PHASE - 1 >
     const phaseVolFrac = m_fluidPhaseVolFrac[k];
@@ -24,6 +24,7 @@
 #include "kernels/ExplicitFiniteStrain.hpp"
 
 #include "chrono"
+#include "numeric"
 #include "thread"
 
 #include "codingUtilities/Utilities.hpp"
@@ -72,7 +73,9 @@ SolidMechanicsMPM::SolidMechanicsMPM( const string & name,
   m_reactionHistory( 0 ),
   m_needsNeighborList( 0 ),
   m_neighborRadius( -1.0 ),
+  m_neighborListSkin( 0.0 ),
   m_binSizeMultiplier( 1 ),
+  m_particleSortInterval( 0 ),
   m_cpdiDomainScaling( 0 ),
   m_smallMass( DBL_MAX ),
   m_numContactGroups(),
@@ -87,6 +90,7 @@ SolidMechanicsMPM::SolidMechanicsMPM( const string & name,
   m_frictionCoefficient( 0.0 ),
   m_planeStrain( 0 ),
   m_numDims( 3 ),
+  m_deterministicScatter( 0 ),
   m_ijkMap()
 {
   registerWrapper( "solverProfiling", &m_solverProfiling ).
@@ -148,11 +152,24 @@ SolidMechanicsMPM::SolidMechanicsMPM( const string & name,
     setApplyDefaultValue( -1.0 ).
     setDescription( "Neighbor radius for SPH-type calculations" );
 
+  registerWrapper( "neighborListSkin", &m_neighborListSkin ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0.0 ).
+    setDescription( "Verlet skin added to the neighbor radius when building the neighbor list, which is then only rebuilt once a particle "
+                    "has moved by more than half the skin or the particles have changed. Only used on a single partition, "
+                    "0 rebuilds the neighbor list every step" );
+
   registerWrapper( "binSizeMultiplier", &m_binSizeMultiplier ).
     setInputFlag( InputFlags::FALSE ).
     setApplyDefaultValue( 1 ).
     setDescription( "Multiplier for setting bin size, used to speed up particle neighbor sorting" );
 
+  registerWrapper( "particleSortInterval", &m_particleSortInterval ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Number of cycles between reorderings of the particle arrays along a Morton curve through the background grid cells, "
+                    "which keeps particles that are close in space close in memory. 0 never reorders the particles" );
+
   registerWrapper( "useDamageAsSurfaceFlag", &m_useDamageAsSurfaceFlag ).
     setInputFlag( InputFlags::OPTIONAL ).
     setApplyDefaultValue( 0 ).
@@ -220,6 +237,12 @@ SolidMechanicsMPM::SolidMechanicsMPM( const string & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Flag for performing plane strain calculations" );
 
+  registerWrapper( "deterministicScatter", &m_deterministicScatter ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag for running the particle-to-grid scatters serially. The parallel scatters accumulate on the grid nodes with atomics, "
+                    "in an order that changes from a run to the next, so that the results are only reproducible up to round-off" );
+
   registerWrapper( "numDims", &m_numDims ).
     setApplyDefaultValue( 3 ).
     setInputFlag( InputFlags::FALSE ).
@@ -952,6 +975,15 @@ real64 SolidMechanicsMPM::explicitStep( real64 const & time_n,
   }
 
 
+  //#######################################################################################
+  solverProfilingIf( "Sort particles by background grid cell", m_particleSortInterval > 0 && cycleNumber % m_particleSortInterval == 0 );
+  //#######################################################################################
+  if( m_particleSortInterval > 0 && cycleNumber % m_particleSortInterval == 0 )
+  {
+    sortParticles( particleManager );
+  }
+
+
   //#######################################################################################
   solverProfiling( "Set grid multi-field labels to avoid a VTK output bug" );
   //#######################################################################################
@@ -1014,7 +1046,10 @@ real64 SolidMechanicsMPM::explicitStep( real64 const & time_n,
     // }
     // else
     // {
-    (void) computeNeighborList( particleManager );
+    if( neighborListNeedsRebuild( particleManager ) )
+    {
+      (void) computeNeighborList( particleManager );
+    }
     // }
   }
 
@@ -1532,7 +1567,7 @@ void SolidMechanicsMPM::computeGridSurfaceNormals( ParticleManager & particleMan
     int const numDims = m_numDims;
     int const damageFieldPartitioning = m_damageFieldPartitioning;
     int const numContactGroups = m_numContactGroups;
-    forAll< serialPolicy >( activeParticleIndices.size(), [=] GEOS_HOST ( localIndex const pp ) // Can parallelize with atomics
+    forParticlesScatter( activeParticleIndices.size(), [=] GEOS_HOST ( localIndex const pp )
       {
         localIndex const p = activeParticleIndices[pp];
 
@@ -1545,7 +1580,7 @@ void SolidMechanicsMPM::computeGridSurfaceNormals( ParticleManager & particleMan
           int const fieldIndex = nodeFlag * numContactGroups + particleGroup[p]; // This ranges from 0 to nMatFields-1
           for( int i=0; i<numDims; i++ )
           {
-            gridSurfaceNormal[mappedNode][fieldIndex][i] += shapeFunctionGradientValues[pp][g][i] * particleVolume[p];
+            RAJA::atomicAdd< ATOMIC_POLICY >( &gridSurfaceNormal[mappedNode][fieldIndex][i], shapeFunctionGradientValues[pp][g][i] * particleVolume[p] );
           }
         }
       } ); // particle loop
@@ -1562,7 +1597,7 @@ void SolidMechanicsMPM::normalizeGridSurfaceNormals( arrayView2d< real64 const >
   int const numVelocityFields = m_numVelocityFields;
   real64 const smallMass = m_smallMass;
   int const planeStrain = m_planeStrain;
-  forAll< serialPolicy >( numNodes, [=] GEOS_HOST_DEVICE ( localIndex const g )
+  forAll< EXEC_POLICY >( numNodes, [=] GEOS_HOST_DEVICE ( localIndex const g )
   {
     for( localIndex fieldIndex = 0; fieldIndex < numVelocityFields; fieldIndex++ )
     {
@@ -1604,7 +1639,7 @@ void SolidMechanicsMPM::computeContactForces( real64 const dt,
   // Get number of nodes
   int numNodes = gridMass.size( 0 );
 
-  forAll< serialPolicy >( numNodes, [&, gridMass, gridVelocity, gridMomentum, gridSurfaceNormal, gridMaterialPosition, gridContactForce] GEOS_HOST ( localIndex const g )
+  forAll< EXEC_POLICY >( numNodes, [&, gridMass, gridVelocity, gridMomentum, gridSurfaceNormal, gridMaterialPosition, gridContactForce] GEOS_HOST ( localIndex const g )
     {
       // Initialize gridContactForce[g] to zero. TODO: This shouldn't be necessary?
       for( int fieldIndex = 0; fieldIndex < m_numVelocityFields; fieldIndex++ )
@@ -1939,7 +1974,7 @@ void SolidMechanicsMPM::resizeGrid( SpatialPartition & partition,
 
   // Update nodal positions
   arrayView2d< real64, nodes::REFERENCE_POSITION_USD > const gridPosition = nodeManager.referencePosition();
-  forAll< serialPolicy >( gridPosition.size( 0 ), [=] GEOS_HOST_DEVICE ( localIndex const g )
+  forAll< EXEC_POLICY >( gridPosition.size( 0 ), [=] GEOS_HOST_DEVICE ( localIndex const g )
   {
     gridPosition[g][0] *= ratio[0];
     gridPosition[g][1] *= ratio[1];
@@ -1983,79 +2018,77 @@ real64 SolidMechanicsMPM::computeNeighborList( ParticleManager & particleManager
   // Time this function
   real64 tStart = MPI_Wtime();
 
-  // Expand bin limits by neighbor radius to account for the buffer zone of ghost particles outside the patch limits
-  real64 neighborRadiusSquared = m_neighborRadius * m_neighborRadius;
-  real64 xmin = m_xLocalMinNoGhost[0] - m_neighborRadius,
-         xmax = m_xLocalMaxNoGhost[0] + m_neighborRadius,
-         ymin = m_xLocalMinNoGhost[1] - m_neighborRadius,
-         ymax = m_xLocalMaxNoGhost[1] + m_neighborRadius,
-         zmin = m_xLocalMinNoGhost[2] - m_neighborRadius,
-         zmax = m_xLocalMaxNoGhost[2] + m_neighborRadius;
+  // Particles within the skin are kept in the list so that it remains valid while they move by less than half of it
+  real64 const searchRadius = m_neighborRadius + m_neighborListSkin;
+  real64 const searchRadiusSquared = searchRadius * searchRadius;
+
+  // Expand bin limits by search radius to account for the buffer zone of ghost particles outside the patch limits
+  real64 const xmin = m_xLocalMinNoGhost[0] - searchRadius,
+               xmax = m_xLocalMaxNoGhost[0] + searchRadius,
+               ymin = m_xLocalMinNoGhost[1] - searchRadius,
+               ymax = m_xLocalMaxNoGhost[1] + searchRadius,
+               zmin = m_xLocalMinNoGhost[2] - searchRadius,
+               zmax = m_xLocalMaxNoGhost[2] + searchRadius;
 
   // Initialize bin sort
-  real64 binWidth = m_binSizeMultiplier * m_neighborRadius;
-  int nxbins = std::ceil( ( xmax - xmin ) / binWidth ),
-      nybins = std::ceil( ( ymax - ymin ) / binWidth ),
-      nzbins = m_planeStrain ? 1 : std::ceil( ( zmax - zmin ) / binWidth );
-  int nbins = nxbins * nybins * nzbins;
-  real64 dx = ( xmax - xmin ) / nxbins,
-         dy = ( ymax - ymin ) / nybins,
-         dz = ( zmax - zmin ) / nzbins;
-
-  // Declare bin key and bins data structure
-  BinKey binKey;
-  std::unordered_map< BinKey, std::vector< localIndex >, BinKeyHash > bins;
-
-  // Reverse entries in bins based on even distribution of particles in partition - OPTIONAL
-  particleManager.forParticleRegions< ParticleRegion >( [&]( ParticleRegion & region ) // idk why this requires a template argument and the
-                                                                                       // subregion loops don't
+  real64 const binWidth = m_binSizeMultiplier * searchRadius;
+  int const nxbins = std::ceil( ( xmax - xmin ) / binWidth ),
+            nybins = std::ceil( ( ymax - ymin ) / binWidth ),
+            nzbins = m_planeStrain ? 1 : std::ceil( ( zmax - zmin ) / binWidth );
+  localIndex const nbins = localIndex( nxbins ) * nybins * nzbins;
+  real64 const dx = ( xmax - xmin ) / nxbins,
+               dy = ( ymax - ymin ) / nybins,
+               dz = ( zmax - zmin ) / nzbins;
+
+  // Bin ijk index of a coordinate, clamped to the bin grid
+  auto const binIndex = [=]( real64 const x, real64 const xLow, real64 const h, int const n )
   {
-    binKey.regionIndex = region.getIndexInParent();
-    region.forParticleSubRegions( [&]( ParticleSubRegion & subRegion )
-    {
-      binKey.subRegionIndex = subRegion.getIndexInParent();
-      int numReserved = std::ceil( subRegion.size() / nbins );
+    return LvArray::math::min( LvArray::math::max( static_cast< int >( std::floor( ( x - xLow ) / h ) ), 0 ), n - 1 );
+  };
 
-      // Loop over bins
-      for( int i=0; i<nxbins; i++ )
-      {
-        for( int j=0; j<nybins; j++ )
-        {
-          for( int k=0; k<nzbins; k++ )
-          {
-            binKey.binIndex = i + j * nxbins + k * nxbins * nybins;
-            bins[binKey].reserve( numReserved );
-          }
-        }
-      }
-    } );
-  } );
+  // Cell list of each subregion: the particles of each bin, stored contiguously (CSR) by a counting sort
+  struct SubRegionBins
+  {
+    localIndex regionIndex;
+    localIndex subRegionIndex;
+    arrayView2d< real64 const > position;
+    ArrayOfArrays< localIndex > bins;
+  };
+  std::vector< SubRegionBins > subRegionBins;
 
-  // Populate bins with local particle indices
   particleManager.forParticleRegions< ParticleRegion >( [&]( ParticleRegion & region ) // idk why this requires a template argument and the
                                                                                        // subregion loops don't
   {
-    binKey.regionIndex = region.getIndexInParent();
     region.forParticleSubRegions( [&]( ParticleSubRegion & subRegion )
     {
-      binKey.subRegionIndex = subRegion.getIndexInParent();
       arrayView2d< real64 const > const particlePosition = subRegion.getParticleCenter();
-      forAll< serialPolicy >( subRegion.size(), [&, particlePosition] GEOS_HOST ( localIndex const p ) // host only because of bin data
-                                                                                                       // structure, need atomics in
-                                                                                                       // parallel since multiple particles
-                                                                                                       // can write to the same bin
-        {
-          // Particle bin ijk indices
-          int i, j, k;
-          i = std::floor( ( particlePosition[p][0] - xmin ) / dx ),
-          j = std::floor( ( particlePosition[p][1] - ymin ) / dy ),
-          k = std::floor( ( particlePosition[p][2] - zmin ) / dz );
+      array1d< localIndex > particleBin( subRegion.size() );
+      array1d< localIndex > binCounts( nbins );
+      arrayView1d< localIndex > const particleBinView = particleBin.toView();
+      arrayView1d< localIndex > const binCountsView = binCounts.toView();
 
-          // Bin number
-          binKey.binIndex = i + j * nxbins + k * nxbins * nybins;
+      // First pass: bin of each particle and number of particles in each bin
+      forAll< EXEC_POLICY >( subRegion.size(), [=] GEOS_HOST ( localIndex const p )
+        {
+          int const i = binIndex( particlePosition[p][0], xmin, dx, nxbins ),
+                    j = binIndex( particlePosition[p][1], ymin, dy, nybins ),
+                    k = binIndex( particlePosition[p][2], zmin, dz, nzbins );
+          particleBinView[p] = i + j * nxbins + k * nxbins * nybins;
+          RAJA::atomicAdd< ATOMIC_POLICY >( &binCountsView[particleBinView[p]], localIndex( 1 ) );
+        } );
 
-          // Add particle to bin
-          bins[binKey].push_back( p );
+      // Second pass: fill the bins, then restore the particle order within each bin to keep the neighbor lists deterministic
+      subRegionBins.push_back( { region.getIndexInParent(), subRegion.getIndexInParent(), particlePosition, ArrayOfArrays< localIndex >() } );
+      ArrayOfArrays< localIndex > & bins = subRegionBins.back().bins;
+      bins.resizeFromCapacities< parallelHostPolicy >( nbins, binCounts.data() );
+      ArrayOfArraysView< localIndex > const binsView = bins.toView();
+      forAll< EXEC_POLICY >( subRegion.size(), [=] GEOS_HOST ( localIndex const p )
+        {
+          binsView.emplaceBackAtomic< ATOMIC_POLICY >( particleBinView[p], p );
+        } );
+      forAll< EXEC_POLICY >( nbins, [=] GEOS_HOST ( localIndex const b )
+        {
+          std::sort( binsView[b].begin(), binsView[b].end() );
         } );
     } );
   } );
@@ -2063,99 +2096,209 @@ real64 SolidMechanicsMPM::computeNeighborList( ParticleManager & particleManager
   // Perform neighbor search over appropriate bins
   particleManager.forParticleSubRegions( [&]( ParticleSubRegion & subRegionA )
   {
-    // Get and initialize neighbor list
-    OrderedVariableToManyParticleRelation & neighborList = subRegionA.neighborList();
-    neighborList.resize( 0, 0 ); // Clear the existing neighbor list
-    neighborList.resize( subRegionA.size() );
-    int numToReserve = m_planeStrain == 1 ? 25 : 179; // Assuming square/cubic cells, 2 particles per cell in each dimension, and a neighbor
-                                                      // radius equal to the cell diagonal length
-    reserveNeighbors( neighborList, numToReserve );
-
     // Get 'this' particle's location
-    arrayView2d< real64 > const xA = subRegionA.getParticleCenter();
+    arrayView2d< real64 const > const xA = subRegionA.getParticleCenter();
 
-    // Find neighbors of 'this' particle
-    SortedArrayView< localIndex const > const subRegionAActiveParticleIndices = subRegionA.activeParticleIndices();
-    forAll< serialPolicy >( subRegionAActiveParticleIndices.size(), [&, subRegionAActiveParticleIndices, xA] GEOS_HOST ( localIndex const pp )
-      {// host only because of bin data structure and invocation of particleManager; not thread-safe for some reason
-        // Particle A index
-        localIndex a = subRegionAActiveParticleIndices[pp];
-
-        // Bin ijk indices bounding a sphere of radius m_neighborRadius centered at 'this' particle
-        int imin, imax, jmin, jmax, kmin, kmax;
-        imin = std::floor( ( xA[a][0] - m_neighborRadius - xmin ) / dx ),
-        jmin = std::floor( ( xA[a][1] - m_neighborRadius - ymin ) / dy ),
-        kmin = std::floor( ( xA[a][2] - m_neighborRadius - zmin ) / dz );
-        imax = std::floor( ( xA[a][0] + m_neighborRadius - xmin ) / dx ),
-        jmax = std::floor( ( xA[a][1] + m_neighborRadius - ymin ) / dy ),
-        kmax = std::floor( ( xA[a][2] + m_neighborRadius - zmin ) / dz );
-
-        // Adjust bin ijk indices if necessary
-        imin = std::max( imin, 0 );
-        imax = std::min( imax, nxbins-1 );
-        jmin = std::max( jmin, 0 );
-        jmax = std::min( jmax, nybins-1 );
-        kmin = std::max( kmin, 0 );
-        kmax = std::min( kmax, nzbins-1 );
-
-        // Inner subregion loop
-        particleManager.forParticleSubRegions( [&]( ParticleSubRegion & subRegionB )
+    // Call a function on each neighbor of particle a, in a deterministic order
+    auto const forNeighbors = [&]( localIndex const a, auto && func )
+    {
+      // Bin ijk indices bounding a sphere of radius searchRadius centered at 'this' particle
+      int const imin = binIndex( xA[a][0] - searchRadius, xmin, dx, nxbins ),
+                jmin = binIndex( xA[a][1] - searchRadius, ymin, dy, nybins ),
+                kmin = binIndex( xA[a][2] - searchRadius, zmin, dz, nzbins ),
+                imax = binIndex( xA[a][0] + searchRadius, xmin, dx, nxbins ),
+                jmax = binIndex( xA[a][1] + searchRadius, ymin, dy, nybins ),
+                kmax = binIndex( xA[a][2] + searchRadius, zmin, dz, nzbins );
+
+      for( SubRegionBins const & subRegionB : subRegionBins )
       {
-        // Get region and subregion indices
-        ParticleRegion & region = dynamicCast< ParticleRegion & >( subRegionB.getParent().getParent() );
-        binKey.regionIndex = region.getIndexInParent();
-        binKey.subRegionIndex = subRegionB.getIndexInParent();
-
-        // Get 'other' particle location
-        arrayView2d< real64 > const xB = subRegionB.getParticleCenter();
-
-        // Declare temporary array of local neighbor indices
-        std::vector< localIndex > localIndices;
-        localIndices.reserve( numToReserve );
-
-        // Loop over bins
-        int count = 0; // Count the number of neighbors on this subregion
+        arrayView2d< real64 const > const xB = subRegionB.position;
         for( int iBin=imin; iBin<=imax; iBin++ )
         {
           for( int jBin=jmin; jBin<=jmax; jBin++ )
           {
             for( int kBin=kmin; kBin<=kmax; kBin++ )
             {
-              binKey.binIndex = iBin + jBin * nxbins + kBin * nxbins * nybins;
-              for( localIndex & b: bins[binKey] )
+              for( localIndex const b : subRegionB.bins[iBin + jBin * nxbins + kBin * nxbins * nybins] )
               {
                 real64 xBA[3];
                 xBA[0] = xB[b][0] - xA[a][0];
                 xBA[1] = xB[b][1] - xA[a][1];
                 xBA[2] = xB[b][2] - xA[a][2];
                 real64 rSquared = xBA[0] * xBA[0] + xBA[1] * xBA[1] + xBA[2] * xBA[2];
-                if( rSquared <= neighborRadiusSquared ) // Would you be my neighbor?
+                if( rSquared <= searchRadiusSquared ) // Would you be my neighbor?
                 {
-                  count++;
-                  localIndices.push_back( b );
+                  func( subRegionB, b );
                 }
               }
             }
           }
         }
+      }
+    };
 
-        // Populate the temporary arrays of neighbor region and subregion indices
-        std::vector< localIndex > regionIndices( count, binKey.regionIndex );
-        std::vector< localIndex > subRegionIndices( count, binKey.subRegionIndex );
-
-        // Insert indices into neighbor list
-        insertMany( neighborList,
-                    a,
-                    regionIndices,
-                    subRegionIndices,
-                    localIndices );
+    // Count the neighbors of each active particle, so that the neighbor list can be allocated once
+    SortedArrayView< localIndex const > const subRegionAActiveParticleIndices = subRegionA.activeParticleIndices();
+    array1d< localIndex > numNeighbors( subRegionA.size() );
+    arrayView1d< localIndex > const numNeighborsView = numNeighbors.toView();
+    forAll< EXEC_POLICY >( subRegionAActiveParticleIndices.size(), [&, subRegionAActiveParticleIndices, numNeighborsView] GEOS_HOST ( localIndex const pp )
+      {
+        localIndex const a = subRegionAActiveParticleIndices[pp];
+        forNeighbors( a, [&]( SubRegionBins const &, localIndex const ) { ++numNeighborsView[a]; } );
       } );
+
+    // Get and size the neighbor list
+    OrderedVariableToManyParticleRelation & neighborList = subRegionA.neighborList();
+    neighborList.resize( 0, 0 ); // Clear the existing neighbor list
+    neighborList.resize( subRegionA.size() );
+    neighborList.m_toParticleRegion.resizeFromCapacities< parallelHostPolicy >( subRegionA.size(), numNeighbors.data() );
+    neighborList.m_toParticleSubRegion.resizeFromCapacities< parallelHostPolicy >( subRegionA.size(), numNeighbors.data() );
+    neighborList.m_toParticleIndex.resizeFromCapacities< parallelHostPolicy >( subRegionA.size(), numNeighbors.data() );
+
+    // Fill the neighbor list, each particle writing its own row
+    arrayView1d< localIndex > const numParticles = neighborList.m_numParticles.toView();
+    ArrayOfArraysView< localIndex > const toParticleRegion = neighborList.m_toParticleRegion.toView();
+    ArrayOfArraysView< localIndex > const toParticleSubRegion = neighborList.m_toParticleSubRegion.toView();
+    ArrayOfArraysView< localIndex > const toParticleIndex = neighborList.m_toParticleIndex.toView();
+    forAll< EXEC_POLICY >( subRegionAActiveParticleIndices.size(), [&, subRegionAActiveParticleIndices] GEOS_HOST ( localIndex const pp )
+      {
+        localIndex const a = subRegionAActiveParticleIndices[pp];
+        numParticles[a] = numNeighborsView[a];
+        forNeighbors( a, [&]( SubRegionBins const & subRegionB, localIndex const b )
+        {
+          toParticleRegion.emplaceBack( a, subRegionB.regionIndex );
+          toParticleSubRegion.emplaceBack( a, subRegionB.subRegionIndex );
+          toParticleIndex.emplaceBack( a, b );
+        } );
       } );
   } );
 
+  // Save the particle positions, against which the validity of the list is checked
+  if( m_neighborListSkin > 0.0 )
+  {
+    m_neighborListPositions.clear();
+    m_neighborListVersions.clear();
+    particleManager.forParticleSubRegions( [&]( ParticleSubRegion & subRegion )
+    {
+      arrayView2d< real64 const > const particlePosition = subRegion.getParticleCenter();
+      m_neighborListVersions.emplace_back( subRegion.particleIndicesVersion() );
+      m_neighborListPositions.emplace_back( subRegion.size(), 3 );
+      arrayView2d< real64 > const listPosition = m_neighborListPositions.back().toView();
+      forAll< EXEC_POLICY >( subRegion.size(), [=] GEOS_HOST ( localIndex const p )
+        {
+          for( int i=0; i<3; i++ )
+          {
+            listPosition[p][i] = particlePosition[p][i];
+          }
+        } );
+    } );
+  }
+
   return( MPI_Wtime() - tStart );
 }
 
+bool SolidMechanicsMPM::neighborListNeedsRebuild( ParticleManager & particleManager )
+{
+  // Without a skin, or when the ghost particles are exchanged (and reindexed) every step, the list is always rebuilt
+  if( m_neighborListSkin <= 0.0 || MpiWrapper::commSize( MPI_COMM_GEOS ) > 1 )
+  {
+    return true;
+  }
+
+  // The list is also rebuilt when particles have been added, deleted or reordered since it was built, even if the
+  // number of particles is unchanged, which the version stamp of the particle indices of each subregion records
+  localIndex subRegionIndex = 0;
+  bool needsRebuild = false;
+  particleManager.forParticleSubRegions( [&]( ParticleSubRegion & subRegion )
+  {
+    if( needsRebuild ||
+        subRegionIndex >= LvArray::integerConversion< localIndex >( m_neighborListVersions.size() ) ||
+        m_neighborListVersions[subRegionIndex] != subRegion.particleIndicesVersion() )
+    {
+      needsRebuild = true;
+      return;
+    }
+
+    // Two particles moving toward each other by half the skin each may have become neighbors
+    arrayView2d< real64 const > const particlePosition = subRegion.getParticleCenter();
+    arrayView2d< real64 const > const listPosition = m_neighborListPositions[subRegionIndex];
+    RAJA::ReduceMax< REDUCE_POLICY, real64 > maxDisplacementSquared( 0.0 );
+    forAll< EXEC_POLICY >( subRegion.size(), [=] GEOS_HOST ( localIndex const p )
+      {
+        real64 displacementSquared = 0.0;
+        for( int i=0; i<3; i++ )
+        {
+          displacementSquared += ( particlePosition[p][i] - listPosition[p][i] ) * ( particlePosition[p][i] - listPosition[p][i] );
+        }
+        maxDisplacementSquared.max( displacementSquared );
+      } );
+    needsRebuild = maxDisplacementSquared.get() > 0.25 * m_neighborListSkin * m_neighborListSkin;
+    subRegionIndex++;
+  } );
+
+  return needsRebuild || subRegionIndex != LvArray::integerConversion< localIndex >( m_neighborListPositions.size() );
+}
+
+void SolidMechanicsMPM::sortParticles( ParticleManager & particleManager )
+{
+  // Spread the low 21 bits of a cell index so that they can be interleaved with those of the two other directions
+  auto const spreadBits = [] ( uint64_t x )
+  {
+    x &= 0x1fffff;
+    x = ( x | x << 32 ) & 0x1f00000000ffff;
+    x = ( x | x << 16 ) & 0x1f0000ff0000ff;
+    x = ( x | x << 8 ) & 0x100f00f00f00f00f;
+    x = ( x | x << 4 ) & 0x10c30c30c30c30c3;
+    x = ( x | x << 2 ) & 0x1249249249249249;
+    return x;
+  };
+
+  real64 const xLocalMin[3] = { m_xLocalMin[0], m_xLocalMin[1], m_xLocalMin[2] };
+  real64 const hEl[3] = { m_hEl[0], m_hEl[1], m_hEl[2] };
+  int const nEl[3] = { m_nEl[0], m_nEl[1], m_nEl[2] };
+
+  particleManager.forParticleSubRegions( [&]( ParticleSubRegion & subRegion )
+  {
+    // Morton code of the background grid cell containing each particle center
+    arrayView2d< real64 const > const particlePosition = subRegion.getParticleCenter();
+    array1d< uint64_t > mortonCode( subRegion.size() );
+    arrayView1d< uint64_t > const mortonCodeView = mortonCode.toView();
+    forAll< EXEC_POLICY >( subRegion.size(), [=] GEOS_HOST ( localIndex const p )
+      {
+        uint64_t code = 0;
+        for( int i=0; i<3; i++ )
+        {
+          int const cell = static_cast< int >( std::floor( ( particlePosition[p][i] - xLocalMin[i] ) / hEl[i] ) );
+          code |= spreadBits( LvArray::math::min( LvArray::math::max( cell, 0 ), nEl[i] - 1 ) ) << i;
+        }
+        mortonCodeView[p] = code;
+      } );
+
+    // Nothing to do if the particles are already in order
+    if( std::is_sorted( mortonCode.begin(), mortonCode.end() ) )
+    {
+      return;
+    }
+
+    // Stable sort so that particles in the same cell keep their relative order
+    array1d< localIndex > newToOld( subRegion.size() );
+    std::iota( newToOld.begin(), newToOld.end(), 0 );
+    std::stable_sort( newToOld.begin(), newToOld.end(), [&]( localIndex const a, localIndex const b )
+    {
+      return mortonCode[a] < mortonCode[b];
+    } );
+
+    subRegion.forWrappers( [&]( WrapperBase & wrapper )
+    {
+      wrapper.move( LvArray::MemorySpace::host, true );
+    } );
+    subRegion.permute( newToOld.toViewConst() );
+  } );
+
+  // The neighbor lists were cleared by the permutation
+  m_neighborListPositions.clear();
+}
+
 void SolidMechanicsMPM::optimizeBinSort( ParticleManager & particleManager )
 {
   // Each partition determines its optimal multiplier which results in the minimum time for neighbor list construction
@@ -2454,7 +2597,7 @@ void SolidMechanicsMPM::computeDamageFieldGradient( ParticleManager & particleMa
 
     // Loop over neighbors
     SortedArrayView< localIndex const > const activeParticleIndices = subRegion.activeParticleIndices();
-    forAll< serialPolicy >( activeParticleIndices.size(), [=] GEOS_HOST ( localIndex const pp ) // Must be on host since we call a 'this'
+    forAll< EXEC_POLICY >( activeParticleIndices.size(), [=] GEOS_HOST ( localIndex const pp ) // Must be on host since we call a 'this'
                                                                                                 // method which uses class variables
       {
         localIndex const p = activeParticleIndices[pp];
@@ -2509,7 +2652,7 @@ void SolidMechanicsMPM::updateSurfaceFlagOverload( ParticleManager & particleMan
     arrayView1d< int > const particleSurfaceFlag = subRegion.getParticleSurfaceFlag();
     arrayView1d< real64 const > const particleDamage = subRegion.getParticleDamage();
     SortedArrayView< localIndex const > const activeParticleIndices = subRegion.activeParticleIndices();
-    forAll< serialPolicy >( activeParticleIndices.size(), [=] GEOS_HOST_DEVICE ( localIndex const pp )
+    forAll< EXEC_POLICY >( activeParticleIndices.size(), [=] GEOS_HOST_DEVICE ( localIndex const pp )
     {
       localIndex const p = activeParticleIndices[pp];
       if( particleSurfaceFlag[p] != 2 )
@@ -2580,7 +2723,7 @@ void SolidMechanicsMPM::updateDeformationGradient( real64 dt,
 
     // Update F
     SortedArrayView< localIndex const > const activeParticleIndices = subRegion.activeParticleIndices();
-    forAll< serialPolicy >( activeParticleIndices.size(), [=] GEOS_HOST_DEVICE ( localIndex const pp )
+    forAll< EXEC_POLICY >( activeParticleIndices.size(), [=] GEOS_HOST_DEVICE ( localIndex const pp )
     {
       localIndex const p = activeParticleIndices[pp];
       LvArray::tensorOps::Rij_eq_AikBkj< 3, 3, 3 >( particleFDot[p], particleVelocityGradient[p], particleDeformationGradient[p] ); // Fdot
@@ -2607,7 +2750,7 @@ void SolidMechanicsMPM::updateConstitutiveModelDependencies( ParticleManager & p
     {
       arrayView1d< real64 > const lengthScale = solidModel.getReference< array1d< real64 > >( "lengthScale" );
       SortedArrayView< localIndex const > const activeParticleIndices = subRegion.activeParticleIndices();
-      forAll< serialPolicy >( activeParticleIndices.size(), [=] GEOS_HOST_DEVICE ( localIndex const pp )
+      forAll< EXEC_POLICY >( activeParticleIndices.size(), [=] GEOS_HOST_DEVICE ( localIndex const pp )
       {
         localIndex const p = activeParticleIndices[pp];
         lengthScale[p] = pow( particleVolume[p], 1.0 / 3.0 );
@@ -2636,13 +2779,13 @@ void SolidMechanicsMPM::updateStress( real64 dt,
     {
       using SolidType = TYPEOFREF( castedSolid );
       typename SolidType::KernelWrapper constitutiveModelWrapper = castedSolid.createKernelUpdates();
-      solidMechanicsMPMKernels::StateUpdateKernel::launch< serialPolicy >( subRegion.activeParticleIndices(),
-                                                                           constitutiveModelWrapper,
-                                                                           dt,
-                                                                           particleDeformationGradient,
-                                                                           particleFDot,
-                                                                           particleVelocityGradient,
-                                                                           particleStress );
+      solidMechanicsMPMKernels::StateUpdateKernel::launch< EXEC_POLICY >( subRegion.activeParticleIndices(),
+                                                                          constitutiveModelWrapper,
+                                                                          dt,
+                                                                          particleDeformationGradient,
+                                                                          particleFDot,
+                                                                          particleVelocityGradient,
+                                                                          particleStress );
     } );
   } );
 }
@@ -2665,7 +2808,7 @@ void SolidMechanicsMPM::particleKinematicUpdate( ParticleManager & particleManag
 
     // Update volume and r-vectors
     SortedArrayView< localIndex const > const activeParticleIndices = subRegion.activeParticleIndices();
-    forAll< serialPolicy >( activeParticleIndices.size(), [=] GEOS_HOST_DEVICE ( localIndex const pp )
+    forAll< EXEC_POLICY >( activeParticleIndices.size(), [=] GEOS_HOST_DEVICE ( localIndex const pp )
     {
       localIndex const p = activeParticleIndices[pp];
       real64 detF = LvArray::tensorOps::determinant< 3 >( particleDeformationGradient[p] );
@@ -2814,7 +2957,7 @@ void SolidMechanicsMPM::initializeGridFields( NodeManager & nodeManager )
   arrayView3d< real64 > const gridSurfaceNormal = nodeManager.getReference< array3d< real64 > >( viewKeyStruct::surfaceNormalString() );
   arrayView3d< real64 > const gridMaterialPosition = nodeManager.getReference< array3d< real64 > >( viewKeyStruct::materialPositionString() );
 
-  forAll< serialPolicy >( numNodes, [=] GEOS_HOST ( localIndex const g ) // Switch to .zero()?
+  forAll< EXEC_POLICY >( numNodes, [=] GEOS_HOST ( localIndex const g ) // Switch to .zero()?
     {
       for( int i = 0; i < 3; i++ )
       {
@@ -2898,39 +3041,36 @@ void SolidMechanicsMPM::particleToGrid( ParticleManager & particleManager,
     int const numDims = m_numDims;
     int voigtMap[3][3] = { {0, 5, 4}, {5, 1, 3}, {4, 3, 2} };
     int const damageFieldPartitioning = m_damageFieldPartitioning;
-    forAll< serialPolicy >( activeParticleIndices.size(), [=] GEOS_HOST ( localIndex const pp ) // Can be parallized using atomics -
-                                                                                                // remember to pass copies of class
-                                                                                                // variables
-      {                                                                                          // Grid max damage will require reduction
+    int const numContactGroups = m_numContactGroups;
+    // Particles sharing a node scatter to it concurrently, hence the atomics
+    forParticlesScatter( activeParticleIndices.size(), [=] GEOS_HOST ( localIndex const pp )
+      {
         localIndex const p = activeParticleIndices[pp];
 
         for( int g = 0; g < 8 * numberOfVerticesPerParticle; g++ )
         {
           localIndex const mappedNode = mappedNodes[pp][g];
-          int const nodeFlag = ( damageFieldPartitioning == 1 && LvArray::tensorOps::AiBi< 3 >( gridDamageGradient[mappedNode], particleDamageGradient[p] ) < 0.0 ) ? 1 : 0; // 0
-                                                                                                                                                                             // undamaged
-                                                                                                                                                                             // or
-                                                                                                                                                                             // "A"
-                                                                                                                                                                             // field,
-                                                                                                                                                                             // 1
-                                                                                                                                                                             // for
-                                                                                                                                                                             // "B"
-                                                                                                                                                                             // field
-          int const fieldIndex = nodeFlag * m_numContactGroups + particleGroup[p]; // This ranges from 0 to nMatFields-1
-          gridMass[mappedNode][fieldIndex] += particleMass[p] * shapeFunctionValues[pp][g];
+          // 0 undamaged or "A" field, 1 for "B" field
+          int const nodeFlag = ( damageFieldPartitioning == 1 && LvArray::tensorOps::AiBi< 3 >( gridDamageGradient[mappedNode], particleDamageGradient[p] ) < 0.0 ) ? 1 : 0;
+          int const fieldIndex = nodeFlag * numContactGroups + particleGroup[p]; // This ranges from 0 to nMatFields-1
+          real64 const weightedMass = particleMass[p] * shapeFunctionValues[pp][g];
+          real64 const damage = particleSurfaceFlag[p] == 1 ? 1 : particleDamage[pp];
+          RAJA::atomicAdd< ATOMIC_POLICY >( &gridMass[mappedNode][fieldIndex], weightedMass );
           // TODO: Normalizing by volume might be better
-          gridDamage[mappedNode][fieldIndex] += particleMass[p] * ( particleSurfaceFlag[p] == 1 ? 1 : particleDamage[pp] ) * shapeFunctionValues[pp][g];
-          gridMaxDamage[mappedNode][fieldIndex] = fmax( gridMaxDamage[mappedNode][fieldIndex], particleSurfaceFlag[p] == 1 ? 1 : particleDamage[pp] );
+          RAJA::atomicAdd< ATOMIC_POLICY >( &gridDamage[mappedNode][fieldIndex], weightedMass * damage );
+          RAJA::atomicMax< ATOMIC_POLICY >( &gridMaxDamage[mappedNode][fieldIndex], damage );
           for( int i=0; i<numDims; i++ )
           {
-            gridMomentum[mappedNode][fieldIndex][i] += particleMass[p] * particleVelocity[p][i] * shapeFunctionValues[pp][g];
+            RAJA::atomicAdd< ATOMIC_POLICY >( &gridMomentum[mappedNode][fieldIndex][i], weightedMass * particleVelocity[p][i] );
             // TODO: Switch to volume weighting?
-            gridMaterialPosition[mappedNode][fieldIndex][i] += particleMass[p] * (particlePosition[p][i] - gridPosition[mappedNode][i]) * shapeFunctionValues[pp][g];
+            RAJA::atomicAdd< ATOMIC_POLICY >( &gridMaterialPosition[mappedNode][fieldIndex][i], weightedMass * (particlePosition[p][i] - gridPosition[mappedNode][i]) );
+            real64 internalForce = 0.0;
             for( int k=0; k<numDims; k++ )
             {
               int voigt = voigtMap[k][i];
-              gridInternalForce[mappedNode][fieldIndex][i] -= particleStress[p][voigt] * shapeFunctionGradientValues[pp][g][k] * particleVolume[p];
+              internalForce -= particleStress[p][voigt] * shapeFunctionGradientValues[pp][g][k] * particleVolume[p];
             }
+            RAJA::atomicAdd< ATOMIC_POLICY >( &gridInternalForce[mappedNode][fieldIndex][i], internalForce );
           }
         }
       } ); // particle loop
@@ -2960,7 +3100,7 @@ void SolidMechanicsMPM::gridTrialUpdate( real64 dt,
   int const numDims = m_numDims;
   for( int fieldIndex=0; fieldIndex<m_numVelocityFields; fieldIndex++ )
   {
-    forAll< serialPolicy >( numNodes, [=] GEOS_HOST_DEVICE ( localIndex const g )
+    forAll< EXEC_POLICY >( numNodes, [=] GEOS_HOST_DEVICE ( localIndex const g )
     {
       if( gridMass[g][fieldIndex] > smallMass ) // small mass threshold
       {
@@ -3039,7 +3179,7 @@ void SolidMechanicsMPM::enforceContact( real64 dt,
   int const numDims = m_numDims;
   for( int fieldIndex=0; fieldIndex<m_numVelocityFields; fieldIndex++ )
   {
-    forAll< serialPolicy >( numNodes, [=] GEOS_HOST_DEVICE ( localIndex const g )
+    forAll< EXEC_POLICY >( numNodes, [=] GEOS_HOST_DEVICE ( localIndex const g )
     {
       if( gridMass[g][fieldIndex] > smallMass ) // small mass threshold
       {
@@ -3151,7 +3291,7 @@ void SolidMechanicsMPM::gridToParticle( real64 dt,
     int const numDims = m_numDims;
     int const damageFieldPartitioning = m_damageFieldPartitioning;
     int const numContactGroups = m_numContactGroups;
-    forAll< serialPolicy >( activeParticleIndices.size(), [=] GEOS_HOST_DEVICE ( localIndex const pp )
+    forAll< EXEC_POLICY >( activeParticleIndices.size(), [=] GEOS_HOST_DEVICE ( localIndex const pp )
     {
       localIndex const p = activeParticleIndices[pp];
 
@@ -3222,7 +3362,7 @@ void SolidMechanicsMPM::updateSolverDependencies( ParticleManager & particleMana
       arrayView1d< real64 > const particleDamage = subRegion.getParticleDamage();
       arrayView2d< real64 const > const constitutiveDamage = solidModel.getReference< array2d< real64 > >( "damage" );
       SortedArrayView< localIndex const > const activeParticleIndices = subRegion.activeParticleIndices();
-      forAll< serialPolicy >( activeParticleIndices.size(), [=] GEOS_HOST_DEVICE ( localIndex const pp )
+      forAll< EXEC_POLICY >( activeParticleIndices.size(), [=] GEOS_HOST_DEVICE ( localIndex const pp )
       {
         localIndex const p = activeParticleIndices[pp];
         if( constitutiveDamage[p][0] > particleDamage[p] ) // Damage can only increase - This will also preserve user-specified damage at
@@ -3253,12 +3393,13 @@ real64 SolidMechanicsMPM::getStableTimeStep( ParticleManager & particleManager )
     arrayView1d< real64 const > const shearModulus = constitutiveRelation.shearModulus();
     arrayView1d< real64 const > const bulkModulus = constitutiveRelation.bulkModulus();
     SortedArrayView< localIndex const > const activeParticleIndices = subRegion.activeParticleIndices();
-    forAll< serialPolicy >( activeParticleIndices.size(), [=, &wavespeed] GEOS_HOST ( localIndex const pp ) // would need reduction to
-                                                                                                            // parallelize
+    RAJA::ReduceMax< REDUCE_POLICY, real64 > subRegionWavespeed( 0.0 );
+    forAll< EXEC_POLICY >( activeParticleIndices.size(), [=] GEOS_HOST ( localIndex const pp )
       {
         localIndex const p = activeParticleIndices[pp];
-        wavespeed = fmax( wavespeed, sqrt( ( bulkModulus[p] + (4.0/3.0) * shearModulus[p] ) / rho[p] ) + LvArray::tensorOps::l2Norm< 3 >( particleVelocity[p] ) );
+        subRegionWavespeed.max( sqrt( ( bulkModulus[p] + (4.0/3.0) * shearModulus[p] ) / rho[p] ) + LvArray::tensorOps::l2Norm< 3 >( particleVelocity[p] ) );
       } );
+    wavespeed = fmax( wavespeed, subRegionWavespeed.get() );
   } );
 
   real64 dtReturn = wavespeed > 1.0e-16 ? m_cflFactor * length / wavespeed : DBL_MAX; // This partitions's dt, make it huge if wavespeed=0.0
@@ -3377,7 +3518,7 @@ void SolidMechanicsMPM::computeSurfaceFlags( ParticleManager & particleManager )
 
     // Loop over neighbors
     SortedArrayView< localIndex const > const activeParticleIndices = subRegion.activeParticleIndices();
-    forAll< serialPolicy >( activeParticleIndices.size(), [=] GEOS_HOST ( localIndex const pp ) // Must be on host since we call a 'this'
+    forAll< EXEC_POLICY >( activeParticleIndices.size(), [=] GEOS_HOST ( localIndex const pp ) // Must be on host since we call a 'this'
                                                                                                 // method which uses class variables
       {
         localIndex const p = activeParticleIndices[pp];
@@ -3453,7 +3594,7 @@ void SolidMechanicsMPM::computeSphF( ParticleManager & particleManager )
 
     // Loop over neighbors
     SortedArrayView< localIndex const > const activeParticleIndices = subRegion.activeParticleIndices();
-    forAll< serialPolicy >( activeParticleIndices.size(), [=] GEOS_HOST ( localIndex const pp ) // I think this must be on host since we
+    forAll< EXEC_POLICY >( activeParticleIndices.size(), [=] GEOS_HOST ( localIndex const pp ) // I think this must be on host since we
                                                                                                 // call a 'this' method which uses class
                                                                                                 // variables
       {
@@ -3665,7 +3806,7 @@ void SolidMechanicsMPM::flagOutOfRangeParticles( ParticleManager & particleManag
     {
       case ParticleType::SinglePoint:
         {
-          forAll< serialPolicy >( activeParticleIndices.size(), [=] GEOS_HOST_DEVICE ( localIndex const pp )
+          forAll< EXEC_POLICY >( activeParticleIndices.size(), [=] GEOS_HOST_DEVICE ( localIndex const pp )
         {
           localIndex const p = activeParticleIndices[pp];
           for( int i=0; i<3; i++ )
@@ -3690,7 +3831,7 @@ void SolidMechanicsMPM::flagOutOfRangeParticles( ParticleManager & particleManag
             {-1, 1, -1},
             {-1, -1, 1},
             {-1, -1, -1} };
-          forAll< serialPolicy >( activeParticleIndices.size(), [=] GEOS_HOST_DEVICE ( localIndex const pp )
+          forAll< EXEC_POLICY >( activeParticleIndices.size(), [=] GEOS_HOST_DEVICE ( localIndex const pp )
         {
           localIndex const p = activeParticleIndices[pp];
           for( int cornerIndex=0; cornerIndex<8; cornerIndex++ )
@@ -3732,7 +3873,7 @@ void SolidMechanicsMPM::computeRVectors( ParticleManager & particleManager )
       arrayView3d< real64 > const particleRVectors = subRegion.getParticleRVectors();
       arrayView3d< real64 const > const particleInitialRVectors = subRegion.getField< fields::mpm::particleInitialRVectors >();
       arrayView3d< real64 const > const particleDeformationGradient = subRegion.getField< fields::mpm::particleDeformationGradient >();
-      forAll< serialPolicy >( activeParticleIndices.size(), [=] GEOS_HOST_DEVICE ( localIndex const pp )
+      forAll< EXEC_POLICY >( activeParticleIndices.size(), [=] GEOS_HOST_DEVICE ( localIndex const pp )
       {
         localIndex const p = activeParticleIndices[pp];
         for( int i=0; i<3; i++ )
@@ -3758,7 +3899,7 @@ void SolidMechanicsMPM::cpdiDomainScaling( ParticleManager & particleManager )
       real64 const lCrit = m_planeStrain == 1 ? 0.49999 * fmin( m_hEl[0], m_hEl[1] ) : 0.49999 * fmin( m_hEl[0], fmin( m_hEl[1], m_hEl[2] ) );
       arrayView3d< real64 > const particleRVectors = subRegion.getParticleRVectors();
       int const planeStrain = m_planeStrain;
-      forAll< serialPolicy >( subRegion.size(), [=] GEOS_HOST_DEVICE ( localIndex const p )
+      forAll< EXEC_POLICY >( subRegion.size(), [=] GEOS_HOST_DEVICE ( localIndex const p )
       {
         arraySlice1d< real64 > const r1 = particleRVectors[p][0];
         arraySlice1d< real64 > const r2 = particleRVectors[p][1];
@@ -3893,7 +4034,7 @@ void SolidMechanicsMPM::populateMappingArrays( ParticleManager & particleManager
     {
       case ParticleType::SinglePoint:
         {
-          forAll< serialPolicy >( activeParticleIndices.size(), [=] GEOS_HOST_DEVICE ( localIndex const pp )
+          forAll< EXEC_POLICY >( activeParticleIndices.size(), [=] GEOS_HOST_DEVICE ( localIndex const pp )
         {
           localIndex const p = activeParticleIndices[pp];
 
@@ -3948,7 +4089,7 @@ void SolidMechanicsMPM::populateMappingArrays( ParticleManager & particleManager
             {  1, 1, 1 },
             { -1, 1, 1 } };
           arrayView3d< real64 const > const particleRVectors = subRegion.getParticleRVectors();
-          forAll< serialPolicy >( activeParticleIndices.size(), [=] GEOS_HOST_DEVICE ( localIndex const pp )
+          forAll< EXEC_POLICY >( activeParticleIndices.size(), [=] GEOS_HOST_DEVICE ( localIndex const pp )
         {
           localIndex const p = activeParticleIndices[pp];
 
@@ -69,6 +69,36 @@ public:
     SYMMETRY    //!<Symmetry
   };
 
+  /// Execution policy of the particle and grid loops, kept on the host since several of them call member functions
+  using EXEC_POLICY = parallelHostPolicy;
+
+  /// Atomic policy of the particle-to-grid scatters. The floating-point sums accumulated on a grid node depend on the
+  /// order in which the threads reach it, so that the grid fields are not reproducible bitwise from a run to the next
+  /// unless the scatters run serially (see m_deterministicScatter)
+  using ATOMIC_POLICY = parallelHostAtomic;
+
+  /// Reduction policy of the particle loops
+  using REDUCE_POLICY = parallelHostReduce;
+
+  /**
+   * @brief Launch a particle-to-grid scatter loop, serially if the deterministic scatter has been requested
+   * @tparam LAMBDA the type of the loop body
+   * @param numParticles the number of particles of the loop
+   * @param lambda the loop body, accumulating on the grid nodes with atomics
+   */
+  template< typename LAMBDA >
+  void forParticlesScatter( localIndex const numParticles, LAMBDA && lambda ) const
+  {
+    if( m_deterministicScatter )
+    {
+      forAll< serialPolicy >( numParticles, std::forward< LAMBDA >( lambda ) );
+    }
+    else
+    {
+      forAll< EXEC_POLICY >( numParticles, std::forward< LAMBDA >( lambda ) );
+    }
+  }
+
   /**
    * Constructor
    * @param name The name of the solver instance
@@ -260,8 +290,12 @@ public:
 
   real64 computeNeighborList( ParticleManager & particleManager );
 
+  bool neighborListNeedsRebuild( ParticleManager & particleManager );
+
   void optimizeBinSort( ParticleManager & particleManager );
 
+  void sortParticles( ParticleManager & particleManager );
+
   real64 kernel( real64 const & r ); // distance from particle to query point
 
   void kernelGradient( arraySlice1d< real64 const > const x,  // query point
@@ -395,7 +429,12 @@ protected:
 
   int m_needsNeighborList;
   real64 m_neighborRadius;
+  real64 m_neighborListSkin;
   int m_binSizeMultiplier;
+  std::vector< array2d< real64 > > m_neighborListPositions; // Particle positions when the neighbor list was last built, by subregion
+  std::vector< localIndex > m_neighborListVersions; // Versions of the particle indices when the neighbor list was last built, by subregion
+
+  int m_particleSortInterval;
 
   int m_useDamageAsSurfaceFlag;
 
@@ -415,6 +454,8 @@ protected:
   int m_planeStrain;
   int m_numDims;
 
+  int m_deterministicScatter;
+
   array1d< real64 > m_hEl;                // Grid spacing in x-y-z
   array1d< real64 > m_xLocalMin;          // Minimum local grid coordinate including ghost nodes
   array1d< real64 > m_xLocalMax;          // Maximum local grid coordinate including ghost nodes
@@ -428,34 +469,6 @@ protected:
   array3d< int > m_ijkMap;        // Map from indices in each spatial dimension to local node ID
 
 private:
-  struct BinKey
-  {
-    localIndex regionIndex;
-    localIndex subRegionIndex;
-    localIndex binIndex;
-
-    bool operator==( BinKey const & other ) const
-    {
-      return (regionIndex == other.regionIndex && subRegionIndex == other.subRegionIndex && binIndex == other.binIndex);
-    }
-  };
-
-  struct BinKeyHash
-  {
-    std::size_t operator()( BinKey const & k ) const
-    {
-      using std::size_t;
-      using std::hash;
-
-      // Compute individual hash values for first,
-      // second and third and combine them using XOR
-      // and bit shifting:
-      return ((std::hash< localIndex >()( k.regionIndex )
-               ^ (std::hash< localIndex >()( k.subRegionIndex ) << 1)) >> 1)
-             ^ (std::hash< localIndex >()( k.binIndex ) << 1);
-    }
-  };
-
   void setParticlesConstitutiveNames( ParticleSubRegionBase & subRegion ) const;
 };
 
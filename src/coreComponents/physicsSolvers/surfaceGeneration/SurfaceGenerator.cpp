@@ -180,7 +180,8 @@ SurfaceGenerator::SurfaceGenerator( const string & name,
   m_nodeBasedSIF( 1 ),
   m_isPoroelastic( 0 ),
   m_rockToughness( 1.0e99 ),
-  m_mpiCommOrder( 0 )
+  m_mpiCommOrder( 0 ),
+  m_concurrentSplitting( 1 )
 {
   this->registerWrapper( viewKeyStruct::failCriterionString(), &this->m_failCriterion );
 
@@ -201,6 +202,12 @@ SurfaceGenerator::SurfaceGenerator( const string & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Flag to enable MPI consistent communication ordering" );
 
+  registerWrapper( viewKeyStruct::concurrentSplittingString(), &m_concurrentSplitting ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 1 ).
+    setDescription( "Flag to split the nodes away from the rank boundaries on all the ranks at once, before the nodes near "
+                    "the rank boundaries are split one rank color at a time. 0 splits all the nodes one rank color at a time" );
+
   registerWrapper( viewKeyStruct::fractureRegionNameString(), &m_fractureRegionName ).
     setRTTypeName( rtTypes::CustomTypes::groupNameRef ).
     setInputFlag( dataRepository::InputFlags::OPTIONAL ).
@@ -237,6 +244,10 @@ void SurfaceGenerator::postInputInitialization()
   GEOS_ERROR_IF( binaryOptions.count( m_mpiCommOrder ) == 0,
                  getWrapperDataContext( viewKeyStruct::mpiCommOrderString() ) <<
                  ": option can be either 0 (false) or 1 (true)" );
+
+  GEOS_ERROR_IF( binaryOptions.count( m_concurrentSplitting ) == 0,
+                 getWrapperDataContext( viewKeyStruct::concurrentSplittingString() ) <<
+                 ": option can be either 0 (false) or 1 (true)" );
 }
 
 SurfaceGenerator::~SurfaceGenerator()
@@ -634,16 +645,74 @@ int SurfaceGenerator::separationDriver( DomainPartition & domain,
 
   array1d< integer > const & isNodeGhost = nodeManager.ghostRank();
 
-  for( int color=0; color<numTileColors; ++color )
+  // The nodes away from the rank boundaries are split by all the ranks at once in a first round (round -1).
+  // Only the nodes near the rank boundaries are split in the rounds of the tile colors, one color at a time.
+  array1d< integer > isNodeNearRankBoundary;
+  if( m_concurrentSplitting == 1 )
+  {
+    flagNodesNearRankBoundaries( nodeManager, edgeManager, faceManager, elementManager, neighbors, isNodeNearRankBoundary );
+  }
+  else
+  {
+    // all the nodes are split in the rounds of the tile colors
+    isNodeNearRankBoundary.resize( nodeManager.size() );
+    isNodeNearRankBoundary.setValues< serialPolicy >( 1 );
+  }
+  localIndex const numNodesBeforeSplit = nodeManager.size();
+
+  // the new nodes are split in the same round as the node they are split from
+  auto isNearRankBoundary = [&]( localIndex const a )
   {
+    localIndex const parentNodeIndex =
+      a < numNodesBeforeSplit ? a : ObjectManagerBase::getParentRecursive( nodeManager.getField< fields::parentIndex >().toViewConst(), a );
+    return isNodeNearRankBoundary[parentNodeIndex] == 1;
+  };
+
+  // the rounds in which no rank has a node next to a ruptured face to split are skipped
+  integer hasInteriorNodesToSplit = 0;
+  array1d< integer > localColorHasNodesToSplit( numTileColors );
+  for( localIndex a = 0; a < numNodesBeforeSplit; ++a )
+  {
+    if( isNodeGhost[a] < 0 &&
+        nodeToElementMap.sizeOfArray( a ) > 1 &&
+        !nodesToRupturedFaces[a].empty() )
+    {
+      if( isNodeNearRankBoundary[a] == 1 )
+      {
+        localColorHasNodesToSplit[tileColor] = 1;
+      }
+      else
+      {
+        hasInteriorNodesToSplit = 1;
+      }
+    }
+  }
+  hasInteriorNodesToSplit = MpiWrapper::max( hasInteriorNodesToSplit );
+  array1d< integer > colorHasNodesToSplit( numTileColors );
+  MpiWrapper::allReduce< integer >( localColorHasNodesToSplit.data(),
+                                    colorHasNodesToSplit.data(),
+                                    numTileColors,
+                                    MPI_MAX,
+                                    MPI_COMM_GEOS );
+
+  for( int color=-1; color<numTileColors; ++color )
+  {
+    if( ( color < 0 && hasInteriorNodesToSplit == 0 ) ||
+        ( color >= 0 && colorHasNodesToSplit[color] == 0 ) )
+    {
+      continue;
+    }
+
     ModifiedObjectLists modifiedObjects;
-    if( color==tileColor )
+    if( color < 0 || color==tileColor )
     {
+      bool const splitNodesNearRankBoundary = ( color >= 0 );
       for( localIndex a=0; a<nodeManager.size(); ++a )
       {
         int didSplit = 0;
         if( isNodeGhost[a]<0 &&
-            nodeToElementMap.sizeOfArray( a )>1 )
+            nodeToElementMap.sizeOfArray( a )>1 &&
+            isNearRankBoundary( a ) == splitNodesNearRankBoundary )
         {
           didSplit += processNode( a,
                                    time_np1,
@@ -779,6 +848,97 @@ int SurfaceGenerator::separationDriver( DomainPartition & domain,
   return rval;
 }
 
+void SurfaceGenerator::flagNodesNearRankBoundaries( NodeManager const & nodeManager,
+                                                    EdgeManager const & edgeManager,
+                                                    FaceManager const & faceManager,
+                                                    ElementRegionManager const & elementManager,
+                                                    std::vector< NeighborCommunicator > const & neighbors,
+                                                    array1d< integer > & isNodeNearRankBoundary )
+{
+  // 1) flag the nodes of the ghost objects and of the objects that are ghosted on a neighbor rank
+  array1d< integer > isNodeShared( nodeManager.size() );
+
+  auto flagSharedObjects = [&]( ObjectManagerBase const & objectManager, auto && flagObjectNodes )
+  {
+    arrayView1d< integer const > const ghostRank = objectManager.ghostRank();
+    for( localIndex i = 0; i < objectManager.size(); ++i )
+    {
+      if( ghostRank[i] >= 0 )
+      {
+        flagObjectNodes( i );
+      }
+    }
+    for( NeighborCommunicator const & neighbor : neighbors )
+    {
+      for( localIndex const i : objectManager.getNeighborData( neighbor.neighborRank() ).ghostsToSend() )
+      {
+        flagObjectNodes( i );
+      }
+    }
+  };
+
+  flagSharedObjects( nodeManager, [&]( localIndex const a )
+  {
+    isNodeShared[a] = 1;
+  } );
+
+  arrayView2d< localIndex const > const edgeToNodeMap = edgeManager.nodeList().toViewConst();
+  flagSharedObjects( edgeManager, [&]( localIndex const ke )
+  {
+    isNodeShared[edgeToNodeMap[ke][0]] = 1;
+    isNodeShared[edgeToNodeMap[ke][1]] = 1;
+  } );
+
+  ArrayOfArraysView< localIndex const > const faceToNodeMap = faceManager.nodeList().toViewConst();
+  flagSharedObjects( faceManager, [&]( localIndex const kf )
+  {
+    for( localIndex const a : faceToNodeMap[kf] )
+    {
+      isNodeShared[a] = 1;
+    }
+  } );
+
+  elementManager.forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion const & subRegion )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemToNodeMap = subRegion.nodeList().toViewConst();
+    flagSharedObjects( subRegion, [&]( localIndex const k )
+    {
+      for( localIndex i = 0; i < elemToNodeMap.size( 1 ); ++i )
+      {
+        isNodeShared[elemToNodeMap[k][i]] = 1;
+      }
+    } );
+  } );
+
+  // 2) flag the nodes of the cell elements that touch a flagged node
+  isNodeNearRankBoundary.resize( nodeManager.size() );
+  isNodeNearRankBoundary.setValues< serialPolicy >( 0 );
+  for( localIndex a = 0; a < nodeManager.size(); ++a )
+  {
+    isNodeNearRankBoundary[a] = isNodeShared[a];
+  }
+
+  elementManager.forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion const & subRegion )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemToNodeMap = subRegion.nodeList().toViewConst();
+    for( localIndex k = 0; k < subRegion.size(); ++k )
+    {
+      bool touchesSharedNode = false;
+      for( localIndex i = 0; i < elemToNodeMap.size( 1 ); ++i )
+      {
+        touchesSharedNode = touchesSharedNode || isNodeShared[elemToNodeMap[k][i]] == 1;
+      }
+      if( touchesSharedNode )
+      {
+        for( localIndex i = 0; i < elemToNodeMap.size( 1 ); ++i )
+        {
+          isNodeNearRankBoundary[elemToNodeMap[k][i]] = 1;
+        }
+      }
+    }
+  } );
+}
+
 void SurfaceGenerator::synchronizeTipSets ( FaceManager & faceManager,
                                             EdgeManager & edgeManager,
                                             NodeManager & nodeManager,
@@ -117,6 +117,27 @@ private:
                         const bool prefrac,
                         const real64 time_np1 );
 
+  /**
+   * @brief Flag the nodes whose splitting may modify objects that are shared with the neighbor ranks.
+   * @param[in] nodeManager the node manager
+   * @param[in] edgeManager the edge manager
+   * @param[in] faceManager the face manager
+   * @param[in] elementManager the element region manager
+   * @param[in] neighbors the neighbor communicators of this rank
+   * @param[out] isNodeNearRankBoundary 1 if the node belongs to a cell element that touches a ghost object
+   *                                    or an object ghosted on a neighbor rank, 0 otherwise
+   *
+   * The splitting of a node only modifies the node, the edges, faces and cell elements around it, and the
+   * other nodes of these edges and faces. The nodes that are not flagged can therefore be split by all the
+   * ranks at the same time.
+   */
+  static void flagNodesNearRankBoundaries( NodeManager const & nodeManager,
+                                           EdgeManager const & edgeManager,
+                                           FaceManager const & faceManager,
+                                           ElementRegionManager const & elementManager,
+                                           std::vector< NeighborCommunicator > const & neighbors,
+                                           array1d< integer > & isNodeNearRankBoundary );
+
   /**
    * @brief Function to generate new global indices of a simple object (node, edge, face)
    * @param[in,out] object A reference to the object that needs new global indices
@@ -517,6 +538,7 @@ private:
     constexpr static char const * trailingFacesString() { return "trailingFaces"; }
     constexpr static char const * fractureRegionNameString() { return "fractureRegion"; }
     constexpr static char const * mpiCommOrderString() { return "mpiCommOrder"; }
+    constexpr static char const * concurrentSplittingString() { return "concurrentSplitting"; }
     constexpr static char const * isPoroelasticString() {return "isPoroelastic";}
 
     //TODO: rock toughness should be a material parameter, and we need to make rock toughness to KIC a constitutive
@@ -546,6 +568,9 @@ private:
   // Flag for consistent communication ordering
   int m_mpiCommOrder;
 
+  // Flag to split the nodes away from the rank boundaries on all the ranks at once
+  int m_concurrentSplitting;
+
   /// set of separable faces
   SortedArray< localIndex > m_separableFaceSet;
 
@@ -194,6 +194,10 @@ void AcousticFirstOrderWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLev
     }
   }
 
+  /// bin the sources and receivers, so that each element only tests the ones that may lie in it
+  PointBinGrid const sourceBins( sourceCoordinates );
+  PointBinGrid const receiverBins( receiverCoordinates );
+
   mesh.getElemManager().forElementSubRegionsComplete< CellElementSubRegion >( regionNames, [&]( localIndex const,
                                                                                                 localIndex const regionIndex,
                                                                                                 localIndex const esr,
@@ -233,12 +237,14 @@ void AcousticFirstOrderWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLev
         elemsToFaces,
         elemCenter,
         sourceCoordinates,
+        sourceBins.toView(),
         sourceIsAccessible,
         sourceElem,
         sourceNodeIds,
         sourceConstants,
         sourceRegion,
         receiverCoordinates,
+        receiverBins.toView(),
         receiverIsLocal,
         receiverElem,
         receiverNodeIds,
@@ -328,7 +334,7 @@ void AcousticFirstOrderWaveEquationSEM::initializePostInitialConditionsPreSubGro
     } );
   } );
 
-  WaveSolverUtils::initTrace( "seismoTraceReceiver", getName(), m_outputSeismoTrace, m_receiverConstants.size( 0 ), m_receiverIsLocal );
+  WaveSolverUtils::initTrace( "seismoTraceReceiver", getName(), m_outputSeismoTrace, m_outputSeismoTraceFormat, m_receiverConstants.size( 0 ), m_receiverIsLocal );
 }
 
 
@@ -429,7 +435,7 @@ real64 AcousticFirstOrderWaveEquationSEM::explicitStepInternal( real64 const & t
   arrayView1d< localIndex const > const sourceIsAccessible = m_sourceIsAccessible.toView();
   arrayView1d< localIndex const > const sourceElem = m_sourceElem.toView();
   arrayView1d< localIndex const > const sourceRegion = m_sourceRegion.toView();
-  arrayView2d< real32 const > const sourceValue = m_sourceValue.toView();
+  WaveSolverUtils::SourceTimeFunction const sourceValue = getSourceTimeFunction();
 
   GEOS_LOG_RANK_0_IF( dt < epsilonLoc, "Warning! Value for dt: " << dt << "s is smaller than local threshold: " << epsilonLoc );
 
@@ -557,14 +563,14 @@ void AcousticFirstOrderWaveEquationSEM::cleanup( real64 const time_n, integer co
       compute2dVariableAllSeismoTraces( regionIndex, time_n, 0.0, velocity_y, velocity_y, uyReceivers );
       compute2dVariableAllSeismoTraces( regionIndex, time_n, 0.0, velocity_z, velocity_z, uzReceivers );
 
-      WaveSolverUtils::writeSeismoTraceVector( "seismoTraceReceiver", getName(), m_outputSeismoTrace, m_receiverConstants.size( 0 ),
-                                               m_receiverIsLocal, m_nsamplesSeismoTrace, uxReceivers, uyReceivers, uzReceivers );
+      WaveSolverUtils::writeSeismoTraceVector( "seismoTraceReceiver", getName(), m_outputSeismoTrace, m_outputSeismoTraceFormat, { "velocityx", "velocityy", "velocityz" },
+                                               m_receiverConstants.size( 0 ), m_receiverIsLocal, m_nsamplesSeismoTrace, uxReceivers, uyReceivers, uzReceivers );
 
     } );
     arrayView2d< real32 > const pReceivers = m_pressureNp1AtReceivers.toView();
     computeAllSeismoTraces( time_n, 0.0, p_np1, p_np1, pReceivers );
-    WaveSolverUtils::writeSeismoTrace( "seismoTraceReceiver", getName(), m_outputSeismoTrace, m_receiverConstants.size( 0 ),
-                                       m_receiverIsLocal, m_nsamplesSeismoTrace, pReceivers );
+    WaveSolverUtils::writeSeismoTrace( "seismoTraceReceiver", getName(), m_outputSeismoTrace, m_outputSeismoTraceFormat, "pressure",
+                                       m_receiverConstants.size( 0 ), m_receiverIsLocal, m_nsamplesSeismoTrace, pReceivers );
 
   } );
 }
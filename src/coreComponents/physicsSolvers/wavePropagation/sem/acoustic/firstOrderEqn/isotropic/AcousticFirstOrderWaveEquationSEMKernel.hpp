@@ -21,6 +21,7 @@
 #define GEOS_PHYSICSSOLVERS_WAVEPROPAGATION_ACOUSTICFIRSTTORDERWAVEEQUATIONSEMKERNEL_HPP_
 
 #include "finiteElement/kernelInterface/KernelBase.hpp"
+#include "physicsSolvers/wavePropagation/shared/WaveSolverUtils.hpp"
 
 namespace geos
 {
@@ -180,7 +181,7 @@ struct PressureComputation
           arrayView1d< real32 const > const mass,
           arrayView1d< real32 const > const damping,
           arrayView2d< real64 const > const sourceConstants,
-          arrayView2d< real32 const > const sourceValue,
+          WaveSolverUtils::SourceTimeFunction const sourceValue,
           arrayView1d< localIndex const > const sourceIsAccessible,
           arrayView1d< localIndex const > const sourceElem,
           arrayView1d< localIndex const > const sourceRegion,
@@ -263,9 +264,10 @@ struct PressureComputation
         {
           if( sourceElem[isrc]==k && sourceRegion[isrc] == regionIndex )
           {
+            real32 const sourceValueAtCycle = sourceValue( cycleNumber, isrc );
             for( localIndex i = 0; i < numNodesPerElem; ++i )
             {
-              real32 const localIncrement2 = dt*(sourceConstants[isrc][i]*sourceValue[cycleNumber][isrc])/(mass[elemsToNodes[k][i]]);
+              real32 const localIncrement2 = dt*(sourceConstants[isrc][i]*sourceValueAtCycle)/(mass[elemsToNodes[k][i]]);
               RAJA::atomicAdd< ATOMIC_POLICY >( &p_np1[elemsToNodes[k][i]], localIncrement2 );
             }
           }
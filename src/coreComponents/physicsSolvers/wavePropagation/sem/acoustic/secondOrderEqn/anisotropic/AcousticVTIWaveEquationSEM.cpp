@@ -150,6 +150,10 @@ void AcousticVTIWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLevel & ba
     }
   }
 
+  /// bin the sources and receivers, so that each element only tests the ones that may lie in it
+  PointBinGrid const sourceBins( sourceCoordinates );
+  PointBinGrid const receiverBins( receiverCoordinates );
+
   mesh.getElemManager().forElementSubRegionsComplete< CellElementSubRegion >( regionNames, [&]( localIndex const,
                                                                                                 localIndex const er,
                                                                                                 localIndex const esr,
@@ -188,10 +192,12 @@ void AcousticVTIWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLevel & ba
         elemsToFaces,
         elemCenter,
         sourceCoordinates,
+        sourceBins.toView(),
         sourceIsAccessible,
         sourceNodeIds,
         sourceConstants,
         receiverCoordinates,
+        receiverBins.toView(),
         receiverIsLocal,
         receiverNodeIds,
         receiverConstants,
@@ -209,16 +215,17 @@ void AcousticVTIWaveEquationSEM::addSourceToRightHandSide( integer const & cycle
   arrayView2d< localIndex const > const sourceNodeIds = m_sourceNodeIds.toViewConst();
   arrayView2d< real64 const > const sourceConstants   = m_sourceConstants.toViewConst();
   arrayView1d< localIndex const > const sourceIsAccessible = m_sourceIsAccessible.toViewConst();
-  arrayView2d< real32 const > const sourceValue   = m_sourceValue.toViewConst();
+  WaveSolverUtils::SourceTimeFunction const sourceValue = getSourceTimeFunction();
 
-  GEOS_THROW_IF( cycleNumber > sourceValue.size( 0 ), "Too many steps compared to array size", std::runtime_error );
+  GEOS_THROW_IF( m_precomputeSourceValue && cycleNumber > m_sourceValue.size( 0 ), "Too many steps compared to array size", std::runtime_error );
   forAll< EXEC_POLICY >( sourceConstants.size( 0 ), [=] GEOS_HOST_DEVICE ( localIndex const isrc )
   {
     if( sourceIsAccessible[isrc] == 1 )
     {
+      real32 const sourceValueAtCycle = sourceValue( cycleNumber, isrc );
       for( localIndex inode = 0; inode < sourceConstants.size( 1 ); ++inode )
       {
-        real32 const localIncrement = sourceConstants[isrc][inode] * sourceValue[cycleNumber][isrc];
+        real32 const localIncrement = sourceConstants[isrc][inode] * sourceValueAtCycle;
         RAJA::atomicAdd< ATOMIC_POLICY >( &rhs[sourceNodeIds[isrc][inode]], localIncrement );
       }
     }
@@ -317,7 +324,7 @@ void AcousticVTIWaveEquationSEM::initializePostInitialConditionsPreSubGroups()
     } );
   } );
 
-  WaveSolverUtils::initTrace( "seismoTraceReceiver", getName(), m_outputSeismoTrace, m_receiverConstants.size( 0 ), m_receiverIsLocal );
+  WaveSolverUtils::initTrace( "seismoTraceReceiver", getName(), m_outputSeismoTrace, m_outputSeismoTraceFormat, m_receiverConstants.size( 0 ), m_receiverIsLocal );
 }
 
 void AcousticVTIWaveEquationSEM::precomputeSurfaceFieldIndicator( DomainPartition & domain )
@@ -649,8 +656,8 @@ void AcousticVTIWaveEquationSEM::cleanup( real64 const time_n,
     arrayView2d< real32 > const pReceivers = m_pressureNp1AtReceivers.toView();
     computeAllSeismoTraces( time_n, 0.0, p_np1, p_n, pReceivers );
 
-    WaveSolverUtils::writeSeismoTrace( "seismoTraceReceiver", getName(), m_outputSeismoTrace, m_receiverConstants.size( 0 ),
-                                       m_receiverIsLocal, m_nsamplesSeismoTrace, pReceivers );
+    WaveSolverUtils::writeSeismoTrace( "seismoTraceReceiver", getName(), m_outputSeismoTrace, m_outputSeismoTraceFormat, "pressure",
+                                       m_receiverConstants.size( 0 ), m_receiverIsLocal, m_nsamplesSeismoTrace, pReceivers );
   } );
 }
 
@@ -23,6 +23,7 @@
 #include "finiteElement/elementFormulations/Qk_Hexahedron_Lagrange_GaussLobatto.hpp"
 #include "finiteElement/kernelInterface/KernelBase.hpp"
 #include "physicsSolvers/wavePropagation/shared/WaveSolverUtils.hpp"
+#include "physicsSolvers/wavePropagation/shared/PointBinGrid.hpp"
 #include "AcousticVTIFields.hpp"
 
 namespace geos
@@ -50,10 +51,12 @@ struct PrecomputeSourceAndReceiverKernel
    * @param[in] elemsToFaces map from element to faces
    * @param[in] elemCenter coordinates of the element centers
    * @param[in] sourceCoordinates coordinates of the source terms
+   * @param[in] sourceBins bin grid of the sources
    * @param[out] sourceIsAccessible flag indicating whether the source is accessible or not
    * @param[out] sourceNodeIds indices of the nodes of the element where the source is located
    * @param[out] sourceConstants constant part of the source terms
    * @param[in] receiverCoordinates coordinates of the receiver terms
+   * @param[in] receiverBins bin grid of the receivers
    * @param[out] receiverIsLocal flag indicating whether the receiver is local or not
    * @param[out] receiverNodeIds indices of the nodes of the element where the receiver is located
    * @param[out] receiverConstants constant part of the receiver term
@@ -77,10 +80,12 @@ struct PrecomputeSourceAndReceiverKernel
           arrayView2d< localIndex const > const elemsToFaces,
           arrayView2d< real64 const > const & elemCenter,
           arrayView2d< real64 const > const sourceCoordinates,
+          PointBinGrid::View const sourceBins,
           arrayView1d< localIndex > const sourceIsAccessible,
           arrayView2d< localIndex > const sourceNodeIds,
           arrayView2d< real64 > const sourceConstants,
           arrayView2d< real64 const > const receiverCoordinates,
+          PointBinGrid::View const receiverBins,
           arrayView1d< localIndex > const receiverIsLocal,
           arrayView2d< localIndex > const receiverNodeIds,
           arrayView2d< real64 > const receiverConstants,
@@ -97,11 +102,13 @@ struct PrecomputeSourceAndReceiverKernel
       real64 const center[3] = { elemCenter[k][0],
                                  elemCenter[k][1],
                                  elemCenter[k][2] };
+      real64 elemMin[3], elemMax[3];
+      WaveSolverUtils::computeElementBoundingBox( baseElemsToNodes[k], baseNodeCoords, elemMin, elemMax );
 
       // Step 1: locate the sources, and precompute the source term
 
-      /// loop over all the source that haven't been found yet
-      for( localIndex isrc = 0; isrc < sourceCoordinates.size( 0 ); ++isrc )
+      /// loop over the sources that haven't been found yet and may lie in this element
+      sourceBins.forPointsInBox( elemMin, elemMax, [&]( localIndex const isrc )
       {
         if( sourceIsAccessible[isrc] == 0 )
         {
@@ -145,13 +152,13 @@ struct PrecomputeSourceAndReceiverKernel
             }
           }
         }
-      } // end loop over all sources
+      } ); // end loop over all sources
 
 
       // Step 2: locate the receivers, and precompute the receiver term
 
-      /// loop over all the receivers that haven't been found yet
-      for( localIndex ircv = 0; ircv < receiverCoordinates.size( 0 ); ++ircv )
+      /// loop over the receivers that haven't been found yet and may lie in this element
+      receiverBins.forPointsInBox( elemMin, elemMax, [&]( localIndex const ircv )
       {
         if( receiverIsLocal[ircv] == 0 )
         {
@@ -190,7 +197,7 @@ struct PrecomputeSourceAndReceiverKernel
             }
           }
         }
-      } // end loop over receivers
+      } ); // end loop over receivers
 
     } );
 
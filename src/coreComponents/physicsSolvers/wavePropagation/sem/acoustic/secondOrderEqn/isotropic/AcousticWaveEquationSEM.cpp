@@ -43,7 +43,8 @@ using namespace fields;
 AcousticWaveEquationSEM::AcousticWaveEquationSEM( const std::string & name,
                                                   Group * const parent ):
   WaveSolverBase( name,
-                  parent )
+                  parent ),
+  m_numShotsPerBatch( 1 )
 {
 
   registerWrapper( viewKeyStruct::pressureNp1AtReceiversString(), &m_pressureNp1AtReceivers ).
@@ -51,6 +52,19 @@ AcousticWaveEquationSEM::AcousticWaveEquationSEM( const std::string & name,
     setSizedFromParent( 0 ).
     setDescription( "Pressure value at each receiver for each timestep" );
 
+  registerWrapper( viewKeyStruct::numShotsPerBatchString(), &m_numShotsPerBatch ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 1 ).
+    setDescription( "Number of shots propagated together in a single pass over the mesh. "
+                    "When larger than 1, each source is a separate shot, with index shotIndex + i for the i-th source, "
+                    "and the traces are written for each shot" );
+
+  registerWrapper( viewKeyStruct::pressureNp1AtReceiversBatchString(), &m_pressureNp1AtReceiversBatch ).
+    setInputFlag( InputFlags::FALSE ).
+    setSizedFromParent( 0 ).
+    setDescription( "Pressure value at each receiver for each timestep for each shot of the batch" );
+
+  registerLocalTimeSteppingInputs();
 }
 
 AcousticWaveEquationSEM::~AcousticWaveEquationSEM()
@@ -95,6 +109,28 @@ void AcousticWaveEquationSEM::registerDataOnMesh( Group & meshBodies )
       nodeManager.getField< acousticfields::AuxiliaryVar2PML >().resizeDimension< 1 >( 3 );
     }
 
+    /// register the local time stepping work arrays only when the multi-rate leapfrog is requested
+    if( m_useLocalTimeStepping )
+    {
+      registerLocalTimeSteppingData( mesh, 1 );
+    }
+
+    /// register the pressure of each shot only when several shots are propagated together
+    if( m_numShotsPerBatch > 1 )
+    {
+      nodeManager.registerField< acousticfields::PressureBatch_nm1,
+                                 acousticfields::PressureBatch_n,
+                                 acousticfields::PressureBatch_np1,
+                                 acousticfields::ForcingRHSBatch,
+                                 acousticfields::StiffnessVectorBatch >( getName() );
+
+      nodeManager.getField< acousticfields::PressureBatch_nm1 >().resizeDimension< 1 >( m_numShotsPerBatch );
+      nodeManager.getField< acousticfields::PressureBatch_n >().resizeDimension< 1 >( m_numShotsPerBatch );
+      nodeManager.getField< acousticfields::PressureBatch_np1 >().resizeDimension< 1 >( m_numShotsPerBatch );
+      nodeManager.getField< acousticfields::ForcingRHSBatch >().resizeDimension< 1 >( m_numShotsPerBatch );
+      nodeManager.getField< acousticfields::StiffnessVectorBatch >().resizeDimension< 1 >( m_numShotsPerBatch );
+    }
+
     FaceManager & faceManager = mesh.getFaceManager();
     faceManager.registerField< acousticfields::AcousticFreeSurfaceFaceIndicator >( getName() );
 
@@ -115,6 +151,27 @@ void AcousticWaveEquationSEM::postInputInitialization()
 {
   WaveSolverBase::postInputInitialization();
 
+  GEOS_THROW_IF( m_useLocalTimeStepping && m_usePML,
+                 getDataContext() << ": Local time stepping is not supported with a PML",
+                 InputError );
+
+  GEOS_THROW_IF( m_numShotsPerBatch < 1 || m_numShotsPerBatch > WaveSolverUtils::maxNumShotsPerBatch,
+                 getDataContext() << ": " << viewKeyStruct::numShotsPerBatchString() << " must be between 1 and " << WaveSolverUtils::maxNumShotsPerBatch,
+                 InputError );
+
+  if( m_numShotsPerBatch > 1 )
+  {
+    GEOS_THROW_IF( m_sourceCoordinates.size( 0 ) != m_numShotsPerBatch,
+                   getDataContext() << ": With " << viewKeyStruct::numShotsPerBatchString() << " = " << m_numShotsPerBatch
+                                    << ", one source per shot is expected but " << m_sourceCoordinates.size( 0 ) << " were given",
+                   InputError );
+    GEOS_THROW_IF( m_usePML || m_useLocalTimeStepping || m_enableLifo,
+                   getDataContext() << ": Batched propagation is not supported with a PML, local time stepping or LIFO storage",
+                   InputError );
+
+    m_pressureNp1AtReceiversBatch.resize( m_nsamplesSeismoTrace, m_receiverCoordinates.size( 0 ) + 1, m_numShotsPerBatch );
+  }
+
   m_pressureNp1AtReceivers.resize( m_nsamplesSeismoTrace, m_receiverCoordinates.size( 0 ) + 1 );
 }
 
@@ -156,6 +213,10 @@ void AcousticWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLevel & baseM
     }
   }
 
+  /// bin the sources and receivers, so that each element only tests the ones that may lie in it
+  PointBinGrid const sourceBins( sourceCoordinates );
+  PointBinGrid const receiverBins( receiverCoordinates );
+
   mesh.getElemManager().forElementSubRegionsComplete< CellElementSubRegion >( regionNames, [&]( localIndex const,
                                                                                                 localIndex const er,
                                                                                                 localIndex const esr,
@@ -196,10 +257,12 @@ void AcousticWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLevel & baseM
           elemsToFaces,
           elemCenter,
           sourceCoordinates,
+          sourceBins.toView(),
           sourceIsAccessible,
           sourceNodeIds,
           sourceConstants,
           receiverCoordinates,
+          receiverBins.toView(),
           receiverIsLocal,
           receiverNodeIds,
           receiverConstants,
@@ -218,24 +281,49 @@ void AcousticWaveEquationSEM::addSourceToRightHandSide( integer const & cycleNum
   arrayView2d< localIndex const > const sourceNodeIds = m_sourceNodeIds.toViewConst();
   arrayView2d< real64 const > const sourceConstants   = m_sourceConstants.toViewConst();
   arrayView1d< localIndex const > const sourceIsAccessible = m_sourceIsAccessible.toViewConst();
-  arrayView2d< real32 const > const sourceValue   = m_sourceValue.toViewConst();
+  WaveSolverUtils::SourceTimeFunction const sourceValue = getSourceTimeFunction();
 
-  GEOS_THROW_IF( cycleNumber > sourceValue.size( 0 ),
+  GEOS_THROW_IF( m_precomputeSourceValue && cycleNumber > m_sourceValue.size( 0 ),
                  getDataContext() << ": Too many steps compared to array size",
                  std::runtime_error );
   forAll< EXEC_POLICY >( sourceConstants.size( 0 ), [=] GEOS_HOST_DEVICE ( localIndex const isrc )
   {
     if( sourceIsAccessible[isrc] == 1 )
     {
+      real32 const sourceValueAtCycle = sourceValue( cycleNumber, isrc );
       for( localIndex inode = 0; inode < sourceConstants.size( 1 ); ++inode )
       {
-        real32 const localIncrement = sourceConstants[isrc][inode] * sourceValue[cycleNumber][isrc];
+        real32 const localIncrement = sourceConstants[isrc][inode] * sourceValueAtCycle;
         RAJA::atomicAdd< ATOMIC_POLICY >( &rhs[sourceNodeIds[isrc][inode]], localIncrement );
       }
     }
   } );
 }
 
+void AcousticWaveEquationSEM::addSourceToRightHandSideBatched( integer const & cycleNumber, arrayView2d< real32 > const rhs )
+{
+  arrayView2d< localIndex const > const sourceNodeIds = m_sourceNodeIds.toViewConst();
+  arrayView2d< real64 const > const sourceConstants   = m_sourceConstants.toViewConst();
+  arrayView1d< localIndex const > const sourceIsAccessible = m_sourceIsAccessible.toViewConst();
+  WaveSolverUtils::SourceTimeFunction const sourceValue = getSourceTimeFunction();
+
+  GEOS_THROW_IF( m_precomputeSourceValue && cycleNumber > m_sourceValue.size( 0 ),
+                 getDataContext() << ": Too many steps compared to array size",
+                 std::runtime_error );
+  forAll< EXEC_POLICY >( sourceConstants.size( 0 ), [=] GEOS_HOST_DEVICE ( localIndex const isrc )
+  {
+    if( sourceIsAccessible[isrc] == 1 )
+    {
+      real32 const sourceValueAtCycle = sourceValue( cycleNumber, isrc );
+      for( localIndex inode = 0; inode < sourceConstants.size( 1 ); ++inode )
+      {
+        real32 const localIncrement = sourceConstants[isrc][inode] * sourceValueAtCycle;
+        RAJA::atomicAdd< ATOMIC_POLICY >( &rhs[sourceNodeIds[isrc][inode]][isrc], localIncrement );
+      }
+    }
+  } );
+}
+
 void AcousticWaveEquationSEM::initializePostInitialConditionsPreSubGroups()
 {
   GEOS_MARK_FUNCTION;
@@ -327,9 +415,22 @@ void AcousticWaveEquationSEM::initializePostInitialConditionsPreSubGroups()
 
       } );
     } );
+
+    if( m_useLocalTimeStepping )
+    {
+      computeLocalTimeSteppingLevels( domain, mesh, regionNames, acousticfields::AcousticVelocity::key() );
+    }
   } );
 
-  WaveSolverUtils::initTrace( "seismoTraceReceiver", getName(), m_outputSeismoTrace, m_receiverConstants.size( 0 ), m_receiverIsLocal );
+  if( m_numShotsPerBatch > 1 )
+  {
+    WaveSolverUtils::initTraceBatched( "seismoTraceReceiver", getName(), m_outputSeismoTrace, m_outputSeismoTraceFormat, m_receiverConstants.size( 0 ), m_receiverIsLocal,
+                                       m_shotIndex, m_numShotsPerBatch );
+  }
+  else
+  {
+    WaveSolverUtils::initTrace( "seismoTraceReceiver", getName(), m_outputSeismoTrace, m_outputSeismoTraceFormat, m_receiverConstants.size( 0 ), m_receiverIsLocal );
+  }
 }
 
 
@@ -771,50 +872,49 @@ real64 AcousticWaveEquationSEM::explicitStepForward( real64 const & time_n,
 
       arrayView1d< real32 > const p_dt2 = nodeManager.getField< acousticfields::PressureDoubleDerivative >();
 
-      if( m_enableLifo )
+      if( m_numShotsPerBatch > 1 )
       {
-        if( !m_lifo )
+        // one file per shot, so that the backward propagation can be run shot by shot
+        arrayView2d< real32 const > const pBatch_nm1 = nodeManager.getField< acousticfields::PressureBatch_nm1 >();
+        arrayView2d< real32 const > const pBatch_n = nodeManager.getField< acousticfields::PressureBatch_n >();
+        arrayView2d< real32 const > const pBatch_np1 = nodeManager.getField< acousticfields::PressureBatch_np1 >();
+        for( integer s = 0; s < m_numShotsPerBatch; ++s )
         {
-          int const rank = MpiWrapper::commRank( MPI_COMM_GEOS );
-          std::string lifoPrefix = GEOS_FMT( "lifo/rank_{:05}/pdt2_shot{:06}", rank, m_shotIndex );
-          m_lifo = std::make_unique< LifoStorage< real32, localIndex > >( lifoPrefix, p_dt2, m_lifoOnDevice, m_lifoOnHost, m_lifoSize );
+          forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOS_HOST_DEVICE ( localIndex const nodeIdx )
+          {
+            p_dt2[nodeIdx] = (pBatch_np1[nodeIdx][s] - 2*pBatch_n[nodeIdx][s] + pBatch_nm1[nodeIdx][s]) / pow( dt, 2 );
+          } );
+          writePressureDoubleDerivative( p_dt2, m_shotIndex + s, cycleNumber );
         }
-
-        m_lifo->pushWait();
-      }
-      forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOS_HOST_DEVICE ( localIndex const nodeIdx )
-      {
-        p_dt2[nodeIdx] = (p_np1[nodeIdx] - 2*p_n[nodeIdx] + p_nm1[nodeIdx]) / pow( dt, 2 );
-      } );
-
-      if( m_enableLifo )
-      {
-        // Need to tell LvArray data is on GPU to avoir HtoD copy
-        p_dt2.move( LvArray::MemorySpace::cuda, false );
-        m_lifo->pushAsync( p_dt2 );
       }
       else
       {
-        GEOS_MARK_SCOPE ( DirectWrite );
-        p_dt2.move( LvArray::MemorySpace::host, false );
-        int const rank = MpiWrapper::commRank( MPI_COMM_GEOS );
-        std::string fileName = GEOS_FMT( "lifo/rank_{:05}/pressuredt2_{:06}_{:08}.dat", rank, m_shotIndex, cycleNumber );
-        int lastDirSeparator = fileName.find_last_of( "/\\" );
-        std::string dirName = fileName.substr( 0, lastDirSeparator );
-        if( string::npos != (size_t)lastDirSeparator && !directoryExists( dirName ))
+        if( m_enableLifo )
         {
-          makeDirsForPath( dirName );
+          if( !m_lifo )
+          {
+            int const rank = MpiWrapper::commRank( MPI_COMM_GEOS );
+            std::string lifoPrefix = GEOS_FMT( "lifo/rank_{:05}/pdt2_shot{:06}", rank, m_shotIndex );
+            m_lifo = std::make_unique< LifoStorage< real32, localIndex > >( lifoPrefix, p_dt2, m_lifoOnDevice, m_lifoOnHost, m_lifoSize );
+          }
+
+          m_lifo->pushWait();
         }
+        forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOS_HOST_DEVICE ( localIndex const nodeIdx )
+        {
+          p_dt2[nodeIdx] = (p_np1[nodeIdx] - 2*p_n[nodeIdx] + p_nm1[nodeIdx]) / pow( dt, 2 );
+        } );
 
-        std::ofstream wf( fileName, std::ios::out | std::ios::binary );
-        GEOS_THROW_IF( !wf,
-                       getDataContext() << ": Could not open file "<< fileName << " for writing",
-                       InputError );
-        wf.write( (char *)&p_dt2[0], p_dt2.size()*sizeof( real32 ) );
-        wf.close( );
-        GEOS_THROW_IF( !wf.good(),
-                       getDataContext() << ": An error occured while writing "<< fileName,
-                       InputError );
+        if( m_enableLifo )
+        {
+          // Need to tell LvArray data is on GPU to avoir HtoD copy
+          p_dt2.move( LvArray::MemorySpace::cuda, false );
+          m_lifo->pushAsync( p_dt2 );
+        }
+        else
+        {
+          writePressureDoubleDerivative( p_dt2, m_shotIndex, cycleNumber );
+        }
       }
 
     }
@@ -826,12 +926,41 @@ real64 AcousticWaveEquationSEM::explicitStepForward( real64 const & time_n,
 }
 
 
+void AcousticWaveEquationSEM::writePressureDoubleDerivative( arrayView1d< real32 > const p_dt2,
+                                                             integer const shotIndex,
+                                                             integer const cycleNumber )
+{
+  GEOS_MARK_SCOPE ( DirectWrite );
+  p_dt2.move( LvArray::MemorySpace::host, false );
+  int const rank = MpiWrapper::commRank( MPI_COMM_GEOS );
+  std::string fileName = GEOS_FMT( "lifo/rank_{:05}/pressuredt2_{:06}_{:08}.dat", rank, shotIndex, cycleNumber );
+  int lastDirSeparator = fileName.find_last_of( "/\\" );
+  std::string dirName = fileName.substr( 0, lastDirSeparator );
+  if( string::npos != (size_t)lastDirSeparator && !directoryExists( dirName ))
+  {
+    makeDirsForPath( dirName );
+  }
+
+  std::ofstream wf( fileName, std::ios::out | std::ios::binary );
+  GEOS_THROW_IF( !wf,
+                 getDataContext() << ": Could not open file "<< fileName << " for writing",
+                 InputError );
+  wf.write( (char *)&p_dt2[0], p_dt2.size()*sizeof( real32 ) );
+  wf.close( );
+  GEOS_THROW_IF( !wf.good(),
+                 getDataContext() << ": An error occured while writing "<< fileName,
+                 InputError );
+}
+
 real64 AcousticWaveEquationSEM::explicitStepBackward( real64 const & time_n,
                                                       real64 const & dt,
                                                       integer cycleNumber,
                                                       DomainPartition & domain,
                                                       bool computeGradient )
 {
+  GEOS_ERROR_IF( m_numShotsPerBatch > 1,
+                 getDataContext() << ": Batched propagation only supports forward modeling, the backward propagation must be run shot by shot" );
+
   real64 dtOut = explicitStepInternal( time_n, dt, cycleNumber, domain );
   forDiscretizationOnMeshTargets( domain.getMeshBodies(),
                                   [&] ( string const &,
@@ -911,24 +1040,64 @@ void AcousticWaveEquationSEM::prepareNextTimestep( MeshLevel & mesh )
 {
   NodeManager & nodeManager = mesh.getNodeManager();
 
-  arrayView1d< real32 > const p_nm1 = nodeManager.getField< acousticfields::Pressure_nm1 >();
-  arrayView1d< real32 > const p_n   = nodeManager.getField< acousticfields::Pressure_n >();
-  arrayView1d< real32 > const p_np1 = nodeManager.getField< acousticfields::Pressure_np1 >();
-
-  arrayView1d< real32 > const stiffnessVector = nodeManager.getField< acousticfields::StiffnessVector >();
-  arrayView1d< real32 > const rhs = nodeManager.getField< acousticfields::ForcingRHS >();
-
   SortedArrayView< localIndex const > const solverTargetNodesSet = m_solverTargetNodesSet.toViewConst();
 
-  forAll< EXEC_POLICY >( solverTargetNodesSet.size(), [=] GEOS_HOST_DEVICE ( localIndex const n )
+  /// the stiffness vector and the right-hand side have already been reset by the time update
+  WaveSolverUtils::rotateTimeLevels( nodeManager.getField< acousticfields::Pressure_nm1 >(),
+                                     nodeManager.getField< acousticfields::Pressure_n >(),
+                                     nodeManager.getField< acousticfields::Pressure_np1 >(),
+                                     solverTargetNodesSet );
+
+  if( m_numShotsPerBatch > 1 )
   {
-    localIndex const a = solverTargetNodesSet[n];
+    WaveSolverUtils::rotateTimeLevels( nodeManager.getField< acousticfields::PressureBatch_nm1 >(),
+                                       nodeManager.getField< acousticfields::PressureBatch_n >(),
+                                       nodeManager.getField< acousticfields::PressureBatch_np1 >(),
+                                       solverTargetNodesSet );
+  }
+}
 
-    p_nm1[a] = p_n[a];
-    p_n[a]   = p_np1[a];
+void AcousticWaveEquationSEM::computeUnknownsBatched( real64 const & dt,
+                                                      integer const cycleNumber,
+                                                      MeshLevel & mesh,
+                                                      arrayView1d< string const > const & regionNames )
+{
+  NodeManager & nodeManager = mesh.getNodeManager();
 
-    stiffnessVector[a] = rhs[a] = 0.0;
-  } );
+  arrayView1d< real32 const > const mass = nodeManager.getField< acousticfields::AcousticMassVector >();
+  arrayView1d< real32 const > const damping = nodeManager.getField< acousticfields::DampingVector >();
+
+  arrayView2d< real32 const > const pBatch_nm1 = nodeManager.getField< acousticfields::PressureBatch_nm1 >();
+  arrayView2d< real32 const > const pBatch_n = nodeManager.getField< acousticfields::PressureBatch_n >();
+  arrayView2d< real32 > const pBatch_np1 = nodeManager.getField< acousticfields::PressureBatch_np1 >();
+
+  arrayView1d< localIndex const > const freeSurfaceNodeIndicator = nodeManager.getField< acousticfields::AcousticFreeSurfaceNodeIndicator >();
+  arrayView2d< real32 > const stiffnessVectorBatch = nodeManager.getField< acousticfields::StiffnessVectorBatch >();
+  arrayView2d< real32 > const rhsBatch = nodeManager.getField< acousticfields::ForcingRHSBatch >();
+
+  /// a single pass over the mesh computes the stiffness vector of all the shots
+  auto kernelFactory = acousticWaveEquationSEMKernels::ExplicitAcousticBatchedSEMFactory( dt );
+
+  finiteElement::
+    regionBasedKernelApplication< EXEC_POLICY,
+                                  constitutive::NullModel,
+                                  CellElementSubRegion >( mesh,
+                                                          regionNames,
+                                                          getDiscretizationName(),
+                                                          "",
+                                                          kernelFactory );
+
+  //Modification of cycleNember useful when minTime < 0
+  EventManager const & event = getGroupByPath< EventManager >( "/Problem/Events" );
+  real64 const & minTime = event.getReference< real64 >( EventManager::viewKeyStruct::minTimeString() );
+  integer const cycleForSource = int(round( -minTime / dt + cycleNumber ));
+  addSourceToRightHandSideBatched( cycleForSource, rhsBatch );
+
+  SortedArrayView< localIndex const > const solverTargetNodesSet = m_solverTargetNodesSet.toViewConst();
+
+  GEOS_MARK_SCOPE ( updatePBatched );
+  AcousticTimeSchemeSEM::LeapFrogWithoutPMLBatched( dt, pBatch_np1, pBatch_n, pBatch_nm1, mass, stiffnessVectorBatch, damping,
+                                                    rhsBatch, freeSurfaceNodeIndicator, solverTargetNodesSet );
 }
 
 void AcousticWaveEquationSEM::computeUnknowns( real64 const & time_n,
@@ -938,6 +1107,12 @@ void AcousticWaveEquationSEM::computeUnknowns( real64 const & time_n,
                                                MeshLevel & mesh,
                                                arrayView1d< string const > const & regionNames )
 {
+  if( m_numShotsPerBatch > 1 )
+  {
+    computeUnknownsBatched( dt, cycleNumber, mesh, regionNames );
+    return;
+  }
+
   NodeManager & nodeManager = mesh.getNodeManager();
 
   arrayView1d< real32 const > const mass = nodeManager.getField< acousticfields::AcousticMassVector >();
@@ -951,16 +1126,19 @@ void AcousticWaveEquationSEM::computeUnknowns( real64 const & time_n,
   arrayView1d< real32 > const stiffnessVector = nodeManager.getField< acousticfields::StiffnessVector >();
   arrayView1d< real32 > const rhs = nodeManager.getField< acousticfields::ForcingRHS >();
 
-  auto kernelFactory = acousticWaveEquationSEMKernels::ExplicitAcousticSEMFactory( dt );
-
-  finiteElement::
-    regionBasedKernelApplication< EXEC_POLICY,
-                                  constitutive::NullModel,
-                                  CellElementSubRegion >( mesh,
-                                                          regionNames,
-                                                          getDiscretizationName(),
-                                                          "",
-                                                          kernelFactory );
+  if( !m_useLocalTimeStepping )
+  {
+    auto kernelFactory = acousticWaveEquationSEMKernels::ExplicitAcousticSEMFactory( dt );
+
+    finiteElement::
+      regionBasedKernelApplication< EXEC_POLICY,
+                                    constitutive::NullModel,
+                                    CellElementSubRegion >( mesh,
+                                                            regionNames,
+                                                            getDiscretizationName(),
+                                                            "",
+                                                            kernelFactory );
+  }
   //Modification of cycleNember useful when minTime < 0
   EventManager const & event = getGroupByPath< EventManager >( "/Problem/Events" );
   real64 const & minTime = event.getReference< real64 >( EventManager::viewKeyStruct::minTimeString() );
@@ -971,7 +1149,39 @@ void AcousticWaveEquationSEM::computeUnknowns( real64 const & time_n,
   real64 const dt2 = pow( dt, 2 );
 
   SortedArrayView< localIndex const > const solverTargetNodesSet = m_solverTargetNodesSet.toViewConst();
-  if( !m_usePML )
+  if( m_useLocalTimeStepping )
+  {
+    GEOS_MARK_SCOPE ( updatePWithLTS );
+    arrayView2d< real32 > const ltsState = nodeManager.getField< fields::localTimeSteppingState >();
+    arrayView2d< real32 > const ltsForce = nodeManager.getField< fields::localTimeSteppingForce >();
+    arrayView2d< real32 const > const ltsResult = nodeManager.getField< fields::localTimeSteppingResult >();
+
+    /// the level 0 state is p_n, and the source enters the frozen force of the coarsest level
+    forAll< EXEC_POLICY >( solverTargetNodesSet.size(), [=] GEOS_HOST_DEVICE ( localIndex const n )
+    {
+      localIndex const a = solverTargetNodesSet[n];
+      ltsState[a][0] = p_n[a];
+      ltsForce[a][0] = -rhs[a] / mass[a];
+      rhs[a] = 0.0;
+    } );
+
+    computeLocalTimeSteppingUpdate( dt, domain, mesh, 1, freeSurfaceNodeIndicator, [&]( integer const level )
+    {
+      auto kernelFactory = acousticWaveEquationSEMKernels::ExplicitAcousticLTSSEMFactory( dt, level );
+      finiteElement::
+        regionBasedKernelApplication< EXEC_POLICY,
+                                      constitutive::NullModel,
+                                      CellElementSubRegion >( mesh,
+                                                              regionNames,
+                                                              getDiscretizationName(),
+                                                              "",
+                                                              kernelFactory );
+    } );
+
+    AcousticTimeSchemeSEM::LocalTimeSteppingLeapFrog( dt, p_np1, p_nm1, mass, damping, ltsResult,
+                                                      freeSurfaceNodeIndicator, solverTargetNodesSet );
+  }
+  else if( !m_usePML )
   {
     GEOS_MARK_SCOPE ( updateP );
     AcousticTimeSchemeSEM::LeapFrogWithoutPML( dt, p_np1, p_n, p_nm1, mass, stiffnessVector, damping,
@@ -1037,6 +1247,7 @@ void AcousticWaveEquationSEM::computeUnknowns( real64 const & time_n,
         }
         u_n[a] += dt * p_n[a];
       }
+      stiffnessVector[a] = rhs[a] = 0.0;
     } );
   }
 }
@@ -1058,7 +1269,14 @@ void AcousticWaveEquationSEM::synchronizeUnknowns( real64 const & time_n,
 
   /// synchronize pressure fields
   FieldIdentifiers fieldsToBeSync;
-  fieldsToBeSync.addFields( FieldLocation::Node, { acousticfields::Pressure_np1::key() } );
+  if( m_numShotsPerBatch > 1 )
+  {
+    fieldsToBeSync.addFields( FieldLocation::Node, { acousticfields::PressureBatch_np1::key() } );
+  }
+  else
+  {
+    fieldsToBeSync.addFields( FieldLocation::Node, { acousticfields::Pressure_np1::key() } );
+  }
 
   if( m_usePML )
   {
@@ -1073,9 +1291,17 @@ void AcousticWaveEquationSEM::synchronizeUnknowns( real64 const & time_n,
                                 domain.getNeighbors(),
                                 true );
   /// compute the seismic traces since last step.
-  arrayView2d< real32 > const pReceivers = m_pressureNp1AtReceivers.toView();
-
-  computeAllSeismoTraces( time_n, dt, p_np1, p_n, pReceivers );
+  if( m_numShotsPerBatch > 1 )
+  {
+    arrayView2d< real32 const > const pBatch_n = nodeManager.getField< acousticfields::PressureBatch_n >();
+    arrayView2d< real32 const > const pBatch_np1 = nodeManager.getField< acousticfields::PressureBatch_np1 >();
+    computeAllSeismoTracesBatched( time_n, dt, pBatch_np1, pBatch_n, m_pressureNp1AtReceiversBatch.toView() );
+  }
+  else
+  {
+    arrayView2d< real32 > const pReceivers = m_pressureNp1AtReceivers.toView();
+    computeAllSeismoTraces( time_n, dt, p_np1, p_n, pReceivers );
+  }
   incrementIndexSeismoTrace( time_n );
 
   if( m_usePML )
@@ -1122,13 +1348,25 @@ void AcousticWaveEquationSEM::cleanup( real64 const time_n,
                                                                 arrayView1d< string const > const & )
   {
     NodeManager & nodeManager = mesh.getNodeManager();
+    if( m_numShotsPerBatch > 1 )
+    {
+      arrayView2d< real32 const > const pBatch_n = nodeManager.getField< acousticfields::PressureBatch_n >();
+      arrayView2d< real32 const > const pBatch_np1 = nodeManager.getField< acousticfields::PressureBatch_np1 >();
+      arrayView3d< real32 > const pReceiversBatch = m_pressureNp1AtReceiversBatch.toView();
+      computeAllSeismoTracesBatched( time_n, 0.0, pBatch_np1, pBatch_n, pReceiversBatch );
+
+      WaveSolverUtils::writeSeismoTraceBatched( "seismoTraceReceiver", getName(), m_outputSeismoTrace, m_outputSeismoTraceFormat, "pressure",
+                                                m_receiverConstants.size( 0 ), m_receiverIsLocal, m_nsamplesSeismoTrace, m_shotIndex, pReceiversBatch );
+      return;
+    }
+
     arrayView1d< real32 const > const p_n = nodeManager.getField< acousticfields::Pressure_n >();
     arrayView1d< real32 const > const p_np1 = nodeManager.getField< acousticfields::Pressure_np1 >();
     arrayView2d< real32 > const pReceivers = m_pressureNp1AtReceivers.toView();
     computeAllSeismoTraces( time_n, 0.0, p_np1, p_n, pReceivers );
 
-    WaveSolverUtils::writeSeismoTrace( "seismoTraceReceiver", getName(), m_outputSeismoTrace, m_receiverConstants.size( 0 ),
-                                       m_receiverIsLocal, m_nsamplesSeismoTrace, pReceivers );
+    WaveSolverUtils::writeSeismoTrace( "seismoTraceReceiver", getName(), m_outputSeismoTrace, m_outputSeismoTraceFormat, "pressure",
+                                       m_receiverConstants.size( 0 ), m_receiverIsLocal, m_nsamplesSeismoTrace, pReceivers );
   } );
 }
 
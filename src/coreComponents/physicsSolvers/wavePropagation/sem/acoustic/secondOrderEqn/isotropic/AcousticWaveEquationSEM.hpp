@@ -89,6 +89,14 @@ public:
    */
   virtual void addSourceToRightHandSide( integer const & cycleNumber, arrayView1d< real32 > const rhs );
 
+  /**
+   * @brief Multiply the precomputed term by the Ricker and add to the right-hand side of the batched propagation,
+   * the i-th source being the source of the i-th shot of the batch
+   * @param cycleNumber the cycle number/step number of evaluation of the source
+   * @param rhs the right hand side of each shot, indexed by (node, shot)
+   */
+  void addSourceToRightHandSideBatched( integer const & cycleNumber, arrayView2d< real32 > const rhs );
+
 
   /**
    * @brief Initialize Perfectly Matched Layer (PML) information
@@ -104,6 +112,8 @@ public:
   struct viewKeyStruct : WaveSolverBase::viewKeyStruct
   {
     static constexpr char const * pressureNp1AtReceiversString() { return "pressureNp1AtReceivers"; }
+    static constexpr char const * pressureNp1AtReceiversBatchString() { return "pressureNp1AtReceiversBatch"; }
+    static constexpr char const * numShotsPerBatchString() { return "numShotsPerBatch"; }
 
   } waveEquationViewKeys;
 
@@ -137,6 +147,18 @@ public:
 
   void prepareNextTimestep( MeshLevel & mesh );
 
+  /**
+   * @brief Compute the pressure at time n+1 of all the shots of the batch
+   * @param dt the perscribed timestep
+   * @param cycleNumber the current cycle number
+   * @param mesh the mesh level
+   * @param regionNames the target regions
+   */
+  void computeUnknownsBatched( real64 const & dt,
+                               integer const cycleNumber,
+                               MeshLevel & mesh,
+                               arrayView1d< string const > const & regionNames );
+
 protected:
 
   virtual void postInputInitialization() override final;
@@ -167,9 +189,25 @@ private:
    */
   virtual void applyPML( real64 const time, DomainPartition & domain ) override;
 
+  /**
+   * @brief Write the second time derivative of the pressure of a shot to disk, to be read back during the backward propagation
+   * @param p_dt2 the second time derivative of the pressure
+   * @param shotIndex the index of the shot
+   * @param cycleNumber the current cycle number
+   */
+  void writePressureDoubleDerivative( arrayView1d< real32 > const p_dt2,
+                                      integer const shotIndex,
+                                      integer const cycleNumber );
+
   /// Pressure_np1 at the receiver location for each time step for each receiver
   array2d< real32 > m_pressureNp1AtReceivers;
 
+  /// Number of shots propagated together, the i-th source being the source of the i-th shot
+  integer m_numShotsPerBatch;
+
+  /// Pressure_np1 at the receiver location for each time step for each receiver for each shot of the batch
+  array3d< real32 > m_pressureNp1AtReceiversBatch;
+
 };
 
 } /* namespace geos */
@@ -221,6 +221,303 @@ protected:
 using ExplicitAcousticSEMFactory = finiteElement::KernelFactory< ExplicitAcousticSEM,
                                                                  real64 >;
 
+/**
+ * @brief Implements the stiffness kernel of the local time stepping (multi-rate leapfrog) scheme
+ * @copydoc geos::finiteElement::KernelBase
+ *
+ * ### ExplicitAcousticLTSSEM Description
+ * Computes M^{-1} K ( P_l - P_{l+1} ) w, where w is the local time stepping state of level l and
+ * P_l - P_{l+1} selects the nodes of level l, and adds it to the local time stepping force of level l+1.
+ * Only the elements having at least one node of level l are visited.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+class ExplicitAcousticLTSSEM : public ExplicitAcousticSEM< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >
+{
+public:
+
+  /// Alias for the base class;
+  using Base = ExplicitAcousticSEM< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >;
+
+  using Base::numNodesPerElem;
+  using Base::numQuadraturePointsPerElem;
+  using Base::m_elemsToNodes;
+  using Base::m_finiteElementSpace;
+  using typename Base::StackVariables;
+
+  /**
+   * @brief Constructor
+   * @copydoc geos::finiteElement::KernelBase::KernelBase
+   * @param nodeManager Reference to the NodeManager object.
+   * @param edgeManager Reference to the EdgeManager object.
+   * @param faceManager Reference to the FaceManager object.
+   * @param targetRegionIndex Index of the region the subregion belongs to.
+   * @param dt The time interval for the step.
+   * @param level The local time stepping level of the nodes on which the stiffness is applied.
+   */
+  ExplicitAcousticLTSSEM( NodeManager & nodeManager,
+                          EdgeManager const & edgeManager,
+                          FaceManager const & faceManager,
+                          localIndex const targetRegionIndex,
+                          SUBREGION_TYPE const & elementSubRegion,
+                          FE_TYPE const & finiteElementSpace,
+                          CONSTITUTIVE_TYPE & inputConstitutiveType,
+                          real64 const dt,
+                          integer const level ):
+    Base( nodeManager,
+          edgeManager,
+          faceManager,
+          targetRegionIndex,
+          elementSubRegion,
+          finiteElementSpace,
+          inputConstitutiveType,
+          dt ),
+    m_mass( nodeManager.getField< fields::acousticfields::AcousticMassVector >() ),
+    m_nodeLevel( nodeManager.getField< fields::localTimeSteppingNodeLevel >() ),
+    m_state( nodeManager.getField< fields::localTimeSteppingState >() ),
+    m_force( nodeManager.getField< fields::localTimeSteppingForce >() ),
+    m_bandElements( elementSubRegion.template getReference< ArrayOfArrays< localIndex > >(
+                      WaveSolverBase::viewKeyStruct::localTimeSteppingElementsString() ).toViewConst() ),
+    m_level( level )
+  {}
+
+  /**
+   * @brief Kernel launcher restricted to the elements touching the nodes of level m_level.
+   * @copydoc geos::finiteElement::KernelBase::kernelLaunch
+   */
+  template< typename POLICY,
+            typename KERNEL_TYPE >
+  static
+  real64
+  kernelLaunch( localIndex const numElems,
+                KERNEL_TYPE const & kernelComponent )
+  {
+    GEOS_MARK_FUNCTION;
+    GEOS_UNUSED_VAR( numElems );
+
+    ArrayOfArraysView< localIndex const > const bandElements = kernelComponent.m_bandElements;
+    integer const level = kernelComponent.m_level;
+    forAll< POLICY >( bandElements.sizeOfArray( level ),
+                      [=] GEOS_HOST_DEVICE ( localIndex const i )
+    {
+      localIndex const k = bandElements( level, i );
+      typename KERNEL_TYPE::StackVariables stack;
+
+      kernelComponent.setup( k, stack );
+      for( integer q=0; q<numQuadraturePointsPerElem; ++q )
+      {
+        kernelComponent.quadraturePointKernel( k, q, stack );
+      }
+      kernelComponent.complete( k, stack );
+    } );
+    return 0;
+  }
+
+  /**
+   * @copydoc geos::finiteElement::KernelBase::complete
+   */
+  GEOS_HOST_DEVICE
+  GEOS_FORCE_INLINE
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const
+  {
+    localIndex const column = WaveSolverUtils::localTimeSteppingColumn( m_level + 1, 0, 1 );
+    for( int i=0; i<numNodesPerElem; i++ )
+    {
+      localIndex const nodeIndex = m_elemsToNodes( k, i );
+      RAJA::atomicAdd< parallelDeviceAtomic >( &m_force[nodeIndex][column], stack.stiffnessVectorLocal[i] / m_mass[nodeIndex] );
+    }
+    return 0;
+  }
+
+  /**
+   * @copydoc geos::finiteElement::KernelBase::quadraturePointKernel
+   *
+   * ### ExplicitAcousticLTSSEM Description
+   * Calculates the stiffness vector applied to the state of the nodes of level m_level
+   */
+  GEOS_HOST_DEVICE
+  GEOS_FORCE_INLINE
+  void quadraturePointKernel( localIndex const k,
+                              localIndex const q,
+                              StackVariables & stack ) const
+  {
+    localIndex const column = WaveSolverUtils::localTimeSteppingColumn( m_level, 0, 1 );
+    m_finiteElementSpace.template computeStiffnessTerm( q, stack.xLocal, [&] ( const int i, const int j, const real64 val )
+    {
+      localIndex const nodeIndex = m_elemsToNodes( k, j );
+      if( m_nodeLevel[nodeIndex] == m_level )
+      {
+        stack.stiffnessVectorLocal[ i ] += stack.invDensity*val*m_state[nodeIndex][column];
+      }
+    } );
+  }
+
+protected:
+
+  /// The array containing the diagonal of the mass matrix
+  arrayView1d< real32 const > const m_mass;
+
+  /// The array containing the local time stepping level of the nodes
+  arrayView1d< integer const > const m_nodeLevel;
+
+  /// The local time stepping states
+  arrayView2d< real32 const > const m_state;
+
+  /// The local time stepping forces
+  arrayView2d< real32 > const m_force;
+
+  /// For each level, the elements having at least one node of this level
+  ArrayOfArraysView< localIndex const > const m_bandElements;
+
+  /// The local time stepping level of the nodes on which the stiffness is applied
+  integer const m_level;
+
+};
+
+/// The factory used to construct a ExplicitAcousticLTSSEM kernel.
+using ExplicitAcousticLTSSEMFactory = finiteElement::KernelFactory< ExplicitAcousticLTSSEM,
+                                                                    real64,
+                                                                    integer >;
+
+
+/**
+ * @brief Implements the stiffness kernel of the batched (multi-shot) propagation
+ * @copydoc geos::finiteElement::KernelBase
+ *
+ * ### ExplicitAcousticBatchedSEM Description
+ * Computes the stiffness vector of all the shots of the batch in a single pass over the mesh.
+ * The pressure is stored as [node][shot], so that the element geometry and the stiffness
+ * coefficients are evaluated once and applied to the contiguous pressure values of all the shots.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+class ExplicitAcousticBatchedSEM : public ExplicitAcousticSEM< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >
+{
+public:
+
+  /// Alias for the base class;
+  using Base = ExplicitAcousticSEM< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >;
+
+  using Base::numNodesPerElem;
+  using Base::m_elemsToNodes;
+  using Base::m_finiteElementSpace;
+
+  /// Maximum number of shots handled by one kernel launch
+  static constexpr integer maxNumShots = WaveSolverUtils::maxNumShotsPerBatch;
+
+  /**
+   * @brief Constructor
+   * @copydoc geos::finiteElement::KernelBase::KernelBase
+   * @param nodeManager Reference to the NodeManager object.
+   * @param edgeManager Reference to the EdgeManager object.
+   * @param faceManager Reference to the FaceManager object.
+   * @param targetRegionIndex Index of the region the subregion belongs to.
+   * @param dt The time interval for the step.
+   */
+  ExplicitAcousticBatchedSEM( NodeManager & nodeManager,
+                              EdgeManager const & edgeManager,
+                              FaceManager const & faceManager,
+                              localIndex const targetRegionIndex,
+                              SUBREGION_TYPE const & elementSubRegion,
+                              FE_TYPE const & finiteElementSpace,
+                              CONSTITUTIVE_TYPE & inputConstitutiveType,
+                              real64 const dt ):
+    Base( nodeManager,
+          edgeManager,
+          faceManager,
+          targetRegionIndex,
+          elementSubRegion,
+          finiteElementSpace,
+          inputConstitutiveType,
+          dt ),
+    m_p_n( nodeManager.getField< fields::acousticfields::PressureBatch_n >() ),
+    m_stiffnessVector( nodeManager.getField< fields::acousticfields::StiffnessVectorBatch >() ),
+    m_numShots( LvArray::integerConversion< integer >( m_p_n.size( 1 ) ) )
+  {
+    GEOS_ERROR_IF_GT( m_numShots, maxNumShots );
+  }
+
+  /**
+   * @copydoc geos::finiteElement::KernelBase::StackVariables
+   *
+   * ### ExplicitAcousticBatchedSEM Description
+   * Adds the element-local stiffness vector of each shot.
+   */
+  struct StackVariables : Base::StackVariables
+  {
+public:
+    GEOS_HOST_DEVICE
+    StackVariables():
+      Base::StackVariables(),
+      stiffnessVectorBatchLocal()
+    {}
+
+    real32 stiffnessVectorBatchLocal[ numNodesPerElem ][ maxNumShots ]{};
+  };
+
+  /**
+   * @copydoc geos::finiteElement::KernelBase::complete
+   */
+  GEOS_HOST_DEVICE
+  GEOS_FORCE_INLINE
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const
+  {
+    for( int i=0; i<numNodesPerElem; i++ )
+    {
+      localIndex const nodeIndex = m_elemsToNodes( k, i );
+      for( integer s=0; s<m_numShots; ++s )
+      {
+        RAJA::atomicAdd< parallelDeviceAtomic >( &m_stiffnessVector[nodeIndex][s], stack.stiffnessVectorBatchLocal[i][s] );
+      }
+    }
+    return 0;
+  }
+
+  /**
+   * @copydoc geos::finiteElement::KernelBase::quadraturePointKernel
+   *
+   * ### ExplicitAcousticBatchedSEM Description
+   * Calculates the stiffness vector of all the shots of the batch
+   */
+  GEOS_HOST_DEVICE
+  GEOS_FORCE_INLINE
+  void quadraturePointKernel( localIndex const k,
+                              localIndex const q,
+                              StackVariables & stack ) const
+  {
+    m_finiteElementSpace.template computeStiffnessTerm( q, stack.xLocal, [&] ( const int i, const int j, const real64 val )
+    {
+      real32 const coefficient = stack.invDensity*val;
+      real32 const * const p_n = &m_p_n[m_elemsToNodes( k, j )][0];
+      real32 * const stiffnessVectorLocal = stack.stiffnessVectorBatchLocal[ i ];
+      for( integer s=0; s<m_numShots; ++s )
+      {
+        stiffnessVectorLocal[s] += coefficient*p_n[s];
+      }
+    } );
+  }
+
+protected:
+
+  /// The array containing the nodal pressure of each shot.
+  arrayView2d< real32 const > const m_p_n;
+
+  /// The array containing the product of the stiffness matrix and the nodal pressure of each shot.
+  arrayView2d< real32 > const m_stiffnessVector;
+
+  /// The number of shots in the batch
+  integer const m_numShots;
+
+};
+
+/// The factory used to construct a ExplicitAcousticBatchedSEM kernel.
+using ExplicitAcousticBatchedSEMFactory = finiteElement::KernelFactory< ExplicitAcousticBatchedSEM,
+                                                                        real64 >;
+
 
 } // namespace acousticWaveEquationSEMKernels
 
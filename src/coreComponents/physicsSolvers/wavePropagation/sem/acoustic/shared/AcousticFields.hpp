@@ -163,6 +163,46 @@ DECLARE_FIELD( AcousticFreeSurfaceNodeIndicator,
                WRITE_AND_READ,
                "Free surface indicator, 1 if a node is on free surface 0 otherwise." );
 
+DECLARE_FIELD( PressureBatch_nm1,
+               "pressureBatch_nm1",
+               array2d< real32 >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Scalar pressure at time n-1 for each shot of the batch." );
+
+DECLARE_FIELD( PressureBatch_n,
+               "pressureBatch_n",
+               array2d< real32 >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Scalar pressure at time n for each shot of the batch." );
+
+DECLARE_FIELD( PressureBatch_np1,
+               "pressureBatch_np1",
+               array2d< real32 >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Scalar pressure at time n+1 for each shot of the batch." );
+
+DECLARE_FIELD( ForcingRHSBatch,
+               "rhsBatch",
+               array2d< real32 >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "RHS for each shot of the batch" );
+
+DECLARE_FIELD( StiffnessVectorBatch,
+               "stiffnessVectorBatch",
+               array2d< real32 >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Stiffness vector for each shot of the batch" );
+
 DECLARE_FIELD( AuxiliaryVar1PML,
                "auxiliaryVar1PML",
                array2d< real32 >,
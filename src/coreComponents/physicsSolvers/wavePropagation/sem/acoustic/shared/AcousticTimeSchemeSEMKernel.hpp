@@ -36,9 +36,9 @@ struct AcousticTimeSchemeSEM
    * @param[in] p_n pressure array at time n
    * @param[in] p_nm1 pressure array at time n-1
    * @param[in] mass the mass matrix
-   * @param[in] stiffnessVector array containing the product of the stiffness matrix R and the pressure at time n
+   * @param[in,out] stiffnessVector array containing the product of the stiffness matrix R and the pressure at time n (reset to zero here)
    * @param[in] damping the damping matrix
-   * @param[in] rhs the right-hand-side
+   * @param[in,out] rhs the right-hand-side (reset to zero here)
    * @param[in] freeSurfaceNodeIndicator array which contains indicators to tell if we are on a free-surface boundary or not
    * @param[in] solverTargetNodesSet the targetted nodeset (useful in particular when we do elasto-acoustic simulation )
    */
@@ -65,10 +65,94 @@ struct AcousticTimeSchemeSEM
         p_np1[a] += dt2 * (rhs[a] - stiffnessVector[a]);
         p_np1[a] /= mass[a] + 0.5 * dt * damping[a];
       }
+      // reset the accumulators for the next time step while the node is in cache
+      stiffnessVector[a] = rhs[a] = 0.0;
     } );
 
   };
 
+  /**
+   * @brief  Apply second order Leap-Frog time scheme for isotropic case without PML to all the shots of a batch
+   * @param[in] dt time-step
+   * @param[out] p_np1 pressure array at time n+1 for each shot (updated here)
+   * @param[in] p_n pressure array at time n for each shot
+   * @param[in] p_nm1 pressure array at time n-1 for each shot
+   * @param[in] mass the mass matrix
+   * @param[in,out] stiffnessVector array containing the product of the stiffness matrix R and the pressure at time n for each shot
+   *                 (reset to zero here)
+   * @param[in] damping the damping matrix
+   * @param[in,out] rhs the right-hand-side for each shot (reset to zero here)
+   * @param[in] freeSurfaceNodeIndicator array which contains indicators to tell if we are on a free-surface boundary or not
+   * @param[in] solverTargetNodesSet the targetted nodeset (useful in particular when we do elasto-acoustic simulation )
+   */
+  static void LeapFrogWithoutPMLBatched( real64 const dt,
+                                         arrayView2d< real32 > const p_np1,
+                                         arrayView2d< real32 const > const p_n,
+                                         arrayView2d< real32 const > const p_nm1,
+                                         arrayView1d< real32 const > const mass,
+                                         arrayView2d< real32 > const stiffnessVector,
+                                         arrayView1d< real32 const > const damping,
+                                         arrayView2d< real32 > const rhs,
+                                         arrayView1d< localIndex const > const freeSurfaceNodeIndicator,
+                                         SortedArrayView< localIndex const > const solverTargetNodesSet )
+  {
+    real64 const dt2 = pow( dt, 2 );
+    localIndex const numShots = p_np1.size( 1 );
+    forAll< EXEC_POLICY >( solverTargetNodesSet.size(), [=] GEOS_HOST_DEVICE ( localIndex const n )
+    {
+      localIndex const a = solverTargetNodesSet[n];
+      if( freeSurfaceNodeIndicator[a] != 1 )
+      {
+        // the node coefficients are shared by all the shots
+        real32 const twoMass = 2.0 * mass[a];
+        real32 const massMinus = mass[a] - 0.5 * dt * damping[a];
+        real32 const invMassPlus = 1.0 / ( mass[a] + 0.5 * dt * damping[a] );
+        for( localIndex s = 0; s < numShots; ++s )
+        {
+          p_np1[a][s] = ( twoMass * p_n[a][s] - massMinus * p_nm1[a][s] + dt2 * (rhs[a][s] - stiffnessVector[a][s]) ) * invMassPlus;
+        }
+      }
+      for( localIndex s = 0; s < numShots; ++s )
+      {
+        stiffnessVector[a][s] = rhs[a][s] = 0.0;
+      }
+    } );
+  };
+
+  /**
+   * @brief  Apply the outer step of the local time stepping (multi-rate leapfrog) scheme without PML
+   * @param[in] dt the coarse time-step
+   * @param[out] p_np1 pressure array at time n+1 (updated here)
+   * @param[in] p_nm1 pressure array at time n-1
+   * @param[in] mass the mass matrix
+   * @param[in] damping the damping matrix
+   * @param[in] ltsResult the local time stepping results, the first level containing the averaged pressure w(dt)
+   * @param[in] freeSurfaceNodeIndicator array which contains indicators to tell if we are on a free-surface boundary or not
+   * @param[in] solverTargetNodesSet the targetted nodeset (useful in particular when we do elasto-acoustic simulation )
+   */
+  static void LocalTimeSteppingLeapFrog( real64 const dt,
+                                         arrayView1d< real32 > const p_np1,
+                                         arrayView1d< real32 const > const p_nm1,
+                                         arrayView1d< real32 const > const mass,
+                                         arrayView1d< real32 const > const damping,
+                                         arrayView2d< real32 const > const ltsResult,
+                                         arrayView1d< localIndex const > const freeSurfaceNodeIndicator,
+                                         SortedArrayView< localIndex const > const solverTargetNodesSet )
+  {
+    localIndex const column = WaveSolverUtils::localTimeSteppingColumn( 1, 0, 1 );
+    forAll< EXEC_POLICY >( solverTargetNodesSet.size(), [=] GEOS_HOST_DEVICE ( localIndex const n )
+    {
+      localIndex const a = solverTargetNodesSet[n];
+      if( freeSurfaceNodeIndicator[a] != 1 )
+      {
+        // 2 M ( w(dt) - p_n ) replaces dt^2 ( rhs - K p_n ) in the standard leapfrog update
+        p_np1[a] = 2.0 * mass[a] * ltsResult[a][column];
+        p_np1[a] -= (mass[a] - 0.5 * dt * damping[a]) * p_nm1[a];
+        p_np1[a] /= mass[a] + 0.5 * dt * damping[a];
+      }
+    } );
+  };
+
   /**
    * @brief  Apply second order Leap-Frog time scheme for VTI case without PML
    * @param[in] size The number of nodes in the nodeManager
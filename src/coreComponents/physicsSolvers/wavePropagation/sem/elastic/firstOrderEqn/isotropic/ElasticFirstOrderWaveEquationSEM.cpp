@@ -245,6 +245,10 @@ void ElasticFirstOrderWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLeve
     }
   }
 
+  /// bin the sources and receivers, so that each element only tests the ones that may lie in it
+  PointBinGrid const sourceBins( sourceCoordinates );
+  PointBinGrid const receiverBins( receiverCoordinates );
+
   mesh.getElemManager().forElementSubRegionsComplete< CellElementSubRegion >( regionNames, [&]( localIndex const,
                                                                                                 localIndex const regionIndex,
                                                                                                 localIndex const esr,
@@ -285,12 +289,14 @@ void ElasticFirstOrderWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLeve
         elemsToFaces,
         elemCenter,
         sourceCoordinates,
+        sourceBins.toView(),
         sourceIsAccessible,
         sourceElem,
         sourceNodeIds,
         sourceConstants,
         sourceRegion,
         receiverCoordinates,
+        receiverBins.toView(),
         receiverIsLocal,
         receiverElem,
         receiverNodeIds,
@@ -495,7 +501,7 @@ real64 ElasticFirstOrderWaveEquationSEM::explicitStepInternal( real64 const & ti
   arrayView1d< localIndex const > const sourceIsAccessible = m_sourceIsAccessible.toView();
   arrayView1d< localIndex const > const sourceElem = m_sourceElem.toView();
   arrayView1d< localIndex const > const sourceRegion = m_sourceRegion.toView();
-  arrayView2d< real32 const > const sourceValue = m_sourceValue.toView();
+  WaveSolverUtils::SourceTimeFunction const sourceValue = getSourceTimeFunction();
 
 
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
@@ -687,10 +693,10 @@ void ElasticFirstOrderWaveEquationSEM::cleanup( real64 const time_n,
       compute2dVariableAllSeismoTraces( regionIndex, time_n, 0.0, stressxz, stressxz, sigmaxzReceivers );
       compute2dVariableAllSeismoTraces( regionIndex, time_n, 0.0, stressyz, stressyz, sigmayzReceivers );
 
-      WaveSolverUtils::writeSeismoTraceVector( "seismoTraceReceiver", getName(), m_outputSeismoTrace, m_receiverConstants.size( 0 ),
-                                               m_receiverIsLocal, m_nsamplesSeismoTrace, sigmaxxReceivers, sigmayyReceivers, sigmazzReceivers );
-      WaveSolverUtils::writeSeismoTraceVector( "seismoTraceReceiver", getName(), m_outputSeismoTrace, m_receiverConstants.size( 0 ),
-                                               m_receiverIsLocal, m_nsamplesSeismoTrace, sigmaxyReceivers, sigmaxzReceivers, sigmayzReceivers );
+      WaveSolverUtils::writeSeismoTraceVector( "seismoTraceReceiver", getName(), m_outputSeismoTrace, m_outputSeismoTraceFormat, { "sigmaxx", "sigmayy", "sigmazz" },
+                                               m_receiverConstants.size( 0 ), m_receiverIsLocal, m_nsamplesSeismoTrace, sigmaxxReceivers, sigmayyReceivers, sigmazzReceivers );
+      WaveSolverUtils::writeSeismoTraceVector( "seismoTraceReceiver", getName(), m_outputSeismoTrace, m_outputSeismoTraceFormat, { "sigmaxy", "sigmaxz", "sigmayz" },
+                                               m_receiverConstants.size( 0 ), m_receiverIsLocal, m_nsamplesSeismoTrace, sigmaxyReceivers, sigmaxzReceivers, sigmayzReceivers );
 
     } );
     arrayView1d< real32 > const ux_np1 = nodeManager.getField< elasticfields::Displacementx_np1 >();
@@ -706,8 +712,8 @@ void ElasticFirstOrderWaveEquationSEM::cleanup( real64 const time_n,
     computeAllSeismoTraces( time_n, 0.0, uy_np1, uy_np1, uyReceivers );
     computeAllSeismoTraces( time_n, 0.0, uz_np1, uz_np1, uzReceivers );
 
-    WaveSolverUtils::writeSeismoTraceVector( "seismoTraceReceiver", getName(), m_outputSeismoTrace, m_receiverConstants.size( 0 ),
-                                             m_receiverIsLocal, m_nsamplesSeismoTrace, uxReceivers, uyReceivers, uzReceivers );
+    WaveSolverUtils::writeSeismoTraceVector( "seismoTraceReceiver", getName(), m_outputSeismoTrace, m_outputSeismoTraceFormat, { "displacementx", "displacementy", "displacementz" },
+                                             m_receiverConstants.size( 0 ), m_receiverIsLocal, m_nsamplesSeismoTrace, uxReceivers, uyReceivers, uzReceivers );
   } );
 }
 
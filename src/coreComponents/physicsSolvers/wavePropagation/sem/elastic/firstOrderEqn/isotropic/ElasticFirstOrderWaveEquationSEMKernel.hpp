@@ -87,7 +87,7 @@ struct StressComputation
           arrayView1d< localIndex const > const sourceIsLocal,
           arrayView1d< localIndex const > const sourceElem,
           arrayView1d< localIndex const > const sourceRegion,
-          arrayView2d< real32 const > const sourceValue,
+          WaveSolverUtils::SourceTimeFunction const sourceValue,
           real64 const dt,
           integer const cycleNumber,
           arrayView2d< real32 > const stressxx,
@@ -211,10 +211,11 @@ struct StressComputation
         {
           if( sourceElem[isrc]==k && sourceRegion[isrc] == regionIndex )
           {
+            real32 const sourceValueAtCycle = sourceValue( cycleNumber, isrc );
             for( localIndex i = 0; i < numNodesPerElem; ++i )
             {
               real32 massLoc = m_finiteElement.computeMassTerm( i, xLocal );
-              real32 const localIncrement = dt*(sourceConstants[isrc][i]*sourceValue[cycleNumber][isrc])/massLoc;
+              real32 const localIncrement = dt*(sourceConstants[isrc][i]*sourceValueAtCycle)/massLoc;
               RAJA::atomicAdd< ATOMIC_POLICY >( &stressxx[k][i], localIncrement );
               RAJA::atomicAdd< ATOMIC_POLICY >( &stressyy[k][i], localIncrement );
               RAJA::atomicAdd< ATOMIC_POLICY >( &stresszz[k][i], localIncrement );
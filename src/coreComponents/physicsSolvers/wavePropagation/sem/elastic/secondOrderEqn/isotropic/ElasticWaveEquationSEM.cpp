@@ -100,6 +100,8 @@ ElasticWaveEquationSEM::ElasticWaveEquationSEM( const std::string & name,
     setSizedFromParent( 0 ).
     setApplyDefaultValue( 0 ).
     setDescription( "Flag to apply VTI anisotropy. The default is to use isotropic physic." );
+
+  registerLocalTimeSteppingInputs();
 }
 
 ElasticWaveEquationSEM::~ElasticWaveEquationSEM()
@@ -171,6 +173,12 @@ void ElasticWaveEquationSEM::registerDataOnMesh( Group & meshBodies )
       nodeManager.getField< elasticfields::DivPsiz >().resizeDimension< 1 >( l );
     }
 
+    /// register the local time stepping work arrays only when the multi-rate leapfrog is requested
+    if( m_useLocalTimeStepping )
+    {
+      registerLocalTimeSteppingData( mesh, 3 );
+    }
+
     FaceManager & faceManager = mesh.getFaceManager();
     faceManager.registerField< elasticfields::ElasticFreeSurfaceFaceIndicator >( getName() );
 
@@ -204,6 +212,10 @@ void ElasticWaveEquationSEM::postInputInitialization()
 {
   WaveSolverBase::postInputInitialization();
 
+  GEOS_THROW_IF( m_useLocalTimeStepping && ( m_useVTI || m_attenuationType != WaveSolverUtils::AttenuationType::none || m_usePML ),
+                 getDataContext() << ": Local time stepping is only supported for isotropic, non-attenuating media without PML",
+                 InputError );
+
   if( m_useDAS == WaveSolverUtils::DASType::none )
   {
     localIndex const numReceiversGlobal = m_receiverCoordinates.size( 0 );
@@ -266,6 +278,15 @@ void ElasticWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLevel & baseMe
     }
   }
 
+  /// bin the sources and receivers, so that each element only tests the ones that may lie in it
+  array1d< real64 > receiverHalfExtent( m_useDAS == WaveSolverUtils::DASType::none ? 0 : m_linearDASGeometry.size( 0 ) );
+  for( localIndex ircv = 0; ircv < receiverHalfExtent.size(); ++ircv )
+  {
+    receiverHalfExtent[ircv] = 0.5 * m_linearDASGeometry[ircv][2];
+  }
+  PointBinGrid const sourceBins( sourceCoordinates );
+  PointBinGrid const receiverBins( receiverCoordinates, receiverHalfExtent.toViewConst() );
+
   mesh.getElemManager().forElementSubRegionsComplete< CellElementSubRegion >( regionNames, [&]( localIndex const,
                                                                                                 localIndex const er,
                                                                                                 localIndex const esr,
@@ -305,12 +326,14 @@ void ElasticWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLevel & baseMe
         elemsToFaces,
         elemCenter,
         sourceCoordinates,
+        sourceBins.toView(),
         sourceIsAccessible,
         sourceNodeIds,
         sourceConstantsx,
         sourceConstantsy,
         sourceConstantsz,
         receiverCoordinates,
+        receiverBins.toView(),
         receiverIsLocal,
         receiverNodeIds,
         receiverConstants,
@@ -339,20 +362,21 @@ void ElasticWaveEquationSEM::addSourceToRightHandSide( integer const & cycleNumb
   arrayView2d< real64 const > const sourceConstantsz   = m_sourceConstantsz.toViewConst();
 
   arrayView1d< localIndex const > const sourceIsAccessible = m_sourceIsAccessible.toViewConst();
-  arrayView2d< real32 const > const sourceValue   = m_sourceValue.toViewConst();
+  WaveSolverUtils::SourceTimeFunction const sourceValue = getSourceTimeFunction();
 
-  GEOS_THROW_IF( cycleNumber > sourceValue.size( 0 ), getDataContext() << ": Too many steps compared to array size", std::runtime_error );
+  GEOS_THROW_IF( m_precomputeSourceValue && cycleNumber > m_sourceValue.size( 0 ), getDataContext() << ": Too many steps compared to array size", std::runtime_error );
   forAll< EXEC_POLICY >( m_sourceConstantsx.size( 0 ), [=] GEOS_HOST_DEVICE ( localIndex const isrc )
   {
     if( sourceIsAccessible[isrc] == 1 )
     {
+      real32 const sourceValueAtCycle = sourceValue( cycleNumber, isrc );
       for( localIndex inode = 0; inode < sourceConstantsx.size( 1 ); ++inode )
       {
-        real32 const localIncrementx = sourceConstantsx[isrc][inode] * sourceValue[cycleNumber][isrc];
+        real32 const localIncrementx = sourceConstantsx[isrc][inode] * sourceValueAtCycle;
         RAJA::atomicAdd< ATOMIC_POLICY >( &rhsx[sourceNodeIds[isrc][inode]], localIncrementx );
-        real32 const localIncrementy = sourceConstantsy[isrc][inode] * sourceValue[cycleNumber][isrc];
+        real32 const localIncrementy = sourceConstantsy[isrc][inode] * sourceValueAtCycle;
         RAJA::atomicAdd< ATOMIC_POLICY >( &rhsy[sourceNodeIds[isrc][inode]], localIncrementy );
-        real32 const localIncrementz = sourceConstantsz[isrc][inode] * sourceValue[cycleNumber][isrc];
+        real32 const localIncrementz = sourceConstantsz[isrc][inode] * sourceValueAtCycle;
         RAJA::atomicAdd< ATOMIC_POLICY >( &rhsz[sourceNodeIds[isrc][inode]], localIncrementz );
       }
     }
@@ -458,10 +482,15 @@ void ElasticWaveEquationSEM::initializePostInitialConditionsPreSubGroups()
       GEOS_WARNING_IF( ySum > minQVal, "The anelasticity parameters are too high for the given quality factor. This could lead to solution artifacts such as zero-velocity waves." );
     }
 
+    if( m_useLocalTimeStepping )
+    {
+      computeLocalTimeSteppingLevels( domain, mesh, regionNames, elasticfields::ElasticVelocityVp::key() );
+    }
+
   } );
 
-  WaveSolverUtils::initTrace( "seismoTraceReceiver", getName(), m_outputSeismoTrace, m_receiverConstants.size( 0 ), m_receiverIsLocal );
-  WaveSolverUtils::initTrace( "dasTraceReceiver", getName(), m_outputSeismoTrace, m_linearDASGeometry.size( 0 ), m_receiverIsLocal );
+  WaveSolverUtils::initTrace( "seismoTraceReceiver", getName(), m_outputSeismoTrace, m_outputSeismoTraceFormat, m_receiverConstants.size( 0 ), m_receiverIsLocal );
+  WaveSolverUtils::initTrace( "dasTraceReceiver", getName(), m_outputSeismoTrace, m_outputSeismoTraceFormat, m_linearDASGeometry.size( 0 ), m_receiverIsLocal );
 }
 
 real32 ElasticWaveEquationSEM::computeGlobalMinQFactor()
@@ -588,7 +617,7 @@ real64 ElasticWaveEquationSEM::explicitStepBackward( real64 const & time_n,
 void ElasticWaveEquationSEM::computeUnknowns( real64 const &,
                                               real64 const & dt,
                                               integer const cycleNumber,
-                                              DomainPartition &,
+                                              DomainPartition & domain,
                                               MeshLevel & mesh,
                                               arrayView1d< string const > const & regionNames )
 {
@@ -616,29 +645,33 @@ void ElasticWaveEquationSEM::computeUnknowns( real64 const &,
   arrayView1d< real32 > const rhsy = nodeManager.getField< elasticfields::ForcingRHSy >();
   arrayView1d< real32 > const rhsz = nodeManager.getField< elasticfields::ForcingRHSz >();
 
-  if( m_useVTI )
+  // with local time stepping, the stiffness is applied level by level in the update below
+  if( !m_useLocalTimeStepping )
   {
-    auto kernelFactory = elasticVTIWaveEquationSEMKernels::ExplicitElasticVTISEMFactory( dt );
-    finiteElement::
-      regionBasedKernelApplication< EXEC_POLICY,
-                                    constitutive::NullModel,
-                                    CellElementSubRegion >( mesh,
-                                                            regionNames,
-                                                            getDiscretizationName(),
-                                                            "",
-                                                            kernelFactory );
-  }
-  else
-  {
-    auto kernelFactory = elasticWaveEquationSEMKernels::ExplicitElasticSEMFactory( dt );
-    finiteElement::
-      regionBasedKernelApplication< EXEC_POLICY,
-                                    constitutive::NullModel,
-                                    CellElementSubRegion >( mesh,
-                                                            regionNames,
-                                                            getDiscretizationName(),
-                                                            "",
-                                                            kernelFactory );
+    if( m_useVTI )
+    {
+      auto kernelFactory = elasticVTIWaveEquationSEMKernels::ExplicitElasticVTISEMFactory( dt );
+      finiteElement::
+        regionBasedKernelApplication< EXEC_POLICY,
+                                      constitutive::NullModel,
+                                      CellElementSubRegion >( mesh,
+                                                              regionNames,
+                                                              getDiscretizationName(),
+                                                              "",
+                                                              kernelFactory );
+    }
+    else
+    {
+      auto kernelFactory = elasticWaveEquationSEMKernels::ExplicitElasticSEMFactory( dt );
+      finiteElement::
+        regionBasedKernelApplication< EXEC_POLICY,
+                                      constitutive::NullModel,
+                                      CellElementSubRegion >( mesh,
+                                                              regionNames,
+                                                              getDiscretizationName(),
+                                                              "",
+                                                              kernelFactory );
+    }
   }
 
   if( m_attenuationType == WaveSolverUtils::AttenuationType::sls )
@@ -662,7 +695,43 @@ void ElasticWaveEquationSEM::computeUnknowns( real64 const &,
   addSourceToRightHandSide( cycleForSource, rhsx, rhsy, rhsz );
 
   SortedArrayView< localIndex const > const solverTargetNodesSet = m_solverTargetNodesSet.toViewConst();
-  if( m_attenuationType == WaveSolverUtils::AttenuationType::sls )
+  if( m_useLocalTimeStepping )
+  {
+    GEOS_MARK_SCOPE ( updateUWithLTS );
+    arrayView2d< real32 > const ltsState = nodeManager.getField< fields::localTimeSteppingState >();
+    arrayView2d< real32 > const ltsForce = nodeManager.getField< fields::localTimeSteppingForce >();
+    arrayView2d< real32 const > const ltsResult = nodeManager.getField< fields::localTimeSteppingResult >();
+
+    /// the level 0 state is u_n, and the source enters the frozen force of the coarsest level
+    forAll< EXEC_POLICY >( solverTargetNodesSet.size(), [=] GEOS_HOST_DEVICE ( localIndex const n )
+    {
+      localIndex const a = solverTargetNodesSet[n];
+      ltsState[a][0] = ux_n[a];
+      ltsState[a][1] = uy_n[a];
+      ltsState[a][2] = uz_n[a];
+      ltsForce[a][0] = -rhsx[a] / mass[a];
+      ltsForce[a][1] = -rhsy[a] / mass[a];
+      ltsForce[a][2] = -rhsz[a] / mass[a];
+      rhsx[a] = rhsy[a] = rhsz[a] = 0.0;
+    } );
+
+    computeLocalTimeSteppingUpdate( dt, domain, mesh, 3, {}, [&]( integer const level )
+    {
+      auto kernelFactory = elasticWaveEquationSEMKernels::ExplicitElasticLTSSEMFactory( dt, level );
+      finiteElement::
+        regionBasedKernelApplication< EXEC_POLICY,
+                                      constitutive::NullModel,
+                                      CellElementSubRegion >( mesh,
+                                                              regionNames,
+                                                              getDiscretizationName(),
+                                                              "",
+                                                              kernelFactory );
+    } );
+
+    ElasticTimeSchemeSEM::LocalTimeSteppingLeapFrog( dt, ux_np1, ux_nm1, uy_np1, uy_nm1, uz_np1, uz_nm1,
+                                                     mass, dampingx, dampingy, dampingz, ltsResult, solverTargetNodesSet );
+  }
+  else if( m_attenuationType == WaveSolverUtils::AttenuationType::sls )
   {
     arrayView1d< real32 > const stiffnessVectorAx = nodeManager.getField< elasticfields::StiffnessVectorAx >();
     arrayView1d< real32 > const stiffnessVectorAy = nodeManager.getField< elasticfields::StiffnessVectorAy >();
@@ -743,51 +812,21 @@ void ElasticWaveEquationSEM::prepareNextTimestep( MeshLevel & mesh )
 {
   NodeManager & nodeManager = mesh.getNodeManager();
 
-  arrayView1d< real32 > const ux_nm1 = nodeManager.getField< elasticfields::Displacementx_nm1 >();
-  arrayView1d< real32 > const uy_nm1 = nodeManager.getField< elasticfields::Displacementy_nm1 >();
-  arrayView1d< real32 > const uz_nm1 = nodeManager.getField< elasticfields::Displacementz_nm1 >();
-  arrayView1d< real32 > const ux_n   = nodeManager.getField< elasticfields::Displacementx_n >();
-  arrayView1d< real32 > const uy_n   = nodeManager.getField< elasticfields::Displacementy_n >();
-  arrayView1d< real32 > const uz_n   = nodeManager.getField< elasticfields::Displacementz_n >();
-  arrayView1d< real32 > const ux_np1 = nodeManager.getField< elasticfields::Displacementx_np1 >();
-  arrayView1d< real32 > const uy_np1 = nodeManager.getField< elasticfields::Displacementy_np1 >();
-  arrayView1d< real32 > const uz_np1 = nodeManager.getField< elasticfields::Displacementz_np1 >();
-
-  arrayView1d< real32 > const stiffnessVectorx = nodeManager.getField< elasticfields::StiffnessVectorx >();
-  arrayView1d< real32 > const stiffnessVectory = nodeManager.getField< elasticfields::StiffnessVectory >();
-  arrayView1d< real32 > const stiffnessVectorz = nodeManager.getField< elasticfields::StiffnessVectorz >();
-
-  arrayView1d< real32 > const rhsx = nodeManager.getField< elasticfields::ForcingRHSx >();
-  arrayView1d< real32 > const rhsy = nodeManager.getField< elasticfields::ForcingRHSy >();
-  arrayView1d< real32 > const rhsz = nodeManager.getField< elasticfields::ForcingRHSz >();
-
   SortedArrayView< localIndex const > const solverTargetNodesSet = m_solverTargetNodesSet.toViewConst();
 
-  forAll< EXEC_POLICY >( solverTargetNodesSet.size(), [=] GEOS_HOST_DEVICE ( localIndex const n )
-  {
-    localIndex const a = solverTargetNodesSet[n];
-    ux_nm1[a] = ux_n[a];
-    uy_nm1[a] = uy_n[a];
-    uz_nm1[a] = uz_n[a];
-    ux_n[a] = ux_np1[a];
-    uy_n[a] = uy_np1[a];
-    uz_n[a] = uz_np1[a];
-
-    stiffnessVectorx[a] = stiffnessVectory[a] = stiffnessVectorz[a] = 0.0;
-    rhsx[a] = rhsy[a] = rhsz[a] = 0.0;
-  } );
-  if( m_attenuationType == WaveSolverUtils::AttenuationType::sls )
-  {
-    arrayView1d< real32 > const stiffnessVectorAx = nodeManager.getField< elasticfields::StiffnessVectorAx >();
-    arrayView1d< real32 > const stiffnessVectorAy = nodeManager.getField< elasticfields::StiffnessVectorAy >();
-    arrayView1d< real32 > const stiffnessVectorAz = nodeManager.getField< elasticfields::StiffnessVectorAz >();
-    forAll< EXEC_POLICY >( solverTargetNodesSet.size(), [=] GEOS_HOST_DEVICE ( localIndex const n )
-    {
-      localIndex const a = solverTargetNodesSet[n];
-      stiffnessVectorAx[a] = stiffnessVectorAy[a] = stiffnessVectorAz[a] = 0.0;
-    } );
-  }
-
+  /// the stiffness vectors and the right-hand sides have already been reset by the time update
+  WaveSolverUtils::rotateTimeLevels( nodeManager.getField< elasticfields::Displacementx_nm1 >(),
+                                     nodeManager.getField< elasticfields::Displacementx_n >(),
+                                     nodeManager.getField< elasticfields::Displacementx_np1 >(),
+                                     solverTargetNodesSet );
+  WaveSolverUtils::rotateTimeLevels( nodeManager.getField< elasticfields::Displacementy_nm1 >(),
+                                     nodeManager.getField< elasticfields::Displacementy_n >(),
+                                     nodeManager.getField< elasticfields::Displacementy_np1 >(),
+                                     solverTargetNodesSet );
+  WaveSolverUtils::rotateTimeLevels( nodeManager.getField< elasticfields::Displacementz_nm1 >(),
+                                     nodeManager.getField< elasticfields::Displacementz_n >(),
+                                     nodeManager.getField< elasticfields::Displacementz_np1 >(),
+                                     solverTargetNodesSet );
 }
 
 real64 ElasticWaveEquationSEM::explicitStepInternal( real64 const & time_n,
@@ -841,8 +880,8 @@ void ElasticWaveEquationSEM::cleanup( real64 const time_n,
       computeAllSeismoTraces( time_n, 0.0, ux_np1, ux_n, uXReceivers );
       computeAllSeismoTraces( time_n, 0.0, uy_np1, uy_n, uYReceivers );
       computeAllSeismoTraces( time_n, 0.0, uz_np1, uz_n, uZReceivers );
-      WaveSolverUtils::writeSeismoTraceVector( "seismoTraceReceiver", getName(), m_outputSeismoTrace, m_receiverConstants.size( 0 ),
-                                               m_receiverIsLocal, m_nsamplesSeismoTrace, uXReceivers, uYReceivers, uZReceivers );
+      WaveSolverUtils::writeSeismoTraceVector( "seismoTraceReceiver", getName(), m_outputSeismoTrace, m_outputSeismoTraceFormat, { "displacementx", "displacementy", "displacementz" },
+                                               m_receiverConstants.size( 0 ), m_receiverIsLocal, m_nsamplesSeismoTrace, uXReceivers, uYReceivers, uZReceivers );
     }
     else
     {
@@ -856,8 +895,8 @@ void ElasticWaveEquationSEM::cleanup( real64 const time_n,
                              m_linearDASGeometry.size( 0 ),
                              MpiWrapper::getMpiOp( MpiWrapper::Reduction::Sum ),
                              MPI_COMM_GEOS );
-      WaveSolverUtils::writeSeismoTrace( "dasTraceReceiver", getName(), m_outputSeismoTrace, m_linearDASGeometry.size( 0 ),
-                                         m_receiverIsLocal, m_nsamplesSeismoTrace, dasReceivers );
+      WaveSolverUtils::writeSeismoTrace( "dasTraceReceiver", getName(), m_outputSeismoTrace, m_outputSeismoTraceFormat, "dasSignal",
+                                         m_linearDASGeometry.size( 0 ), m_receiverIsLocal, m_nsamplesSeismoTrace, dasReceivers );
     }
   } );
 }
@@ -266,6 +266,194 @@ template< typename SUBREGION_TYPE,
 using ExplicitElasticSEM = ExplicitElasticSEMBase< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >;
 using ExplicitElasticSEMFactory = finiteElement::KernelFactory< ExplicitElasticSEM,
                                                                 real64 >;
+/**
+ * @brief Implements the stiffness kernel of the local time stepping (multi-rate leapfrog) scheme
+ * @copydoc geos::finiteElement::KernelBase
+ *
+ * ### ExplicitElasticLTSSEM Description
+ * Computes M^{-1} K ( P_l - P_{l+1} ) w, where w is the local time stepping displacement of level l and
+ * P_l - P_{l+1} selects the nodes of level l, and adds it to the local time stepping force of level l+1.
+ * Only the elements having at least one node of level l are visited.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+class ExplicitElasticLTSSEM : public ExplicitElasticSEMBase< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >
+{
+public:
+
+  /// Alias for the base class;
+  using Base = ExplicitElasticSEMBase< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >;
+
+  using Base::numNodesPerElem;
+  using Base::numQuadraturePointsPerElem;
+  using Base::m_elemsToNodes;
+  using Base::m_finiteElementSpace;
+  using typename Base::StackVariables;
+
+  /// Number of components of the displacement
+  static constexpr integer numComponents = 3;
+
+  /**
+   * @brief Constructor
+   * @copydoc geos::finiteElement::KernelBase::KernelBase
+   * @param nodeManager Reference to the NodeManager object.
+   * @param edgeManager Reference to the EdgeManager object.
+   * @param faceManager Reference to the FaceManager object.
+   * @param targetRegionIndex Index of the region the subregion belongs to.
+   * @param dt The time interval for the step.
+   * @param level The local time stepping level of the nodes on which the stiffness is applied.
+   */
+  ExplicitElasticLTSSEM( NodeManager & nodeManager,
+                         EdgeManager const & edgeManager,
+                         FaceManager const & faceManager,
+                         localIndex const targetRegionIndex,
+                         SUBREGION_TYPE const & elementSubRegion,
+                         FE_TYPE const & finiteElementSpace,
+                         CONSTITUTIVE_TYPE & inputConstitutiveType,
+                         real64 const dt,
+                         integer const level ):
+    Base( nodeManager,
+          edgeManager,
+          faceManager,
+          targetRegionIndex,
+          elementSubRegion,
+          finiteElementSpace,
+          inputConstitutiveType,
+          dt ),
+    m_mass( nodeManager.getField< fields::elasticfields::ElasticMassVector >() ),
+    m_nodeLevel( nodeManager.getField< fields::localTimeSteppingNodeLevel >() ),
+    m_state( nodeManager.getField< fields::localTimeSteppingState >() ),
+    m_force( nodeManager.getField< fields::localTimeSteppingForce >() ),
+    m_bandElements( elementSubRegion.template getReference< ArrayOfArrays< localIndex > >(
+                      WaveSolverBase::viewKeyStruct::localTimeSteppingElementsString() ).toViewConst() ),
+    m_level( level )
+  {}
+
+  /**
+   * @brief Kernel launcher restricted to the elements touching the nodes of level m_level.
+   * @copydoc geos::finiteElement::KernelBase::kernelLaunch
+   */
+  template< typename POLICY,
+            typename KERNEL_TYPE >
+  static
+  real64
+  kernelLaunch( localIndex const numElems,
+                KERNEL_TYPE const & kernelComponent )
+  {
+    GEOS_MARK_FUNCTION;
+    GEOS_UNUSED_VAR( numElems );
+
+    ArrayOfArraysView< localIndex const > const bandElements = kernelComponent.m_bandElements;
+    integer const level = kernelComponent.m_level;
+    forAll< POLICY >( bandElements.sizeOfArray( level ),
+                      [=] GEOS_HOST_DEVICE ( localIndex const i )
+    {
+      localIndex const k = bandElements( level, i );
+      typename KERNEL_TYPE::StackVariables stack;
+
+      kernelComponent.setup( k, stack );
+      for( integer q=0; q<numQuadraturePointsPerElem; ++q )
+      {
+        kernelComponent.quadraturePointKernel( k, q, stack );
+      }
+      kernelComponent.complete( k, stack );
+    } );
+    return 0;
+  }
+
+  /**
+   * @copydoc geos::finiteElement::KernelBase::complete
+   */
+  GEOS_HOST_DEVICE
+  GEOS_FORCE_INLINE
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const
+  {
+    localIndex const columnx = WaveSolverUtils::localTimeSteppingColumn( m_level + 1, 0, numComponents );
+    localIndex const columny = WaveSolverUtils::localTimeSteppingColumn( m_level + 1, 1, numComponents );
+    localIndex const columnz = WaveSolverUtils::localTimeSteppingColumn( m_level + 1, 2, numComponents );
+    for( int i=0; i<numNodesPerElem; i++ )
+    {
+      localIndex const nodeIndex = m_elemsToNodes( k, i );
+      real32 const invMass = 1.0 / m_mass[nodeIndex];
+      RAJA::atomicAdd< parallelDeviceAtomic >( &m_force[nodeIndex][columnx], stack.stiffnessVectorxLocal[i] * invMass );
+      RAJA::atomicAdd< parallelDeviceAtomic >( &m_force[nodeIndex][columny], stack.stiffnessVectoryLocal[i] * invMass );
+      RAJA::atomicAdd< parallelDeviceAtomic >( &m_force[nodeIndex][columnz], stack.stiffnessVectorzLocal[i] * invMass );
+    }
+    return 0;
+  }
+
+  /**
+   * @copydoc geos::finiteElement::KernelBase::quadraturePointKernel
+   *
+   * ### ExplicitElasticLTSSEM Description
+   * Calculates the stiffness vector applied to the displacement of the nodes of level m_level
+   */
+  GEOS_HOST_DEVICE
+  GEOS_FORCE_INLINE
+  void quadraturePointKernel( localIndex const k,
+                              localIndex const q,
+                              StackVariables & stack ) const
+  {
+    localIndex const columnx = WaveSolverUtils::localTimeSteppingColumn( m_level, 0, numComponents );
+    localIndex const columny = WaveSolverUtils::localTimeSteppingColumn( m_level, 1, numComponents );
+    localIndex const columnz = WaveSolverUtils::localTimeSteppingColumn( m_level, 2, numComponents );
+    m_finiteElementSpace.template computeFirstOrderStiffnessTerm( q, stack.xLocal, [&] ( int i, int j, real64 val, real64 J[3][3], int p, int r )
+    {
+      localIndex const nodeIndex = m_elemsToNodes( k, j );
+      if( m_nodeLevel[nodeIndex] != m_level )
+      {
+        return;
+      }
+
+      real32 const Rxx_ij = val*((stack.lambda+2.0*stack.mu)*J[p][0]*J[r][0]+stack.mu*(J[p][1]*J[r][1]+J[p][2]*J[r][2]));
+      real32 const Ryy_ij = val*((stack.lambda+2.0*stack.mu)*J[p][1]*J[r][1]+stack.mu*(J[p][0]*J[r][0]+J[p][2]*J[r][2]));
+      real32 const Rzz_ij = val*((stack.lambda+2.0*stack.mu)*J[p][2]*J[r][2]+stack.mu*(J[p][0]*J[r][0]+J[p][1]*J[r][1]));
+      real32 const Rxy_ij = val*(stack.lambda*J[p][0]*J[r][1]+stack.mu*J[p][1]*J[r][0]);
+      real32 const Ryx_ij = val*(stack.mu*J[p][0]*J[r][1]+stack.lambda*J[p][1]*J[r][0]);
+      real32 const Rxz_ij = val*(stack.lambda*J[p][0]*J[r][2]+stack.mu*J[p][2]*J[r][0]);
+      real32 const Rzx_ij = val*(stack.mu*J[p][0]*J[r][2]+stack.lambda*J[p][2]*J[r][0]);
+      real32 const Ryz_ij = val*(stack.lambda*J[p][1]*J[r][2]+stack.mu*J[p][2]*J[r][1]);
+      real32 const Rzy_ij = val*(stack.mu*J[p][1]*J[r][2]+stack.lambda*J[p][2]*J[r][1]);
+
+      real32 const ux = m_state[nodeIndex][columnx];
+      real32 const uy = m_state[nodeIndex][columny];
+      real32 const uz = m_state[nodeIndex][columnz];
+
+      stack.stiffnessVectorxLocal[ i ] += Rxx_ij * ux + Rxy_ij * uy + Rxz_ij * uz;
+      stack.stiffnessVectoryLocal[ i ] += Ryx_ij * ux + Ryy_ij * uy + Ryz_ij * uz;
+      stack.stiffnessVectorzLocal[ i ] += Rzx_ij * ux + Rzy_ij * uy + Rzz_ij * uz;
+    } );
+  }
+
+protected:
+
+  /// The array containing the diagonal of the mass matrix
+  arrayView1d< real32 const > const m_mass;
+
+  /// The array containing the local time stepping level of the nodes
+  arrayView1d< integer const > const m_nodeLevel;
+
+  /// The local time stepping states
+  arrayView2d< real32 const > const m_state;
+
+  /// The local time stepping forces
+  arrayView2d< real32 > const m_force;
+
+  /// For each level, the elements having at least one node of this level
+  ArrayOfArraysView< localIndex const > const m_bandElements;
+
+  /// The local time stepping level of the nodes on which the stiffness is applied
+  integer const m_level;
+
+};
+
+/// The factory used to construct a ExplicitElasticLTSSEM kernel.
+using ExplicitElasticLTSSEMFactory = finiteElement::KernelFactory< ExplicitElasticLTSSEM,
+                                                                   real64,
+                                                                   integer >;
+
 /// Specialization for attenuation kernel
 template< typename SUBREGION_TYPE,
           typename CONSTITUTIVE_TYPE,
@@ -43,12 +43,15 @@ struct ElasticTimeSchemeSEM
    * @param[in] dampingx the damping matrix for x-component
    * @param[in] dampingy the damping matrix for y-component
    * @param[in] dampingz the damping matrix for z-component
-   * @param[in] stiffnessVectorx array containing the product of the stiffness matrix R and the displacement in x-direction at time n
-   * @param[in] stiffnessVectory array containing the product of the stiffness matrix R and the displacement in y-direction at time n
-   * @param[in] stiffnessVectorz array containing the product of the stiffness matrix R and the displacement in z-direction at time n
-   * @param[in] rhsx the right-hand-side for displacement in x-direction
-   * @param[in] rhsy the right-hand-side for displacement in y-direction
-   * @param[in] rhsz the right-hand-side for displacement in z-direction
+   * @param[in,out] stiffnessVectorx array containing the product of the stiffness matrix R and the displacement in x-direction at time n
+   *                 (reset to zero here)
+   * @param[in,out] stiffnessVectory array containing the product of the stiffness matrix R and the displacement in y-direction at time n
+   *                 (reset to zero here)
+   * @param[in,out] stiffnessVectorz array containing the product of the stiffness matrix R and the displacement in z-direction at time n
+   *                 (reset to zero here)
+   * @param[in,out] rhsx the right-hand-side for displacement in x-direction (reset to zero here)
+   * @param[in,out] rhsy the right-hand-side for displacement in y-direction (reset to zero here)
+   * @param[in,out] rhsz the right-hand-side for displacement in z-direction (reset to zero here)
    * @param[in] solverTargetNodesSet the targetted nodeset (useful in particular when we do elasto-acoustic simulation )
    */
   static void LeapFrog( real64 const dt,
@@ -92,10 +95,62 @@ struct ElasticTimeSchemeSEM
       uz_np1[a] -= (mass[a]-0.5*dt*dampingz[a])*uz_nm1[a];
       uz_np1[a] += dt2*(rhsz[a]-stiffnessVectorz[a]);
       uz_np1[a] /= mass[a]+0.5*dt*dampingz[a];
+      // reset the accumulators for the next time step while the node is in cache
+      stiffnessVectorx[a] = stiffnessVectory[a] = stiffnessVectorz[a] = 0.0;
+      rhsx[a] = rhsy[a] = rhsz[a] = 0.0;
     } );
 
   };
 
+  /**
+   * @brief  Apply the outer step of the local time stepping (multi-rate leapfrog) scheme for isotropic case without PML
+   * @param[in] dt the coarse time-step
+   * @param[out] ux_np1 displacement in x-direction array at time n+1 (updated here)
+   * @param[in] ux_nm1 displacement in x-direction array at time n-1
+   * @param[out] uy_np1 displacement in y-direction array at time n+1 (updated here)
+   * @param[in] uy_nm1 displacement in y-direction array at time n-1
+   * @param[out] uz_np1 displacement in z-direction array at time n+1 (updated here)
+   * @param[in] uz_nm1 displacement in z-direction array at time n-1
+   * @param[in] mass the mass matrix
+   * @param[in] dampingx the damping matrix for x-component
+   * @param[in] dampingy the damping matrix for y-component
+   * @param[in] dampingz the damping matrix for z-component
+   * @param[in] ltsResult the local time stepping results, the first level containing the averaged displacement w(dt)
+   * @param[in] solverTargetNodesSet the targetted nodeset (useful in particular when we do elasto-acoustic simulation )
+   */
+  static void LocalTimeSteppingLeapFrog( real64 const dt,
+                                         arrayView1d< real32 > const ux_np1,
+                                         arrayView1d< real32 const > const ux_nm1,
+                                         arrayView1d< real32 > const uy_np1,
+                                         arrayView1d< real32 const > const uy_nm1,
+                                         arrayView1d< real32 > const uz_np1,
+                                         arrayView1d< real32 const > const uz_nm1,
+                                         arrayView1d< real32 const > const mass,
+                                         arrayView1d< real32 const > const dampingx,
+                                         arrayView1d< real32 const > const dampingy,
+                                         arrayView1d< real32 const > const dampingz,
+                                         arrayView2d< real32 const > const ltsResult,
+                                         SortedArrayView< localIndex const > const solverTargetNodesSet )
+  {
+    localIndex const columnx = WaveSolverUtils::localTimeSteppingColumn( 1, 0, 3 );
+    localIndex const columny = WaveSolverUtils::localTimeSteppingColumn( 1, 1, 3 );
+    localIndex const columnz = WaveSolverUtils::localTimeSteppingColumn( 1, 2, 3 );
+    forAll< EXEC_POLICY >( solverTargetNodesSet.size(), [=] GEOS_HOST_DEVICE ( localIndex const n )
+    {
+      localIndex const a = solverTargetNodesSet[n];
+      // 2 M ( w(dt) - u_n ) replaces dt^2 ( rhs - K u_n ) in the standard leapfrog update
+      ux_np1[a] = 2.0*mass[a]*ltsResult[a][columnx];
+      ux_np1[a] -= (mass[a]-0.5*dt*dampingx[a])*ux_nm1[a];
+      ux_np1[a] /= mass[a]+0.5*dt*dampingx[a];
+      uy_np1[a] = 2.0*mass[a]*ltsResult[a][columny];
+      uy_np1[a] -= (mass[a]-0.5*dt*dampingy[a])*uy_nm1[a];
+      uy_np1[a] /= mass[a]+0.5*dt*dampingy[a];
+      uz_np1[a] = 2.0*mass[a]*ltsResult[a][columnz];
+      uz_np1[a] -= (mass[a]-0.5*dt*dampingz[a])*uz_nm1[a];
+      uz_np1[a] /= mass[a]+0.5*dt*dampingz[a];
+    } );
+  };
+
   /**
    * @brief  Apply second order Leap-Frog time scheme for isotropic case without PML, but with attenuation
    * @param[in] dt time-step
@@ -115,18 +170,21 @@ struct ElasticTimeSchemeSEM
    * @param[in] dampingx the damping matrix for x-component
    * @param[in] dampingy the damping matrix for y-component
    * @param[in] dampingz the damping matrix for z-component
-   * @param[in] stiffnessVectorx array containing the product of the stiffness matrix R and the displacement in x-direction at time n
-   * @param[in] stiffnessVectory array containing the product of the stiffness matrix R and the displacement in y-direction at time n
-   * @param[in] stiffnessVectorz array containing the product of the stiffness matrix R and the displacement in z-direction at time n
-   * @param[in] stiffnessVectorAx array containing the product of the attenuation stiffness matrix R and the displacement in x-direction at
-   * time n
-   * @param[in] stiffnessVectorAy array containing the product of the attenuation stiffness matrix R and the displacement in y-direction at
-   * time n
-   * @param[in] stiffnessVectorAz array containing the product of the attenuation stiffness matrix R and the displacement in z-direction at
-   * time n
-   * @param[in] rhsx the right-hand-side for displacement in x-direction
-   * @param[in] rhsy the right-hand-side for displacement in y-direction
-   * @param[in] rhsz the right-hand-side for displacement in z-direction
+   * @param[in,out] stiffnessVectorx array containing the product of the stiffness matrix R and the displacement in x-direction at time n
+   *                 (reset to zero here)
+   * @param[in,out] stiffnessVectory array containing the product of the stiffness matrix R and the displacement in y-direction at time n
+   *                 (reset to zero here)
+   * @param[in,out] stiffnessVectorz array containing the product of the stiffness matrix R and the displacement in z-direction at time n
+   *                 (reset to zero here)
+   * @param[in,out] stiffnessVectorAx array containing the product of the attenuation stiffness matrix R and the displacement in x-direction
+   *                 at time n (reset to zero here)
+   * @param[in,out] stiffnessVectorAy array containing the product of the attenuation stiffness matrix R and the displacement in y-direction
+   *                 at time n (reset to zero here)
+   * @param[in,out] stiffnessVectorAz array containing the product of the attenuation stiffness matrix R and the displacement in z-direction
+   *                 at time n (reset to zero here)
+   * @param[in,out] rhsx the right-hand-side for displacement in x-direction (reset to zero here)
+   * @param[in,out] rhsy the right-hand-side for displacement in y-direction (reset to zero here)
+   * @param[in,out] rhsz the right-hand-side for displacement in z-direction (reset to zero here)
    * @param[in] solverTargetNodesSet the targetted nodeset (useful in particular when we do elasto-acoustic simulation )
    */
   static void AttenuationLeapFrog( real64 const dt,
@@ -192,6 +250,10 @@ struct ElasticTimeSchemeSEM
       ux_np1[a] /= mass[a]+0.5*dt*dampingx[a];
       uy_np1[a] /= mass[a]+0.5*dt*dampingy[a];
       uz_np1[a] /= mass[a]+0.5*dt*dampingz[a];
+      // reset the accumulators for the next time step while the node is in cache
+      stiffnessVectorx[a] = stiffnessVectory[a] = stiffnessVectorz[a] = 0.0;
+      stiffnessVectorAx[a] = stiffnessVectorAy[a] = stiffnessVectorAz[a] = 0.0;
+      rhsx[a] = rhsy[a] = rhsz[a] = 0.0;
     } );
 
   };
@@ -0,0 +1,240 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file PointBinGrid.hpp
+ */
+
+#ifndef GEOS_PHYSICSSOLVERS_WAVEPROPAGATION_POINTBINGRID_HPP_
+#define GEOS_PHYSICSSOLVERS_WAVEPROPAGATION_POINTBINGRID_HPP_
+
+#include "common/DataTypes.hpp"
+
+namespace geos
+{
+
+/**
+ * @brief Uniform bin grid over a set of points (sources, receivers), used to locate them in the mesh
+ *        without testing every point against every element.
+ *
+ * Each point is given a half-extent (zero for a point receiver, half the fiber length for a DAS channel),
+ * and is stored in all the bins overlapped by its bounding box. An element then only tests the points
+ * stored in the bins overlapped by its own bounding box, which makes the location cost proportional to
+ * the number of elements plus the number of points instead of their product.
+ */
+class PointBinGrid
+{
+public:
+
+  /// Maximum number of bins in each direction
+  static constexpr integer maxNumBinsPerDim = 64;
+
+  /**
+   * @brief Device-capturable view of the bin grid
+   */
+  struct View
+  {
+    /**
+     * @brief Call a function on each point whose bounding box may overlap a given box.
+     *        Each point is visited at most once, even if it is stored in several bins.
+     * @tparam FUNC the type of the function, taking the index of the point
+     * @param[in] boxMin the lower corner of the box
+     * @param[in] boxMax the upper corner of the box
+     * @param[in] func the function to call
+     */
+    template< typename FUNC >
+    GEOS_HOST_DEVICE
+    void forPointsInBox( real64 const (&boxMin)[3],
+                         real64 const (&boxMax)[3],
+                         FUNC && func ) const
+    {
+      integer lo[3], hi[3];
+      for( integer d = 0; d < 3; ++d )
+      {
+        if( boxMax[d] < m_min[d] || boxMin[d] > m_max[d] )
+        {
+          return;
+        }
+        lo[d] = binIndex( boxMin[d], d );
+        hi[d] = binIndex( boxMax[d], d );
+      }
+
+      for( integer i = lo[0]; i <= hi[0]; ++i )
+      {
+        for( integer j = lo[1]; j <= hi[1]; ++j )
+        {
+          for( integer k = lo[2]; k <= hi[2]; ++k )
+          {
+            integer const bin[3] = { i, j, k };
+            localIndex const b = ( localIndex( i ) * m_numBins[1] + j ) * m_numBins[2] + k;
+            for( localIndex n = 0; n < m_binPoints.sizeOfArray( b ); ++n )
+            {
+              localIndex const p = m_binPoints( b, n );
+              // only visit the point in the first bin shared by the point and the box
+              bool isFirstSharedBin = true;
+              for( integer d = 0; d < 3; ++d )
+              {
+                integer const first = m_pointFirstBin( p, d ) > lo[d] ? m_pointFirstBin( p, d ) : lo[d];
+                isFirstSharedBin = isFirstSharedBin && ( bin[d] == first );
+              }
+              if( isFirstSharedBin )
+              {
+                func( p );
+              }
+            }
+          }
+        }
+      }
+    }
+
+    /**
+     * @brief Compute the bin index of a coordinate, clamped to the grid
+     * @param[in] x the coordinate
+     * @param[in] d the direction
+     * @return the bin index
+     */
+    GEOS_HOST_DEVICE
+    integer binIndex( real64 const x, integer const d ) const
+    {
+      integer const b = static_cast< integer >( ( x - m_min[d] ) * m_invBinSize[d] );
+      return b < 0 ? 0 : ( b >= m_numBins[d] ? m_numBins[d] - 1 : b );
+    }
+
+    /// Lower corner of the grid
+    real64 m_min[3];
+    /// Upper corner of the grid
+    real64 m_max[3];
+    /// Inverse of the bin size in each direction
+    real64 m_invBinSize[3];
+    /// Number of bins in each direction
+    integer m_numBins[3];
+    /// Points stored in each bin
+    ArrayOfArraysView< localIndex const > m_binPoints;
+    /// First bin (in each direction) overlapped by the bounding box of each point
+    arrayView2d< integer const > m_pointFirstBin;
+  };
+
+  /**
+   * @brief Build the bin grid on the host
+   * @param[in] coordinates the coordinates of the points
+   * @param[in] halfExtent the half-extent of the bounding box of each point, may be empty for points
+   */
+  PointBinGrid( arrayView2d< real64 const > const coordinates,
+                arrayView1d< real64 const > const halfExtent = {} )
+  {
+    localIndex const numPoints = coordinates.size( 0 );
+    coordinates.move( hostMemorySpace, false );
+    if( halfExtent.size() > 0 )
+    {
+      halfExtent.move( hostMemorySpace, false );
+    }
+
+    auto const pointMin = [&]( localIndex const p, integer const d )
+    {
+      return coordinates( p, d ) - ( halfExtent.size() > 0 ? halfExtent[p] : 0.0 );
+    };
+    auto const pointMax = [&]( localIndex const p, integer const d )
+    {
+      return coordinates( p, d ) + ( halfExtent.size() > 0 ? halfExtent[p] : 0.0 );
+    };
+
+    /// aim at about one point per bin
+    integer const numBinsPerDim =
+      LvArray::math::min( maxNumBinsPerDim,
+                          LvArray::math::max( 1, static_cast< integer >( std::ceil( std::cbrt( static_cast< real64 >( numPoints ) ) ) ) ) );
+    for( integer d = 0; d < 3; ++d )
+    {
+      m_view.m_min[d] = numPoints > 0 ? LvArray::NumericLimits< real64 >::max : 0.0;
+      m_view.m_max[d] = numPoints > 0 ? LvArray::NumericLimits< real64 >::lowest : 0.0;
+      for( localIndex p = 0; p < numPoints; ++p )
+      {
+        m_view.m_min[d] = LvArray::math::min( m_view.m_min[d], pointMin( p, d ) );
+        m_view.m_max[d] = LvArray::math::max( m_view.m_max[d], pointMax( p, d ) );
+      }
+      real64 const length = m_view.m_max[d] - m_view.m_min[d];
+      // a flat direction (e.g. receivers on a plane) only needs one bin
+      m_view.m_numBins[d] = length > 0.0 ? numBinsPerDim : 1;
+      m_view.m_invBinSize[d] = length > 0.0 ? m_view.m_numBins[d] / length : 0.0;
+    }
+
+    /// count the points in each bin, then fill the bins
+    localIndex const numBins = localIndex( m_view.m_numBins[0] ) * m_view.m_numBins[1] * m_view.m_numBins[2];
+    m_pointFirstBin.resize( numPoints, 3 );
+    array2d< integer > pointLastBin( numPoints, 3 );
+    array1d< localIndex > binCounts( numBins );
+    for( localIndex p = 0; p < numPoints; ++p )
+    {
+      for( integer d = 0; d < 3; ++d )
+      {
+        m_pointFirstBin( p, d ) = m_view.binIndex( pointMin( p, d ), d );
+        pointLastBin( p, d ) = m_view.binIndex( pointMax( p, d ), d );
+      }
+      forBinsOfPoint( m_pointFirstBin[p], pointLastBin[p], [&]( localIndex const b ) { ++binCounts[b]; } );
+    }
+
+    m_binPoints.resizeFromCapacities< serialPolicy >( numBins, binCounts.data() );
+    for( localIndex p = 0; p < numPoints; ++p )
+    {
+      forBinsOfPoint( m_pointFirstBin[p], pointLastBin[p], [&]( localIndex const b ) { m_binPoints.emplaceBack( b, p ); } );
+    }
+
+    m_view.m_binPoints = m_binPoints.toViewConst();
+    m_view.m_pointFirstBin = m_pointFirstBin.toViewConst();
+  }
+
+  /**
+   * @brief Get a view of the bin grid, to be captured in the kernels
+   * @return the view
+   */
+  View const & toView() const { return m_view; }
+
+private:
+
+  /**
+   * @brief Call a function on the flattened index of each bin between two bins
+   * @param[in] first the first bin in each direction
+   * @param[in] last the last bin in each direction
+   * @param[in] func the function to call
+   */
+  template< typename FUNC >
+  void forBinsOfPoint( arraySlice1d< integer const > const first,
+                       arraySlice1d< integer const > const last,
+                       FUNC && func ) const
+  {
+    for( integer i = first[0]; i <= last[0]; ++i )
+    {
+      for( integer j = first[1]; j <= last[1]; ++j )
+      {
+        for( integer k = first[2]; k <= last[2]; ++k )
+        {
+          func( ( localIndex( i ) * m_view.m_numBins[1] + j ) * m_view.m_numBins[2] + k );
+        }
+      }
+    }
+  }
+
+  /// Points stored in each bin
+  ArrayOfArrays< localIndex > m_binPoints;
+
+  /// First bin (in each direction) overlapped by the bounding box of each point
+  array2d< integer > m_pointFirstBin;
+
+  /// The view captured in the kernels
+  View m_view;
+};
+
+} // namespace geos
+
+#endif //GEOS_PHYSICSSOLVERS_WAVEPROPAGATION_POINTBINGRID_HPP_
@@ -20,6 +20,8 @@
 #ifndef GEOS_PHYSICSSOLVERS_WAVEPROPAGATION_PRECOMPUTESOURCESANDRECEIVERSKERNEL_HPP_
 #define GEOS_PHYSICSSOLVERS_WAVEPROPAGATION_PRECOMPUTESOURCESANDRECEIVERSKERNEL_HPP_
 
+#include "physicsSolvers/wavePropagation/shared/PointBinGrid.hpp"
+
 namespace geos
 {
 
@@ -44,10 +46,12 @@ struct PreComputeSourcesAndReceivers
    * @param[in] elemsToFaces map from element to faces
    * @param[in] elemCenter coordinates of the element centers
    * @param[in] sourceCoordinates coordinates of the source terms
+   * @param[in] sourceBins bin grid of the sources
    * @param[out] sourceIsAccessible flag indicating whether the source is accessible or not
    * @param[out] sourceNodeIds indices of the nodes of the element where the source is located
    * @param[out] sourceConstants constant part of the source terms
    * @param[in] receiverCoordinates coordinates of the receiver terms
+   * @param[in] receiverBins bin grid of the receivers
    * @param[out] receiverIsLocal flag indicating whether the receiver is local or not
    * @param[out] receiverNodeIds indices of the nodes of the element where the receiver is located
    * @param[out] receiverConstants constant part of the receiver term
@@ -71,10 +75,12 @@ struct PreComputeSourcesAndReceivers
                                        arrayView2d< localIndex const > const elemsToFaces,
                                        arrayView2d< real64 const > const & elemCenter,
                                        arrayView2d< real64 const > const sourceCoordinates,
+                                       PointBinGrid::View const sourceBins,
                                        arrayView1d< localIndex > const sourceIsAccessible,
                                        arrayView2d< localIndex > const sourceNodeIds,
                                        arrayView2d< real64 > const sourceConstants,
                                        arrayView2d< real64 const > const receiverCoordinates,
+                                       PointBinGrid::View const receiverBins,
                                        arrayView1d< localIndex > const receiverIsLocal,
                                        arrayView2d< localIndex > const receiverNodeIds,
                                        arrayView2d< real64 > const receiverConstants,
@@ -91,11 +97,13 @@ struct PreComputeSourcesAndReceivers
       real64 const center[3] = { elemCenter[k][0],
                                  elemCenter[k][1],
                                  elemCenter[k][2] };
+      real64 elemMin[3], elemMax[3];
+      WaveSolverUtils::computeElementBoundingBox( baseElemsToNodes[k], baseNodeCoords, elemMin, elemMax );
 
       // Step 1: locate the sources, and precompute the source term
 
-      /// loop over all the source that haven't been found yet
-      for( localIndex isrc = 0; isrc < sourceCoordinates.size( 0 ); ++isrc )
+      /// loop over the sources that haven't been found yet and may lie in this element
+      sourceBins.forPointsInBox( elemMin, elemMax, [&]( localIndex const isrc )
       {
         if( sourceIsAccessible[isrc] == 0 )
         {
@@ -138,13 +146,13 @@ struct PreComputeSourcesAndReceivers
             }
           }
         }
-      } // end loop over all sources
+      } ); // end loop over all sources
 
 
       // Step 2: locate the receivers, and precompute the receiver term
 
-      /// loop over all the receivers that haven't been found yet
-      for( localIndex ircv = 0; ircv < receiverCoordinates.size( 0 ); ++ircv )
+      /// loop over the receivers that haven't been found yet and may lie in this element
+      receiverBins.forPointsInBox( elemMin, elemMax, [&]( localIndex const ircv )
       {
         if( receiverIsLocal[ircv] == 0 )
         {
@@ -183,7 +191,7 @@ struct PreComputeSourcesAndReceivers
             }
           }
         }
-      } // end loop over receivers
+      } ); // end loop over receivers
 
     } );
 
@@ -207,11 +215,13 @@ struct PreComputeSourcesAndReceivers
    * @param[in] elemsToFaces map from element to faces
    * @param[in] elemCenter coordinates of the element centers
    * @param[in] sourceCoordinates coordinates of the source terms
+   * @param[in] sourceBins bin grid of the sources
    * @param[out] sourceIsAccessible flag indicating whether the source is accessible or not
    * @param[out] sourceElem element where a source is located
    * @param[out] sourceNodeIds indices of the nodes of the element where the source is located
    * @param[out] sourceConstants constant part of the source terms
    * @param[in] receiverCoordinates coordinates of the receiver terms
+   * @param[in] receiverBins bin grid of the receivers
    * @param[out] receiverIsLocal flag indicating whether the receiver is local or not
    * @param[out] receiverElem element where a receiver is located
    * @param[out] receiverNodeIds indices of the nodes of the element where the receiver is located
@@ -237,12 +247,14 @@ struct PreComputeSourcesAndReceivers
                                                                    arrayView2d< localIndex const > const elemsToFaces,
                                                                    arrayView2d< real64 const > const & elemCenter,
                                                                    arrayView2d< real64 const > const sourceCoordinates,
+                                                                   PointBinGrid::View const sourceBins,
                                                                    arrayView1d< localIndex > const sourceIsAccessible,
                                                                    arrayView1d< localIndex > const sourceElem,
                                                                    arrayView2d< localIndex > const sourceNodeIds,
                                                                    arrayView2d< real64 > const sourceConstants,
                                                                    arrayView1d< localIndex > const sourceRegion,
                                                                    arrayView2d< real64 const > const receiverCoordinates,
+                                                                   PointBinGrid::View const receiverBins,
                                                                    arrayView1d< localIndex > const receiverIsLocal,
                                                                    arrayView1d< localIndex > const receiverElem,
                                                                    arrayView2d< localIndex > const receiverNodeIds,
@@ -261,11 +273,13 @@ struct PreComputeSourcesAndReceivers
       real64 const center[3] = { elemCenter[k][0],
                                  elemCenter[k][1],
                                  elemCenter[k][2] };
+      real64 elemMin[3], elemMax[3];
+      WaveSolverUtils::computeElementBoundingBox( baseElemsToNodes[k], baseNodeCoords, elemMin, elemMax );
 
       // Step 1: locate the sources, and precompute the source term
 
-      /// loop over all the source that haven't been found yet
-      for( localIndex isrc = 0; isrc < sourceCoordinates.size( 0 ); ++isrc )
+      /// loop over the sources that haven't been found yet and may lie in this element
+      sourceBins.forPointsInBox( elemMin, elemMax, [&]( localIndex const isrc )
       {
         if( sourceIsAccessible[isrc] == 0 )
         {
@@ -310,13 +324,13 @@ struct PreComputeSourcesAndReceivers
             }
           }
         }
-      } // end loop over all sources
+      } ); // end loop over all sources
 
 
       // Step 2: locate the receivers, and precompute the receiver term
 
-      /// loop over all the receivers that haven't been found yet
-      for( localIndex ircv = 0; ircv < receiverCoordinates.size( 0 ); ++ircv )
+      /// loop over the receivers that haven't been found yet and may lie in this element
+      receiverBins.forPointsInBox( elemMin, elemMax, [&]( localIndex const ircv )
       {
         if( receiverIsLocal[ircv] == 0 )
         {
@@ -356,7 +370,7 @@ struct PreComputeSourcesAndReceivers
             }
           }
         }
-      } // end loop over receivers
+      } ); // end loop over receivers
 
     } );
 
@@ -381,12 +395,14 @@ struct PreComputeSourcesAndReceivers
    * @param[in] elemsToFaces map from element to faces
    * @param[in] elemCenter coordinates of the element centers
    * @param[in] sourceCoordinates coordinates of the source terms
+   * @param[in] sourceBins bin grid of the sources
    * @param[out] sourceIsAccessible flag indicating whether the source is accessible or not
    * @param[out] sourceNodeIds indices of the nodes of the element where the source is located
    * @param[out] sourceConstantsx constant part of the source terms in x-direction
    * @param[out] sourceConstantsy constant part of the source terms in y-direction
    * @param[out] sourceConstantsz constant part of the source terms in z-direction
    * @param[in] receiverCoordinates coordinates of the receiver terms
+   * @param[in] receiverBins bin grid of the receivers
    * @param[out] receiverIsLocal flag indicating whether the receiver is local or not
    * @param[out] receiverNodeIds indices of the nodes of the element where the receiver is located
    * @param[out] receiverConstants constant part of the receiver term
@@ -416,12 +432,14 @@ struct PreComputeSourcesAndReceivers
                                               arrayView2d< localIndex const > const elemsToFaces,
                                               arrayView2d< real64 const > const & elemCenter,
                                               arrayView2d< real64 const > const sourceCoordinates,
+                                              PointBinGrid::View const sourceBins,
                                               arrayView1d< localIndex > const sourceIsAccessible,
                                               arrayView2d< localIndex > const sourceNodeIds,
                                               arrayView2d< real64 > const sourceConstantsx,
                                               arrayView2d< real64 > const sourceConstantsy,
                                               arrayView2d< real64 > const sourceConstantsz,
                                               arrayView2d< real64 const > const receiverCoordinates,
+                                              PointBinGrid::View const receiverBins,
                                               arrayView1d< localIndex > const receiverIsLocal,
                                               arrayView2d< localIndex > const receiverNodeIds,
                                               arrayView2d< real64 > const receiverConstants,
@@ -448,11 +466,13 @@ struct PreComputeSourcesAndReceivers
       real64 const center[3] = { elemCenter[k][0],
                                  elemCenter[k][1],
                                  elemCenter[k][2] };
+      real64 elemMin[3], elemMax[3];
+      WaveSolverUtils::computeElementBoundingBox( baseElemsToNodes[k], baseNodeCoords, elemMin, elemMax );
 
       // Step 1: locate the sources, and precompute the source term
 
-      /// loop over all the source that haven't been found yet
-      for( localIndex isrc = 0; isrc < sourceCoordinates.size( 0 ); ++isrc )
+      /// loop over the sources that haven't been found yet and may lie in this element
+      sourceBins.forPointsInBox( elemMin, elemMax, [&]( localIndex const isrc )
       {
         if( sourceIsAccessible[isrc] == 0 )
         {
@@ -519,7 +539,7 @@ struct PreComputeSourcesAndReceivers
 
           }
         }
-      } // end loop over all sources
+      } ); // end loop over all sources
 
       // Step 2: locate the receivers, and precompute the receiver term
 
@@ -559,8 +579,8 @@ struct PreComputeSourcesAndReceivers
         }
       }
 
-      /// loop over all the receivers
-      for( localIndex ircv = 0; ircv < receiverCoordinates.size( 0 ); ++ircv )
+      /// loop over the receivers that may lie in this element
+      receiverBins.forPointsInBox( elemMin, elemMax, [&]( localIndex const ircv )
       {
         R1Tensor receiverCenter = { receiverCoordinates[ ircv ][ 0 ], receiverCoordinates[ ircv ][ 1 ], receiverCoordinates[ ircv ][ 2 ] };
         R1Tensor receiverVector;
@@ -644,7 +664,7 @@ struct PreComputeSourcesAndReceivers
         {
           receiverIsLocal[ ircv ] = 1;
         }
-      } // end loop over receivers
+      } ); // end loop over receivers
     } );
 
   }
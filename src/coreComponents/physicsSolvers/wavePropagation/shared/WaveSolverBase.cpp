@@ -40,7 +40,11 @@ using namespace dataRepository;
 WaveSolverBase::WaveSolverBase( const std::string & name,
                                 Group * const parent ):
   SolverBase( name,
-              parent )
+              parent ),
+  m_sourceTimeStep( 0 ),
+  m_useLocalTimeStepping( 0 ),
+  m_maxLocalTimeSteppingLevel( 0 ),
+  m_numLocalTimeSteppingLevels( 1 )
 {
 
   registerWrapper( viewKeyStruct::sourceCoordinatesString(), &m_sourceCoordinates ).
@@ -59,6 +63,12 @@ WaveSolverBase::WaveSolverBase( const std::string & name,
     setSizedFromParent( 0 ).
     setDescription( "Source Value of the sources" );
 
+  registerWrapper( viewKeyStruct::precomputeSourceValueString(), &m_precomputeSourceValue ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 1 ).
+    setDescription( "Set to 0 to evaluate the Ricker wavelet on the fly instead of storing the value of each source "
+                    "for all the time steps in sourceValue, which is then left empty and cannot be used to provide a custom wavelet" );
+
   registerWrapper( viewKeyStruct::timeSourceDelayString(), &m_timeSourceDelay ).
     setInputFlag( InputFlags::OPTIONAL ).
     setApplyDefaultValue( -1 ).
@@ -79,6 +89,12 @@ WaveSolverBase::WaveSolverBase( const std::string & name,
     setApplyDefaultValue( 0 ).
     setDescription( "Flag that indicates if we write the seismo trace in a file .txt, 0 no output, 1 otherwise" );
 
+  registerWrapper( viewKeyStruct::outputSeismoTraceFormatString(), &m_outputSeismoTraceFormat ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( WaveSolverUtils::SeismoTraceFormat::txt ).
+    setDescription( "Format of the seismo trace output: \"txt\" for one text file per receiver, "
+                    "\"hdf5\" for one HDF5 file per solver, written collectively, with one dataset per recorded variable" );
+
   registerWrapper( viewKeyStruct::dtSeismoTraceString(), &m_dtSeismoTrace ).
     setInputFlag( InputFlags::OPTIONAL ).
     setApplyDefaultValue( 0 ).
@@ -381,8 +397,10 @@ void WaveSolverBase::postInputInitialization()
   }
   localIndex const nsamples = int( (maxTime - minTime) / dt) + 1;
 
+  /// the dense table of source values is stored unless the wavelet is evaluated on the fly
+  m_sourceTimeStep = dt;
   localIndex const numSourcesGlobal = m_sourceCoordinates.size( 0 );
-  m_sourceValue.resize( nsamples, numSourcesGlobal );
+  m_sourceValue.resize( m_precomputeSourceValue ? nsamples : 0, numSourcesGlobal );
 
 }
 
@@ -452,6 +470,11 @@ localIndex WaveSolverBase::getNumNodesPerElem()
   return numNodesPerElem;
 }
 
+WaveSolverUtils::SourceTimeFunction WaveSolverBase::getSourceTimeFunction() const
+{
+  return { m_sourceValue.toViewConst(), m_sourceTimeStep, m_timeSourceFrequency, m_timeSourceDelay, m_rickerOrder };
+}
+
 void WaveSolverBase::computeTargetNodeSet( arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elemsToNodes,
                                            localIndex const subRegionSize,
                                            localIndex const numQuadraturePointsPerElem )
@@ -513,6 +536,25 @@ void WaveSolverBase::computeAllSeismoTraces( real64 const time_n,
   }
 }
 
+void WaveSolverBase::computeAllSeismoTracesBatched( real64 const time_n,
+                                                    real64 const dt,
+                                                    arrayView2d< real32 const > const var_np1,
+                                                    arrayView2d< real32 const > const var_n,
+                                                    arrayView3d< real32 > varAtReceivers )
+{
+  if( m_nsamplesSeismoTrace == 0 )
+    return;
+  integer const dir = m_forward ? +1 : -1;
+  for( localIndex iSeismo = m_indexSeismoTrace; iSeismo < m_nsamplesSeismoTrace; iSeismo++ )
+  {
+    real64 const timeSeismo = m_dtSeismoTrace * (m_forward ? iSeismo : (m_nsamplesSeismoTrace - 1) - iSeismo);
+    if( dir * timeSeismo > dir * (time_n + epsilonLoc) )
+      break;
+    WaveSolverUtils::computeSeismoTraceBatched( time_n, dir * dt, timeSeismo, iSeismo, m_receiverNodeIds,
+                                                m_receiverConstants, m_receiverIsLocal, var_np1, var_n, varAtReceivers );
+  }
+}
+
 void WaveSolverBase::compute2dVariableAllSeismoTraces( localIndex const regionIndex,
                                                        real64 const time_n,
                                                        real64 const dt,
@@ -533,6 +575,345 @@ void WaveSolverBase::compute2dVariableAllSeismoTraces( localIndex const regionIn
   }
 }
 
+void WaveSolverBase::registerLocalTimeSteppingInputs()
+{
+  registerWrapper( viewKeyStruct::useLocalTimeSteppingString(), &m_useLocalTimeStepping ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Set to 1 to enable local time stepping: elements are binned by their stable time step into power-of-two levels, "
+                    "and the elements of level l are advanced with dt / 2^l using a multi-rate leapfrog scheme" );
+
+  registerWrapper( viewKeyStruct::maxLocalTimeSteppingLevelString(), &m_maxLocalTimeSteppingLevel ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 3 ).
+    setDescription( "Maximum local time stepping level, i.e. the finest elements are advanced with dt / 2^maxLocalTimeSteppingLevel" );
+}
+
+void WaveSolverBase::registerLocalTimeSteppingData( MeshLevel & mesh, integer const numComponents )
+{
+  integer const numColumns = ( m_maxLocalTimeSteppingLevel + 2 ) * numComponents;
+
+  NodeManager & nodeManager = mesh.getNodeManager();
+  nodeManager.registerField< fields::localTimeSteppingNodeLevel,
+                             fields::localTimeSteppingState,
+                             fields::localTimeSteppingResult,
+                             fields::localTimeSteppingForce >( getName() );
+
+  nodeManager.getField< fields::localTimeSteppingState >().resizeDimension< 1 >( numColumns );
+  nodeManager.getField< fields::localTimeSteppingResult >().resizeDimension< 1 >( numColumns );
+  nodeManager.getField< fields::localTimeSteppingForce >().resizeDimension< 1 >( numColumns );
+
+  mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion & subRegion )
+  {
+    subRegion.registerField< fields::localTimeSteppingElementLevel >( getName() );
+    subRegion.registerWrapper< ArrayOfArrays< localIndex > >( viewKeyStruct::localTimeSteppingElementsString() ).
+      setSizedFromParent( 0 ).
+      setRestartFlags( RestartFlags::NO_WRITE ).
+      setDescription( "For each local time stepping level l, the elements having at least one node of level l" );
+  } );
+}
+
+void WaveSolverBase::computeLocalTimeSteppingLevels( DomainPartition & domain,
+                                                     MeshLevel & mesh,
+                                                     arrayView1d< string const > const & regionNames,
+                                                     string const & velocityFieldName )
+{
+  GEOS_MARK_FUNCTION;
+
+  NodeManager & nodeManager = mesh.getNodeManager();
+  ElementRegionManager & elemManager = mesh.getElemManager();
+  arrayView2d< wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords = nodeManager.getField< fields::referencePosition32 >().toViewConst();
+
+  // Characteristic time h / c of each element, where h is the smallest edge of the hexahedron
+  auto const computeCrossingTime = [&]( CellElementSubRegion const & elementSubRegion, auto && lambda )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes = elementSubRegion.nodeList();
+    arrayView1d< real32 const > const velocity = elementSubRegion.getReference< array1d< real32 > >( velocityFieldName );
+
+    finiteElement::FiniteElementBase const &
+    fe = elementSubRegion.getReference< finiteElement::FiniteElementBase >( getDiscretizationName() );
+    finiteElement::FiniteElementDispatchHandler< SEM_FE_TYPES >::dispatch3D( fe, [&] ( auto const finiteElement )
+    {
+      using FE_TYPE = TYPEOFREF( finiteElement );
+
+      forAll< serialPolicy >( elementSubRegion.size(), [&] ( localIndex const k )
+      {
+        real64 minEdgeLength = LvArray::NumericLimits< real64 >::max;
+        for( integer a = 0; a < 8; ++a )
+        {
+          localIndex const nodeA = elemsToNodes( k, FE_TYPE::meshIndexToLinearIndex3D( a ) );
+          for( integer bit = 1; bit < 8; bit *= 2 )
+          {
+            if( ( a & bit ) == 0 )
+            {
+              localIndex const nodeB = elemsToNodes( k, FE_TYPE::meshIndexToLinearIndex3D( a | bit ) );
+              real64 length2 = 0.0;
+              for( integer i = 0; i < 3; ++i )
+              {
+                length2 += ( nodeCoords[nodeB][i] - nodeCoords[nodeA][i] ) * ( nodeCoords[nodeB][i] - nodeCoords[nodeA][i] );
+              }
+              minEdgeLength = LvArray::math::min( minEdgeLength, LvArray::math::sqrt( length2 ) );
+            }
+          }
+        }
+        lambda( k, minEdgeLength / velocity[k] );
+      } );
+    } );
+  };
+
+  /// 1) The element with the largest crossing time defines the coarsest level, advanced with the event dt
+  real64 maxCrossingTime = 0.0;
+  elemManager.forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                              CellElementSubRegion & elementSubRegion )
+  {
+    computeCrossingTime( elementSubRegion, [&]( localIndex const, real64 const crossingTime )
+    {
+      maxCrossingTime = LvArray::math::max( maxCrossingTime, crossingTime );
+    } );
+  } );
+  maxCrossingTime = MpiWrapper::max( maxCrossingTime );
+
+  /// 2) Bin the elements into power-of-two levels, and set the node level to the max of the adjacent element levels
+  arrayView1d< integer > const nodeLevel = nodeManager.getField< fields::localTimeSteppingNodeLevel >();
+  nodeLevel.move( hostMemorySpace, true );
+  nodeLevel.setValues< serialPolicy >( 0 );
+
+  integer maxElementLevel = 0;
+  integer numTruncatedElements = 0;
+  elemManager.forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                              CellElementSubRegion & elementSubRegion )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes = elementSubRegion.nodeList();
+    arrayView1d< integer > const elemLevel = elementSubRegion.getField< fields::localTimeSteppingElementLevel >();
+    arrayView1d< integer const > const elemGhostRank = elementSubRegion.ghostRank();
+    elemLevel.move( hostMemorySpace, true );
+
+    computeCrossingTime( elementSubRegion, [&]( localIndex const k, real64 const crossingTime )
+    {
+      integer const requiredLevel = static_cast< integer >( std::ceil( std::log2( maxCrossingTime / crossingTime ) - 1e-6 ) );
+      elemLevel[k] = LvArray::math::min( LvArray::math::max( requiredLevel, 0 ), m_maxLocalTimeSteppingLevel );
+      if( elemGhostRank[k] < 0 && requiredLevel > m_maxLocalTimeSteppingLevel )
+      {
+        ++numTruncatedElements;
+      }
+      maxElementLevel = LvArray::math::max( maxElementLevel, elemLevel[k] );
+      for( localIndex a = 0; a < elemsToNodes.size( 1 ); ++a )
+      {
+        localIndex const nodeIdx = elemsToNodes( k, a );
+        nodeLevel[nodeIdx] = LvArray::math::max( nodeLevel[nodeIdx], elemLevel[k] );
+      }
+    } );
+  } );
+  m_numLocalTimeSteppingLevels = MpiWrapper::max( maxElementLevel ) + 1;
+
+  numTruncatedElements = MpiWrapper::sum( numTruncatedElements );
+  GEOS_LOG_RANK_0_IF( numTruncatedElements > 0,
+                      GEOS_FMT( "{}: {} elements would require a local time stepping level larger than {} to be stable, "
+                                "consider increasing {} or decreasing the time step",
+                                getDataContext(), numTruncatedElements, m_maxLocalTimeSteppingLevel,
+                                viewKeyStruct::maxLocalTimeSteppingLevelString() ) );
+
+  /// the owner of a node sees all the adjacent elements, so the ghost node levels are taken from the owner
+  FieldIdentifiers fieldsToBeSync;
+  fieldsToBeSync.addFields( FieldLocation::Node, { fields::localTimeSteppingNodeLevel::key() } );
+  CommunicationTools::getInstance().synchronizeFields( fieldsToBeSync,
+                                                       mesh,
+                                                       domain.getNeighbors(),
+                                                       false );
+
+  nodeLevel.move( hostMemorySpace, false );
+
+  /// 3) Build the element bands, i.e. the elements touched by the nodes of each level, and the active node sets
+  integer const numLevels = m_numLocalTimeSteppingLevels;
+  array1d< integer > nodeActiveLevel( nodeManager.size() );
+  nodeActiveLevel.setValues< serialPolicy >( -1 );
+  array1d< globalIndex > numElementsPerLevel( numLevels );
+
+  elemManager.forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                              CellElementSubRegion & elementSubRegion )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes = elementSubRegion.nodeList();
+    arrayView1d< integer const > const elemLevel = elementSubRegion.getField< fields::localTimeSteppingElementLevel >();
+    arrayView1d< integer const > const elemGhostRank = elementSubRegion.ghostRank();
+
+    ArrayOfArrays< localIndex > & bands =
+      elementSubRegion.getReference< ArrayOfArrays< localIndex > >( viewKeyStruct::localTimeSteppingElementsString() );
+    bands.resize( 0 );
+    bands.resize( numLevels );
+
+    forAll< serialPolicy >( elementSubRegion.size(), [&] ( localIndex const k )
+    {
+      integer minNodeLevel = numLevels;
+      integer maxNodeLevel = 0;
+      for( localIndex a = 0; a < elemsToNodes.size( 1 ); ++a )
+      {
+        minNodeLevel = LvArray::math::min( minNodeLevel, nodeLevel[elemsToNodes( k, a )] );
+        maxNodeLevel = LvArray::math::max( maxNodeLevel, nodeLevel[elemsToNodes( k, a )] );
+      }
+      for( integer level = minNodeLevel; level <= maxNodeLevel; ++level )
+      {
+        bands.emplaceBack( level, k );
+      }
+      for( localIndex a = 0; a < elemsToNodes.size( 1 ); ++a )
+      {
+        localIndex const nodeIdx = elemsToNodes( k, a );
+        nodeActiveLevel[nodeIdx] = LvArray::math::max( nodeActiveLevel[nodeIdx], maxNodeLevel );
+      }
+      if( elemGhostRank[k] < 0 )
+      {
+        numElementsPerLevel[elemLevel[k]] += 1;
+      }
+    } );
+  } );
+
+  m_localTimeSteppingNodes.resize( 0 );
+  m_localTimeSteppingNodes.resize( numLevels );
+  for( localIndex n = 0; n < m_solverTargetNodesSet.size(); ++n )
+  {
+    localIndex const a = m_solverTargetNodesSet[n];
+    for( integer level = 0; level <= nodeActiveLevel[a]; ++level )
+    {
+      m_localTimeSteppingNodes.emplaceBack( level, a );
+    }
+  }
+
+  for( integer level = 0; level < numLevels; ++level )
+  {
+    GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "{}: local time stepping level {} (dt / {}): {} elements",
+                                        getDataContext(), level, 1 << level, MpiWrapper::sum( numElementsPerLevel[level] ) ) );
+  }
+}
+
+void WaveSolverBase::computeLocalTimeSteppingUpdate( real64 const dt,
+                                                     DomainPartition & domain,
+                                                     MeshLevel & mesh,
+                                                     integer const numComponents,
+                                                     arrayView1d< localIndex const > const fixedNodeIndicator,
+                                                     std::function< void ( integer const ) > const & launchBandKernel )
+{
+  GEOS_MARK_FUNCTION;
+
+  NodeManager & nodeManager = mesh.getNodeManager();
+  arrayView2d< real32 > const force = nodeManager.getField< fields::localTimeSteppingForce >();
+  ArrayOfArraysView< localIndex const > const activeNodes = m_localTimeSteppingNodes.toViewConst();
+
+  /// force_1 = force_0 + M^{-1} K ( P_0 - P_1 ) u_n, where force_0 = -M^{-1} f is provided by the solver
+  forAll< EXEC_POLICY >( activeNodes.sizeOfArray( 0 ), [=] GEOS_HOST_DEVICE ( localIndex const n )
+  {
+    localIndex const a = activeNodes( 0, n );
+    for( integer c = 0; c < numComponents; ++c )
+    {
+      force[a][WaveSolverUtils::localTimeSteppingColumn( 1, c, numComponents )] =
+        force[a][WaveSolverUtils::localTimeSteppingColumn( 0, c, numComponents )];
+    }
+  } );
+  launchBandKernel( 0 );
+
+  advanceLocalTimeSteppingLevel( 1, dt, domain, mesh, numComponents, fixedNodeIndicator, launchBandKernel );
+}
+
+void WaveSolverBase::advanceLocalTimeSteppingLevel( integer const level,
+                                                    real64 const H,
+                                                    DomainPartition & domain,
+                                                    MeshLevel & mesh,
+                                                    integer const numComponents,
+                                                    arrayView1d< localIndex const > const fixedNodeIndicator,
+                                                    std::function< void ( integer const ) > const & launchBandKernel )
+{
+  NodeManager & nodeManager = mesh.getNodeManager();
+  arrayView2d< real32 > const state = nodeManager.getField< fields::localTimeSteppingState >();
+  arrayView2d< real32 > const result = nodeManager.getField< fields::localTimeSteppingResult >();
+  arrayView2d< real32 > const force = nodeManager.getField< fields::localTimeSteppingForce >();
+  ArrayOfArraysView< localIndex const > const activeNodes = m_localTimeSteppingNodes.toViewConst();
+  bool const hasFixedNodes = fixedNodeIndicator.size() > 0;
+
+  /// Outside of the nodes of level >= level, the force is frozen and the averaged solution is known in closed form
+  {
+    real64 const halfH2 = 0.5 * H * H;
+    forAll< EXEC_POLICY >( activeNodes.sizeOfArray( level - 1 ), [=] GEOS_HOST_DEVICE ( localIndex const n )
+    {
+      localIndex const a = activeNodes( level - 1, n );
+      bool const isFixed = hasFixedNodes && fixedNodeIndicator[a] == 1;
+      for( integer c = 0; c < numComponents; ++c )
+      {
+        localIndex const in = WaveSolverUtils::localTimeSteppingColumn( level - 1, c, numComponents );
+        localIndex const out = WaveSolverUtils::localTimeSteppingColumn( level, c, numComponents );
+        result[a][out] = isFixed ? state[a][in] : state[a][in] - halfH2 * force[a][out];
+      }
+    } );
+  }
+
+  if( level >= m_numLocalTimeSteppingLevels )
+  {
+    return;
+  }
+
+  /// Two leapfrog substeps of size H/2, the force of the finer levels being recomputed recursively at each substep
+  localIndex const numActiveNodes = activeNodes.sizeOfArray( level );
+  real64 const h = 0.5 * H;
+
+  forAll< EXEC_POLICY >( numActiveNodes, [=] GEOS_HOST_DEVICE ( localIndex const n )
+  {
+    localIndex const a = activeNodes( level, n );
+    for( integer c = 0; c < numComponents; ++c )
+    {
+      state[a][WaveSolverUtils::localTimeSteppingColumn( level, c, numComponents )] =
+        state[a][WaveSolverUtils::localTimeSteppingColumn( level - 1, c, numComponents )];
+    }
+  } );
+
+  for( integer substep = 0; substep < 2; ++substep )
+  {
+    forAll< EXEC_POLICY >( numActiveNodes, [=] GEOS_HOST_DEVICE ( localIndex const n )
+    {
+      localIndex const a = activeNodes( level, n );
+      for( integer c = 0; c < numComponents; ++c )
+      {
+        force[a][WaveSolverUtils::localTimeSteppingColumn( level + 1, c, numComponents )] =
+          force[a][WaveSolverUtils::localTimeSteppingColumn( level, c, numComponents )];
+      }
+    } );
+    launchBandKernel( level );
+
+    advanceLocalTimeSteppingLevel( level + 1, h, domain, mesh, numComponents, fixedNodeIndicator, launchBandKernel );
+
+    if( substep == 0 )
+    {
+      /// w_1 = Q( w_0 )
+      forAll< EXEC_POLICY >( numActiveNodes, [=] GEOS_HOST_DEVICE ( localIndex const n )
+      {
+        localIndex const a = activeNodes( level, n );
+        for( integer c = 0; c < numComponents; ++c )
+        {
+          state[a][WaveSolverUtils::localTimeSteppingColumn( level, c, numComponents )] =
+            result[a][WaveSolverUtils::localTimeSteppingColumn( level + 1, c, numComponents )];
+        }
+      } );
+
+      FieldIdentifiers fieldsToBeSync;
+      fieldsToBeSync.addFields( FieldLocation::Node, { fields::localTimeSteppingState::key() } );
+      CommunicationTools::getInstance().synchronizeFields( fieldsToBeSync,
+                                                           mesh,
+                                                           domain.getNeighbors(),
+                                                           true );
+    }
+    else
+    {
+      /// w_2 = 2 Q( w_1 ) - w_0
+      forAll< EXEC_POLICY >( numActiveNodes, [=] GEOS_HOST_DEVICE ( localIndex const n )
+      {
+        localIndex const a = activeNodes( level, n );
+        for( integer c = 0; c < numComponents; ++c )
+        {
+          result[a][WaveSolverUtils::localTimeSteppingColumn( level, c, numComponents )] =
+            2.0 * result[a][WaveSolverUtils::localTimeSteppingColumn( level + 1, c, numComponents )]
+            - state[a][WaveSolverUtils::localTimeSteppingColumn( level - 1, c, numComponents )];
+        }
+      } );
+    }
+  }
+}
+
 bool WaveSolverBase::directoryExists( std::string const & directoryName )
 {
   struct stat buffer;
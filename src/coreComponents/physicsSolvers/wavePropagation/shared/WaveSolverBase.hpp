@@ -83,6 +83,7 @@ public:
   {
     static constexpr char const * sourceCoordinatesString() { return "sourceCoordinates"; }
     static constexpr char const * sourceValueString() { return "sourceValue"; }
+    static constexpr char const * precomputeSourceValueString() { return "precomputeSourceValue"; }
 
     static constexpr char const * timeSourceFrequencyString() { return "timeSourceFrequency"; }
     static constexpr char const * timeSourceDelayString() { return "timeSourceDelay"; }
@@ -99,6 +100,7 @@ public:
     static constexpr char const * receiverIsLocalString() { return "receiverIsLocal"; }
 
     static constexpr char const * outputSeismoTraceString() { return "outputSeismoTrace"; }
+    static constexpr char const * outputSeismoTraceFormatString() { return "outputSeismoTraceFormat"; }
     static constexpr char const * dtSeismoTraceString() { return "dtSeismoTrace"; }
     static constexpr char const * indexSeismoTraceString() { return "indexSeismoTrace"; }
     static constexpr char const * forwardString() { return "forward"; }
@@ -126,6 +128,10 @@ public:
     static constexpr char const * attenuationTypeString() { return "attenuationType"; }
     static constexpr char const * slsReferenceAngularFrequenciesString() { return "slsReferenceAngularFrequencies"; }
     static constexpr char const * slsAnelasticityCoefficientsString() { return "slsAnelasticityCoefficients"; }
+
+    static constexpr char const * useLocalTimeSteppingString() { return "useLocalTimeStepping"; }
+    static constexpr char const * maxLocalTimeSteppingLevelString() { return "maxLocalTimeSteppingLevel"; }
+    static constexpr char const * localTimeSteppingElementsString() { return "localTimeSteppingElements"; }
   };
 
   /**
@@ -197,6 +203,20 @@ protected:
                                                  arrayView2d< real32 const > const var_n,
                                                  arrayView2d< real32 > varAtReceivers );
 
+  /**
+   * @brief Computes the traces of all the shots of a batch on all receivers up to time_n+dt
+   * @param time_n the time corresponding to the field values pressure_n
+   * @param dt the simulation timestep
+   * @param var_np1 the field values at time_n + dt, indexed by (node, shot)
+   * @param var_n the field values at time_n, indexed by (node, shot)
+   * @param varAtreceivers the array holding the trace values, indexed by (sample, receiver, shot)
+   */
+  void computeAllSeismoTracesBatched( real64 const time_n,
+                                      real64 const dt,
+                                      arrayView2d< real32 const > const var_np1,
+                                      arrayView2d< real32 const > const var_n,
+                                      arrayView3d< real32 > varAtReceivers );
+
   /**
    * @brief Apply Perfectly Matched Layer (PML) to the regions defined in the geometry box from the xml
    * @param time the time to apply the BC
@@ -241,17 +261,93 @@ protected:
                                        DomainPartition & domain,
                                        bool const computeGradient ) = 0;
 
+  /**
+   * @brief Recursive step of the multi-rate leapfrog: integrates w'' = -( z_l + M^{-1} K P_l w ) over a step H
+   *   with w(0) = state_{l-1} and w'(0) = 0, and writes w(H) in result_l on the active nodes of level l-1.
+   * @param level the current level
+   * @param H the time step of the level above
+   * @param domain the partition domain
+   * @param mesh the mesh level on which the solver is applied
+   * @param numComponents the number of components of the unknown
+   * @param fixedNodeIndicator indicator of the nodes which are not updated, may be empty
+   * @param launchBandKernel function adding M^{-1} K (P_l - P_{l+1}) state_l to force_{l+1}
+   */
+  void advanceLocalTimeSteppingLevel( integer const level,
+                                      real64 const H,
+                                      DomainPartition & domain,
+                                      MeshLevel & mesh,
+                                      integer const numComponents,
+                                      arrayView1d< localIndex const > const fixedNodeIndicator,
+                                      std::function< void ( integer const ) > const & launchBandKernel );
 
   virtual void registerDataOnMesh( Group & meshBodies ) override;
 
   localIndex getNumNodesPerElem();
 
+  /**
+   * @brief Get the time function of the sources, to be evaluated in the kernels
+   * @return the source time function
+   */
+  WaveSolverUtils::SourceTimeFunction getSourceTimeFunction() const;
+
+  /**
+   * @brief Register the input flags of the local time stepping (LTS) scheme.
+   * @note Only called by the solvers supporting the multi-rate leapfrog
+   */
+  void registerLocalTimeSteppingInputs();
+
+  /**
+   * @brief Register the node and element data needed by the local time stepping scheme
+   * @param mesh the mesh level on which the solver is applied
+   * @param numComponents the number of components of the unknown (1 for pressure, 3 for displacement)
+   */
+  void registerLocalTimeSteppingData( MeshLevel & mesh, integer const numComponents );
+
+  /**
+   * @brief Bin the elements into power-of-two time stepping levels according to their stable time step.
+   *   Elements with the largest ratio h / c advance with the time step of the event (level 0), while an element
+   *   of level l advances with dt / 2^l. The node level is the maximum level of the adjacent elements.
+   * @param domain the partition domain
+   * @param mesh the mesh level on which the solver is applied
+   * @param regionNames the names of the target regions
+   * @param velocityFieldName the key of the cell-wise wave speed driving the CFL condition
+   */
+  void computeLocalTimeSteppingLevels( DomainPartition & domain,
+                                       MeshLevel & mesh,
+                                       arrayView1d< string const > const & regionNames,
+                                       string const & velocityFieldName );
+
+  /**
+   * @brief Compute the multi-rate leapfrog (Diaz & Grote) update over one coarse step.
+   *   On input, column 0 of the LTS state contains u_n and column 0 of the LTS force contains -M^{-1} f.
+   *   On output, column 1 of the LTS result contains the averaged solution w(dt), such that
+   *   u_{n+1} = 2 w(dt) - u_{n-1} in the absence of damping.
+   * @param dt the coarse time step
+   * @param domain the partition domain
+   * @param mesh the mesh level on which the solver is applied
+   * @param numComponents the number of components of the unknown
+   * @param fixedNodeIndicator indicator of the nodes which are not updated (e.g. free surface), may be empty
+   * @param launchBandKernel function adding M^{-1} K (P_l - P_{l+1}) state_l to force_{l+1} for a given level l
+   */
+  void computeLocalTimeSteppingUpdate( real64 const dt,
+                                       DomainPartition & domain,
+                                       MeshLevel & mesh,
+                                       integer const numComponents,
+                                       arrayView1d< localIndex const > const fixedNodeIndicator,
+                                       std::function< void ( integer const ) > const & launchBandKernel );
+
   /// Coordinates of the sources in the mesh
   array2d< real64 > m_sourceCoordinates;
 
-  /// Precomputed value of the source terms
+  /// Precomputed value of the source terms, only allocated when m_precomputeSourceValue is set
   array2d< real32 > m_sourceValue;
 
+  /// Flag to store the value of the sources for all the time steps, the wavelet being evaluated on the fly otherwise
+  integer m_precomputeSourceValue;
+
+  /// Time-step used to evaluate the source time function
+  real64 m_sourceTimeStep;
+
   /// Central frequency for the Ricker time source
   real32 m_timeSourceFrequency;
 
@@ -267,6 +363,9 @@ protected:
   /// Flag that indicates if we write the seismo trace in a file .txt, 0 no output, 1 otherwise
   integer m_outputSeismoTrace;
 
+  /// Format of the seismo trace files (text or HDF5)
+  WaveSolverUtils::SeismoTraceFormat m_outputSeismoTraceFormat;
+
   /// Time step for seismoTrace output
   real64 m_dtSeismoTrace;
 
@@ -357,6 +456,18 @@ protected:
   /// A set of target nodes IDs that will be handled by the current solver
   SortedArray< localIndex > m_solverTargetNodesSet;
 
+  /// Flag to enable the local time stepping (multi-rate leapfrog) scheme
+  integer m_useLocalTimeStepping;
+
+  /// Maximum local time stepping level (the finest elements advance with dt / 2^maxLevel)
+  integer m_maxLocalTimeSteppingLevel;
+
+  /// Number of local time stepping levels actually present in the mesh
+  integer m_numLocalTimeSteppingLevels;
+
+  /// For each level l, the nodes belonging to an element which has at least one node of level >= l
+  ArrayOfArrays< localIndex > m_localTimeSteppingNodes;
+
   struct parametersPML
   {
     /// Mininum (x,y,z) coordinates of inner PML boundaries
@@ -389,6 +500,46 @@ DECLARE_FIELD( referencePosition32,
                NOPLOT,
                WRITE_AND_READ,
                "Copy of the referencePosition from NodeManager in 32 bits integer" );
+
+DECLARE_FIELD( localTimeSteppingNodeLevel,
+               "localTimeSteppingNodeLevel",
+               array1d< integer >,
+               0,
+               LEVEL_1,
+               WRITE_AND_READ,
+               "Local time stepping level of the node (maximum level of the adjacent elements)" );
+
+DECLARE_FIELD( localTimeSteppingElementLevel,
+               "localTimeSteppingElementLevel",
+               array1d< integer >,
+               0,
+               LEVEL_1,
+               WRITE_AND_READ,
+               "Local time stepping level of the element: the element is advanced with dt / 2^level" );
+
+DECLARE_FIELD( localTimeSteppingState,
+               "localTimeSteppingState",
+               array2d< real32 >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Intermediate states of the local time stepping scheme, stored per level and component" );
+
+DECLARE_FIELD( localTimeSteppingResult,
+               "localTimeSteppingResult",
+               array2d< real32 >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Averaged solutions returned by each level of the local time stepping scheme" );
+
+DECLARE_FIELD( localTimeSteppingForce,
+               "localTimeSteppingForce",
+               array2d< real32 >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Frozen forces (divided by the mass) seen by each level of the local time stepping scheme" );
 }
 } /* namespace geos */
 
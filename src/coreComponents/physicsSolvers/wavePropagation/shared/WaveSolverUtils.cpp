@@ -0,0 +1,139 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file WaveSolverUtils.cpp
+ */
+
+#include "WaveSolverUtils.hpp"
+
+#include "common/MpiWrapper.hpp"
+#include "fileIO/timeHistory/HDFFile.hpp"
+
+#include <hdf5.h>
+
+namespace geos
+{
+
+/// Maximum number of samples in a chunk of the HDF5 seismo trace datasets
+static constexpr hsize_t maxSeismoTraceChunkSize = 4096;
+
+void WaveSolverUtils::initTraceHDF5( string const & fileName )
+{
+  HDFFile const target( fileName, true, true, MPI_COMM_GEOS );
+  GEOS_ERROR_IF( target < 0, GEOS_FMT( "Failed to create the seismo trace file {}.hdf5", fileName ) );
+}
+
+void WaveSolverUtils::writeSeismoTraceHDF5( string const & fileName,
+                                            string const & datasetName,
+                                            localIndex const nReceivers,
+                                            arrayView1d< localIndex const > const receiverIsLocal,
+                                            localIndex const nsamplesSeismoTrace,
+                                            arrayView2d< real32 const > const varAtReceivers )
+{
+  if( nsamplesSeismoTrace == 0 ) return;
+
+  receiverIsLocal.move( hostMemorySpace, false );
+  varAtReceivers.move( hostMemorySpace, false );
+
+  // rows of the dataset written by this rank: the local receivers, and the time (last row) on rank 0
+  std::vector< localIndex > rows;
+  for( localIndex ircv = 0; ircv < nReceivers; ++ircv )
+  {
+    if( receiverIsLocal[ircv] == 1 )
+    {
+      rows.emplace_back( ircv );
+    }
+  }
+  if( MpiWrapper::commRank( MPI_COMM_GEOS ) == 0 )
+  {
+    rows.emplace_back( nReceivers );
+  }
+
+  // transpose the traces so that the samples of a receiver are contiguous, as in the file
+  hsize_t const numSamples = LvArray::integerConversion< hsize_t >( nsamplesSeismoTrace );
+  std::vector< real32 > traces( rows.size() * numSamples );
+  for( std::size_t i = 0; i < rows.size(); ++i )
+  {
+    for( localIndex iSample = 0; iSample < nsamplesSeismoTrace; ++iSample )
+    {
+      traces[i * numSamples + iSample] = varAtReceivers[iSample][rows[i]];
+    }
+  }
+
+  HDFFile target( fileName, false, true, MPI_COMM_GEOS );
+  GEOS_ERROR_IF( target < 0, GEOS_FMT( "Failed to open the seismo trace file {}.hdf5", fileName ) );
+
+  hsize_t dims[2] = { LvArray::integerConversion< hsize_t >( nReceivers + 1 ), numSamples };
+  hsize_t sampleOffset = 0;
+  hid_t dataset;
+  if( !target.hasDataset( datasetName ) )
+  {
+    // extensible along the samples, so that successive writes are appended
+    hsize_t const maxDims[2] = { dims[0], H5S_UNLIMITED };
+    hsize_t const chunkDims[2] = { 1, LvArray::math::min( numSamples, maxSeismoTraceChunkSize ) };
+    hid_t const dcplId = H5Pcreate( H5P_DATASET_CREATE );
+    H5Pset_chunk( dcplId, 2, chunkDims );
+    hid_t const space = H5Screate_simple( 2, dims, maxDims );
+    dataset = H5Dcreate( target, datasetName.c_str(), H5T_NATIVE_FLOAT, space, H5P_DEFAULT, dcplId, H5P_DEFAULT );
+    H5Sclose( space );
+    H5Pclose( dcplId );
+    GEOS_ERROR_IF( dataset < 0, GEOS_FMT( "Failed to create dataset {} in {}", datasetName, fileName ) );
+  }
+  else
+  {
+    dataset = H5Dopen( target, datasetName.c_str(), H5P_DEFAULT );
+    GEOS_ERROR_IF( dataset < 0, GEOS_FMT( "Failed to open dataset {} in {}", datasetName, fileName ) );
+    hid_t const space = H5Dget_space( dataset );
+    H5Sget_simple_extent_dims( space, dims, nullptr );
+    H5Sclose( space );
+    GEOS_ERROR_IF( dims[0] != LvArray::integerConversion< hsize_t >( nReceivers + 1 ),
+                   GEOS_FMT( "Dataset {} of {} has {} receivers instead of {}", datasetName, fileName, dims[0] - 1, nReceivers ) );
+    sampleOffset = dims[1];
+    dims[1] += numSamples;
+    GEOS_ERROR_IF( H5Dset_extent( dataset, dims ) < 0,
+                   GEOS_FMT( "Failed to extend dataset {} of {}", datasetName, fileName ) );
+  }
+
+  // select the rows owned by this rank, in increasing order to match the packed traces
+  hid_t const fileSpace = H5Dget_space( dataset );
+  H5Sselect_none( fileSpace );
+  for( localIndex const row : rows )
+  {
+    hsize_t const start[2] = { LvArray::integerConversion< hsize_t >( row ), sampleOffset };
+    hsize_t const count[2] = { 1, numSamples };
+    H5Sselect_hyperslab( fileSpace, H5S_SELECT_OR, start, nullptr, count, nullptr );
+  }
+  hsize_t const memDims[1] = { LvArray::math::max( hsize_t( 1 ), LvArray::integerConversion< hsize_t >( traces.size() ) ) };
+  hid_t const memSpace = H5Screate_simple( 1, memDims, nullptr );
+  if( traces.empty() )
+  {
+    H5Sselect_none( memSpace );
+  }
+
+  // every rank takes part in the collective write, even without local receivers
+  hid_t const dxplId = H5Pcreate( H5P_DATASET_XFER );
+  H5Pset_dxpl_mpio( dxplId, H5FD_MPIO_COLLECTIVE );
+  herr_t const status = H5Dwrite( dataset, H5T_NATIVE_FLOAT, memSpace, fileSpace, dxplId, traces.data() );
+  GEOS_ERROR_IF( status < 0, GEOS_FMT( "Failed to write dataset {} of {}", datasetName, fileName ) );
+
+  H5Pclose( dxplId );
+  H5Sclose( memSpace );
+  H5Sclose( fileSpace );
+  H5Dclose( dataset );
+}
+
+} /* namespace geos */
@@ -35,6 +35,9 @@ struct WaveSolverUtils
   using EXEC_POLICY = parallelDevicePolicy< >;
   using wsCoordType = real32;
 
+  /// Maximum number of shots propagated together in batched mode (bounds the per-element stack storage)
+  static constexpr integer maxNumShotsPerBatch = 8;
+
   enum class DASType : integer
   {
     none,               ///< deactivate DAS computation
@@ -48,6 +51,62 @@ struct WaveSolverUtils
     sls,                ///< istandard-linear-solid description [Fichtner 2014]
   };
 
+  enum class SeismoTraceFormat : integer
+  {
+    txt,                ///< one text file per receiver (default)
+    hdf5,               ///< one HDF5 file per solver, written collectively by all the MPI ranks
+  };
+
+
+  /**
+   * @brief Column of the local time stepping work arrays storing a component at a given level
+   * @param[in] level the local time stepping level
+   * @param[in] component the component of the unknown
+   * @param[in] numComponents the number of components of the unknown
+   * @return the column index
+   */
+  GEOS_HOST_DEVICE
+  static constexpr localIndex localTimeSteppingColumn( integer const level, integer const component, integer const numComponents )
+  {
+    return level * numComponents + component;
+  }
+
+  /**
+   * @brief Shift the time levels of an unknown (n-1 <- n, n <- n+1). The levels n-1 and n are swapped instead of
+   *        copied, and the level n+1 is then copied into the level n on the target nodes, so that the level n+1 keeps
+   *        holding the unknown at the new time n, as expected by the consumers reading it after the time step.
+   * @tparam ARRAY the type of the arrays holding the unknown (one or two dimensions, the second one being the shots)
+   * @param[in,out] u_nm1 the unknown at time n-1
+   * @param[in,out] u_n the unknown at time n
+   * @param[in] u_np1 the unknown at time n+1
+   * @param[in] solverTargetNodesSet the nodes updated by the solver
+   */
+  template< typename ARRAY >
+  static void rotateTimeLevels( ARRAY & u_nm1,
+                                ARRAY & u_n,
+                                ARRAY const & u_np1,
+                                SortedArrayView< localIndex const > const solverTargetNodesSet )
+  {
+    std::swap( u_nm1, u_n );
+
+    auto const n = u_n.toView();
+    auto const np1 = u_np1.toViewConst();
+    forAll< EXEC_POLICY >( solverTargetNodesSet.size(), [=] GEOS_HOST_DEVICE ( localIndex const i )
+    {
+      localIndex const a = solverTargetNodesSet[i];
+      if constexpr ( ARRAY::NDIM == 1 )
+      {
+        n[a] = np1[a];
+      }
+      else
+      {
+        for( localIndex s = 0; s < n.size( 1 ); ++s )
+        {
+          n[a][s] = np1[a][s];
+        }
+      }
+    } );
+  }
 
   GEOS_HOST_DEVICE
   static real32 evaluateRicker( real64 const time_n, real32 const f0, real32 const t0, localIndex const order )
@@ -83,23 +142,64 @@ struct WaveSolverUtils
     return pulse;
   }
 
+  /**
+   * @brief Time function of the sources. The Ricker wavelet is evaluated on the fly, unless the values of the sources
+   *        have been precomputed and stored (e.g. to provide a custom wavelet), in which case they are read from the table.
+   */
+  struct SourceTimeFunction
+  {
+    /**
+     * @brief Evaluate the time function of a source at a given cycle
+     * @param[in] cycle the cycle, counted from the minimum time of the simulation
+     * @param[in] isrc the index of the source
+     * @return the value of the source
+     */
+    GEOS_HOST_DEVICE
+    real32 operator()( localIndex const cycle, localIndex const isrc ) const
+    {
+      if( sourceValue.size( 0 ) > 0 )
+      {
+        return sourceValue[cycle][isrc];
+      }
+      return evaluateRicker( cycle * dt, timeSourceFrequency, timeSourceDelay, rickerOrder );
+    }
+
+    /// Precomputed values of the sources, empty if the wavelet is evaluated on the fly
+    arrayView2d< real32 const > sourceValue;
+    /// Time-step between two cycles
+    real64 dt;
+    /// Central frequency of the Ricker wavelet
+    real32 timeSourceFrequency;
+    /// Time delay of the Ricker wavelet
+    real32 timeSourceDelay;
+    /// Order of the Ricker wavelet
+    localIndex rickerOrder;
+  };
+
   /**
    * @brief Initialize (clear) the trace file.
    * @param[in] prefix Prefix of the output file
    * @param[in] name Name of the solver on which you write the seismo trace
    * @param[in] outputSeismoTrace Boolean equals to 1 if you want to output the seismotrace on a txt file 0 either
+   * @param[in] outputFormat Format of the seismo trace files
    * @param[in] nReceivers Number of receivers
    * @param[in] receiverIsLocal Array to check if the receiver is local to the MPI partition
    */
   static void initTrace( char const * prefix,
                          string const & name,
                          bool const outputSeismoTrace,
+                         SeismoTraceFormat const outputFormat,
                          localIndex const nReceivers,
                          arrayView1d< localIndex const > const receiverIsLocal )
   {
     if( !outputSeismoTrace ) return;
 
     string const outputDir = OutputBase::getOutputDirectory();
+    if( outputFormat == SeismoTraceFormat::hdf5 )
+    {
+      initTraceHDF5( joinPath( outputDir, GEOS_FMT( "{}_{}", prefix, name ) ) );
+    }
+
     RAJA::ReduceSum< ReducePolicy< serialPolicy >, localIndex > count( 0 );
 
     forAll< serialPolicy >( nReceivers, [=] ( localIndex const ircv )
@@ -107,8 +207,11 @@ struct WaveSolverUtils
       if( receiverIsLocal[ircv] == 1 )
       {
         count += 1;
-        string const fn = joinPath( outputDir, GEOS_FMT( "{}_{}_{:03}.txt", prefix, name, ircv ) );
-        std::ofstream f( fn, std::ios::out | std::ios::trunc );
+        if( outputFormat == SeismoTraceFormat::txt )
+        {
+          string const fn = joinPath( outputDir, GEOS_FMT( "{}_{}_{:03}.txt", prefix, name, ircv ) );
+          std::ofstream f( fn, std::ios::out | std::ios::trunc );
+        }
       }
     } );
 
@@ -121,6 +224,8 @@ struct WaveSolverUtils
    * @param[in] prefix Prefix of the output file
    * @param[in] name Name of the solver on which you write the seismo trace
    * @param[in] outputSeismoTrace Boolean equals to 1 if you want to output the seismotrace on a txt file 0 either
+   * @param[in] outputFormat Format of the seismo trace files
+   * @param[in] datasetNames Names of the HDF5 datasets of the three components (unused for text output)
    * @param[in] nReceivers Number of receivers
    * @param[in] receiverIsLocal Array to check if the receiver is local to the MPI partition
    * @param[in] nsamplesSeismoTrace Number of samples per seismo trace
@@ -131,6 +236,8 @@ struct WaveSolverUtils
   static void writeSeismoTraceVector( char const * prefix,
                                       string const & name,
                                       bool const outputSeismoTrace,
+                                      SeismoTraceFormat const outputFormat,
+                                      std::array< string, 3 > const & datasetNames,
                                       localIndex const nReceivers,
                                       arrayView1d< localIndex const > const receiverIsLocal,
                                       localIndex const nsamplesSeismoTrace,
@@ -138,9 +245,9 @@ struct WaveSolverUtils
                                       arrayView2d< real32 const > const varAtReceiversy,
                                       arrayView2d< real32 const > const varAtReceiversz )
   {
-    writeSeismoTrace( prefix, name, outputSeismoTrace, nReceivers, receiverIsLocal, nsamplesSeismoTrace, varAtReceiversx );
-    writeSeismoTrace( prefix, name, outputSeismoTrace, nReceivers, receiverIsLocal, nsamplesSeismoTrace, varAtReceiversy );
-    writeSeismoTrace( prefix, name, outputSeismoTrace, nReceivers, receiverIsLocal, nsamplesSeismoTrace, varAtReceiversz );
+    writeSeismoTrace( prefix, name, outputSeismoTrace, outputFormat, datasetNames[0], nReceivers, receiverIsLocal, nsamplesSeismoTrace, varAtReceiversx );
+    writeSeismoTrace( prefix, name, outputSeismoTrace, outputFormat, datasetNames[1], nReceivers, receiverIsLocal, nsamplesSeismoTrace, varAtReceiversy );
+    writeSeismoTrace( prefix, name, outputSeismoTrace, outputFormat, datasetNames[2], nReceivers, receiverIsLocal, nsamplesSeismoTrace, varAtReceiversz );
   }
 
   /**
@@ -148,6 +255,8 @@ struct WaveSolverUtils
    * @param[in] prefix Prefix of the output file
    * @param[in] name Name of the solver on which you write the seismo trace
    * @param[in] outputSeismoTrace Boolean equals to 1 if you want to output the seismotrace on a txt file 0 either
+   * @param[in] outputFormat Format of the seismo trace files
+   * @param[in] datasetName Name of the HDF5 dataset (unused for text output)
    * @param[in] nReceivers Number of receivers
    * @param[in] receiverIsLocal Array to check if the receiver is local to the MPI partition
    * @param[in] nsamplesSeismoTrace Number of samples per seismo trace
@@ -156,6 +265,8 @@ struct WaveSolverUtils
   static void writeSeismoTrace( char const * prefix,
                                 string const & name,
                                 bool const outputSeismoTrace,
+                                SeismoTraceFormat const outputFormat,
+                                string const & datasetName,
                                 localIndex const nReceivers,
                                 arrayView1d< localIndex const > const receiverIsLocal,
                                 localIndex const nsamplesSeismoTrace,
@@ -164,6 +275,13 @@ struct WaveSolverUtils
     if( !outputSeismoTrace ) return;
 
     string const outputDir = OutputBase::getOutputDirectory();
+    if( outputFormat == SeismoTraceFormat::hdf5 )
+    {
+      writeSeismoTraceHDF5( joinPath( outputDir, GEOS_FMT( "{}_{}", prefix, name ) ), datasetName,
+                            nReceivers, receiverIsLocal, nsamplesSeismoTrace, varAtReceivers );
+      return;
+    }
+
     forAll< serialPolicy >( nReceivers, [=] ( localIndex const ircv )
     {
       if( receiverIsLocal[ircv] == 1 )
@@ -188,6 +306,131 @@ struct WaveSolverUtils
     } );
   }
 
+  /**
+   * @brief Initialize (clear) the trace files of each shot of a batch.
+   * @param[in] prefix Prefix of the output file
+   * @param[in] name Name of the solver on which you write the seismo trace
+   * @param[in] outputSeismoTrace Boolean equals to 1 if you want to output the seismotrace on a txt file 0 either
+   * @param[in] outputFormat Format of the seismo trace files
+   * @param[in] nReceivers Number of receivers
+   * @param[in] receiverIsLocal Array to check if the receiver is local to the MPI partition
+   * @param[in] firstShotIndex Index of the first shot of the batch
+   * @param[in] numShots Number of shots in the batch
+   */
+  static void initTraceBatched( char const * prefix,
+                                string const & name,
+                                bool const outputSeismoTrace,
+                                SeismoTraceFormat const outputFormat,
+                                localIndex const nReceivers,
+                                arrayView1d< localIndex const > const receiverIsLocal,
+                                integer const firstShotIndex,
+                                integer const numShots )
+  {
+    for( integer s = 0; s < numShots; ++s )
+    {
+      initTrace( prefix, GEOS_FMT( "{}_shot{:06}", name, firstShotIndex + s ), outputSeismoTrace, outputFormat, nReceivers, receiverIsLocal );
+    }
+  }
+
+  /**
+   * @brief Write the seismo traces of each shot of a batch to a file, one file per shot and per receiver.
+   * @param[in] prefix Prefix of the output file
+   * @param[in] name Name of the solver on which you write the seismo trace
+   * @param[in] outputSeismoTrace Boolean equals to 1 if you want to output the seismotrace on a txt file 0 either
+   * @param[in] outputFormat Format of the seismo trace files
+   * @param[in] datasetName Name of the HDF5 dataset (unused for text output)
+   * @param[in] nReceivers Number of receivers
+   * @param[in] receiverIsLocal Array to check if the receiver is local to the MPI partition
+   * @param[in] nsamplesSeismoTrace Number of samples per seismo trace
+   * @param[in] firstShotIndex Index of the first shot of the batch
+   * @param[in] varAtReceivers Array containing the the variable computed at the receivers, indexed by (sample, receiver, shot)
+   */
+  static void writeSeismoTraceBatched( char const * prefix,
+                                       string const & name,
+                                       bool const outputSeismoTrace,
+                                       SeismoTraceFormat const outputFormat,
+                                       string const & datasetName,
+                                       localIndex const nReceivers,
+                                       arrayView1d< localIndex const > const receiverIsLocal,
+                                       localIndex const nsamplesSeismoTrace,
+                                       integer const firstShotIndex,
+                                       arrayView3d< real32 const > const varAtReceivers )
+  {
+    if( !outputSeismoTrace ) return;
+
+    string const outputDir = OutputBase::getOutputDirectory();
+    localIndex const numShots = varAtReceivers.size( 2 );
+    if( outputFormat == SeismoTraceFormat::hdf5 )
+    {
+      varAtReceivers.move( hostMemorySpace, false );
+      array2d< real32 > varAtReceiversOfShot( varAtReceivers.size( 0 ), varAtReceivers.size( 1 ) );
+      for( localIndex s = 0; s < numShots; ++s )
+      {
+        for( localIndex iSample = 0; iSample < varAtReceivers.size( 0 ); ++iSample )
+        {
+          for( localIndex ircv = 0; ircv < varAtReceivers.size( 1 ); ++ircv )
+          {
+            varAtReceiversOfShot[iSample][ircv] = varAtReceivers[iSample][ircv][s];
+          }
+        }
+        writeSeismoTraceHDF5( joinPath( outputDir, GEOS_FMT( "{}_{}_shot{:06}", prefix, name, firstShotIndex + s ) ), datasetName,
+                              nReceivers, receiverIsLocal, nsamplesSeismoTrace, varAtReceiversOfShot.toViewConst() );
+      }
+      return;
+    }
+
+    forAll< serialPolicy >( nReceivers, [=] ( localIndex const ircv )
+    {
+      if( receiverIsLocal[ircv] == 1 )
+      {
+        for( localIndex s = 0; s < numShots; ++s )
+        {
+          string const fn = joinPath( outputDir, GEOS_FMT( "{}_{}_shot{:06}_{:03}.txt", prefix, name, firstShotIndex + s, ircv ) );
+          std::ofstream f( fn, std::ios::app );
+          if( f )
+          {
+            GEOS_LOG_RANK( GEOS_FMT( "Append to seismo trace file {}", fn ) );
+            for( localIndex iSample = 0; iSample < nsamplesSeismoTrace; ++iSample )
+            {
+              // index - time - value
+              f << iSample << " " << varAtReceivers[iSample][nReceivers][s] << " " << varAtReceivers[iSample][ircv][s] << std::endl;
+            }
+            f.close();
+          }
+          else
+          {
+            GEOS_WARNING( GEOS_FMT( "Failed to open output file {}", fn ) );
+          }
+        }
+      }
+    } );
+  }
+
+  /**
+   * @brief Create (or truncate) the HDF5 seismo trace file. Collective over all the MPI ranks.
+   * @param[in] fileName Name of the file, without the extension
+   */
+  static void initTraceHDF5( string const & fileName );
+
+  /**
+   * @brief Write the seismo traces to a dataset of an HDF5 file, with a collective write over all the MPI ranks.
+   *        The dataset is indexed by (receiver, sample), its last row containing the time of the samples, and
+   *        is chunked along the samples so that each trace is stored contiguously. If the dataset already
+   *        exists, the new samples are appended to it.
+   * @param[in] fileName Name of the file, without the extension
+   * @param[in] datasetName Name of the dataset
+   * @param[in] nReceivers Number of receivers
+   * @param[in] receiverIsLocal Array to check if the receiver is local to the MPI partition
+   * @param[in] nsamplesSeismoTrace Number of samples per seismo trace
+   * @param[in] varAtReceivers Array containing the the variable computed at the receivers
+   */
+  static void writeSeismoTraceHDF5( string const & fileName,
+                                    string const & datasetName,
+                                    localIndex const nReceivers,
+                                    arrayView1d< localIndex const > const receiverIsLocal,
+                                    localIndex const nsamplesSeismoTrace,
+                                    arrayView2d< real32 const > const varAtReceivers );
+
   /**
    * @brief Compute the seismo traces.
    * @param[in] time_n Current time iteration
@@ -245,13 +488,78 @@ struct WaveSolverUtils
         {
           varAtReceivers( iSeismo, ircv ) = receiverCoeff * ( a1 * vtmp_n + a2 * vtmp_np1 );
         }
-        // NOTE: varAtReceivers has size(1) = numReceiversGlobal + 1, this does not OOB
-        // left in the forAll loop for sync issues since the following does not depend on `ircv`
+      }
+      // NOTE: varAtReceivers has size(1) = numReceiversGlobal + 1, this does not OOB
+      // left in the forAll loop for sync issues, and filled on every rank, including the ranks without local receivers
+      if( ircv == 0 )
+      {
         varAtReceivers( iSeismo, nReceivers ) = a1 * time_n + a2 * time_np1;
       }
     } );
   }
 
+  /**
+   * @brief Compute the seismo traces of each shot of a batch.
+   * @param[in] time_n Current time iteration
+   * @param[in] dt time-step
+   * @param[in] timeSeismo time when the seismo is computed
+   * @param[in] iSeismo i-th seismo trace
+   * @param[in] receiverNodeIds indices of the nodes of the element where the receiver is located
+   * @param[in] receiverConstants constant part of the receiver term
+   * @param[in] receiverIsLocal flag indicating whether the receiver is local or not
+   * @param[in] var_np1 Array containing the variable at time n+1, indexed by (node, shot)
+   * @param[in] var_n Array containing the variable at time n, indexed by (node, shot)
+   * @param[out] varAtReceivers Array containing the the variable computed at the receivers, indexed by (sample, receiver, shot)
+   */
+  static void computeSeismoTraceBatched( real64 const time_n,
+                                         real64 const dt,
+                                         real64 const timeSeismo,
+                                         localIndex const iSeismo,
+                                         arrayView2d< localIndex const > const receiverNodeIds,
+                                         arrayView2d< real64 const > const receiverConstants,
+                                         arrayView1d< localIndex const > const receiverIsLocal,
+                                         arrayView2d< real32 const > const var_np1,
+                                         arrayView2d< real32 const > const var_n,
+                                         arrayView3d< real32 > varAtReceivers )
+  {
+    real64 const time_np1 = time_n + dt;
+
+    real32 const a1 = LvArray::math::abs( dt ) < epsilonLoc ? 1.0 : (time_np1 - timeSeismo) / dt;
+    real32 const a2 = 1.0 - a1;
+
+    localIndex const nReceivers = receiverConstants.size( 0 );
+    localIndex const numShots = var_np1.size( 1 );
+    forAll< EXEC_POLICY >( nReceivers, [=] GEOS_HOST_DEVICE ( localIndex const ircv )
+    {
+      if( receiverIsLocal[ircv] > 0 )
+      {
+        for( localIndex s = 0; s < numShots; ++s )
+        {
+          real32 vtmp_np1 = 0.0, vtmp_n = 0.0;
+          for( localIndex inode = 0; inode < receiverConstants.size( 1 ); ++inode )
+          {
+            if( receiverNodeIds( ircv, inode ) >= 0 )
+            {
+              vtmp_np1 += var_np1( receiverNodeIds( ircv, inode ), s ) * receiverConstants( ircv, inode );
+              vtmp_n += var_n( receiverNodeIds( ircv, inode ), s ) * receiverConstants( ircv, inode );
+            }
+          }
+          // linear interpolation between the pressure value at time_n and time_{n+1}
+          varAtReceivers( iSeismo, ircv, s ) = a1 * vtmp_n + a2 * vtmp_np1;
+        }
+      }
+      // NOTE: varAtReceivers has size(1) = numReceiversGlobal + 1, this does not OOB
+      // filled on every rank, including the ranks without local receivers
+      if( ircv == 0 )
+      {
+        for( localIndex s = 0; s < numShots; ++s )
+        {
+          varAtReceivers( iSeismo, nReceivers, s ) = a1 * time_n + a2 * time_np1;
+        }
+      }
+    } );
+  }
+
   /**
    * @brief Compute the seismo traces for 2d arrays
    * @param[in] time_n Current time iteration
@@ -301,11 +609,14 @@ struct WaveSolverUtils
           }
           // linear interpolation between the pressure value at time_n and time_{n+1}
           varAtReceivers( iSeismo, ircv ) = a1 * vtmp_n + a2 * vtmp_np1;
-          // NOTE: varAtReceivers has size(1) = numReceiversGlobal + 1, this does not OOB
-          // left in the forAll loop for sync issues since the following does not depend on `ircv`
-          varAtReceivers( iSeismo, nReceivers ) = a1 * time_n + a2 * time_np1;
         }
       }
+      // NOTE: varAtReceivers has size(1) = numReceiversGlobal + 1, this does not OOB
+      // left in the forAll loop for sync issues, and filled on every rank, including the ranks without local receivers
+      if( ircv == 0 )
+      {
+        varAtReceivers( iSeismo, nReceivers ) = a1 * time_n + a2 * time_np1;
+      }
     } );
   }
 
@@ -396,6 +707,35 @@ struct WaveSolverUtils
     }
   }
 
+  /**
+   * @brief Compute the axis-aligned bounding box of an element of the base mesh
+   * @param[in] elemToNodes element to node map for the base mesh
+   * @param[in] nodeCoords array of base mesh nodes coordinates
+   * @param[out] boxMin the lower corner of the bounding box
+   * @param[out] boxMax the upper corner of the bounding box
+   */
+  GEOS_HOST_DEVICE
+  static void
+  computeElementBoundingBox( arraySlice1d< localIndex const, cells::NODE_MAP_USD - 1 > const elemToNodes,
+                             arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const nodeCoords,
+                             real64 (& boxMin)[3],
+                             real64 (& boxMax)[3] )
+  {
+    for( integer d = 0; d < 3; ++d )
+    {
+      boxMin[d] = nodeCoords( elemToNodes[0], d );
+      boxMax[d] = boxMin[d];
+    }
+    for( localIndex a = 1; a < elemToNodes.size(); ++a )
+    {
+      for( integer d = 0; d < 3; ++d )
+      {
+        boxMin[d] = LvArray::math::min( boxMin[d], nodeCoords( elemToNodes[a], d ) );
+        boxMax[d] = LvArray::math::max( boxMax[d], nodeCoords( elemToNodes[a], d ) );
+      }
+    }
+  }
+
 /**
  * @brief Converts the DAS direction from dip/azimuth to a 3D unit vector
  * @param[in] dip the dip of the linear DAS
@@ -426,6 +766,10 @@ ENUM_STRINGS( WaveSolverUtils::AttenuationType,
               "none",
               "sls" );
 
+ENUM_STRINGS( WaveSolverUtils::SeismoTraceFormat,
+              "txt",
+              "hdf5" );
+
 } /* namespace geos */
 
 #endif /* GEOS_PHYSICSSOLVERS_WAVEPROPAGATION_WAVESOLVERUTILS_HPP_ */
@@ -166,6 +166,8 @@ testNumericalDerivatives( constitutive::MultiFluidBase & fluid,
   integer const NDOF = NC+2;
 
   bool const isThermal = fluid.isThermal();
+  // the enthalpy and internal energy derivatives are only stored for thermal fluids
+  integer const NDOF_THERMAL = isThermal ? NDOF : 0;
 
   // Copy input values into an array with expected layout
   array2d< real64, compflow::LAYOUT_COMP > compositionValues( 1, NC );
@@ -271,8 +273,8 @@ testNumericalDerivatives( constitutive::MultiFluidBase & fluid,
     auto dPhaseFrac     = invertLayout( phaseFrac.derivs.toSliceConst(), NP, NDOF );
     auto dPhaseDens     = invertLayout( phaseDens.derivs.toSliceConst(), NP, NDOF );
     auto dPhaseVisc     = invertLayout( phaseVisc.derivs.toSliceConst(), NP, NDOF );
-    auto dPhaseEnth     = invertLayout( phaseEnthalpy.derivs.toSliceConst(), NP, NDOF );
-    auto dPhaseEnergy   = invertLayout( phaseInternalEnergy.derivs.toSliceConst(), NP, NDOF );
+    auto dPhaseEnth     = invertLayout( phaseEnthalpy.derivs.toSliceConst(), NP, NDOF_THERMAL );
+    auto dPhaseEnergy   = invertLayout( phaseInternalEnergy.derivs.toSliceConst(), NP, NDOF_THERMAL );
     auto dTotalDens     = invertLayout( totalDens.derivs.toSliceConst(), NDOF );
     auto dPhaseCompFrac = invertLayout( phaseCompFrac.derivs.toSliceConst(), NP, NC, NDOF );
 
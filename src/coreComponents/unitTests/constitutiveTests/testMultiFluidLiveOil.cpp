@@ -156,6 +156,78 @@ TEST_F( MultiFluidLiveOilTest, numericalDerivativesMass )
   }
 }
 
+TEST_F( MultiFluidLiveOilTest, singlePrecisionPhaseCompFractionDerivatives )
+{
+  auto & fluid = getFluid();
+  fluid.setMassFlag( false );
+
+  // a copy of the fluid storing the derivatives of the phase component fractions in single precision
+  std::unique_ptr< ConstitutiveBase > fluidFloatPtr = fluid.deliverClone( "fluidFloat", &getParent() );
+  MultiFluidBase & fluidFloat = dynamicCast< MultiFluidBase & >( *fluidFloatPtr );
+  fluidFloat.getReference< integer >( MultiFluidBase::viewKeyStruct::useFloatPhaseCompFractionDerivativesString() ) = 1;
+
+  fluid.allocateConstitutiveData( fluid.getParent(), 1 );
+  fluidFloat.allocateConstitutiveData( fluid.getParent(), 1 );
+
+  integer const NC = fluid.numFluidComponents();
+  integer const NP = fluid.numFluidPhases();
+  integer const NDOF = NC + 2;
+
+  // only one of the two derivative arrays is used
+  EXPECT_FALSE( fluid.useFloatPhaseCompFractionDerivatives() );
+  EXPECT_TRUE( fluidFloat.useFloatPhaseCompFractionDerivatives() );
+  EXPECT_EQ( fluid.getField< fields::multifluid::dPhaseCompFraction >().reference().size( 4 ), NDOF );
+  EXPECT_EQ( fluid.getField< fields::multifluid::dPhaseCompFraction_float >().reference().size( 4 ), 0 );
+  EXPECT_EQ( fluidFloat.getField< fields::multifluid::dPhaseCompFraction >().reference().size( 4 ), 0 );
+  EXPECT_EQ( fluidFloat.getField< fields::multifluid::dPhaseCompFraction_float >().reference().size( 4 ), NDOF );
+
+  array2d< real64 > samples( 2, 3 );
+  fill< 3 >( samples[0], { 0.10000, 0.3, 0.60000 } );
+  fill< 3 >( samples[1], { 0.79999, 0.2, 0.00001 } );
+
+  array2d< real64, compflow::LAYOUT_COMP > compositionValues( 1, NC );
+  arraySlice1d< real64 const, compflow::USD_COMP - 1 > const composition = compositionValues[0];
+
+  for( real64 const pressure : { 1.24e7, 3.21e7, 5.01e7 } )
+  {
+    for( integer sampleIndex = 0; sampleIndex < samples.size( 0 ); sampleIndex++ )
+    {
+      for( integer ic = 0; ic < NC; ++ic )
+      {
+        compositionValues[0][ic] = samples[sampleIndex][ic];
+      }
+
+      for( MultiFluidBase * const updatedFluid : { &fluid, &fluidFloat } )
+      {
+        constitutiveUpdatePassThru( *updatedFluid, [&] ( auto & castedFluid )
+        {
+          typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+          fluidWrapper.update( 0, 0, pressure, 297.15, composition );
+        } );
+      }
+
+      // the values are unchanged, and the derivatives are the double precision ones rounded to single precision
+      auto const phaseCompFrac = fluid.phaseCompFraction();
+      auto const phaseCompFracFloat = fluidFloat.phaseCompFraction();
+      multifluid::PhaseCompDerivsView const dPhaseCompFrac = fluid.dPhaseCompFraction();
+      multifluid::PhaseCompDerivsView const dPhaseCompFracFloat = fluidFloat.dPhaseCompFraction();
+      for( integer ip = 0; ip < NP; ++ip )
+      {
+        for( integer ic = 0; ic < NC; ++ic )
+        {
+          EXPECT_EQ( phaseCompFracFloat( 0, 0, ip, ic ), phaseCompFrac( 0, 0, ip, ic ) );
+          for( integer idof = 0; idof < NDOF; ++idof )
+          {
+            real64 const expected = static_cast< real32 >( dPhaseCompFrac( 0, 0, ip, ic, idof ) );
+            EXPECT_EQ( dPhaseCompFracFloat( 0, 0, ip, ic, idof ), expected );
+            EXPECT_EQ( dPhaseCompFracFloat[0][0][ip][ic][idof], expected );
+          }
+        }
+      }
+    }
+  }
+}
+
 int main( int argc, char * * argv )
 {
   ::testing::InitGoogleTest( &argc, argv );
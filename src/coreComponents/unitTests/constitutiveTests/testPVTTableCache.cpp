@@ -0,0 +1,212 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "common/DataTypes.hpp"
+#include "constitutive/fluid/multifluid/CO2Brine/functions/PVTFunctionHelpers.hpp"
+#include "constitutive/fluid/multifluid/CO2Brine/functions/SpanWagnerCO2Density.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/initialization.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+// System includes
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <unistd.h>
+
+using namespace geos;
+using namespace geos::constitutive::PVTProps;
+
+// This unit test checks that the PVT tables read from the table cache are bitwise identical to the computed ones,
+// and that the cache files that do not match the tables (other format version, other key, truncated file) are
+// ignored and overwritten.
+
+class PVTTableCacheTest : public ::testing::Test
+{
+protected:
+
+  void SetUp() override
+  {
+    m_cacheDirectory = std::filesystem::temp_directory_path() / GEOS_FMT( "geos_pvt_table_cache_{}", ::getpid() );
+    std::filesystem::remove_all( m_cacheDirectory );
+    std::filesystem::create_directories( m_cacheDirectory );
+
+    for( integer i = 0; i < 30; ++i )
+    {
+      m_tableCoords.appendPressure( 1e6 + i * 1e6 );
+    }
+    for( integer j = 0; j < 12; ++j )
+    {
+      m_tableCoords.appendTemperature( 15.0 + j * 7.5 );
+    }
+  }
+
+  void TearDown() override
+  {
+    ::unsetenv( "GEOS_PVT_TABLE_CACHE_DIR" );
+    std::filesystem::remove_all( m_cacheDirectory );
+  }
+
+  void enableCache() const
+  {
+    ::setenv( "GEOS_PVT_TABLE_CACHE_DIR", m_cacheDirectory.c_str(), 1 );
+  }
+
+  // Compute the CO2 density and a second table derived from it, counting the evaluations
+  array1d< array1d< real64 > > computeTables( real64 const tolerance )
+  {
+    array1d< array1d< real64 > > tables( 2 );
+    PVTFunctionHelpers::computePropertyTables( "co2Density",
+                                               GEOS_FMT( "SpanWagnerCO2Density tolerance={}", tolerance ),
+                                               m_tableCoords,
+                                               [&]( PTTableCoordinates const & coords, array1d< array1d< real64 > > & localTables )
+    {
+      ++m_numEvaluations;
+      SpanWagnerCO2Density::calculateCO2Density( "co2Density", tolerance, coords, localTables[0] );
+      for( localIndex i = 0; i < localTables[0].size(); ++i )
+      {
+        localTables[1][i] = 1.0 / localTables[0][i];
+      }
+    },
+                                               tables );
+    return tables;
+  }
+
+  std::vector< std::filesystem::path > getCacheFiles() const
+  {
+    std::vector< std::filesystem::path > files;
+    for( std::filesystem::directory_entry const & entry : std::filesystem::directory_iterator( m_cacheDirectory ) )
+    {
+      files.push_back( entry.path() );
+    }
+    return files;
+  }
+
+  static void expectBitwiseEqual( array1d< array1d< real64 > > const & tables,
+                                  array1d< array1d< real64 > > const & expectedTables )
+  {
+    ASSERT_EQ( tables.size(), expectedTables.size() );
+    for( localIndex k = 0; k < tables.size(); ++k )
+    {
+      ASSERT_EQ( tables[k].size(), expectedTables[k].size() );
+      EXPECT_EQ( std::memcmp( tables[k].data(), expectedTables[k].data(), tables[k].size() * sizeof( real64 ) ), 0 ) << "table " << k;
+    }
+  }
+
+  std::filesystem::path m_cacheDirectory;
+  PTTableCoordinates m_tableCoords;
+  integer m_numEvaluations = 0;
+};
+
+TEST_F( PVTTableCacheTest, cachedTablesMatchComputedTables )
+{
+  array1d< array1d< real64 > > const expectedTables = computeTables( 1e-10 );
+  EXPECT_EQ( m_numEvaluations, 1 );
+  EXPECT_TRUE( getCacheFiles().empty() );
+
+  // the first run writes the cache file, the second one reads it
+  enableCache();
+  expectBitwiseEqual( computeTables( 1e-10 ), expectedTables );
+  EXPECT_EQ( m_numEvaluations, 2 );
+  ASSERT_EQ( getCacheFiles().size(), 1u );
+
+  expectBitwiseEqual( computeTables( 1e-10 ), expectedTables );
+  EXPECT_EQ( m_numEvaluations, 2 );
+
+  // other model parameters give another file
+  computeTables( 1e-9 );
+  EXPECT_EQ( m_numEvaluations, 3 );
+  EXPECT_EQ( getCacheFiles().size(), 2u );
+}
+
+TEST_F( PVTTableCacheTest, mismatchedCacheFilesAreRecomputed )
+{
+  array1d< array1d< real64 > > const expectedTables = computeTables( 1e-10 );
+  enableCache();
+  computeTables( 1e-10 );
+  ASSERT_EQ( getCacheFiles().size(), 1u );
+  std::filesystem::path const cacheFile = getCacheFiles()[0];
+  std::uintmax_t const cacheFileSize = std::filesystem::file_size( cacheFile );
+
+  // the file starts with the format version, the size of the key, the number of tables and the key
+  auto const overwrite = [&]( std::streamoff const offset, std::uint64_t const value )
+  {
+    std::fstream file( cacheFile, std::ios::binary | std::ios::in | std::ios::out );
+    file.seekp( offset );
+    file.write( reinterpret_cast< char const * >( &value ), sizeof( value ) );
+  };
+  std::vector< std::pair< string, std::function< void() > > > const corruptions = {
+    { "stale format version", [&]() { overwrite( 0, 0 ); } },
+    { "other key size", [&]() { overwrite( 8, 3 ); } },
+    { "other number of tables", [&]() { overwrite( 16, 1 ); } },
+    { "other key", [&]()
+      {
+        std::fstream file( cacheFile, std::ios::binary | std::ios::in | std::ios::out );
+        file.seekp( 3 * sizeof( std::uint64_t ) );
+        file.put( '#' );
+      } },
+    { "truncated file", [&]() { std::filesystem::resize_file( cacheFile, cacheFileSize - sizeof( real64 ) ); } } };
+
+  for( auto const & [description, corrupt] : corruptions )
+  {
+    corrupt();
+
+    // the file is ignored, the tables are recomputed and the file is written again
+    integer const numEvaluations = m_numEvaluations;
+    expectBitwiseEqual( computeTables( 1e-10 ), expectedTables );
+    EXPECT_EQ( m_numEvaluations, numEvaluations + 1 ) << description;
+    EXPECT_EQ( std::filesystem::file_size( cacheFile ), cacheFileSize ) << description;
+
+    expectBitwiseEqual( computeTables( 1e-10 ), expectedTables );
+    EXPECT_EQ( m_numEvaluations, numEvaluations + 1 ) << description;
+  }
+  EXPECT_EQ( getCacheFiles().size(), 1u );
+}
+
+TEST_F( PVTTableCacheTest, computationErrorIsThrown )
+{
+  enableCache();
+  array1d< array1d< real64 > > tables( 1 );
+  EXPECT_THROW( PVTFunctionHelpers::computePropertyTables( "failingFunction",
+                                                           "FailingModel",
+                                                           m_tableCoords,
+                                                           []( PTTableCoordinates const &, array1d< array1d< real64 > > & )
+  {
+    GEOS_THROW( "failingFunction: the computation failed", InputError );
+  },
+                                                           tables ),
+                InputError );
+
+  // nothing is written in the cache
+  EXPECT_TRUE( getCacheFiles().empty() );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+
+  geos::GeosxState state( geos::basicSetup( argc, argv ) );
+
+  int const result = RUN_ALL_TESTS();
+
+  geos::basicCleanup();
+
+  return result;
+}
@@ -0,0 +1,207 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "mainInterface/ProblemManager.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/initialization.hpp"
+#include "fieldSpecification/FieldSpecificationManager.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mesh/MeshBody.hpp"
+#include "common/DataTypes.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+using namespace geos;
+using namespace geos::dataRepository;
+
+// This unit test checks that the field specifications selected through the application plans of the
+// FieldSpecificationManager are the ones selected by a loop over all the field specifications.
+
+class FieldSpecificationApplicationPlansTest : public ::testing::Test
+{
+protected:
+
+  void SetUp() override
+  {
+    DomainPartition & domain = getGlobalState().getProblemManager().getDomainPartition();
+    MeshBody & meshBody = domain.getMeshBodies().registerGroup< MeshBody >( "body" );
+    for( string const & levelName : { "level0", "level1" } )
+    {
+      MeshLevel & meshLevel = meshBody.createMeshLevel( levelName );
+      ElementRegionManager & elemManager = meshLevel.getElemManager();
+      elemManager.createChild( "CellElementRegion", "region" );
+      elemManager.getRegion< CellElementRegion >( "region" ).createElementSubRegion< CellElementSubRegion >( "subRegion" );
+    }
+  }
+
+  void TearDown() override
+  {
+    FieldSpecificationManager & fieldSpecificationManager = FieldSpecificationManager::getInstance();
+    for( string const & name : m_specNames )
+    {
+      fieldSpecificationManager.deregisterFieldSpecification( name );
+    }
+    getGlobalState().getProblemManager().getDomainPartition().getMeshBodies().deregisterGroup( "body" );
+  }
+
+  FieldSpecificationBase const & registerSpecification( string const & name,
+                                                        string const & fieldName,
+                                                        string const & objectPath,
+                                                        real64 const startTime,
+                                                        real64 const endTime,
+                                                        bool const isInitialCondition = false )
+  {
+    FieldSpecificationManager & fieldSpecificationManager = FieldSpecificationManager::getInstance();
+    FieldSpecificationBase & fieldSpec = fieldSpecificationManager.registerGroup< FieldSpecificationBase >( name );
+    fieldSpec.setFieldName( fieldName );
+    fieldSpec.setObjectPath( objectPath );
+    fieldSpec.setMeshObjectPath( getGlobalState().getProblemManager().getDomainPartition().getMeshBodies() );
+    fieldSpec.setStartTime( startTime );
+    fieldSpec.setEndTime( endTime );
+    fieldSpec.initialCondition( isInitialCondition );
+    m_specNames.emplace_back( name );
+    return fieldSpec;
+  }
+
+  MeshLevel const & getMeshLevel( string const & levelName ) const
+  {
+    return getGlobalState().getProblemManager().getDomainPartition().getMeshBody( "body" ).getMeshLevel( levelName );
+  }
+
+  std::vector< string > m_specNames;
+};
+
+/// Select the active field specifications with a loop over all of them, as FieldSpecificationManager::apply used to do
+std::vector< FieldSpecificationBase const * > selectWithFullScan( real64 const time,
+                                                                  MeshLevel const & mesh,
+                                                                  string const & fieldName )
+{
+  std::vector< FieldSpecificationBase const * > activeSpecs;
+  FieldSpecificationManager::getInstance().forSubGroups< FieldSpecificationBase >( [&] ( FieldSpecificationBase const & fs )
+  {
+    if( !fs.initialCondition() && time >= fs.getStartTime() && time < fs.getEndTime() && fieldName == fs.getFieldName() &&
+        fs.getMeshObjectPaths().containsMeshLevel( mesh ) )
+    {
+      activeSpecs.emplace_back( &fs );
+    }
+  } );
+  return activeSpecs;
+}
+
+TEST_F( FieldSpecificationApplicationPlansTest, ActiveWindows )
+{
+  FieldSpecificationManager & fieldSpecificationManager = FieldSpecificationManager::getInstance();
+  MeshLevel const & level0 = getMeshLevel( "level0" );
+
+  FieldSpecificationBase const & first = registerSpecification( "first", "pressure", "ElementRegions/region", 1.0, 3.0 );
+  FieldSpecificationBase const & second = registerSpecification( "second", "pressure", "ElementRegions/region", 2.0, 4.0 );
+  registerSpecification( "initial", "pressure", "ElementRegions/region", 0.0, 10.0, true );
+  FieldSpecificationBase const & other = registerSpecification( "other", "temperature", "ElementRegions/region", 0.0, 10.0 );
+
+  using SpecList = std::vector< FieldSpecificationBase const * >;
+
+  // before, at and after the start and end times (the end time is excluded), with overlapping windows
+  std::vector< std::pair< real64, SpecList > > const expected =
+  {
+    { 0.5, {} },
+    { 1.0, { &first } },
+    { 1.5, { &first } },
+    { 2.0, { &first, &second } },
+    { 2.5, { &first, &second } },
+    { 3.0, { &second } },
+    { 3.5, { &second } },
+    { 4.0, {} },
+    { 5.0, {} }
+  };
+
+  // forward, then backward in time, so that the active specifications are selected again in each interval
+  for( integer pass = 0; pass < 2; ++pass )
+  {
+    for( size_t i = 0; i < expected.size(); ++i )
+    {
+      auto const & [time, expectedSpecs] = expected[ pass == 0 ? i : expected.size() - 1 - i ];
+      SpecList const & activeSpecs = fieldSpecificationManager.getActiveSpecifications( time, level0, "pressure" );
+      EXPECT_EQ( activeSpecs, expectedSpecs ) << "time " << time;
+      EXPECT_EQ( activeSpecs, selectWithFullScan( time, level0, "pressure" ) ) << "time " << time;
+    }
+  }
+
+  EXPECT_TRUE( fieldSpecificationManager.getActiveSpecifications( 2.5, level0, "displacement" ).empty() );
+  EXPECT_EQ( fieldSpecificationManager.getActiveSpecifications( 2.5, level0, "temperature" ), SpecList( { &other } ) );
+}
+
+TEST_F( FieldSpecificationApplicationPlansTest, MeshLevelFiltering )
+{
+  FieldSpecificationManager & fieldSpecificationManager = FieldSpecificationManager::getInstance();
+  MeshLevel const & level0 = getMeshLevel( "level0" );
+  MeshLevel const & level1 = getMeshLevel( "level1" );
+
+  FieldSpecificationBase const & allLevels = registerSpecification( "allLevels", "pressure", "ElementRegions/region", 0.0, 10.0 );
+  FieldSpecificationBase const & onLevel1 = registerSpecification( "onLevel1", "pressure", "level1/ElementRegions/region", 0.0, 10.0 );
+
+  using SpecList = std::vector< FieldSpecificationBase const * >;
+  EXPECT_EQ( fieldSpecificationManager.getActiveSpecifications( 1.0, level0, "pressure" ), SpecList( { &allLevels } ) );
+  EXPECT_EQ( fieldSpecificationManager.getActiveSpecifications( 1.0, level1, "pressure" ), SpecList( { &allLevels, &onLevel1 } ) );
+  EXPECT_EQ( fieldSpecificationManager.getActiveSpecifications( 1.0, level0, "pressure" ), selectWithFullScan( 1.0, level0, "pressure" ) );
+  EXPECT_EQ( fieldSpecificationManager.getActiveSpecifications( 1.0, level1, "pressure" ), selectWithFullScan( 1.0, level1, "pressure" ) );
+}
+
+TEST_F( FieldSpecificationApplicationPlansTest, PlansRebuiltAfterChanges )
+{
+  FieldSpecificationManager & fieldSpecificationManager = FieldSpecificationManager::getInstance();
+  MeshLevel const & level0 = getMeshLevel( "level0" );
+
+  FieldSpecificationBase const & first = registerSpecification( "first", "pressure", "ElementRegions/region", 0.0, 10.0 );
+
+  using SpecList = std::vector< FieldSpecificationBase const * >;
+  EXPECT_EQ( fieldSpecificationManager.getActiveSpecifications( 1.0, level0, "pressure" ), SpecList( { &first } ) );
+
+  // a specification added after the plan was built
+  FieldSpecificationBase const & second = registerSpecification( "second", "pressure", "ElementRegions/region", 0.0, 10.0 );
+  EXPECT_EQ( fieldSpecificationManager.getActiveSpecifications( 1.0, level0, "pressure" ), SpecList( { &first, &second } ) );
+
+  // a specification whose window is changed after the plan was built
+  FieldSpecificationBase & modified = fieldSpecificationManager.getGroup< FieldSpecificationBase >( "first" );
+  modified.setStartTime( 2.0 );
+  EXPECT_EQ( fieldSpecificationManager.getActiveSpecifications( 1.0, level0, "pressure" ), SpecList( { &second } ) );
+  EXPECT_EQ( fieldSpecificationManager.getActiveSpecifications( 2.0, level0, "pressure" ), SpecList( { &first, &second } ) );
+
+  // a specification applied to another field after the plan was built
+  modified.setFieldName( "temperature" );
+  EXPECT_EQ( fieldSpecificationManager.getActiveSpecifications( 2.0, level0, "pressure" ), SpecList( { &second } ) );
+  EXPECT_EQ( fieldSpecificationManager.getActiveSpecifications( 2.0, level0, "temperature" ), SpecList( { &first } ) );
+
+  // a specification removed after the plan was built
+  fieldSpecificationManager.deregisterFieldSpecification( "second" );
+  m_specNames.erase( std::find( m_specNames.begin(), m_specNames.end(), "second" ) );
+  EXPECT_TRUE( fieldSpecificationManager.getActiveSpecifications( 2.0, level0, "pressure" ).empty() );
+  EXPECT_EQ( fieldSpecificationManager.getActiveSpecifications( 2.0, level0, "pressure" ), selectWithFullScan( 2.0, level0, "pressure" ) );
+}
+
+int main( int argc, char * * argv )
+{
+  GeosxState state( basicSetup( argc, argv ) );
+
+  ::testing::InitGoogleTest( &argc, argv );
+  int const result = RUN_ALL_TESTS();
+
+  basicCleanup();
+
+  return result;
+}
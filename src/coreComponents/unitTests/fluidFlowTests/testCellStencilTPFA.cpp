@@ -0,0 +1,290 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "common/DataTypes.hpp"
+#include "finiteVolume/CellElementStencilTPFA.hpp"
+#include "finiteVolume/FiniteVolumeManager.hpp"
+#include "finiteVolume/FluxApproximationBase.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mesh/CellElementRegion.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mesh/utilities/ComputationalGeometry.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBaseFields.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geos;
+using namespace geos::dataRepository;
+
+CommandLineOptions g_commandLineOptions;
+
+// This unit test checks that the cell stencil built in parallel by the TPFA is identical to the one built by adding
+// the connections one face at a time with add() and addVectors(), as done before the parallel build.
+// The mesh is biased so that the faces have different areas, only one of its two regions is targeted by the solver,
+// and the transmissibility multiplier is zero on a plane of faces.
+char const * xmlInput =
+  R"xml(
+  <Problem>
+    <Solvers gravityVector="{ 0.0, 0.0, -9.81 }">
+      <SinglePhaseFVM
+        name="singlePhaseFlow"
+        discretization="singlePhaseTPFA"
+        targetRegions="{ Region1 }"/>
+    </Solvers>
+    <Mesh>
+      <InternalMesh
+        name="mesh"
+        elementTypes="{ C3D8 }"
+        xCoords="{ 0, 3, 5 }"
+        yCoords="{ 0, 2 }"
+        zCoords="{ 0, 2 }"
+        nx="{ 6, 2 }"
+        ny="{ 5 }"
+        nz="{ 4 }"
+        xBias="{ 0.4, 0 }"
+        yBias="{ -0.3 }"
+        cellBlockNames="{ cb1, cb2 }"/>
+    </Mesh>
+    <Geometry>
+      <Box
+        name="zPlane"
+        xMin="{ -1e3, -1e3, 0.9 }"
+        xMax="{ 1e3, 1e3, 1.1 }"/>
+    </Geometry>
+    <NumericalMethods>
+      <FiniteVolume>
+        <TwoPointFluxApproximation name="singlePhaseTPFA"/>
+      </FiniteVolume>
+    </NumericalMethods>
+    <ElementRegions>
+      <CellElementRegion
+        name="Region1"
+        cellBlocks="{ cb1 }"
+        materialList="{ water, rock }"/>
+      <CellElementRegion
+        name="Region2"
+        cellBlocks="{ cb2 }"
+        materialList="{ water, rock }"/>
+    </ElementRegions>
+    <Constitutive>
+      <CompressibleSinglePhaseFluid
+        name="water"
+        defaultDensity="1000"
+        defaultViscosity="0.001"
+        compressibility="5e-10"/>
+      <CompressibleSolidConstantPermeability
+        name="rock"
+        solidModelName="nullSolid"
+        porosityModelName="rockPorosity"
+        permeabilityModelName="rockPerm"/>
+      <NullModel
+        name="nullSolid"/>
+      <PressurePorosity
+        name="rockPorosity"
+        defaultReferencePorosity="0.05"
+        referencePressure="0.0"
+        compressibility="1.0e-9"/>
+      <ConstantPermeability
+        name="rockPerm"
+        permeabilityComponents="{ 2.0e-16, 2.0e-16, 2.0e-16 }"/>
+    </Constitutive>
+    <FieldSpecifications>
+      <FieldSpecification
+        name="zPlaneTransMultiplier"
+        initialCondition="1"
+        setNames="{ zPlane }"
+        objectPath="faceManager"
+        fieldName="permeabilityTransMultiplier"
+        scale="0.0"/>
+    </FieldSpecifications>
+  </Problem>
+  )xml";
+
+// The serial build of the cell stencil, as done by TwoPointFluxApproximation::computeCellStencil before the parallel build
+void buildSerialCellStencil( MeshLevel const & mesh,
+                             arrayView1d< string const > const & targetRegions,
+                             real64 const areaTolerance,
+                             CellElementStencilTPFA & stencil )
+{
+  NodeManager const & nodeManager = mesh.getNodeManager();
+  FaceManager const & faceManager = mesh.getFaceManager();
+  ElementRegionManager const & elemManager = mesh.getElemManager();
+
+  arrayView2d< localIndex const > const & elemRegionList = faceManager.elementRegionList();
+  arrayView2d< localIndex const > const & elemSubRegionList = faceManager.elementSubRegionList();
+  arrayView2d< localIndex const > const & elemList = faceManager.elementList();
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & X = nodeManager.referencePosition();
+  arrayView1d< real64 const > const & transMultiplier = faceManager.getField< fields::flow::transMultiplier >();
+
+  ElementRegionManager::ElementViewAccessor< arrayView2d< real64 const > > const elemCenter =
+    elemManager.constructArrayViewAccessor< real64, 2 >( CellElementSubRegion::viewKeyStruct::elementCenterString() );
+  ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > > const elemGlobalIndex =
+    elemManager.constructArrayViewAccessor< globalIndex, 1 >( ObjectManagerBase::viewKeyStruct::localToGlobalMapString() );
+  ElementRegionManager::ElementViewAccessor< arrayView1d< integer const > > const elemGhostRank =
+    elemManager.constructArrayViewAccessor< integer, 1 >( ObjectManagerBase::viewKeyStruct::ghostRankString() );
+
+  ArrayOfArraysView< localIndex const > const faceToNodes = faceManager.nodeList().toViewConst();
+
+  SortedArray< localIndex > regionFilter;
+  elemManager.forElementRegionsComplete< CellElementRegion >( targetRegions,
+                                                              [&]( localIndex,
+                                                                   localIndex const ei,
+                                                                   CellElementRegion const & )
+  {
+    regionFilter.insert( ei );
+  } );
+
+  for( localIndex kf = 0; kf < faceManager.size(); ++kf )
+  {
+    if( elemList[kf][0] < 0 || elemList[kf][1] < 0 || isZero( transMultiplier[kf] ) )
+    {
+      continue;
+    }
+    if( elemGhostRank[elemRegionList[kf][0]][elemSubRegionList[kf][0]][elemList[kf][0]] >= 0 &&
+        elemGhostRank[elemRegionList[kf][1]][elemSubRegionList[kf][1]][elemList[kf][1]] >= 0 )
+    {
+      continue;
+    }
+    if( !( regionFilter.contains( elemRegionList[kf][0] ) && regionFilter.contains( elemRegionList[kf][1] ) ) )
+    {
+      continue;
+    }
+
+    real64 faceCenter[ 3 ], faceNormal[ 3 ], cellToFaceVec[2][ 3 ];
+    real64 const faceArea = computationalGeometry::centroid_3DPolygon( faceToNodes[kf], X, faceCenter, faceNormal, areaTolerance );
+    if( faceArea < areaTolerance )
+    {
+      continue;
+    }
+
+    localIndex regionIndex[2];
+    localIndex subRegionIndex[2];
+    localIndex elementIndex[2];
+    real64 stencilWeights[2];
+    real64 stencilStabilizationWeights[2];
+    globalIndex stencilCellsGlobalIndex[2];
+    for( localIndex ke = 0; ke < 2; ++ke )
+    {
+      localIndex const er  = elemRegionList[kf][ke];
+      localIndex const esr = elemSubRegionList[kf][ke];
+      localIndex const ei  = elemList[kf][ke];
+
+      regionIndex[ke] = er;
+      subRegionIndex[ke] = esr;
+      elementIndex[ke] = ei;
+      stencilCellsGlobalIndex[ke] = elemGlobalIndex[er][esr][ei];
+
+      LvArray::tensorOps::copy< 3 >( cellToFaceVec[ke], faceCenter );
+      LvArray::tensorOps::subtract< 3 >( cellToFaceVec[ke], elemCenter[er][esr][ei] );
+
+      real64 const c2fDistance = LvArray::tensorOps::normalize< 3 >( cellToFaceVec[ke] );
+
+      stencilWeights[ke] = faceArea / c2fDistance;
+      stencilStabilizationWeights[ke] = faceArea * c2fDistance;
+    }
+
+    real64 const sumStabilizationWeight = stencilStabilizationWeights[0] + stencilStabilizationWeights[1];
+
+    if( stencilCellsGlobalIndex[0] >= stencilCellsGlobalIndex[1] )
+    {
+      std::swap( regionIndex[0], regionIndex[1] );
+      std::swap( subRegionIndex[0], subRegionIndex[1] );
+      std::swap( elementIndex[0], elementIndex[1] );
+      std::swap( stencilWeights[0], stencilWeights[1] );
+      for( integer i = 0; i < 3; ++i )
+      {
+        std::swap( cellToFaceVec[0][i], cellToFaceVec[1][i] );
+      }
+    }
+
+    stencil.add( 2, regionIndex, subRegionIndex, elementIndex, stencilWeights, kf );
+    stencil.addVectors( transMultiplier[kf], sumStabilizationWeight, faceNormal, cellToFaceVec );
+  }
+}
+
+TEST( CellStencilTPFATest, parallelBuildMatchesSerialBuild )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  ProblemManager & problemManager = state.getProblemManager();
+  problemManager.parseInputString( xmlInput );
+  problemManager.problemSetup();
+  problemManager.applyInitialConditions();
+
+  DomainPartition & domain = problemManager.getDomainPartition();
+  MeshBody const & meshBody = domain.getMeshBody( 0 );
+  MeshLevel & mesh = domain.getMeshBody( 0 ).getBaseDiscretization();
+  FluxApproximationBase const & fluxApprox =
+    domain.getNumericalMethodManager().getFiniteVolumeManager().getFluxApproximation( "singlePhaseTPFA" );
+  CellElementStencilTPFA & stencil =
+    fluxApprox.getStencil< CellElementStencilTPFA >( mesh, FluxApproximationBase::viewKeyStruct::cellStencilString() );
+
+  real64 const lengthTolerance = meshBody.getGlobalLengthScale() *
+                                 fluxApprox.getReference< real64 >( FluxApproximationBase::viewKeyStruct::areaRelativeToleranceString() );
+  array1d< string > targetRegions;
+  targetRegions.emplace_back( "Region1" );
+  CellElementStencilTPFA serialStencil;
+  buildSerialCellStencil( mesh, targetRegions.toViewConst(), lengthTolerance * lengthTolerance, serialStencil );
+
+  // Region1 has 6x5x4 cells, minus the 6x5 connections through the zero-multiplier plane
+  localIndex const numConnections = 5 * 5 * 4 + 6 * 4 * 4 + 6 * 5 * 3 - 6 * 5;
+  EXPECT_EQ( serialStencil.size(), numConnections );
+  ASSERT_EQ( stencil.size(), serialStencil.size() );
+
+  // the two builds do the same floating-point operations, so the stencils are bitwise identical
+  for( localIndex iconn = 0; iconn < stencil.size(); ++iconn )
+  {
+    for( localIndex a = 0; a < 2; ++a )
+    {
+      EXPECT_EQ( stencil.getElementRegionIndices()[iconn][a], serialStencil.getElementRegionIndices()[iconn][a] ) << iconn;
+      EXPECT_EQ( stencil.getElementSubRegionIndices()[iconn][a], serialStencil.getElementSubRegionIndices()[iconn][a] ) << iconn;
+      EXPECT_EQ( stencil.getElementIndices()[iconn][a], serialStencil.getElementIndices()[iconn][a] ) << iconn;
+      EXPECT_EQ( stencil.getWeights()[iconn][a], serialStencil.getWeights()[iconn][a] ) << iconn;
+      for( integer i = 0; i < 3; ++i )
+      {
+        EXPECT_EQ( stencil.getCellToFaceVec()[iconn][a][i], serialStencil.getCellToFaceVec()[iconn][a][i] ) << iconn;
+      }
+    }
+    for( integer i = 0; i < 3; ++i )
+    {
+      EXPECT_EQ( stencil.getFaceNormal()[iconn][i], serialStencil.getFaceNormal()[iconn][i] ) << iconn;
+    }
+    EXPECT_EQ( stencil.getTransMultiplier()[iconn], serialStencil.getTransMultiplier()[iconn] ) << iconn;
+    EXPECT_EQ( stencil.getGeometricStabilizationCoef()[iconn], serialStencil.getGeometricStabilizationCoef()[iconn] ) << iconn;
+  }
+
+  // the faces are mapped to the same connections: zeroing the connection of a face zeroes the same weights
+  for( localIndex kf = 0; kf < mesh.getFaceManager().size(); kf += 7 )
+  {
+    EXPECT_EQ( stencil.zero( kf ), serialStencil.zero( kf ) ) << kf;
+  }
+  for( localIndex iconn = 0; iconn < stencil.size(); ++iconn )
+  {
+    for( localIndex a = 0; a < 2; ++a )
+    {
+      EXPECT_EQ( stencil.getWeights()[iconn][a], serialStencil.getWeights()[iconn][a] ) << iconn;
+    }
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
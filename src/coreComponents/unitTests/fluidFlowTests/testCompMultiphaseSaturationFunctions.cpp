@@ -0,0 +1,302 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "common/DataTypes.hpp"
+#include "constitutive/capillaryPressure/CapillaryPressureFields.hpp"
+#include "constitutive/relativePermeability/RelativePermeabilityFields.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mesh/CellElementSubRegion.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "physicsSolvers/fluidFlow/CompositionalMultiphaseBaseFields.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBaseFields.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+
+using namespace geos;
+using namespace geos::dataRepository;
+
+CommandLineOptions g_commandLineOptions;
+
+// This unit test checks that updating the table relperm, the phase mobility, and the table capillary pressure in a single
+// kernel sharing the search of the phase volume fractions (fuseSaturationFunctions="1") gives results bitwise identical
+// to the separate updates (fuseSaturationFunctions="0"), with the constitutive updates done in all the cells or only in
+// the cells whose primary variables changed. The water relperm and capillary pressure tables share the same axis.
+
+char const * pvtLiquid = "DensityFun PhillipsBrineDensity 1e6 7.5e7 5e5 295.15 370.15 25 0\n"
+                         "ViscosityFun PhillipsBrineViscosity 0\n";
+
+char const * pvtGas = "DensityFun SpanWagnerCO2Density 1e6 7.5e7 5e5 295.15 370.15 25\n"
+                      "ViscosityFun FenghourCO2Viscosity 1e6 7.5e7 5e5 295.15 370.15 25\n";
+
+char const * co2flash = "FlashModel CO2Solubility 1e6 7.5e7 5e5 295.15 370.15 25 0";
+
+string const xmlInputBegin =
+  R"xml(
+  <Problem>
+    <Solvers>
+      <CompositionalMultiphaseFVM name="compflow"
+                                  discretization="fluidTPFA"
+                                  temperature="368.15"
+                                  useMass="1"
+                                  initialDt="1e3"
+                                  maxCompFractionChange="0.5"
+                                  targetRegions="{ region }"
+  )xml";
+
+string const xmlInputEnd =
+  R"xml(
+                                  >
+        <NonlinearSolverParameters newtonTol="1.0e-8"
+                                   newtonMaxIter="20"
+                                   lineSearchAction="None"
+                                   maxTimeStepCuts="5" />
+        <LinearSolverParameters directParallel="0" />
+      </CompositionalMultiphaseFVM>
+    </Solvers>
+    <Mesh>
+      <InternalMesh name="mesh"
+                    elementTypes="{ C3D8 }"
+                    xCoords="{ 0, 100 }"
+                    yCoords="{ 0, 1 }"
+                    zCoords="{ 0, 1 }"
+                    nx="{ 20 }"
+                    ny="{ 1 }"
+                    nz="{ 1 }"
+                    cellBlockNames="{ cb }" />
+    </Mesh>
+    <Geometry>
+      <Box name="source"
+           xMin="{ -0.01, -0.01, -0.01 }"
+           xMax="{ 5.01, 1.01, 1.01 }" />
+    </Geometry>
+    <Events maxTime="5e3">
+      <PeriodicEvent name="solverApplications"
+                     forceDt="1e3"
+                     target="/Solvers/compflow" />
+    </Events>
+    <NumericalMethods>
+      <FiniteVolume>
+        <TwoPointFluxApproximation name="fluidTPFA" />
+      </FiniteVolume>
+    </NumericalMethods>
+    <ElementRegions>
+      <CellElementRegion name="region"
+                         cellBlocks="{ cb }"
+                         materialList="{ fluid, rock, relperm, cappres }" />
+    </ElementRegions>
+    <Constitutive>
+      <CompressibleSolidConstantPermeability name="rock"
+                                             solidModelName="nullSolid"
+                                             porosityModelName="rockPorosity"
+                                             permeabilityModelName="rockPerm" />
+      <NullModel name="nullSolid" />
+      <PressurePorosity name="rockPorosity"
+                        defaultReferencePorosity="0.2"
+                        referencePressure="0.0"
+                        compressibility="1.0e-9" />
+      <ConstantPermeability name="rockPerm"
+                            permeabilityComponents="{ 1.0e-13, 1.0e-13, 1.0e-13 }" />
+      <CO2BrinePhillipsFluid name="fluid"
+                             phaseNames="{ gas, water }"
+                             componentNames="{ co2, water }"
+                             componentMolarWeight="{ 44e-3, 18e-3 }"
+                             phasePVTParaFiles="{ pvtgas.txt, pvtliquid.txt }"
+                             flashModelParaFile="co2flash.txt" />
+      <TableRelativePermeability name="relperm"
+                                 phaseNames="{ gas, water }"
+                                 wettingNonWettingRelPermTableNames="{ waterRelPermTable, gasRelPermTable }" />
+      <TableCapillaryPressure name="cappres"
+                              phaseNames="{ gas, water }"
+                              wettingNonWettingCapPressureTableName="waterCapPressureTable" />
+    </Constitutive>
+    <Functions>
+      <TableFunction name="waterRelPermTable"
+                     coordinates="{ 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0 }"
+                     values="{ 0.0, 0.005, 0.02, 0.045, 0.08, 0.125, 0.18, 0.245, 0.32, 0.405, 0.5 }" />
+      <TableFunction name="gasRelPermTable"
+                     coordinates="{ 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0 }"
+                     values="{ 0.0, 0.009, 0.036, 0.081, 0.144, 0.225, 0.324, 0.441, 0.576, 0.729, 0.9 }" />
+      <TableFunction name="waterCapPressureTable"
+                     coordinates="{ 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0 }"
+                     values="{ 4e4, 2e4, 1e4, 8e3, 6e3, 5e3, 4e3, 3e3, 2e3, 1e3, 0.0 }" />
+    </Functions>
+    <FieldSpecifications>
+      <FieldSpecification name="initialPressure"
+                          initialCondition="1"
+                          setNames="{ all }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="pressure"
+                          scale="9e6" />
+      <FieldSpecification name="initialTemperature"
+                          initialCondition="1"
+                          setNames="{ all }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="temperature"
+                          scale="368.15" />
+      <FieldSpecification name="initialComposition_co2"
+                          initialCondition="1"
+                          setNames="{ all }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="globalCompFraction"
+                          component="0"
+                          scale="0.01" />
+      <FieldSpecification name="initialComposition_water"
+                          initialCondition="1"
+                          setNames="{ all }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="globalCompFraction"
+                          component="1"
+                          scale="0.99" />
+      <FieldSpecification name="sourcePressure"
+                          setNames="{ source }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="pressure"
+                          scale="1.2e7" />
+      <FieldSpecification name="sourceTemperature"
+                          setNames="{ source }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="temperature"
+                          scale="368.15" />
+      <FieldSpecification name="sourceTermComposition_co2"
+                          setNames="{ source }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="globalCompFraction"
+                          component="0"
+                          scale="0.9" />
+      <FieldSpecification name="sourceTermComposition_water"
+                          setNames="{ source }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="globalCompFraction"
+                          component="1"
+                          scale="0.1" />
+    </FieldSpecifications>
+  </Problem>
+  )xml";
+
+void writeTableToFile( string const & filename, char const * str )
+{
+  std::ofstream os( filename );
+  ASSERT_TRUE( os.is_open() );
+  os << str;
+  os.close();
+}
+
+// The raw bytes of the fields compared between the two runs, keyed by field name
+using FieldValues = std::map< string, std::vector< real64 > >;
+
+template< typename FIELD_TRAIT >
+void saveField( Group & group, FieldValues & values )
+{
+  typename FIELD_TRAIT::type & field = group.getReference< typename FIELD_TRAIT::type >( FIELD_TRAIT::key() );
+  field.move( hostMemorySpace, false );
+  values[FIELD_TRAIT::key()].assign( field.data(), field.data() + field.size() );
+}
+
+FieldValues runAndGetFields( string const & fuseSaturationFunctions,
+                             string const & stateUpdateTolerance )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  ProblemManager & problemManager = state.getProblemManager();
+  string const xmlInput = xmlInputBegin +
+                         "fuseSaturationFunctions=\"" + fuseSaturationFunctions + "\" " +
+                         "stateUpdateTolerance=\"" + stateUpdateTolerance + "\"" +
+                         xmlInputEnd;
+  problemManager.parseInputString( xmlInput );
+  problemManager.problemSetup();
+  problemManager.applyInitialConditions();
+
+  EXPECT_FALSE( problemManager.runSimulation() ) << "Simulation exited early.";
+
+  FieldValues values;
+  DomainPartition & domain = problemManager.getDomainPartition();
+  domain.getMeshBody( 0 ).getBaseDiscretization().getElemManager().
+    forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion & subRegion )
+  {
+    saveField< fields::flow::pressure >( subRegion, values );
+    saveField< fields::flow::globalCompDensity >( subRegion, values );
+    saveField< fields::flow::phaseVolumeFraction >( subRegion, values );
+    saveField< fields::flow::phaseMobility >( subRegion, values );
+    saveField< fields::flow::dPhaseMobility >( subRegion, values );
+
+    Group & constitutiveModels = subRegion.getConstitutiveModels();
+    saveField< fields::relperm::phaseRelPerm >( constitutiveModels.getGroup( "relperm" ), values );
+    saveField< fields::relperm::dPhaseRelPerm_dPhaseVolFraction >( constitutiveModels.getGroup( "relperm" ), values );
+    saveField< fields::cappres::phaseCapPressure >( constitutiveModels.getGroup( "cappres" ), values );
+    saveField< fields::cappres::dPhaseCapPressure_dPhaseVolFraction >( constitutiveModels.getGroup( "cappres" ), values );
+  } );
+  return values;
+}
+
+void checkBitwiseIdentical( FieldValues const & separateUpdates,
+                            FieldValues const & fusedUpdates )
+{
+  ASSERT_EQ( fusedUpdates.size(), separateUpdates.size() );
+  for( auto const & [name, values] : separateUpdates )
+  {
+    ASSERT_EQ( fusedUpdates.count( name ), 1u ) << name;
+    std::vector< real64 > const & fusedValues = fusedUpdates.at( name );
+    ASSERT_EQ( fusedValues.size(), values.size() ) << name;
+    EXPECT_EQ( std::memcmp( fusedValues.data(), values.data(), values.size() * sizeof( real64 ) ), 0 ) << name;
+  }
+}
+
+class CompositionalMultiphaseSaturationFunctionsTest : public ::testing::Test
+{
+protected:
+
+  void SetUp() override
+  {
+    writeTableToFile( "pvtliquid.txt", pvtLiquid );
+    writeTableToFile( "pvtgas.txt", pvtGas );
+    writeTableToFile( "co2flash.txt", co2flash );
+  }
+
+  void TearDown() override
+  {
+    std::remove( "pvtliquid.txt" );
+    std::remove( "pvtgas.txt" );
+    std::remove( "co2flash.txt" );
+  }
+};
+
+TEST_F( CompositionalMultiphaseSaturationFunctionsTest, fusedUpdatesAreBitwiseIdentical )
+{
+  FieldValues const separateUpdates = runAndGetFields( "0", "-1" );
+  FieldValues const fusedUpdates = runAndGetFields( "1", "-1" );
+  checkBitwiseIdentical( separateUpdates, fusedUpdates );
+}
+
+TEST_F( CompositionalMultiphaseSaturationFunctionsTest, fusedUpdatesOfChangedCellsAreBitwiseIdentical )
+{
+  FieldValues const separateUpdates = runAndGetFields( "0", "0" );
+  FieldValues const fusedUpdates = runAndGetFields( "1", "0" );
+  checkBitwiseIdentical( separateUpdates, fusedUpdates );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
@@ -0,0 +1,267 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "common/DataTypes.hpp"
+#include "constitutive/capillaryPressure/CapillaryPressureFields.hpp"
+#include "constitutive/relativePermeability/RelativePermeabilityFields.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mesh/CellElementSubRegion.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "physicsSolvers/fluidFlow/CompositionalMultiphaseBaseFields.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBaseFields.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+
+using namespace geos;
+using namespace geos::dataRepository;
+
+CommandLineOptions g_commandLineOptions;
+
+// This unit test checks that skipping the constitutive updates of the cells whose primary variables did not change
+// (stateUpdateTolerance="0") gives results bitwise identical to the full updates (stateUpdateTolerance="-1").
+// The primary variables of the source cells are fixed by the boundary conditions, so that both skipped and updated
+// cells are exercised, including the relperm and capillary pressure updates restricted to the changed cells.
+
+char const * pvtLiquid = "DensityFun PhillipsBrineDensity 1e6 7.5e7 5e5 295.15 370.15 25 0\n"
+                         "ViscosityFun PhillipsBrineViscosity 0\n";
+
+char const * pvtGas = "DensityFun SpanWagnerCO2Density 1e6 7.5e7 5e5 295.15 370.15 25\n"
+                      "ViscosityFun FenghourCO2Viscosity 1e6 7.5e7 5e5 295.15 370.15 25\n";
+
+char const * co2flash = "FlashModel CO2Solubility 1e6 7.5e7 5e5 295.15 370.15 25 0";
+
+string const xmlInputBegin =
+  R"xml(
+  <Problem>
+    <Solvers>
+      <CompositionalMultiphaseFVM name="compflow"
+                                  discretization="fluidTPFA"
+                                  temperature="368.15"
+                                  useMass="1"
+                                  initialDt="1e3"
+                                  maxCompFractionChange="0.5"
+                                  targetRegions="{ region }"
+  )xml";
+
+string const xmlInputEnd =
+  R"xml(
+                                  >
+        <NonlinearSolverParameters newtonTol="1.0e-8"
+                                   newtonMaxIter="20"
+                                   lineSearchAction="None"
+                                   maxTimeStepCuts="5" />
+        <LinearSolverParameters directParallel="0" />
+      </CompositionalMultiphaseFVM>
+    </Solvers>
+    <Mesh>
+      <InternalMesh name="mesh"
+                    elementTypes="{ C3D8 }"
+                    xCoords="{ 0, 100 }"
+                    yCoords="{ 0, 1 }"
+                    zCoords="{ 0, 1 }"
+                    nx="{ 20 }"
+                    ny="{ 1 }"
+                    nz="{ 1 }"
+                    cellBlockNames="{ cb }" />
+    </Mesh>
+    <Geometry>
+      <Box name="source"
+           xMin="{ -0.01, -0.01, -0.01 }"
+           xMax="{ 5.01, 1.01, 1.01 }" />
+    </Geometry>
+    <Events maxTime="5e3">
+      <PeriodicEvent name="solverApplications"
+                     forceDt="1e3"
+                     target="/Solvers/compflow" />
+    </Events>
+    <NumericalMethods>
+      <FiniteVolume>
+        <TwoPointFluxApproximation name="fluidTPFA" />
+      </FiniteVolume>
+    </NumericalMethods>
+    <ElementRegions>
+      <CellElementRegion name="region"
+                         cellBlocks="{ cb }"
+                         materialList="{ fluid, rock, relperm, cappres }" />
+    </ElementRegions>
+    <Constitutive>
+      <CompressibleSolidConstantPermeability name="rock"
+                                             solidModelName="nullSolid"
+                                             porosityModelName="rockPorosity"
+                                             permeabilityModelName="rockPerm" />
+      <NullModel name="nullSolid" />
+      <PressurePorosity name="rockPorosity"
+                        defaultReferencePorosity="0.2"
+                        referencePressure="0.0"
+                        compressibility="1.0e-9" />
+      <ConstantPermeability name="rockPerm"
+                            permeabilityComponents="{ 1.0e-13, 1.0e-13, 1.0e-13 }" />
+      <CO2BrinePhillipsFluid name="fluid"
+                             phaseNames="{ gas, water }"
+                             componentNames="{ co2, water }"
+                             componentMolarWeight="{ 44e-3, 18e-3 }"
+                             phasePVTParaFiles="{ pvtgas.txt, pvtliquid.txt }"
+                             flashModelParaFile="co2flash.txt" />
+      <BrooksCoreyRelativePermeability name="relperm"
+                                       phaseNames="{ gas, water }"
+                                       phaseMinVolumeFraction="{ 0.0, 0.0 }"
+                                       phaseRelPermExponent="{ 1.5, 1.5 }"
+                                       phaseRelPermMaxValue="{ 0.9, 0.9 }" />
+      <BrooksCoreyCapillaryPressure name="cappres"
+                                    phaseNames="{ gas, water }"
+                                    phaseMinVolumeFraction="{ 0.0, 0.0 }"
+                                    phaseCapPressureExponentInv="{ 0, 4 }"
+                                    phaseEntryPressure="{ 0, 1e4 }"
+                                    capPressureEpsilon="1e-8" />
+    </Constitutive>
+    <FieldSpecifications>
+      <FieldSpecification name="initialPressure"
+                          initialCondition="1"
+                          setNames="{ all }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="pressure"
+                          scale="9e6" />
+      <FieldSpecification name="initialTemperature"
+                          initialCondition="1"
+                          setNames="{ all }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="temperature"
+                          scale="368.15" />
+      <FieldSpecification name="initialComposition_co2"
+                          initialCondition="1"
+                          setNames="{ all }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="globalCompFraction"
+                          component="0"
+                          scale="0.01" />
+      <FieldSpecification name="initialComposition_water"
+                          initialCondition="1"
+                          setNames="{ all }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="globalCompFraction"
+                          component="1"
+                          scale="0.99" />
+      <FieldSpecification name="sourcePressure"
+                          setNames="{ source }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="pressure"
+                          scale="1.2e7" />
+      <FieldSpecification name="sourceTemperature"
+                          setNames="{ source }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="temperature"
+                          scale="368.15" />
+      <FieldSpecification name="sourceTermComposition_co2"
+                          setNames="{ source }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="globalCompFraction"
+                          component="0"
+                          scale="0.9" />
+      <FieldSpecification name="sourceTermComposition_water"
+                          setNames="{ source }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="globalCompFraction"
+                          component="1"
+                          scale="0.1" />
+    </FieldSpecifications>
+  </Problem>
+  )xml";
+
+void writeTableToFile( string const & filename, char const * str )
+{
+  std::ofstream os( filename );
+  ASSERT_TRUE( os.is_open() );
+  os << str;
+  os.close();
+}
+
+// The raw bytes of the fields compared between the two runs, keyed by field name
+using FieldValues = std::map< string, std::vector< real64 > >;
+
+template< typename FIELD_TRAIT >
+void saveField( Group & group, FieldValues & values )
+{
+  typename FIELD_TRAIT::type & field = group.getReference< typename FIELD_TRAIT::type >( FIELD_TRAIT::key() );
+  field.move( hostMemorySpace, false );
+  values[FIELD_TRAIT::key()].assign( field.data(), field.data() + field.size() );
+}
+
+FieldValues runAndGetFields( string const & stateUpdateTolerance )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  ProblemManager & problemManager = state.getProblemManager();
+  string const xmlInput = xmlInputBegin + "stateUpdateTolerance=\"" + stateUpdateTolerance + "\"" + xmlInputEnd;
+  problemManager.parseInputString( xmlInput );
+  problemManager.problemSetup();
+  problemManager.applyInitialConditions();
+
+  EXPECT_FALSE( problemManager.runSimulation() ) << "Simulation exited early.";
+
+  FieldValues values;
+  DomainPartition & domain = problemManager.getDomainPartition();
+  domain.getMeshBody( 0 ).getBaseDiscretization().getElemManager().
+    forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion & subRegion )
+  {
+    saveField< fields::flow::pressure >( subRegion, values );
+    saveField< fields::flow::globalCompDensity >( subRegion, values );
+    saveField< fields::flow::phaseVolumeFraction >( subRegion, values );
+    saveField< fields::flow::phaseMobility >( subRegion, values );
+    saveField< fields::flow::dPhaseMobility >( subRegion, values );
+
+    Group & constitutiveModels = subRegion.getConstitutiveModels();
+    saveField< fields::relperm::phaseRelPerm >( constitutiveModels.getGroup( "relperm" ), values );
+    saveField< fields::cappres::phaseCapPressure >( constitutiveModels.getGroup( "cappres" ), values );
+  } );
+  return values;
+}
+
+TEST( CompositionalMultiphaseStateUpdateTest, skippedUpdatesAreBitwiseIdentical )
+{
+  writeTableToFile( "pvtliquid.txt", pvtLiquid );
+  writeTableToFile( "pvtgas.txt", pvtGas );
+  writeTableToFile( "co2flash.txt", co2flash );
+
+  FieldValues const fullUpdates = runAndGetFields( "-1" );
+  FieldValues const skippedUpdates = runAndGetFields( "0" );
+
+  ASSERT_EQ( skippedUpdates.size(), fullUpdates.size() );
+  for( auto const & [name, values] : fullUpdates )
+  {
+    ASSERT_EQ( skippedUpdates.count( name ), 1u ) << name;
+    std::vector< real64 > const & skippedValues = skippedUpdates.at( name );
+    ASSERT_EQ( skippedValues.size(), values.size() ) << name;
+    EXPECT_EQ( std::memcmp( skippedValues.data(), values.data(), values.size() * sizeof( real64 ) ), 0 ) << name;
+  }
+
+  std::remove( "pvtliquid.txt" );
+  std::remove( "pvtgas.txt" );
+  std::remove( "co2flash.txt" );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
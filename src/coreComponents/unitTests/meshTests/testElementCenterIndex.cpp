@@ -0,0 +1,169 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "common/DataTypes.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mesh/MeshForLoopInterface.hpp"
+#include "mesh/utilities/ElementCenterIndex.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+using namespace geos;
+
+CommandLineOptions g_commandLineOptions;
+
+// This unit test checks that the element found by the element-center index is the one found by a loop over all
+// the elements of the mesh, including for the points equidistant to several centers and the points outside the mesh.
+// The mesh has two regions, and its element centers and nodes are exactly representable, so that the nodes, the
+// face centers and the edge centers are exactly equidistant to several element centers.
+char const * xmlInput =
+  R"xml(
+  <Problem>
+    <Mesh>
+      <InternalMesh
+        name="mesh"
+        elementTypes="{ C3D8 }"
+        xCoords="{ 0, 2, 4 }"
+        yCoords="{ 0, 2 }"
+        zCoords="{ 0, 1 }"
+        nx="{ 4, 4 }"
+        ny="{ 4 }"
+        nz="{ 2 }"
+        cellBlockNames="{ cb1, cb2 }"/>
+    </Mesh>
+    <ElementRegions>
+      <CellElementRegion
+        name="region1"
+        cellBlocks="{ cb1 }"
+        materialList="{ }"/>
+      <CellElementRegion
+        name="region2"
+        cellBlocks="{ cb2 }"
+        materialList="{ }"/>
+    </ElementRegions>
+  </Problem>
+  )xml";
+
+class ElementCenterIndexTest : public ::testing::Test
+{
+protected:
+
+  ElementCenterIndexTest():
+    state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) )
+  {}
+
+  void SetUp() override
+  {
+    ProblemManager & problemManager = state.getProblemManager();
+    problemManager.parseInputString( xmlInput );
+    problemManager.problemSetup();
+    problemManager.applyInitialConditions();
+  }
+
+  MeshLevel const & getMesh()
+  {
+    return state.getProblemManager().getDomainPartition().getMeshBody( 0 ).getBaseDiscretization();
+  }
+
+  // Compare the index with the search for the closest element done by the well generation before the index
+  void checkAgainstBruteForce( ElementCenterIndex const & index, real64 const (&location)[3] )
+  {
+    MeshLevel const & mesh = getMesh();
+    ElementRegionManager::ElementViewAccessor< arrayView2d< real64 const > > const resElemCenter =
+      mesh.getElemManager().constructViewAccessor< array2d< real64 >,
+                                                   arrayView2d< real64 const > >( ElementSubRegionBase::viewKeyStruct::elementCenterString() );
+    auto const ret = minLocOverElemsInMesh( mesh, [&] ( localIndex const er,
+                                                        localIndex const esr,
+                                                        localIndex const ei )
+    {
+      real64 v[3] = { location[0], location[1], location[2] };
+      LvArray::tensorOps::subtract< 3 >( v, resElemCenter[er][esr][ei] );
+      return LvArray::tensorOps::l2Norm< 3 >( v );
+    } );
+
+    localIndex er, esr, ei;
+    index.findClosestElement( location, er, esr, ei );
+    EXPECT_EQ( er, std::get< 0 >( ret.second ) ) << location[0] << " " << location[1] << " " << location[2];
+    EXPECT_EQ( esr, std::get< 1 >( ret.second ) ) << location[0] << " " << location[1] << " " << location[2];
+    EXPECT_EQ( ei, std::get< 2 >( ret.second ) ) << location[0] << " " << location[1] << " " << location[2];
+  }
+
+  GeosxState state;
+};
+
+TEST_F( ElementCenterIndexTest, randomPointsMatchBruteForce )
+{
+  ElementCenterIndex const index( getMesh() );
+
+  // half of the points are outside of the bounding box of the mesh
+  std::mt19937 generator( 2024 );
+  std::uniform_real_distribution< real64 > xDistribution( -4.0, 8.0 );
+  std::uniform_real_distribution< real64 > yDistribution( -2.0, 4.0 );
+  std::uniform_real_distribution< real64 > zDistribution( -1.0, 2.0 );
+  for( integer test = 0; test < 2000; ++test )
+  {
+    real64 const location[3] = { xDistribution( generator ), yDistribution( generator ), zDistribution( generator ) };
+    checkAgainstBruteForce( index, location );
+  }
+}
+
+TEST_F( ElementCenterIndexTest, tiesMatchBruteForce )
+{
+  ElementCenterIndex const index( getMesh() );
+
+  // the nodes, edge centers and face centers of the mesh, including the ones on the interface between the regions,
+  // and their counterparts outside of the mesh
+  for( integer i = -4; i <= 20; ++i )
+  {
+    for( integer j = -2; j <= 10; ++j )
+    {
+      for( integer k = -2; k <= 6; ++k )
+      {
+        real64 const location[3] = { 0.25 * i, 0.25 * j, 0.25 * k };
+        checkAgainstBruteForce( index, location );
+      }
+    }
+  }
+}
+
+TEST_F( ElementCenterIndexTest, farPointsMatchBruteForce )
+{
+  ElementCenterIndex const index( getMesh() );
+
+  // points far from the mesh, for which the search visits all the rings of bins
+  real64 const farLocations[][3] = { { -1000.0, -1000.0, -1000.0 },
+    { 1000.0, 1.0, 0.5 },
+    { 2.0, -1000.0, 0.5 },
+    { 2.0, 1.0, 1000.0 },
+    { 1000.0, 1000.0, 1000.0 } };
+  for( auto const & location : farLocations )
+  {
+    checkAgainstBruteForce( index, location );
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
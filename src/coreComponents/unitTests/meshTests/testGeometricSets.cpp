@@ -0,0 +1,176 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "common/DataTypes.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mesh/CellElementSubRegion.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mesh/simpleGeometricObjects/GeometricObjectManager.hpp"
+#include "mesh/simpleGeometricObjects/SimpleGeometricObjectBase.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geos;
+
+CommandLineOptions g_commandLineOptions;
+
+// This unit test checks that the node and element sets built from the geometric objects, with the culling of the
+// nodes outside of the bounding box of the objects, are the ones found by testing every node against the objects.
+// The objects are placed so that some of the mesh nodes (spaced by 0.5) are on their surface.
+char const * xmlInput =
+  R"xml(
+  <Problem>
+    <Mesh>
+      <InternalMesh
+        name="mesh"
+        elementTypes="{ C3D8 }"
+        xCoords="{ 0, 4 }"
+        yCoords="{ 0, 4 }"
+        zCoords="{ 0, 4 }"
+        nx="{ 8 }"
+        ny="{ 8 }"
+        nz="{ 8 }"
+        cellBlockNames="{ cb1 }"/>
+    </Mesh>
+    <Geometry>
+      <Box
+        name="box"
+        xMin="{ 0.5, 0.5, 0.5 }"
+        xMax="{ 2.0, 1.5, 3.0 }"/>
+      <Box
+        name="boxStrike90"
+        strike="90"
+        xMin="{ 1.0, 1.5, 0.5 }"
+        xMax="{ 3.0, 2.5, 1.5 }"/>
+      <Box
+        name="boxStrikeMinus45"
+        strike="-45"
+        xMin="{ 0.5, 1.75, 0.0 }"
+        xMax="{ 3.5, 2.25, 4.0 }"/>
+      <Cylinder
+        name="cylinder"
+        point1="{ 2.0, 2.0, 0.0 }"
+        point2="{ 2.0, 2.0, 4.0 }"
+        radius="1.0"/>
+      <Cylinder
+        name="tiltedCylinder"
+        point1="{ 0.0, 0.0, 0.0 }"
+        point2="{ 4.0, 4.0, 4.0 }"
+        radius="0.75"
+        innerRadius="0.25"/>
+      <Disc
+        name="disc"
+        center="{ 2.0, 2.0, 2.0 }"
+        normal="{ 0, 0, 1 }"
+        lengthVector="{ 1, 0, 0 }"
+        widthVector="{ 0, 1, 0 }"
+        radius="1.5"/>
+      <Disc
+        name="tiltedDisc"
+        center="{ 2.0, 2.0, 2.0 }"
+        normal="{ 0.707106781186548, 0, 0.707106781186548 }"
+        lengthVector="{ -0.707106781186548, 0, 0.707106781186548 }"
+        widthVector="{ 0, 1, 0 }"
+        radius="1.5"/>
+      <Rectangle
+        name="rectangle"
+        origin="{ 2.0, 2.0, 2.0 }"
+        normal="{ 0, 1, 0 }"
+        lengthVector="{ 1, 0, 0 }"
+        widthVector="{ 0, 0, 1 }"
+        dimensions="{ 2, 3 }"/>
+      <Rectangle
+        name="tiltedRectangle"
+        origin="{ 2.0, 2.0, 2.0 }"
+        normal="{ -0.707106781186548, 0.707106781186548, 0 }"
+        lengthVector="{ 0.707106781186548, 0.707106781186548, 0 }"
+        widthVector="{ 0, 0, 1 }"
+        dimensions="{ 2.82842712474619, 2 }"/>
+    </Geometry>
+    <ElementRegions>
+      <CellElementRegion
+        name="region"
+        cellBlocks="{ cb1 }"
+        materialList="{ }"/>
+    </ElementRegions>
+  </Problem>
+  )xml";
+
+TEST( GeometricSetsTest, setsMatchBruteForce )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  ProblemManager & problemManager = state.getProblemManager();
+  problemManager.parseInputString( xmlInput );
+  problemManager.problemSetup();
+  problemManager.applyInitialConditions();
+
+  MeshLevel const & mesh = problemManager.getDomainPartition().getMeshBody( 0 ).getBaseDiscretization();
+  NodeManager const & nodeManager = mesh.getNodeManager();
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition();
+  GeometricObjectManager const & geometries =
+    problemManager.getGroup< GeometricObjectManager >( problemManager.groupKeys.geometricObjectManager );
+
+  integer numObjects = 0;
+  geometries.forSubGroups< SimpleGeometricObjectBase >( [&]( SimpleGeometricObjectBase const & object )
+  {
+    string const & name = object.getName();
+    ++numObjects;
+
+    // node set
+    SortedArrayView< localIndex const > const nodeSet = nodeManager.getSet( name );
+    array1d< bool > isNodeInObject( nodeManager.size() );
+    localIndex numNodesInObject = 0;
+    for( localIndex a = 0; a < nodeManager.size(); ++a )
+    {
+      real64 const nodeCoord[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( X[a] );
+      isNodeInObject[a] = object.isCoordInObject( nodeCoord );
+      numNodesInObject += isNodeInObject[a] ? 1 : 0;
+      EXPECT_EQ( nodeSet.contains( a ), isNodeInObject[a] ) << name << ", node " << a;
+    }
+    EXPECT_EQ( nodeSet.size(), numNodesInObject ) << name;
+    EXPECT_GT( numNodesInObject, 0 ) << name;
+
+    // element sets: the elements whose nodes are all in the node set
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion const & subRegion )
+    {
+      SortedArrayView< localIndex const > const elemSet = subRegion.getSet( name );
+      auto const & elemToNodes = subRegion.nodeList();
+      localIndex numElemsInObject = 0;
+      for( localIndex k = 0; k < subRegion.size(); ++k )
+      {
+        bool isElemInObject = true;
+        for( localIndex i = 0; i < subRegion.numNodesPerElement( k ); ++i )
+        {
+          isElemInObject = isElemInObject && isNodeInObject[elemToNodes[k][i]];
+        }
+        numElemsInObject += isElemInObject ? 1 : 0;
+        EXPECT_EQ( elemSet.contains( k ), isElemInObject ) << name << ", element " << k;
+      }
+      EXPECT_EQ( elemSet.size(), numElemsInObject ) << name;
+    } );
+  } );
+  EXPECT_EQ( numObjects, 9 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
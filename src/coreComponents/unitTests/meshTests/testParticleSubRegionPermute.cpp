@@ -0,0 +1,180 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "common/DataTypes.hpp"
+#include "common/MpiWrapper.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mesh/ParticleSubRegion.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+using namespace geos;
+using namespace geos::dataRepository;
+
+// This unit test checks that every particle field, the sets and the fields of the constitutive models follow
+// the reordering of the particles.
+
+static localIndex constexpr numParticles = 57;
+
+// A value that identifies the particle and the component of a field
+real64 fieldValue( localIndex const p, integer const component )
+{
+  return 1000.0 * p + component + 0.5;
+}
+
+array1d< localIndex > randomPermutation( localIndex const size )
+{
+  array1d< localIndex > newToOld( size );
+  for( localIndex i = 0; i < size; ++i )
+  {
+    newToOld[i] = i;
+  }
+  std::mt19937 generator( 2024 );
+  std::shuffle( newToOld.begin(), newToOld.end(), generator );
+  return newToOld;
+}
+
+TEST( ParticleSubRegionPermuteTest, FieldsFollowThePermutation )
+{
+  conduit::Node node;
+  Group root( "root", node );
+  ParticleSubRegion & subRegion = root.registerGroup< ParticleSubRegion >( "subRegion" );
+  subRegion.setParticleType( ParticleType::SinglePoint );
+
+  // a constitutive model holding a field sized by the number of particles and a scalar
+  Group & constitutiveModel = subRegion.getConstitutiveModels().registerGroup( "model" );
+  constitutiveModel.setSizedFromParent( 1 );
+  array2d< real64 > & modelField = constitutiveModel.registerWrapper< array2d< real64 > >( "modelField" ).reference();
+  modelField.resizeDimension< 1 >( 2 );
+  real64 & modelScalar = constitutiveModel.registerWrapper< real64 >( "modelScalar" ).reference();
+  modelScalar = 3.25;
+
+  subRegion.resize( numParticles );
+  subRegion.setParticleRank( MpiWrapper::commRank( MPI_COMM_GEOS ) );
+
+  arrayView1d< globalIndex > const particleID = subRegion.getParticleID();
+  arrayView1d< int > const particleGroup = subRegion.getParticleGroup();
+  arrayView1d< int > const surfaceFlag = subRegion.getParticleSurfaceFlag();
+  arrayView1d< real64 > const damage = subRegion.getParticleDamage();
+  arrayView1d< real64 > const strengthScale = subRegion.getParticleStrengthScale();
+  arrayView2d< real64 > const center = subRegion.getParticleCenter();
+  arrayView2d< real64 > const velocity = subRegion.getParticleVelocity();
+  arrayView2d< real64 > const materialDirection = subRegion.getParticleMaterialDirection();
+  arrayView1d< real64 > const volume = subRegion.getParticleVolume();
+  arrayView3d< real64 > const rVectors = subRegion.getParticleRVectors();
+  for( localIndex p = 0; p < numParticles; ++p )
+  {
+    particleID[p] = 10 * p + 3;
+    particleGroup[p] = p % 4;
+    surfaceFlag[p] = p % 3;
+    damage[p] = fieldValue( p, 1 );
+    strengthScale[p] = fieldValue( p, 2 );
+    volume[p] = fieldValue( p, 3 );
+    for( integer i = 0; i < 3; ++i )
+    {
+      center[p][i] = fieldValue( p, 10 + i );
+      velocity[p][i] = fieldValue( p, 20 + i );
+      materialDirection[p][i] = fieldValue( p, 30 + i );
+      for( integer j = 0; j < 3; ++j )
+      {
+        rVectors[p][i][j] = fieldValue( p, 40 + 3 * i + j );
+      }
+    }
+    for( integer i = 0; i < 2; ++i )
+    {
+      modelField[p][i] = fieldValue( p, 50 + i );
+    }
+  }
+
+  SortedArray< localIndex > & set = subRegion.createSet( "everyThirdParticle" );
+  for( localIndex p = 0; p < numParticles; p += 3 )
+  {
+    set.insert( p );
+  }
+
+  array1d< localIndex > const newToOld = randomPermutation( numParticles );
+  array1d< localIndex > oldToNew( numParticles );
+  for( localIndex i = 0; i < numParticles; ++i )
+  {
+    oldToNew[newToOld[i]] = i;
+  }
+  subRegion.permute( newToOld.toViewConst() );
+
+  ASSERT_EQ( subRegion.size(), numParticles );
+  for( localIndex i = 0; i < numParticles; ++i )
+  {
+    localIndex const p = newToOld[i];
+    EXPECT_EQ( particleID[i], 10 * p + 3 );
+    EXPECT_EQ( particleGroup[i], p % 4 );
+    EXPECT_EQ( surfaceFlag[i], p % 3 );
+    EXPECT_EQ( damage[i], fieldValue( p, 1 ) );
+    EXPECT_EQ( strengthScale[i], fieldValue( p, 2 ) );
+    EXPECT_EQ( volume[i], fieldValue( p, 3 ) );
+    for( integer d = 0; d < 3; ++d )
+    {
+      EXPECT_EQ( center[i][d], fieldValue( p, 10 + d ) );
+      EXPECT_EQ( velocity[i][d], fieldValue( p, 20 + d ) );
+      EXPECT_EQ( materialDirection[i][d], fieldValue( p, 30 + d ) );
+      for( integer j = 0; j < 3; ++j )
+      {
+        EXPECT_EQ( rVectors[i][d][j], fieldValue( p, 40 + 3 * d + j ) );
+      }
+    }
+    for( integer d = 0; d < 2; ++d )
+    {
+      EXPECT_EQ( modelField[i][d], fieldValue( p, 50 + d ) );
+    }
+
+    // the maps are rebuilt from the permuted particle IDs
+    EXPECT_EQ( subRegion.localToGlobalMap()[i], 10 * p + 3 );
+    EXPECT_EQ( subRegion.globalToLocalMap().at( 10 * p + 3 ), i );
+  }
+
+  // the scalar of the constitutive model is not an entry per particle
+  EXPECT_EQ( modelScalar, 3.25 );
+
+  EXPECT_EQ( set.size(), ( numParticles + 2 ) / 3 );
+  for( localIndex p = 0; p < numParticles; p += 3 )
+  {
+    EXPECT_TRUE( set.contains( oldToNew[p] ) );
+  }
+  EXPECT_EQ( subRegion.activeParticleIndices().size(), numParticles );
+}
+
+TEST( ParticleSubRegionPermuteTest, UnsupportedWrapperIsAnError )
+{
+  conduit::Node node;
+  Group root( "root", node );
+  Group & group = root.registerGroup( "group" );
+
+  // resized with its parent, but its entries cannot be gathered one by one
+  group.registerWrapper< ArrayOfArrays< localIndex > >( "relation" );
+  group.resize( 4 );
+
+  array1d< localIndex > const newToOld = randomPermutation( 4 );
+  EXPECT_DEATH_IF_SUPPORTED( ObjectManagerBase::permuteWrappers( group, newToOld.toViewConst() ), "" );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
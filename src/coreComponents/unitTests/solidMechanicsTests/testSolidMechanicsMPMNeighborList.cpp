@@ -0,0 +1,278 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "common/DataTypes.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mesh/ParticleManager.hpp"
+#include "mesh/ParticleSubRegion.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsMPM.hpp"
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <random>
+#include <set>
+
+using namespace geos;
+using namespace geos::dataRepository;
+
+CommandLineOptions g_commandLineOptions;
+
+// This unit test checks that the neighbor lists reused within the Verlet skin contain the same neighbors as a
+// brute-force search, including after the particles have been reordered by the periodic sort.
+char const * xmlInput =
+  R"xml(
+  <Problem>
+    <Mesh>
+      <InternalMesh
+        name="backgroundGrid"
+        elementTypes="{ C3D8 }"
+        xCoords="{ -4, 4 }"
+        yCoords="{ -4, 4 }"
+        zCoords="{ -4, 4 }"
+        nx="{ 8 }"
+        ny="{ 8 }"
+        nz="{ 8 }"
+        cellBlockNames="{ cb1 }"/>
+      <ParticleMesh
+        name="particles"
+        particleFile="mpmParticleFile_neighborList"
+        headerFile="mpmHeaderFile_neighborList"
+        particleBlockNames="{ pb1 }"
+        particleTypes="{ SinglePoint }"/>
+    </Mesh>
+    <ElementRegions>
+      <CellElementRegion
+        name="CellRegion1"
+        meshBody="backgroundGrid"
+        cellBlocks="{ cb1 }"
+        materialList="{ null }"/>
+    </ElementRegions>
+    <ParticleRegions>
+      <ParticleRegion
+        name="ParticleRegion1"
+        meshBody="particles"
+        particleBlocks="{ pb1 }"
+        materialList="{ testMaterial }"/>
+    </ParticleRegions>
+    <Solvers
+      gravityVector="{ 0.0, 0.0, 0.0 }">
+      <SolidMechanics_MPM
+        name="mpmsolve"
+        discretization="FE1"
+        targetRegions="{ backgroundGrid/CellRegion1, particles/ParticleRegion1 }"
+        timeIntegrationOption="ExplicitDynamic"
+        needsNeighborList="1"
+        neighborRadius="0.6"
+        neighborListSkin="0.2"
+        particleSortInterval="7"
+        boundaryConditionTypes="{ 0, 0, 0, 0, 0, 0 }"/>
+    </Solvers>
+    <Constitutive>
+      <ElasticIsotropic
+        name="null"
+        defaultDensity="1000"
+        defaultBulkModulus="1.0e4"
+        defaultShearModulus="1.0e4"/>
+      <ElasticIsotropic
+        name="testMaterial"
+        defaultDensity="1000"
+        defaultBulkModulus="1.0e4"
+        defaultShearModulus="1.0e4"/>
+    </Constitutive>
+    <Events
+      maxTime="1.0">
+      <PeriodicEvent
+        name="solverApplications"
+        target="/Solvers/mpmsolve"/>
+    </Events>
+    <NumericalMethods>
+      <FiniteElements>
+        <FiniteElementSpace
+          name="FE1"
+          order="1"/>
+      </FiniteElements>
+    </NumericalMethods>
+  </Problem>
+  )xml";
+
+static real64 constexpr neighborRadius = 0.6;
+static real64 constexpr dt = 0.01;
+static int constexpr numSteps = 40;
+
+// Write a 6x6x2 lattice of particles with random velocities, in the file format of the ParticleMesh
+void writeParticleFiles()
+{
+  std::mt19937 generator( 2024 );
+  std::uniform_real_distribution< real64 > velocityDistribution( -1.0, 1.0 );
+
+  int const nx = 6, ny = 6, nz = 2;
+  std::ofstream headerFile( "mpmHeaderFile_neighborList" );
+  headerFile << "1 1\n";
+  headerFile << "testMaterial 0\n";
+  headerFile << "SinglePoint " << nx * ny * nz << "\n";
+
+  std::ofstream particleFile( "mpmParticleFile_neighborList" );
+  int id = 0;
+  for( int k = 0; k < nz; ++k )
+  {
+    for( int j = 0; j < ny; ++j )
+    {
+      for( int i = 0; i < nx; ++i )
+      {
+        // ID, position, velocity, material direction, material, group, surface flag, damage, strength scale, volume
+        particleFile << id++ << " "
+                     << -1.25 + 0.5 * i << " " << -1.25 + 0.5 * j << " " << -0.25 + 0.5 * k << " "
+                     << velocityDistribution( generator ) << " " << velocityDistribution( generator ) << " " << velocityDistribution( generator ) << " "
+                     << "1 0 0 0 0 0 0 1 0.125\n";
+      }
+    }
+  }
+}
+
+real64 distanceSquared( arraySlice1d< real64 const > const xA, arraySlice1d< real64 const > const xB )
+{
+  real64 const xBA[3] = { xB[0] - xA[0], xB[1] - xA[1], xB[2] - xA[2] };
+  return xBA[0] * xBA[0] + xBA[1] * xBA[1] + xBA[2] * xBA[2];
+}
+
+// Compare the neighbors of each active particle in the list, within the neighbor radius, with a brute-force search
+void checkNeighborList( ParticleSubRegion & subRegion )
+{
+  arrayView2d< real64 const > const x = subRegion.getParticleCenter();
+  SortedArrayView< localIndex const > const activeParticleIndices = subRegion.activeParticleIndices();
+  OrderedVariableToManyParticleRelation const & neighborList = subRegion.neighborList();
+  ArrayOfArraysView< localIndex const > const toParticleIndex = neighborList.m_toParticleIndex.toViewConst();
+  arrayView1d< localIndex const > const numParticles = neighborList.m_numParticles.toViewConst();
+  real64 const radiusSquared = neighborRadius * neighborRadius;
+
+  ASSERT_EQ( neighborList.size(), subRegion.size() );
+  for( localIndex const a : activeParticleIndices )
+  {
+    std::set< localIndex > listed;
+    for( localIndex n = 0; n < numParticles[a]; ++n )
+    {
+      localIndex const b = toParticleIndex[a][n];
+      ASSERT_LT( b, subRegion.size() );
+      if( distanceSquared( x[a], x[b] ) <= radiusSquared )
+      {
+        listed.insert( b );
+      }
+    }
+
+    std::set< localIndex > expected;
+    for( localIndex b = 0; b < subRegion.size(); ++b )
+    {
+      if( distanceSquared( x[a], x[b] ) <= radiusSquared )
+      {
+        expected.insert( b );
+      }
+    }
+    EXPECT_EQ( listed, expected ) << "particle " << a;
+  }
+}
+
+TEST( SolidMechanicsMPMNeighborListTest, ReusedListMatchesBruteForce )
+{
+  writeParticleFiles();
+
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  ProblemManager & problemManager = state.getProblemManager();
+  problemManager.parseInputString( xmlInput );
+  problemManager.problemSetup();
+  problemManager.applyInitialConditions();
+
+  DomainPartition & domain = problemManager.getDomainPartition();
+  SolidMechanicsMPM & solver = problemManager.getPhysicsSolverManager().getGroup< SolidMechanicsMPM >( "mpmsolve" );
+  ParticleManager & particleManager = domain.getMeshBody( "particles" ).getBaseDiscretization().getParticleManager();
+
+  int numReuses = 0;
+  int numRebuilds = 0;
+  real64 time_n = 0.0;
+  for( int cycle = 0; cycle < numSteps; ++cycle )
+  {
+    solver.explicitStep( time_n, dt, cycle, domain );
+    time_n += dt;
+
+    // whenever the list is deemed valid for the current positions, it must hold all the neighbors
+    if( solver.neighborListNeedsRebuild( particleManager ) )
+    {
+      numRebuilds++;
+    }
+    else
+    {
+      numReuses++;
+      particleManager.forParticleSubRegions( [&]( ParticleSubRegion & subRegion )
+      {
+        checkNeighborList( subRegion );
+      } );
+    }
+  }
+
+  // both the reuse and the rebuild (after the particles have moved or been sorted) must have been exercised
+  EXPECT_GT( numReuses, 0 );
+  EXPECT_GT( numRebuilds, 0 );
+}
+
+TEST( SolidMechanicsMPMNeighborListTest, ReorderedParticlesTriggerRebuild )
+{
+  writeParticleFiles();
+
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  ProblemManager & problemManager = state.getProblemManager();
+  problemManager.parseInputString( xmlInput );
+  problemManager.problemSetup();
+  problemManager.applyInitialConditions();
+
+  DomainPartition & domain = problemManager.getDomainPartition();
+  SolidMechanicsMPM & solver = problemManager.getPhysicsSolverManager().getGroup< SolidMechanicsMPM >( "mpmsolve" );
+  ParticleManager & particleManager = domain.getMeshBody( "particles" ).getBaseDiscretization().getParticleManager();
+
+  solver.explicitStep( 0.0, dt, 0, domain );
+  solver.computeNeighborList( particleManager );
+  EXPECT_FALSE( solver.neighborListNeedsRebuild( particleManager ) );
+
+  // reversing the particles keeps their number and their positions, only the version stamp tells the list is stale
+  particleManager.forParticleSubRegions( [&]( ParticleSubRegion & subRegion )
+  {
+    array1d< localIndex > newToOld( subRegion.size() );
+    for( localIndex p = 0; p < subRegion.size(); ++p )
+    {
+      newToOld[p] = subRegion.size() - 1 - p;
+    }
+    subRegion.permute( newToOld.toViewConst() );
+  } );
+  EXPECT_TRUE( solver.neighborListNeedsRebuild( particleManager ) );
+
+  solver.computeNeighborList( particleManager );
+  EXPECT_FALSE( solver.neighborListNeedsRebuild( particleManager ) );
+  particleManager.forParticleSubRegions( [&]( ParticleSubRegion & subRegion )
+  {
+    checkNeighborList( subRegion );
+  } );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
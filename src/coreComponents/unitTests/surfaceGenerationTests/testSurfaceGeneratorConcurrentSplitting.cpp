@@ -0,0 +1,254 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "common/DataTypes.hpp"
+#include "common/MpiWrapper.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mesh/CellElementSubRegion.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mesh/FaceElementSubRegion.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/surfaceGeneration/SurfaceGenerator.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <map>
+
+using namespace geos;
+using namespace geos::dataRepository;
+
+CommandLineOptions g_commandLineOptions;
+
+// This unit test checks that splitting the nodes away from the rank boundaries on all the ranks at once gives the
+// same fracture topology as splitting all the nodes one rank color at a time. The three fracture planes cross each
+// other, and two of them lie on the rank boundaries when the test is run on a 2x2 partition.
+string const xmlInputBegin =
+  R"xml(
+  <Problem>
+    <Solvers
+      gravityVector="{ 0.0, 0.0, 0.0 }">
+      <SolidMechanicsLagrangianSSLE
+        name="lagSolve"
+        timeIntegrationOption="QuasiStatic"
+        discretization="FE1"
+        targetRegions="{ Region2 }"
+        surfaceGeneratorName="SurfaceGen"/>
+      <SurfaceGenerator
+        name="SurfaceGen"
+        targetRegions="{ Region2 }"
+        rockToughness="1e6"
+        mpiCommOrder="1"
+  )xml";
+
+string const xmlInputEnd =
+  R"xml(
+        />
+    </Solvers>
+    <Mesh>
+      <InternalMesh
+        name="mesh1"
+        elementTypes="{ C3D8 }"
+        xCoords="{ -1, 1 }"
+        yCoords="{ -1, 1 }"
+        zCoords="{ -1, 1 }"
+        nx="{ 6 }"
+        ny="{ 6 }"
+        nz="{ 6 }"
+        cellBlockNames="{ cb1 }"/>
+    </Mesh>
+    <Geometry>
+      <Box
+        name="fracPlaneX"
+        xMin="{ -0.1, -1e3, -1e3 }"
+        xMax="{ 0.1, 1e3, 1e3 }"/>
+      <Box
+        name="fracPlaneY"
+        xMin="{ -1e3, -0.1, -1e3 }"
+        xMax="{ 1e3, 0.1, 1e3 }"/>
+      <Box
+        name="fracPlaneZ"
+        xMin="{ -1e3, -1e3, 0.2 }"
+        xMax="{ 1e3, 1e3, 0.4 }"/>
+    </Geometry>
+    <Events
+      maxTime="1.0">
+      <SoloEvent
+        name="preFracture"
+        target="/Solvers/SurfaceGen"/>
+    </Events>
+    <NumericalMethods>
+      <FiniteElements>
+        <FiniteElementSpace
+          name="FE1"
+          order="1"/>
+      </FiniteElements>
+    </NumericalMethods>
+    <ElementRegions>
+      <CellElementRegion
+        name="Region2"
+        cellBlocks="{ cb1 }"
+        materialList="{ granite }"/>
+      <SurfaceElementRegion
+        name="Fracture"
+        defaultAperture="1.0e-4"
+        materialList="{ granite }"/>
+    </ElementRegions>
+    <Constitutive>
+      <ElasticIsotropic
+        name="granite"
+        defaultDensity="2700"
+        defaultBulkModulus="5.5556e9"
+        defaultShearModulus="4.16667e9"/>
+    </Constitutive>
+    <FieldSpecifications>
+      <FieldSpecification
+        name="frac"
+        initialCondition="1"
+        setNames="{ fracPlaneX, fracPlaneY, fracPlaneZ }"
+        objectPath="faceManager"
+        fieldName="ruptureState"
+        scale="1"/>
+    </FieldSpecifications>
+  </Problem>
+  )xml";
+
+// A description of the topology that does not depend on the local and global indices of the new nodes
+struct FractureTopology
+{
+  /// For each locally owned cell element and each of its nodes, the global indices of the cell elements sharing the node
+  std::map< globalIndex, std::vector< std::vector< globalIndex > > > elemNodeNeighbors;
+
+  /// Centers of the locally owned fracture elements
+  std::vector< std::array< real64, 3 > > fractureElementCenters;
+
+  /// Number of nodes owned by all the ranks
+  globalIndex numNodes = 0;
+
+  /// Number of fracture elements owned by all the ranks
+  globalIndex numFractureElements = 0;
+};
+
+FractureTopology splitAndGetTopology( string const & surfaceGeneratorAttributes )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  ProblemManager & problemManager = state.getProblemManager();
+  string const xmlInput = xmlInputBegin + surfaceGeneratorAttributes + xmlInputEnd;
+  problemManager.parseInputString( xmlInput );
+  problemManager.problemSetup();
+  problemManager.applyInitialConditions();
+
+  DomainPartition & domain = problemManager.getDomainPartition();
+  SurfaceGenerator & surfaceGenerator =
+    problemManager.getPhysicsSolverManager().getGroup< SurfaceGenerator >( "SurfaceGen" );
+  surfaceGenerator.execute( 0.0, 0.0, 0, 0, 0.0, domain );
+
+  MeshLevel const & mesh = domain.getMeshBody( 0 ).getBaseDiscretization();
+  NodeManager const & nodeManager = mesh.getNodeManager();
+  ElementRegionManager const & elemManager = mesh.getElemManager();
+  ArrayOfArraysView< localIndex const > const nodeToElemRegion = nodeManager.elementRegionList();
+  ArrayOfArraysView< localIndex const > const nodeToElemSubRegion = nodeManager.elementSubRegionList();
+  ArrayOfArraysView< localIndex const > const nodeToElem = nodeManager.elementList();
+
+  FractureTopology topology;
+
+  elemManager.forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion const & subRegion )
+  {
+    arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+    arrayView1d< globalIndex const > const localToGlobal = subRegion.localToGlobalMap();
+    auto const & elemToNodes = subRegion.nodeList();
+    for( localIndex k = 0; k < subRegion.size(); ++k )
+    {
+      if( ghostRank[k] >= 0 )
+      {
+        continue;
+      }
+      std::vector< std::vector< globalIndex > > & nodeNeighbors = topology.elemNodeNeighbors[localToGlobal[k]];
+      for( localIndex i = 0; i < subRegion.numNodesPerElement( k ); ++i )
+      {
+        localIndex const a = elemToNodes[k][i];
+        std::vector< globalIndex > neighbors;
+        for( localIndex j = 0; j < nodeToElem.sizeOfArray( a ); ++j )
+        {
+          ElementSubRegionBase const & neighborSubRegion =
+            elemManager.getRegion( nodeToElemRegion[a][j] ).getSubRegion( nodeToElemSubRegion[a][j] );
+          if( dynamic_cast< CellElementSubRegion const * >( &neighborSubRegion ) != nullptr )
+          {
+            neighbors.emplace_back( neighborSubRegion.localToGlobalMap()[nodeToElem[a][j]] );
+          }
+        }
+        std::sort( neighbors.begin(), neighbors.end() );
+        nodeNeighbors.emplace_back( neighbors );
+      }
+    }
+  } );
+
+  elemManager.forElementSubRegions< FaceElementSubRegion >( [&]( FaceElementSubRegion const & subRegion )
+  {
+    arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+    arrayView2d< real64 const > const elemCenter = subRegion.getElementCenter();
+    for( localIndex k = 0; k < subRegion.size(); ++k )
+    {
+      if( ghostRank[k] < 0 )
+      {
+        topology.fractureElementCenters.push_back( { elemCenter[k][0], elemCenter[k][1], elemCenter[k][2] } );
+      }
+    }
+  } );
+  std::sort( topology.fractureElementCenters.begin(), topology.fractureElementCenters.end() );
+
+  arrayView1d< integer const > const nodeGhostRank = nodeManager.ghostRank();
+  globalIndex numLocalNodes = 0;
+  for( localIndex a = 0; a < nodeManager.size(); ++a )
+  {
+    numLocalNodes += nodeGhostRank[a] < 0 ? 1 : 0;
+  }
+  topology.numNodes = MpiWrapper::sum( numLocalNodes );
+  topology.numFractureElements = MpiWrapper::sum( globalIndex( topology.fractureElementCenters.size() ) );
+
+  return topology;
+}
+
+TEST( SurfaceGeneratorConcurrentSplittingTest, TopologyMatchesColoredRounds )
+{
+  FractureTopology const colored = splitAndGetTopology( "concurrentSplitting=\"0\"" );
+  FractureTopology const concurrent = splitAndGetTopology( "concurrentSplitting=\"1\"" );
+
+  // three crossing planes through a 6x6x6 mesh, 6x6 faces each
+  EXPECT_EQ( colored.numFractureElements, 3 * 36 );
+  EXPECT_GT( colored.numNodes, 7 * 7 * 7 );
+
+  EXPECT_EQ( concurrent.numFractureElements, colored.numFractureElements );
+  EXPECT_EQ( concurrent.numNodes, colored.numNodes );
+  EXPECT_EQ( concurrent.fractureElementCenters, colored.fractureElementCenters );
+  ASSERT_EQ( concurrent.elemNodeNeighbors.size(), colored.elemNodeNeighbors.size() );
+  for( auto const & [elemIndex, nodeNeighbors] : colored.elemNodeNeighbors )
+  {
+    ASSERT_EQ( concurrent.elemNodeNeighbors.count( elemIndex ), 1 );
+    EXPECT_EQ( concurrent.elemNodeNeighbors.at( elemIndex ), nodeNeighbors ) << "element " << elemIndex;
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
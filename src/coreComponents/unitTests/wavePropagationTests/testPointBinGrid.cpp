@@ -0,0 +1,137 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "common/DataTypes.hpp"
+#include "mainInterface/initialization.hpp"
+#include "physicsSolvers/wavePropagation/shared/PointBinGrid.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+using namespace geos;
+
+// This unit test checks that the points visited by the bin grid for a box are the ones found by testing
+// the bounding box of every point against the box, each of them being visited exactly once.
+void checkAgainstBruteForce( array2d< real64 > const & coordinates,
+                             array1d< real64 > const & halfExtent,
+                             std::mt19937 & generator )
+{
+  PointBinGrid const bins( coordinates.toViewConst(), halfExtent.toViewConst() );
+  PointBinGrid::View const & binsView = bins.toView();
+
+  localIndex const numPoints = coordinates.size( 0 );
+  std::uniform_real_distribution< real64 > cornerDistribution( -20.0, 120.0 );
+  std::uniform_real_distribution< real64 > sizeDistribution( 0.0, 30.0 );
+
+  for( integer test = 0; test < 200; ++test )
+  {
+    real64 boxMin[3], boxMax[3];
+    for( integer d = 0; d < 3; ++d )
+    {
+      boxMin[d] = cornerDistribution( generator );
+      // some of the boxes are flat, as the bounding box of an element of a 2D mesh
+      boxMax[d] = boxMin[d] + ( test % 5 == 0 ? 0.0 : sizeDistribution( generator ) );
+    }
+
+    array1d< integer > numVisits( numPoints );
+    binsView.forPointsInBox( boxMin, boxMax, [&]( localIndex const p )
+    {
+      ++numVisits[p];
+    } );
+
+    for( localIndex p = 0; p < numPoints; ++p )
+    {
+      real64 const extent = halfExtent.size() > 0 ? halfExtent[p] : 0.0;
+      bool overlaps = true;
+      for( integer d = 0; d < 3; ++d )
+      {
+        overlaps = overlaps && coordinates( p, d ) + extent >= boxMin[d] && coordinates( p, d ) - extent <= boxMax[d];
+      }
+      // the bins may return points close to the box, but must return each overlapping point exactly once
+      EXPECT_LE( numVisits[p], 1 );
+      if( overlaps )
+      {
+        EXPECT_EQ( numVisits[p], 1 );
+      }
+    }
+  }
+}
+
+TEST( PointBinGridTest, pointsMatchBruteForce )
+{
+  std::mt19937 generator( 2024 );
+  std::uniform_real_distribution< real64 > coordDistribution( 0.0, 100.0 );
+
+  localIndex const numPoints = 500;
+  array2d< real64 > coordinates( numPoints, 3 );
+  for( localIndex p = 0; p < numPoints; ++p )
+  {
+    for( integer d = 0; d < 3; ++d )
+    {
+      coordinates( p, d ) = coordDistribution( generator );
+    }
+  }
+
+  checkAgainstBruteForce( coordinates, array1d< real64 >(), generator );
+}
+
+TEST( PointBinGridTest, extendedPointsMatchBruteForce )
+{
+  std::mt19937 generator( 2025 );
+  std::uniform_real_distribution< real64 > coordDistribution( 0.0, 100.0 );
+  std::uniform_real_distribution< real64 > extentDistribution( 0.0, 10.0 );
+
+  localIndex const numPoints = 300;
+  array2d< real64 > coordinates( numPoints, 3 );
+  array1d< real64 > halfExtent( numPoints );
+  for( localIndex p = 0; p < numPoints; ++p )
+  {
+    for( integer d = 0; d < 3; ++d )
+    {
+      coordinates( p, d ) = coordDistribution( generator );
+    }
+    halfExtent[p] = extentDistribution( generator );
+  }
+
+  checkAgainstBruteForce( coordinates, halfExtent, generator );
+}
+
+TEST( PointBinGridTest, planarPointsMatchBruteForce )
+{
+  // receivers on a plane, for which the grid has a single bin in the normal direction
+  std::mt19937 generator( 2026 );
+  std::uniform_real_distribution< real64 > coordDistribution( 0.0, 100.0 );
+
+  localIndex const numPoints = 400;
+  array2d< real64 > coordinates( numPoints, 3 );
+  for( localIndex p = 0; p < numPoints; ++p )
+  {
+    coordinates( p, 0 ) = coordDistribution( generator );
+    coordinates( p, 1 ) = coordDistribution( generator );
+    coordinates( p, 2 ) = 50.0;
+  }
+
+  checkAgainstBruteForce( coordinates, array1d< real64 >(), generator );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
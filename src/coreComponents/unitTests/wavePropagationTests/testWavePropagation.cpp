@@ -24,6 +24,7 @@
 #include "physicsSolvers/PhysicsSolverManager.hpp"
 #include "physicsSolvers/wavePropagation/shared/WaveSolverBase.hpp"
 #include "physicsSolvers/wavePropagation/sem/acoustic/secondOrderEqn/isotropic/AcousticWaveEquationSEM.hpp"
+#include "physicsSolvers/wavePropagation/sem/acoustic/shared/AcousticFields.hpp"
 
 #include <gtest/gtest.h>
 
@@ -251,6 +252,44 @@ TEST_F( AcousticWaveEquationSEMTest, SeismoTrace )
   }
 }
 
+TEST_F( AcousticWaveEquationSEMTest, TimeLevelsAfterStep )
+{
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+  propagator = &state.getProblemManager().getPhysicsSolverManager().getGroup< AcousticWaveEquationSEM >( "acousticSolver" );
+  NodeManager & nodeManager = domain.getMeshBody( 0 ).getBaseDiscretization().getNodeManager();
+
+  // after each step, the pressure at n+1 read by the consumers of the field must be the new pressure at n,
+  // and the pressure at n-1 must be the pressure at n before the step
+  array1d< real32 > previousPressure( nodeManager.size() );
+  real64 time_n = time;
+  for( int i = 0; i < 5; i++ )
+  {
+    propagator->explicitStepForward( time_n, dt, i, domain, false );
+    time_n += dt;
+
+    arrayView1d< real32 const > const p_nm1 = nodeManager.getField< fields::acousticfields::Pressure_nm1 >().toViewConst();
+    arrayView1d< real32 const > const p_n = nodeManager.getField< fields::acousticfields::Pressure_n >().toViewConst();
+    arrayView1d< real32 const > const p_np1 = nodeManager.getField< fields::acousticfields::Pressure_np1 >().toViewConst();
+    p_nm1.move( hostMemorySpace, false );
+    p_n.move( hostMemorySpace, false );
+    p_np1.move( hostMemorySpace, false );
+
+    real32 maxAbs = 0.0;
+    for( localIndex a = 0; a < nodeManager.size(); ++a )
+    {
+      EXPECT_EQ( p_np1[a], p_n[a] );
+      EXPECT_EQ( p_nm1[a], previousPressure[a] );
+      previousPressure[a] = p_n[a];
+      maxAbs = LvArray::math::max( maxAbs, LvArray::math::abs( p_n[a] ) );
+    }
+    // the source is active from the second step on
+    if( i > 0 )
+    {
+      EXPECT_GT( maxAbs, 0.0 );
+    }
+  }
+}
+
 int main( int argc, char * * argv )
 {
   ::testing::InitGoogleTest( &argc, argv );
@@ -0,0 +1,217 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// using some utility classes from the following unit test
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+#include "common/DataTypes.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/wavePropagation/shared/WaveSolverBase.hpp"
+#include "physicsSolvers/wavePropagation/sem/acoustic/secondOrderEqn/isotropic/AcousticWaveEquationSEM.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geos;
+using namespace geos::dataRepository;
+using namespace geos::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+// This unit test checks that propagating several shots in a batch gives the seismograms
+// obtained by propagating each shot on its own.
+string const xmlInputBegin =
+  R"xml(
+  <Problem>
+    <Solvers>
+      <AcousticSEM
+        name="acousticSolver"
+        cflFactor="0.25"
+        discretization="FE1"
+        targetRegions="{ Region }"
+        timeSourceFrequency="20"
+        receiverCoordinates="{ { 10, 10, 10 }, { 10, 90, 30 }, { 70, 20, 60 }, { 90, 90, 90 } }"
+        outputSeismoTrace="0"
+        dtSeismoTrace="0.005"
+        )xml";
+
+string const xmlInputEnd =
+  R"xml(
+      />
+    </Solvers>
+    <Mesh>
+      <InternalMesh
+        name="mesh"
+        elementTypes="{ C3D8 }"
+        xCoords="{ 0, 100 }"
+        yCoords="{ 0, 100 }"
+        zCoords="{ 0, 100 }"
+        nx="{ 4 }"
+        ny="{ 4 }"
+        nz="{ 4 }"
+        cellBlockNames="{ cb }"/>
+    </Mesh>
+    <Events
+      maxTime="0.1">
+      <PeriodicEvent
+        name="solverApplications"
+        forceDt="0.005"
+        targetExactStartStop="0"
+        targetExactTimestep="0"
+        target="/Solvers/acousticSolver"/>
+    </Events>
+    <NumericalMethods>
+      <FiniteElements>
+        <FiniteElementSpace
+          name="FE1"
+          order="1"
+          formulation="SEM"/>
+      </FiniteElements>
+    </NumericalMethods>
+    <ElementRegions>
+      <CellElementRegion
+        name="Region"
+        cellBlocks="{ cb }"
+        materialList="{ nullModel }"/>
+    </ElementRegions>
+    <Constitutive>
+      <NullModel
+        name="nullModel"/>
+    </Constitutive>
+    <FieldSpecifications>
+      <FieldSpecification
+        name="initialPressureN"
+        initialCondition="1"
+        setNames="{ all }"
+        objectPath="nodeManager"
+        fieldName="pressure_n"
+        scale="0.0"/>
+      <FieldSpecification
+        name="initialPressureNm1"
+        initialCondition="1"
+        setNames="{ all }"
+        objectPath="nodeManager"
+        fieldName="pressure_nm1"
+        scale="0.0"/>
+      <FieldSpecification
+        name="cellVelocity"
+        initialCondition="1"
+        objectPath="ElementRegions/Region/cb"
+        fieldName="acousticVelocity"
+        scale="1500"
+        setNames="{ all }"/>
+      <FieldSpecification
+        name="cellDensity"
+        initialCondition="1"
+        objectPath="ElementRegions/Region/cb"
+        fieldName="acousticDensity"
+        scale="1"
+        setNames="{ all }"/>
+      <FieldSpecification
+        name="zposFreeSurface"
+        objectPath="faceManager"
+        fieldName="FreeSurface"
+        scale="0.0"
+        setNames="{ zpos }"/>
+    </FieldSpecifications>
+  </Problem>
+  )xml";
+
+static real64 constexpr dt = 0.005;
+static int constexpr numSteps = 20;
+static integer constexpr numShots = 3;
+
+template< typename ARRAY >
+ARRAY copyToHost( ARRAY const & array )
+{
+  array.move( hostMemorySpace, false );
+  ARRAY copy( array );
+  return copy;
+}
+
+std::pair< array2d< real32 >, array3d< real32 > > computeSeismograms( string const & solverAttributes )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  string const xmlInput = xmlInputBegin + solverAttributes + xmlInputEnd;
+  setupProblemFromXML( state.getProblemManager(), xmlInput.c_str() );
+
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+  AcousticWaveEquationSEM & propagator =
+    state.getProblemManager().getPhysicsSolverManager().getGroup< AcousticWaveEquationSEM >( "acousticSolver" );
+
+  real64 time_n = 0.0;
+  for( int i = 0; i < numSteps; ++i )
+  {
+    propagator.explicitStepForward( time_n, dt, i, domain, false );
+    time_n += dt;
+  }
+  // cleanup (triggers calculation of the remaining seismograms data points)
+  propagator.cleanup( time_n, numSteps, 0, 0, domain );
+
+  return { copyToHost( propagator.getReference< array2d< real32 > >( AcousticWaveEquationSEM::viewKeyStruct::pressureNp1AtReceiversString() ) ),
+           copyToHost( propagator.getReference< array3d< real32 > >( AcousticWaveEquationSEM::viewKeyStruct::pressureNp1AtReceiversBatchString() ) ) };
+}
+
+TEST( AcousticWaveEquationSEMBatchTest, BatchedShotsMatchSequentialShots )
+{
+  string const sources[numShots] = { "{ 50, 50, 50 }", "{ 20, 70, 40 }", "{ 80, 30, 60 }" };
+
+  array3d< real32 > const batch =
+    computeSeismograms( "sourceCoordinates=\"{ " + sources[0] + ", " + sources[1] + ", " + sources[2] + " }\" "
+                        "numShotsPerBatch=\"" + std::to_string( numShots ) + "\"" ).second;
+
+  for( integer s = 0; s < numShots; ++s )
+  {
+    array2d< real32 > const sequential =
+      computeSeismograms( "sourceCoordinates=\"{ " + sources[s] + " }\"" ).first;
+
+    ASSERT_EQ( batch.size( 0 ), sequential.size( 0 ) );
+    ASSERT_EQ( batch.size( 1 ), sequential.size( 1 ) );
+    ASSERT_EQ( batch.size( 2 ), numShots );
+
+    // the last column contains the time stamps
+    localIndex const numReceivers = sequential.size( 1 ) - 1;
+    real64 maxAbs = 0.0;
+    for( localIndex i = 0; i < sequential.size( 0 ); ++i )
+    {
+      for( localIndex r = 0; r < numReceivers; ++r )
+      {
+        maxAbs = LvArray::math::max( maxAbs, real64( LvArray::math::abs( sequential[i][r] ) ) );
+      }
+    }
+    ASSERT_GT( maxAbs, 0.0 );
+
+    // the shots of a batch only differ from the sequential shots by the ordering of the single precision operations
+    for( localIndex i = 0; i < sequential.size( 0 ); ++i )
+    {
+      for( localIndex r = 0; r < numReceivers; ++r )
+      {
+        EXPECT_NEAR( batch[i][r][s], sequential[i][r], 1e-5 * maxAbs );
+      }
+    }
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
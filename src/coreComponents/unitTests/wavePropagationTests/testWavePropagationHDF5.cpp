@@ -0,0 +1,232 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// using some utility classes from the following unit test
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+#include "common/DataTypes.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/wavePropagation/shared/WaveSolverBase.hpp"
+#include "physicsSolvers/wavePropagation/sem/acoustic/secondOrderEqn/isotropic/AcousticWaveEquationSEM.hpp"
+#include "common/Path.hpp"
+#include "fileIO/Outputs/OutputBase.hpp"
+
+#include <hdf5.h>
+
+#include <gtest/gtest.h>
+
+using namespace geos;
+using namespace geos::dataRepository;
+using namespace geos::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+// This unit test checks that the seismograms written in the HDF5 format can be read back and match the
+// seismograms computed by the solver. The receivers are all on the side x > 50 of the mesh, so that the
+// first rank of a two-rank run owns none of them and still writes the time row of the file.
+char const * xmlInput =
+  R"xml(
+  <Problem>
+    <Solvers>
+      <AcousticSEM
+        name="acousticSolver"
+        cflFactor="0.25"
+        discretization="FE1"
+        targetRegions="{ Region }"
+        sourceCoordinates="{ { 50, 50, 50 } }"
+        timeSourceFrequency="20"
+        receiverCoordinates="{ { 60, 10, 10 }, { 70, 90, 30 }, { 80, 20, 60 }, { 90, 90, 90 } }"
+        outputSeismoTrace="1"
+        outputSeismoTraceFormat="hdf5"
+        dtSeismoTrace="0.005"/>
+    </Solvers>
+
+    <Mesh>
+      <InternalMesh
+        name="mesh"
+        elementTypes="{ C3D8 }"
+        xCoords="{ 0, 100 }"
+        yCoords="{ 0, 100 }"
+        zCoords="{ 0, 100 }"
+        nx="{ 4 }"
+        ny="{ 4 }"
+        nz="{ 4 }"
+        cellBlockNames="{ cb }"/>
+    </Mesh>
+    <Events
+      maxTime="0.1">
+      <PeriodicEvent
+        name="solverApplications"
+        forceDt="0.005"
+        targetExactStartStop="0"
+        targetExactTimestep="0"
+        target="/Solvers/acousticSolver"/>
+    </Events>
+    <NumericalMethods>
+      <FiniteElements>
+        <FiniteElementSpace
+          name="FE1"
+          order="1"
+          formulation="SEM"/>
+      </FiniteElements>
+    </NumericalMethods>
+    <ElementRegions>
+      <CellElementRegion
+        name="Region"
+        cellBlocks="{ cb }"
+        materialList="{ nullModel }"/>
+    </ElementRegions>
+    <Constitutive>
+      <NullModel
+        name="nullModel"/>
+    </Constitutive>
+    <FieldSpecifications>
+      <FieldSpecification
+        name="initialPressureN"
+        initialCondition="1"
+        setNames="{ all }"
+        objectPath="nodeManager"
+        fieldName="pressure_n"
+        scale="0.0"/>
+      <FieldSpecification
+        name="initialPressureNm1"
+        initialCondition="1"
+        setNames="{ all }"
+        objectPath="nodeManager"
+        fieldName="pressure_nm1"
+        scale="0.0"/>
+      <FieldSpecification
+        name="cellVelocity"
+        initialCondition="1"
+        objectPath="ElementRegions/Region/cb"
+        fieldName="acousticVelocity"
+        scale="1500"
+        setNames="{ all }"/>
+      <FieldSpecification
+        name="cellDensity"
+        initialCondition="1"
+        objectPath="ElementRegions/Region/cb"
+        fieldName="acousticDensity"
+        scale="1"
+        setNames="{ all }"/>
+      <FieldSpecification
+        name="zposFreeSurface"
+        objectPath="faceManager"
+        fieldName="FreeSurface"
+        scale="0.0"
+        setNames="{ zpos }"/>
+    </FieldSpecifications>
+  </Problem>
+  )xml";
+
+static real64 constexpr dt = 0.005;
+static int constexpr numSteps = 20;
+
+TEST( AcousticWaveEquationSEMHDF5Test, SeismoTraceReadBack )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  setupProblemFromXML( state.getProblemManager(), xmlInput );
+
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+  AcousticWaveEquationSEM & propagator =
+    state.getProblemManager().getPhysicsSolverManager().getGroup< AcousticWaveEquationSEM >( "acousticSolver" );
+
+  real64 time_n = 0.0;
+  for( int i = 0; i < numSteps; ++i )
+  {
+    propagator.explicitStepForward( time_n, dt, i, domain, false );
+    time_n += dt;
+  }
+  // cleanup (triggers calculation of the remaining seismograms data points, and writes them)
+  propagator.cleanup( time_n, numSteps, 0, 0, domain );
+
+  arrayView2d< real32 const > const pReceivers =
+    propagator.getReference< array2d< real32 > >( AcousticWaveEquationSEM::viewKeyStruct::pressureNp1AtReceiversString() ).toViewConst();
+  arrayView1d< localIndex const > const receiverIsLocal =
+    propagator.getReference< array1d< localIndex > >( WaveSolverBase::viewKeyStruct::receiverIsLocalString() ).toViewConst();
+  pReceivers.move( hostMemorySpace, false );
+  receiverIsLocal.move( hostMemorySpace, false );
+
+  localIndex const numSamples = pReceivers.size( 0 );
+  localIndex const numReceivers = pReceivers.size( 1 ) - 1;
+
+  // gather the traces of all the receivers, each of them being owned by a single rank
+  array2d< real32 > localTraces( numReceivers, numSamples );
+  array2d< real32 > traces( numReceivers, numSamples );
+  for( localIndex ircv = 0; ircv < numReceivers; ++ircv )
+  {
+    for( localIndex iSample = 0; iSample < numSamples; ++iSample )
+    {
+      localTraces[ircv][iSample] = receiverIsLocal[ircv] == 1 ? pReceivers[iSample][ircv] : 0.0;
+    }
+  }
+  MpiWrapper::allReduce( localTraces.data(),
+                         traces.data(),
+                         LvArray::integerConversion< int >( localTraces.size() ),
+                         MpiWrapper::getMpiOp( MpiWrapper::Reduction::Sum ),
+                         MPI_COMM_GEOS );
+  MpiWrapper::barrier( MPI_COMM_GEOS );
+
+  if( MpiWrapper::commRank( MPI_COMM_GEOS ) == 0 )
+  {
+    string const fileName = joinPath( OutputBase::getOutputDirectory(), "seismoTraceReceiver_acousticSolver.hdf5" );
+    hid_t const file = H5Fopen( fileName.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT );
+    ASSERT_GE( file, 0 );
+    hid_t const dataset = H5Dopen( file, "pressure", H5P_DEFAULT );
+    ASSERT_GE( dataset, 0 );
+
+    hsize_t dims[2];
+    hid_t const space = H5Dget_space( dataset );
+    H5Sget_simple_extent_dims( space, dims, nullptr );
+    H5Sclose( space );
+    ASSERT_EQ( dims[0], LvArray::integerConversion< hsize_t >( numReceivers + 1 ) );
+    ASSERT_EQ( dims[1], LvArray::integerConversion< hsize_t >( numSamples ) );
+
+    std::vector< real32 > values( dims[0] * dims[1] );
+    ASSERT_GE( H5Dread( dataset, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, values.data() ), 0 );
+    H5Dclose( dataset );
+    H5Fclose( file );
+
+    real64 maxAbs = 0.0;
+    for( localIndex ircv = 0; ircv < numReceivers; ++ircv )
+    {
+      for( localIndex iSample = 0; iSample < numSamples; ++iSample )
+      {
+        EXPECT_EQ( values[ircv * numSamples + iSample], traces[ircv][iSample] );
+        maxAbs = LvArray::math::max( maxAbs, real64( LvArray::math::abs( traces[ircv][iSample] ) ) );
+      }
+    }
+    EXPECT_GT( maxAbs, 0.0 );
+
+    // the last row holds the time of the samples
+    for( localIndex iSample = 0; iSample < numSamples; ++iSample )
+    {
+      EXPECT_NEAR( values[numReceivers * numSamples + iSample], iSample * dt, 1e-6 );
+    }
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
@@ -0,0 +1,306 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// using some utility classes from the following unit test
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+#include "common/DataTypes.hpp"
+#include "common/MpiWrapper.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mesh/CellElementSubRegion.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/wavePropagation/shared/WaveSolverBase.hpp"
+#include "physicsSolvers/wavePropagation/sem/acoustic/secondOrderEqn/isotropic/AcousticWaveEquationSEM.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <functional>
+
+using namespace geos;
+using namespace geos::dataRepository;
+using namespace geos::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+// This unit test checks that local time stepping on a uniform mesh, where all the elements belong to the
+// coarsest level, reproduces the seismograms of the standard leapfrog scheme. It then checks that a layered
+// velocity model, whose fast layers are advanced with dt / 2 and dt / 4, gives the expected element levels and
+// the seismograms of the leapfrog scheme run with the finest time step on the whole mesh.
+string const xmlInputBegin =
+  R"xml(
+  <Problem>
+    <Solvers>
+      <AcousticSEM
+        name="acousticSolver"
+        cflFactor="0.25"
+        discretization="FE1"
+        targetRegions="{ Region }"
+        sourceCoordinates="{ { 50, 50, 50 } }"
+        timeSourceFrequency="20"
+        receiverCoordinates="{ { 10, 10, 10 }, { 10, 90, 30 }, { 70, 20, 60 }, { 90, 90, 90 } }"
+        outputSeismoTrace="0"
+        dtSeismoTrace="0.005"
+  )xml";
+
+string const xmlInputEnd =
+  R"xml(
+      />
+    </Solvers>
+    <Mesh>
+      <InternalMesh
+        name="mesh"
+        elementTypes="{ C3D8 }"
+        xCoords="{ 0, 100 }"
+        yCoords="{ 0, 100 }"
+        zCoords="{ 0, 100 }"
+        nx="{ 4 }"
+        ny="{ 4 }"
+        nz="{ 4 }"
+        cellBlockNames="{ cb }"/>
+    </Mesh>
+    <Geometry>
+      <Box
+        name="slowLayer"
+        xMin="{ -1, -1, -1 }"
+        xMax="{ 50.1, 101, 101 }"/>
+      <Box
+        name="fastLayer"
+        xMin="{ 49.9, -1, -1 }"
+        xMax="{ 75.1, 101, 101 }"/>
+      <Box
+        name="fastestLayer"
+        xMin="{ 74.9, -1, -1 }"
+        xMax="{ 101, 101, 101 }"/>
+    </Geometry>
+    <Events
+      maxTime="0.1">
+      <PeriodicEvent
+        name="solverApplications"
+        forceDt="0.005"
+        targetExactStartStop="0"
+        targetExactTimestep="0"
+        target="/Solvers/acousticSolver"/>
+    </Events>
+    <NumericalMethods>
+      <FiniteElements>
+        <FiniteElementSpace
+          name="FE1"
+          order="1"
+          formulation="SEM"/>
+      </FiniteElements>
+    </NumericalMethods>
+    <ElementRegions>
+      <CellElementRegion
+        name="Region"
+        cellBlocks="{ cb }"
+        materialList="{ nullModel }"/>
+    </ElementRegions>
+    <Constitutive>
+      <NullModel
+        name="nullModel"/>
+    </Constitutive>
+    <FieldSpecifications>
+      <FieldSpecification
+        name="initialPressureN"
+        initialCondition="1"
+        setNames="{ all }"
+        objectPath="nodeManager"
+        fieldName="pressure_n"
+        scale="0.0"/>
+      <FieldSpecification
+        name="initialPressureNm1"
+        initialCondition="1"
+        setNames="{ all }"
+        objectPath="nodeManager"
+        fieldName="pressure_nm1"
+        scale="0.0"/>
+      <FieldSpecification
+        name="cellVelocity"
+        initialCondition="1"
+        objectPath="ElementRegions/Region/cb"
+        fieldName="acousticVelocity"
+        scale="1500"
+        setNames="{ slowLayer }"/>
+      <FieldSpecification
+        name="fastLayerVelocity"
+        initialCondition="1"
+        objectPath="ElementRegions/Region/cb"
+        fieldName="acousticVelocity"
+        scale="$FAST_VELOCITY"
+        setNames="{ fastLayer }"/>
+      <FieldSpecification
+        name="fastestLayerVelocity"
+        initialCondition="1"
+        objectPath="ElementRegions/Region/cb"
+        fieldName="acousticVelocity"
+        scale="$FASTEST_VELOCITY"
+        setNames="{ fastestLayer }"/>
+      <FieldSpecification
+        name="cellDensity"
+        initialCondition="1"
+        objectPath="ElementRegions/Region/cb"
+        fieldName="acousticDensity"
+        scale="1"
+        setNames="{ all }"/>
+      <FieldSpecification
+        name="zposFreeSurface"
+        objectPath="faceManager"
+        fieldName="FreeSurface"
+        scale="0.0"
+        setNames="{ zpos }"/>
+    </FieldSpecifications>
+  </Problem>
+  )xml";
+
+// Replace the velocities of the fast layers in the input
+string getXmlInput( string const & solverAttributes, string const & fastVelocity, string const & fastestVelocity )
+{
+  string xmlInput = xmlInputBegin + solverAttributes + xmlInputEnd;
+  xmlInput.replace( xmlInput.find( "$FAST_VELOCITY" ), std::strlen( "$FAST_VELOCITY" ), fastVelocity );
+  xmlInput.replace( xmlInput.find( "$FASTEST_VELOCITY" ), std::strlen( "$FASTEST_VELOCITY" ), fastestVelocity );
+  return xmlInput;
+}
+
+array2d< real32 > computeSeismograms( string const & xmlInput,
+                                      real64 const dt,
+                                      integer const numSteps,
+                                      std::function< void( DomainPartition & ) > const & checkDomain = {} )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  setupProblemFromXML( state.getProblemManager(), xmlInput.c_str() );
+
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+  AcousticWaveEquationSEM & propagator =
+    state.getProblemManager().getPhysicsSolverManager().getGroup< AcousticWaveEquationSEM >( "acousticSolver" );
+
+  if( checkDomain )
+  {
+    checkDomain( domain );
+  }
+
+  real64 time_n = 0.0;
+  for( integer i = 0; i < numSteps; ++i )
+  {
+    propagator.explicitStepForward( time_n, dt, i, domain, false );
+    time_n += dt;
+  }
+  // cleanup (triggers calculation of the remaining seismograms data points)
+  propagator.cleanup( time_n, numSteps, 0, 0, domain );
+
+  arrayView2d< real32 const > const pReceivers =
+    propagator.getReference< array2d< real32 > >( AcousticWaveEquationSEM::viewKeyStruct::pressureNp1AtReceiversString() ).toViewConst();
+  pReceivers.move( hostMemorySpace, false );
+
+  array2d< real32 > seismograms( pReceivers.size( 0 ), pReceivers.size( 1 ) );
+  for( localIndex i = 0; i < pReceivers.size( 0 ); ++i )
+  {
+    for( localIndex r = 0; r < pReceivers.size( 1 ); ++r )
+    {
+      seismograms[i][r] = pReceivers[i][r];
+    }
+  }
+  return seismograms;
+}
+
+// Compare the seismograms, relatively to their largest amplitude over all the ranks
+void compareSeismograms( array2d< real32 > const & seismograms,
+                         array2d< real32 > const & expectedSeismograms,
+                         real64 const relTol )
+{
+  ASSERT_EQ( seismograms.size( 0 ), expectedSeismograms.size( 0 ) );
+  ASSERT_EQ( seismograms.size( 1 ), expectedSeismograms.size( 1 ) );
+
+  // the last column contains the time stamps
+  localIndex const numReceivers = expectedSeismograms.size( 1 ) - 1;
+  real64 maxAbs = 0.0;
+  for( localIndex i = 0; i < expectedSeismograms.size( 0 ); ++i )
+  {
+    for( localIndex r = 0; r < numReceivers; ++r )
+    {
+      maxAbs = LvArray::math::max( maxAbs, real64( LvArray::math::abs( expectedSeismograms[i][r] ) ) );
+    }
+  }
+  maxAbs = MpiWrapper::max( maxAbs );
+  ASSERT_GT( maxAbs, 0.0 );
+
+  for( localIndex i = 0; i < expectedSeismograms.size( 0 ); ++i )
+  {
+    for( localIndex r = 0; r < numReceivers; ++r )
+    {
+      EXPECT_NEAR( seismograms[i][r], expectedSeismograms[i][r], relTol * maxAbs ) << "sample " << i << ", receiver " << r;
+    }
+  }
+}
+
+TEST( AcousticWaveEquationSEMLocalTimeSteppingTest, SingleLevelMatchesLeapfrog )
+{
+  real64 constexpr dt = 0.005;
+  integer constexpr numSteps = 20;
+
+  array2d< real32 > const leapfrog = computeSeismograms( getXmlInput( "", "1500", "1500" ), dt, numSteps );
+  array2d< real32 > const lts = computeSeismograms( getXmlInput( "useLocalTimeStepping=\"1\"", "1500", "1500" ), dt, numSteps );
+
+  // the two schemes only differ by the ordering of the single precision operations
+  compareSeismograms( lts, leapfrog, 1e-4 );
+}
+
+TEST( AcousticWaveEquationSEMLocalTimeSteppingTest, MultiLevelMatchesFineLeapfrog )
+{
+  // the elements of the layers with twice and four times the velocity of the slow layer need dt / 2 and dt / 4
+  real64 constexpr dt = 0.0025;
+  integer constexpr numSteps = 40;
+  integer constexpr numFineSubSteps = 4;
+
+  auto const checkLevels = []( DomainPartition & domain )
+  {
+    integer numCheckedElements = 0;
+    MeshLevel & mesh = domain.getMeshBody( 0 ).getBaseDiscretization();
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion & subRegion )
+    {
+      arrayView1d< integer const > const elemLevel = subRegion.getField< fields::localTimeSteppingElementLevel >().toViewConst();
+      arrayView2d< real64 const > const elemCenter = subRegion.getElementCenter().toViewConst();
+      elemLevel.move( hostMemorySpace, false );
+      elemCenter.move( hostMemorySpace, false );
+      for( localIndex k = 0; k < subRegion.size(); ++k )
+      {
+        integer const expectedLevel = ( elemCenter[k][0] < 50.0 ) ? 0 : ( ( elemCenter[k][0] < 75.0 ) ? 1 : 2 );
+        EXPECT_EQ( elemLevel[k], expectedLevel ) << "element " << k << " centered at x = " << elemCenter[k][0];
+        ++numCheckedElements;
+      }
+    } );
+    EXPECT_GT( MpiWrapper::sum( numCheckedElements ), 0 );
+  };
+
+  array2d< real32 > const leapfrog =
+    computeSeismograms( getXmlInput( "", "3000", "6000" ), dt / numFineSubSteps, numSteps * numFineSubSteps );
+  array2d< real32 > const lts =
+    computeSeismograms( getXmlInput( "useLocalTimeStepping=\"1\"", "3000", "6000" ), dt, numSteps, checkLevels );
+
+  // both schemes are second-order accurate in time, they differ by the time discretization error of the coarse levels
+  compareSeismograms( lts, leapfrog, 2e-2 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
@@ -0,0 +1,624 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2016-2024 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2024 Total, S.A
+ * Copyright (c) 2018-2024 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2024 Chevron
+ * Copyright (c) 2019-     GEOS/GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+#include "common/DataTypes.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mesh/PerforationData.hpp"
+#include "mesh/WellElementSubRegion.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/multiphysics/CompositionalMultiphaseReservoirAndWells.hpp"
+#include "physicsSolvers/multiphysics/SinglePhaseReservoirAndWells.hpp"
+#include "physicsSolvers/fluidFlow/wells/CompositionalMultiphaseWell.hpp"
+#include "physicsSolvers/fluidFlow/wells/CompositionalMultiphaseWellFields.hpp"
+#include "physicsSolvers/fluidFlow/wells/SinglePhaseWell.hpp"
+#include "physicsSolvers/fluidFlow/wells/SinglePhaseWellFields.hpp"
+#include "physicsSolvers/fluidFlow/wells/WellSolverBaseFields.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+
+using namespace geos;
+using namespace geos::dataRepository;
+using namespace geos::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+// This unit test checks that the well kernels batched over all the local wells give the results of the
+// kernels launched well by well. The same wells are simulated together and one at a time: the perforation
+// rates of each well must not depend on the other wells. In the multi-well problem, the state update of
+// CompositionalMultiphaseWell (batched) is also compared with the update of the wells one by one.
+
+char const * pvtLiquid = "DensityFun PhillipsBrineDensity 1e6 7.5e7 5e5 295.15 370.15 25 0\n"
+                         "ViscosityFun PhillipsBrineViscosity 0\n";
+
+char const * pvtGas = "DensityFun SpanWagnerCO2Density 1e6 7.5e7 5e5 295.15 370.15 25\n"
+                      "ViscosityFun FenghourCO2Viscosity 1e6 7.5e7 5e5 295.15 370.15 25\n";
+
+char const * co2flash = "FlashModel CO2Solubility 1e6 7.5e7 5e5 295.15 370.15 25 0";
+
+integer constexpr numWells = 3;
+
+real64 constexpr TIME = 0.0;
+real64 constexpr DT = 1e4;
+
+/// The well controls of the three wells: a producer under BHP control, an injector without crossflow,
+/// and a producer under rate control
+std::array< string const, numWells > const compositionalWellControls =
+{
+  R"xml(
+          <WellControls name="wellControls0"
+                        type="producer"
+                        referenceElevation="3.5"
+                        control="BHP"
+                        targetBHP="8e6"
+                        targetPhaseRate="1e-3"
+                        targetPhaseName="water"/>)xml",
+  R"xml(
+          <WellControls name="wellControls1"
+                        type="injector"
+                        referenceElevation="3.5"
+                        control="totalVolRate"
+                        targetBHP="2e7"
+                        targetTotalRate="1e-4"
+                        injectionTemperature="368.15"
+                        injectionStream="{ 0.75, 0.25 }"
+                        enableCrossflow="0"/>)xml",
+  R"xml(
+          <WellControls name="wellControls2"
+                        type="producer"
+                        referenceElevation="3.5"
+                        control="phaseVolRate"
+                        targetBHP="5e6"
+                        targetPhaseRate="5e-4"
+                        targetPhaseName="water"/>)xml"
+};
+
+std::array< string const, numWells > const singlePhaseWellControls =
+{
+  R"xml(
+          <WellControls name="wellControls0"
+                        type="producer"
+                        referenceElevation="3.5"
+                        control="BHP"
+                        targetBHP="5e5"
+                        targetTotalRate="1e-3"/>)xml",
+  R"xml(
+          <WellControls name="wellControls1"
+                        type="injector"
+                        referenceElevation="3.5"
+                        control="totalVolRate"
+                        targetBHP="2e7"
+                        targetTotalRate="1e-4"/>)xml",
+  R"xml(
+          <WellControls name="wellControls2"
+                        type="producer"
+                        referenceElevation="3.5"
+                        control="totalVolRate"
+                        targetBHP="1e5"
+                        targetTotalRate="5e-4"/>)xml"
+};
+
+string wellRegionName( integer const iwell )
+{
+  return "wellRegion" + std::to_string( iwell );
+}
+
+/// The vertical wells, with three perforations each
+string internalWell( integer const iwell )
+{
+  string const x = std::to_string( 0.5 + 2.0 * iwell );
+  return R"xml(
+        <InternalWell name="well)xml" + std::to_string( iwell ) + R"xml("
+                      wellRegionName=")xml" + wellRegionName( iwell ) + R"xml("
+                      wellControlsName="wellControls)xml" + std::to_string( iwell ) + R"xml("
+                      polylineNodeCoords="{ { )xml" + x + R"xml(, 0.5, 4.0 },
+                                             { )xml" + x + R"xml(, 0.5, 0.2 } }"
+                      polylineSegmentConn="{ { 0, 1 } }"
+                      radius="0.1"
+                      numElementsPerSegment="3">
+          <Perforation name="perf0" distanceFromHead="1.5"/>
+          <Perforation name="perf1" distanceFromHead="2.5"/>
+          <Perforation name="perf2" distanceFromHead="3.5"/>
+        </InternalWell>)xml";
+}
+
+string wellRegionList( std::vector< integer > const & wells )
+{
+  string list;
+  for( integer const iwell : wells )
+  {
+    list += ", " + wellRegionName( iwell );
+  }
+  return list;
+}
+
+string meshInput( std::vector< integer > const & wells )
+{
+  string input = R"xml(
+    <Mesh>
+      <InternalMesh name="mesh"
+                    elementTypes="{ C3D8 }"
+                    xCoords="{ 0, 6 }"
+                    yCoords="{ 0, 1 }"
+                    zCoords="{ 0, 3 }"
+                    nx="{ 6 }"
+                    ny="{ 1 }"
+                    nz="{ 3 }"
+                    cellBlockNames="{ cb }">)xml";
+  for( integer const iwell : wells )
+  {
+    input += internalWell( iwell );
+  }
+  return input + R"xml(
+      </InternalMesh>
+    </Mesh>
+    <NumericalMethods>
+      <FiniteVolume>
+        <TwoPointFluxApproximation name="TPFA"/>
+      </FiniteVolume>
+    </NumericalMethods>)xml";
+}
+
+string wellElementRegions( std::vector< integer > const & wells, string const & materialList )
+{
+  string input;
+  for( integer const iwell : wells )
+  {
+    input += R"xml(
+      <WellElementRegion name=")xml" + wellRegionName( iwell ) + R"xml("
+                         materialList="{ )xml" + materialList + R"xml( }"/>)xml";
+  }
+  return input;
+}
+
+string compositionalXmlInput( std::vector< integer > const & wells )
+{
+  string input = R"xml(
+  <Problem>
+    <Solvers gravityVector="{ 0.0, 0.0, -9.81 }">
+      <CompositionalMultiphaseReservoir name="reservoirSystem"
+                                        flowSolverName="compflow"
+                                        wellSolverName="compositionalMultiphaseWell"
+                                        targetRegions="{ region)xml" + wellRegionList( wells ) + R"xml( }">
+        <NonlinearSolverParameters newtonMaxIter="20"/>
+        <LinearSolverParameters solverType="direct"/>
+      </CompositionalMultiphaseReservoir>
+      <CompositionalMultiphaseFVM name="compflow"
+                                  discretization="TPFA"
+                                  temperature="368.15"
+                                  useMass="1"
+                                  targetRegions="{ region }"/>
+      <CompositionalMultiphaseWell name="compositionalMultiphaseWell"
+                                   useMass="1"
+                                   targetRegions="{ )xml" + wellRegionList( wells ).substr( 2 ) + R"xml( }">)xml";
+  for( integer const iwell : wells )
+  {
+    input += compositionalWellControls[iwell];
+  }
+  input += R"xml(
+      </CompositionalMultiphaseWell>
+    </Solvers>)xml";
+  input += meshInput( wells );
+  input += R"xml(
+    <ElementRegions>
+      <CellElementRegion name="region"
+                         cellBlocks="{ cb }"
+                         materialList="{ fluid, rock, relperm }"/>)xml";
+  input += wellElementRegions( wells, "fluid, relperm" );
+  input += R"xml(
+    </ElementRegions>
+    <Constitutive>
+      <CompressibleSolidConstantPermeability name="rock"
+                                             solidModelName="nullSolid"
+                                             porosityModelName="rockPorosity"
+                                             permeabilityModelName="rockPerm"/>
+      <NullModel name="nullSolid"/>
+      <PressurePorosity name="rockPorosity"
+                        defaultReferencePorosity="0.2"
+                        referencePressure="0.0"
+                        compressibility="1.0e-9"/>
+      <ConstantPermeability name="rockPerm"
+                            permeabilityComponents="{ 1.0e-13, 1.0e-13, 1.0e-13 }"/>
+      <CO2BrinePhillipsFluid name="fluid"
+                             phaseNames="{ gas, water }"
+                             componentNames="{ co2, water }"
+                             componentMolarWeight="{ 44e-3, 18e-3 }"
+                             phasePVTParaFiles="{ pvtgas.txt, pvtliquid.txt }"
+                             flashModelParaFile="co2flash.txt"/>
+      <BrooksCoreyRelativePermeability name="relperm"
+                                       phaseNames="{ gas, water }"
+                                       phaseMinVolumeFraction="{ 0.0, 0.0 }"
+                                       phaseRelPermExponent="{ 1.5, 1.5 }"
+                                       phaseRelPermMaxValue="{ 0.9, 0.9 }"/>
+    </Constitutive>
+    <FieldSpecifications>
+      <FieldSpecification name="initialPressure"
+                          initialCondition="1"
+                          setNames="{ all }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="pressure"
+                          scale="9e6"/>
+      <FieldSpecification name="initialTemperature"
+                          initialCondition="1"
+                          setNames="{ all }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="temperature"
+                          scale="368.15"/>
+      <FieldSpecification name="initialComposition_co2"
+                          initialCondition="1"
+                          setNames="{ all }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="globalCompFraction"
+                          component="0"
+                          scale="0.3"/>
+      <FieldSpecification name="initialComposition_water"
+                          initialCondition="1"
+                          setNames="{ all }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="globalCompFraction"
+                          component="1"
+                          scale="0.7"/>
+    </FieldSpecifications>
+  </Problem>)xml";
+  return input;
+}
+
+string singlePhaseXmlInput( std::vector< integer > const & wells )
+{
+  string input = R"xml(
+  <Problem>
+    <Solvers gravityVector="{ 0.0, 0.0, -9.81 }">
+      <SinglePhaseReservoir name="reservoirSystem"
+                            flowSolverName="singlePhaseFlow"
+                            wellSolverName="singlePhaseWell"
+                            targetRegions="{ region)xml" + wellRegionList( wells ) + R"xml( }">
+        <NonlinearSolverParameters newtonMaxIter="20"/>
+        <LinearSolverParameters solverType="direct"/>
+      </SinglePhaseReservoir>
+      <SinglePhaseFVM name="singlePhaseFlow"
+                      discretization="TPFA"
+                      targetRegions="{ region }"/>
+      <SinglePhaseWell name="singlePhaseWell"
+                       targetRegions="{ )xml" + wellRegionList( wells ).substr( 2 ) + R"xml( }">)xml";
+  for( integer const iwell : wells )
+  {
+    input += singlePhaseWellControls[iwell];
+  }
+  input += R"xml(
+      </SinglePhaseWell>
+    </Solvers>)xml";
+  input += meshInput( wells );
+  input += R"xml(
+    <ElementRegions>
+      <CellElementRegion name="region"
+                         cellBlocks="{ cb }"
+                         materialList="{ water, rock }"/>)xml";
+  input += wellElementRegions( wells, "water" );
+  input += R"xml(
+    </ElementRegions>
+    <Constitutive>
+      <CompressibleSinglePhaseFluid name="water"
+                                    defaultDensity="1000"
+                                    defaultViscosity="0.001"
+                                    referencePressure="0.0"
+                                    referenceDensity="1000"
+                                    compressibility="5e-10"
+                                    referenceViscosity="0.001"
+                                    viscosibility="0.0"/>
+      <CompressibleSolidConstantPermeability name="rock"
+                                             solidModelName="nullSolid"
+                                             porosityModelName="rockPorosity"
+                                             permeabilityModelName="rockPerm"/>
+      <NullModel name="nullSolid"/>
+      <PressurePorosity name="rockPorosity"
+                        defaultReferencePorosity="0.05"
+                        referencePressure="0.0"
+                        compressibility="1.0e-9"/>
+      <ConstantPermeability name="rockPerm"
+                            permeabilityComponents="{ 2.0e-16, 2.0e-16, 2.0e-16 }"/>
+    </Constitutive>
+    <FieldSpecifications>
+      <FieldSpecification name="initialPressure"
+                          initialCondition="1"
+                          setNames="{ all }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="pressure"
+                          scale="5e6"/>
+    </FieldSpecifications>
+  </Problem>)xml";
+  return input;
+}
+
+void writeTableToFile( string const & filename, char const * str )
+{
+  std::ofstream os( filename );
+  ASSERT_TRUE( os.is_open() );
+  os << str;
+  os.close();
+}
+
+// The raw bytes of the fields compared between the runs, keyed by well controls and field name
+using FieldValues = std::map< string, std::vector< real64 > >;
+
+template< typename FIELD_TRAIT >
+void saveField( WellElementSubRegion const & subRegion, Group const & group, FieldValues & values )
+{
+  typename FIELD_TRAIT::type const & field = group.getReference< typename FIELD_TRAIT::type >( FIELD_TRAIT::key() );
+  field.move( hostMemorySpace, false );
+  values[subRegion.getWellControlsName() + "/" + FIELD_TRAIT::key()].assign( field.data(), field.data() + field.size() );
+}
+
+template< typename FIELD_TRAIT >
+void fillField( Group & group )
+{
+  group.getReference< typename FIELD_TRAIT::type >( FIELD_TRAIT::key() ).toView().template setValues< parallelDevicePolicy<> >( -1.0 );
+}
+
+void compareFieldValues( FieldValues const & values, FieldValues const & expectedValues )
+{
+  ASSERT_EQ( values.size(), expectedValues.size() );
+  for( auto const & [name, expected] : expectedValues )
+  {
+    ASSERT_EQ( values.count( name ), 1u ) << name;
+    std::vector< real64 > const & actual = values.at( name );
+    ASSERT_EQ( actual.size(), expected.size() ) << name;
+    EXPECT_EQ( std::memcmp( actual.data(), expected.data(), expected.size() * sizeof( real64 ) ), 0 ) << name;
+  }
+}
+
+template< typename LAMBDA >
+void forWellSubRegions( SolverBase & wellSolver, DomainPartition & domain, LAMBDA && lambda )
+{
+  wellSolver.forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                           MeshLevel & mesh,
+                                                                           arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions< WellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                          WellElementSubRegion & subRegion )
+    {
+      // the global index of the well, shared by the multi-well and single-well problems
+      integer const iwell = subRegion.getWellControlsName().back() - '0';
+      lambda( iwell, subRegion );
+    } );
+  } );
+}
+
+/// Move the well primary variables away from their initial values, differently in each well and well element
+template< typename WELL_SOLVER >
+void perturbWellPrimaryVariables( WELL_SOLVER & wellSolver, DomainPartition & domain )
+{
+  forWellSubRegions( wellSolver, domain, [&]( integer const iwell, WellElementSubRegion & subRegion )
+  {
+    arrayView1d< real64 > const pres = subRegion.getField< fields::well::pressure >().toView();
+    pres.move( hostMemorySpace, true );
+    for( localIndex iwelem = 0; iwelem < subRegion.size(); ++iwelem )
+    {
+      pres[iwelem] *= 1.0 + 0.01 * ( iwell + 1 ) + 0.002 * iwelem;
+    }
+
+    if constexpr ( std::is_same_v< WELL_SOLVER, CompositionalMultiphaseWell > )
+    {
+      auto const compDens = subRegion.getField< fields::well::globalCompDensity >().toView();
+      compDens.move( hostMemorySpace, true );
+      for( localIndex iwelem = 0; iwelem < subRegion.size(); ++iwelem )
+      {
+        for( integer ic = 0; ic < compDens.size( 1 ); ++ic )
+        {
+          compDens[iwelem][ic] *= 1.0 + 0.03 * ( ic + 1 ) * ( iwell + 1 ) + 0.001 * iwelem;
+        }
+      }
+    }
+  } );
+}
+
+void fillCompositionalState( CompositionalMultiphaseWell & wellSolver, DomainPartition & domain )
+{
+  forWellSubRegions( wellSolver, domain, [&]( integer const, WellElementSubRegion & subRegion )
+  {
+    fillField< fields::well::globalCompFraction >( subRegion );
+    fillField< fields::well::dGlobalCompFraction_dGlobalCompDensity >( subRegion );
+    fillField< fields::well::phaseVolumeFraction >( subRegion );
+    fillField< fields::well::dPhaseVolumeFraction >( subRegion );
+    fillField< fields::well::totalMassDensity >( subRegion );
+    fillField< fields::well::dTotalMassDensity_dPressure >( subRegion );
+    fillField< fields::well::dTotalMassDensity_dGlobalCompDensity >( subRegion );
+  } );
+}
+
+FieldValues saveCompositionalState( CompositionalMultiphaseWell & wellSolver, DomainPartition & domain )
+{
+  FieldValues values;
+  forWellSubRegions( wellSolver, domain, [&]( integer const, WellElementSubRegion & subRegion )
+  {
+    saveField< fields::well::globalCompFraction >( subRegion, subRegion, values );
+    saveField< fields::well::dGlobalCompFraction_dGlobalCompDensity >( subRegion, subRegion, values );
+    saveField< fields::well::phaseVolumeFraction >( subRegion, subRegion, values );
+    saveField< fields::well::dPhaseVolumeFraction >( subRegion, subRegion, values );
+    saveField< fields::well::totalMassDensity >( subRegion, subRegion, values );
+    saveField< fields::well::dTotalMassDensity_dPressure >( subRegion, subRegion, values );
+    saveField< fields::well::dTotalMassDensity_dGlobalCompDensity >( subRegion, subRegion, values );
+
+    WellControls const & wellControls = wellSolver.getWellControls( subRegion );
+    values[subRegion.getWellControlsName() + "/currentBHP"] =
+    { wellControls.getReference< real64 >( CompositionalMultiphaseWell::viewKeyStruct::currentBHPString() ) };
+    values[subRegion.getWellControlsName() + "/currentTotalVolRate"] =
+    { wellControls.getReference< real64 >( CompositionalMultiphaseWell::viewKeyStruct::currentTotalVolRateString() ) };
+  } );
+  return values;
+}
+
+/// Results of a run of the compositional problem
+struct CompositionalResults
+{
+  /// Well state updated by the batched CompositionalMultiphaseWell::updateState
+  FieldValues batchedState;
+  /// Well state updated well by well
+  FieldValues perWellState;
+  /// Perforation rates computed from the batched well state
+  FieldValues perforationRates;
+};
+
+CompositionalResults runCompositional( std::vector< integer > const & wells )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  ProblemManager & problemManager = state.getProblemManager();
+  string const xmlInput = compositionalXmlInput( wells );
+  setupProblemFromXML( problemManager, xmlInput.c_str() );
+
+  CompositionalMultiphaseReservoirAndWells<> & solver =
+    problemManager.getPhysicsSolverManager().getGroup< CompositionalMultiphaseReservoirAndWells<> >( "reservoirSystem" );
+  DomainPartition & domain = problemManager.getDomainPartition();
+
+  solver.setupSystem( domain,
+                      solver.getDofManager(),
+                      solver.getLocalMatrix(),
+                      solver.getSystemRhs(),
+                      solver.getSystemSolution() );
+  solver.implicitStepSetup( TIME, DT, domain );
+
+  CompositionalMultiphaseWell & wellSolver = *solver.wellSolver();
+  perturbWellPrimaryVariables( wellSolver, domain );
+
+  CompositionalResults results;
+
+  // batched state update, then the perforation rates of all the wells
+  fillCompositionalState( wellSolver, domain );
+  wellSolver.updateState( domain );
+  results.batchedState = saveCompositionalState( wellSolver, domain );
+
+  forWellSubRegions( wellSolver, domain, [&]( integer const, WellElementSubRegion & subRegion )
+  {
+    PerforationData & perforationData = *subRegion.getPerforationData();
+    fillField< fields::well::compPerforationRate >( perforationData );
+    fillField< fields::well::dCompPerforationRate_dPres >( perforationData );
+    fillField< fields::well::dCompPerforationRate_dComp >( perforationData );
+  } );
+  wellSolver.computePerforationRates( domain );
+  forWellSubRegions( wellSolver, domain, [&]( integer const, WellElementSubRegion & subRegion )
+  {
+    PerforationData const & perforationData = *subRegion.getPerforationData();
+    saveField< fields::well::compPerforationRate >( subRegion, perforationData, results.perforationRates );
+    saveField< fields::well::dCompPerforationRate_dPres >( subRegion, perforationData, results.perforationRates );
+    saveField< fields::well::dCompPerforationRate_dComp >( subRegion, perforationData, results.perforationRates );
+  } );
+
+  // state update well by well
+  fillCompositionalState( wellSolver, domain );
+  forWellSubRegions( wellSolver, domain, [&]( integer const, WellElementSubRegion & subRegion )
+  {
+    wellSolver.updateSubRegionState( subRegion );
+  } );
+  results.perWellState = saveCompositionalState( wellSolver, domain );
+
+  return results;
+}
+
+FieldValues runSinglePhase( std::vector< integer > const & wells )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  ProblemManager & problemManager = state.getProblemManager();
+  string const xmlInput = singlePhaseXmlInput( wells );
+  setupProblemFromXML( problemManager, xmlInput.c_str() );
+
+  SinglePhaseReservoirAndWells<> & solver =
+    problemManager.getPhysicsSolverManager().getGroup< SinglePhaseReservoirAndWells<> >( "reservoirSystem" );
+  DomainPartition & domain = problemManager.getDomainPartition();
+
+  solver.setupSystem( domain,
+                      solver.getDofManager(),
+                      solver.getLocalMatrix(),
+                      solver.getSystemRhs(),
+                      solver.getSystemSolution() );
+  solver.implicitStepSetup( TIME, DT, domain );
+
+  SinglePhaseWell & wellSolver = *solver.wellSolver();
+  perturbWellPrimaryVariables( wellSolver, domain );
+  wellSolver.updateState( domain );
+
+  forWellSubRegions( wellSolver, domain, [&]( integer const, WellElementSubRegion & subRegion )
+  {
+    PerforationData & perforationData = *subRegion.getPerforationData();
+    fillField< fields::well::perforationRate >( perforationData );
+    fillField< fields::well::dPerforationRate_dPres >( perforationData );
+  } );
+  wellSolver.computePerforationRates( domain );
+
+  FieldValues perforationRates;
+  forWellSubRegions( wellSolver, domain, [&]( integer const, WellElementSubRegion & subRegion )
+  {
+    PerforationData const & perforationData = *subRegion.getPerforationData();
+    saveField< fields::well::perforationRate >( subRegion, perforationData, perforationRates );
+    saveField< fields::well::dPerforationRate_dPres >( subRegion, perforationData, perforationRates );
+  } );
+  return perforationRates;
+}
+
+TEST( MultiWellBatchedKernelsTest, singlePhasePerforationRates )
+{
+  FieldValues const allWells = runSinglePhase( { 0, 1, 2 } );
+
+  FieldValues oneWellAtATime;
+  for( integer iwell = 0; iwell < numWells; ++iwell )
+  {
+    FieldValues const oneWell = runSinglePhase( { iwell } );
+    oneWellAtATime.insert( oneWell.begin(), oneWell.end() );
+  }
+
+  compareFieldValues( allWells, oneWellAtATime );
+}
+
+TEST( MultiWellBatchedKernelsTest, compositionalStateAndPerforationRates )
+{
+  writeTableToFile( "pvtliquid.txt", pvtLiquid );
+  writeTableToFile( "pvtgas.txt", pvtGas );
+  writeTableToFile( "co2flash.txt", co2flash );
+
+  CompositionalResults const allWells = runCompositional( { 0, 1, 2 } );
+
+  // the batched state update must give the state of the update well by well
+  compareFieldValues( allWells.batchedState, allWells.perWellState );
+
+  // the perforation rates of each well must not depend on the other wells of the batch
+  FieldValues oneWellAtATime;
+  for( integer iwell = 0; iwell < numWells; ++iwell )
+  {
+    CompositionalResults const oneWell = runCompositional( { iwell } );
+    compareFieldValues( oneWell.batchedState, oneWell.perWellState );
+    oneWellAtATime.insert( oneWell.perforationRates.begin(), oneWell.perforationRates.end() );
+  }
+  compareFieldValues( allWells.perforationRates, oneWellAtATime );
+
+  std::remove( "pvtliquid.txt" );
+  std::remove( "pvtgas.txt" );
+  std::remove( "co2flash.txt" );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}